@@ -92,7 +92,8 @@ typedef enum {
 typedef enum {
    primme_orth_default,
    primme_orth_implicit_I,          /* assume for search subspace V, V'*B*V = I */
-   primme_orth_explicit_I           /* explicitly compute V'*B*V */
+   primme_orth_explicit_I,          /* explicitly compute V'*B*V */
+   primme_orth_lowsync              /* as explicit_I, one reduction per pass */
 } primme_orth;
 
 /* Datatype of vectors passed on matrixMatvec, applyPreconditioner,           */
@@ -103,7 +104,8 @@ typedef enum {
    primme_op_float,
    primme_op_double,
    primme_op_quad,
-   primme_op_int
+   primme_op_int,
+   primme_op_auto       /* internalPrecision only: single, then refined */
 } primme_op_datatype;
 
 typedef struct primme_stats {
@@ -132,6 +134,8 @@ typedef struct primme_stats {
    double maxConvTol;               /* largest norm residual of a locked eigenpair */
    double estimateResidualError;    /* accumulated error in V and W */
    PRIMME_INT lockingIssue;         /* Some converged with a weak criterion */
+   PRIMME_INT numGlobalSumRequested; /* reductions requested before coalescing */
+   PRIMME_INT numReplicatedMismatches; /* replicated results that differed */
 } primme_stats;
 
 typedef struct JD_projectors {
@@ -145,6 +149,8 @@ typedef struct JD_projectors {
 
 typedef struct projection_params {
    primme_projection projection;
+   int partialSolve;
+   int replicatedSolve;
 } projection_params;
 
 typedef struct correction_params {
@@ -154,6 +160,8 @@ typedef struct correction_params {
    struct JD_projectors projectors;
    primme_convergencetest convTest;
    double relTolBase;
+   primme_op_datatype innerPrecision;
+   int chebyshevDegree;
 } correction_params;
 
 
@@ -161,6 +169,19 @@ typedef struct restarting_params {
    int maxPrevRetain;
 } restarting_params;
 
+/* Calls and times of a call site, returned by primme_get_profile */
+
+typedef struct primme_profile_entry {
+   const char *name;    /* call and location, "call@file:line" */
+   PRIMME_INT count;    /* number of calls */
+   double totalTime;    /* time spent in all calls */
+   double maxTime;      /* time spent in the longest call */
+} primme_profile_entry;
+
+/* Opaque table with the times collected when profile is set */
+
+typedef struct primme_profile_str primme_profile;
+
 
 /*--------------------------------------------------------------------------*/
 typedef struct primme_params {
@@ -250,6 +271,23 @@ typedef struct primme_params {
    void *monitor;
    void *queue;      /* magma device queue (magma_queue_t*) */
    const char *profile; /* regex expression with functions to monitor times */
+   int memoryArena;     /* if nonzero, serve temporaries from a per-solve arena */
+   primme_op_datatype storagePrecision; /* store the basis in that precision */
+   const char *basisStorageDir; /* if set, keep the basis in files there */
+   const char *checkpointFile;  /* file to save and resume the solver state */
+   int checkpointInterval;      /* save the state every that many restarts */
+   int checkpointRequest;       /* if nonzero, save at the next restart */
+   primme_profile *profileTable; /* times per call site, see primme_get_profile */
+   const char *traceFile;       /* if set, write the timeline of the solve */
+   int dynamicBlockSize;        /* if nonzero, tune the block size at runtime */
+   const char *tuningFile;      /* if set, reuse the tuning of previous solves */
+
+   /* optional split-phase version of globalSumReal */
+   void (*globalSumRealStart)
+      (void *sendBuf, void *recvBuf, int *count, void **request,
+       struct primme_params *primme, int *ierr);
+   void (*globalSumRealWait)
+      (void *request, struct primme_params *primme, int *ierr);
 } primme_params;
 /*---------------------------------------------------------------------------*/
 
@@ -374,9 +412,35 @@ typedef enum {
    PRIMME_monitorFun_type                        = 86  ,
    PRIMME_monitor                                = 87  ,
    PRIMME_queue                                  = 88  ,
-   PRIMME_profile                                = 89  
+   PRIMME_profile                                = 89  ,
+   PRIMME_memoryArena                            = 90  ,
+   PRIMME_globalSumRealStart                     = 91  ,
+   PRIMME_globalSumRealWait                      = 92  ,
+   PRIMME_stats_numGlobalSumRequested            = 93  ,
+   PRIMME_correctionParams_innerPrecision        = 94  ,
+   PRIMME_projectionParams_partialSolve          = 95  ,
+   PRIMME_projectionParams_replicatedSolve       = 96  ,
+   PRIMME_correctionParams_chebyshevDegree       = 97  ,
+   PRIMME_storagePrecision                       = 98  ,
+   PRIMME_basisStorageDir                        = 99  ,
+   PRIMME_checkpointFile                         = 100 ,
+   PRIMME_checkpointInterval                     = 101 ,
+   PRIMME_checkpointRequest                      = 102 ,
+   PRIMME_profileTable                           = 103 ,
+   PRIMME_traceFile                              = 104 ,
+   PRIMME_dynamicBlockSize                       = 105 ,
+   PRIMME_tuningFile                             = 106 ,
+   PRIMME_stats_numReplicatedMismatches          = 107 
 } primme_params_label;
 
+/* Opaque handle with memory and state reused across solver calls */
+
+typedef struct primme_workspace_str primme_workspace;
+
+/* Opaque handle of a sparse matrix used by primme_csr_matvec */
+
+typedef struct primme_csr_str primme_csr;
+
 /* Hermitian operator */
 
 int hprimme(PRIMME_HALF *evals, PRIMME_HALF *evecs, PRIMME_HALF *resNorms, 
@@ -433,12 +497,82 @@ int kcprimme_normal(PRIMME_COMPLEX_FLOAT *evals, PRIMME_COMPLEX_HALF *evecs, flo
 int magma_kcprimme_normal(PRIMME_COMPLEX_FLOAT *evals, PRIMME_COMPLEX_HALF *evecs, float *resNorms, 
       primme_params *primme);
 
+/* Calls reusing a workspace */
+
+int hprimme_ws(PRIMME_HALF *evals, PRIMME_HALF *evecs, PRIMME_HALF *resNorms, 
+      primme_params *primme, primme_workspace *ws);
+int kprimme_ws(PRIMME_HALF *evals, PRIMME_COMPLEX_HALF *evecs, PRIMME_HALF *resNorms, 
+      primme_params *primme, primme_workspace *ws);
+int sprimme_ws(float *evals, float *evecs, float *resNorms, 
+      primme_params *primme, primme_workspace *ws);
+int cprimme_ws(float *evals, PRIMME_COMPLEX_FLOAT *evecs, float *resNorms, 
+      primme_params *primme, primme_workspace *ws);
+int dprimme_ws(double *evals, double *evecs, double *resNorms, 
+      primme_params *primme, primme_workspace *ws);
+int zprimme_ws(double *evals, PRIMME_COMPLEX_DOUBLE *evecs, double *resNorms, 
+      primme_params *primme, primme_workspace *ws);
+int kprimme_normal_ws(PRIMME_COMPLEX_HALF *evals, PRIMME_COMPLEX_HALF *evecs, PRIMME_HALF *resNorms, 
+      primme_params *primme, primme_workspace *ws);
+int cprimme_normal_ws(PRIMME_COMPLEX_FLOAT *evals, PRIMME_COMPLEX_FLOAT *evecs, float *resNorms, 
+      primme_params *primme, primme_workspace *ws);
+int zprimme_normal_ws(PRIMME_COMPLEX_DOUBLE *evals, PRIMME_COMPLEX_DOUBLE *evecs, double *resNorms, 
+      primme_params *primme, primme_workspace *ws);
+
+/* Calls solving independent problems concurrently */
+
+int hprimme_batch(PRIMME_HALF **evals, PRIMME_HALF **evecs, PRIMME_HALF **resNorms, 
+      primme_params **primme, int numProblems, int numThreads, int *ierrs);
+int kprimme_batch(PRIMME_HALF **evals, PRIMME_COMPLEX_HALF **evecs, PRIMME_HALF **resNorms, 
+      primme_params **primme, int numProblems, int numThreads, int *ierrs);
+int sprimme_batch(float **evals, float **evecs, float **resNorms, 
+      primme_params **primme, int numProblems, int numThreads, int *ierrs);
+int cprimme_batch(float **evals, PRIMME_COMPLEX_FLOAT **evecs, float **resNorms, 
+      primme_params **primme, int numProblems, int numThreads, int *ierrs);
+int dprimme_batch(double **evals, double **evecs, double **resNorms, 
+      primme_params **primme, int numProblems, int numThreads, int *ierrs);
+int zprimme_batch(double **evals, PRIMME_COMPLEX_DOUBLE **evecs, double **resNorms, 
+      primme_params **primme, int numProblems, int numThreads, int *ierrs);
+int kprimme_normal_batch(PRIMME_COMPLEX_HALF **evals, PRIMME_COMPLEX_HALF **evecs, PRIMME_HALF **resNorms, 
+      primme_params **primme, int numProblems, int numThreads, int *ierrs);
+int cprimme_normal_batch(PRIMME_COMPLEX_FLOAT **evals, PRIMME_COMPLEX_FLOAT **evecs, float **resNorms, 
+      primme_params **primme, int numProblems, int numThreads, int *ierrs);
+int zprimme_normal_batch(PRIMME_COMPLEX_DOUBLE **evals, PRIMME_COMPLEX_DOUBLE **evecs, double **resNorms, 
+      primme_params **primme, int numProblems, int numThreads, int *ierrs);
+
+/* Calls finding all eigenvalues in an interval by spectrum slicing */
+
+int sprimme_slice(float *evals, float *evecs, float *resNorms, double lower,
+      double upper, primme_params *primme, int numSlices, int numThreads);
+int cprimme_slice(float *evals, PRIMME_COMPLEX_FLOAT *evecs, float *resNorms,
+      double lower, double upper, primme_params *primme, int numSlices,
+      int numThreads);
+int dprimme_slice(double *evals, double *evecs, double *resNorms, double lower,
+      double upper, primme_params *primme, int numSlices, int numThreads);
+int zprimme_slice(double *evals, PRIMME_COMPLEX_DOUBLE *evecs,
+      double *resNorms, double lower, double upper, primme_params *primme,
+      int numSlices, int numThreads);
+
 primme_params* primme_params_create(void);
 int primme_params_destroy(primme_params *primme);
+primme_workspace* primme_workspace_create(int warmStart);
+int primme_workspace_destroy(primme_workspace *ws);
+primme_csr* primme_csr_create(PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const void *a, int base, primme_op_datatype type,
+      int iscomplex);
+int primme_csr_sell(primme_csr *A, int C, int sigma);
+int primme_csr_destroy(primme_csr *A);
+int primme_csr_mm(primme_csr *A, int trans, int blockSize, void *x,
+      PRIMME_INT ldx, void *y, PRIMME_INT ldy);
+int primme_csr_normal_mm(primme_csr *A, int trans, int blockSize, void *x,
+      PRIMME_INT ldx, void *y, PRIMME_INT ldy);
+void primme_csr_matvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr);
 void primme_initialize(primme_params *primme);
 int  primme_set_method(primme_preset_method method, primme_params *params);
 void primme_display_params(primme_params primme);
 void primme_free(primme_params *primme);
+int primme_get_profile(primme_params *primme, primme_profile_entry *entries,
+      int *numEntries);
 int primme_get_member(primme_params *primme, primme_params_label label,
       void *value);
 int primme_set_member(primme_params *primme, primme_params_label label,
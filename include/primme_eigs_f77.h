@@ -167,7 +167,25 @@ C-------------------------------------------------------
      : PRIMME_monitorFun_type                        ,
      : PRIMME_monitor                                ,
      : PRIMME_queue                                  ,
-     : PRIMME_profile                                
+     : PRIMME_profile                                ,
+     : PRIMME_memoryArena                            ,
+     : PRIMME_globalSumRealStart                     ,
+     : PRIMME_globalSumRealWait                      ,
+     : PRIMME_stats_numGlobalSumRequested            ,
+     : PRIMME_correctionParams_innerPrecision        ,
+     : PRIMME_projectionParams_partialSolve          ,
+     : PRIMME_projectionParams_replicatedSolve       ,
+     : PRIMME_correctionParams_chebyshevDegree       ,
+     : PRIMME_storagePrecision                       ,
+     : PRIMME_basisStorageDir                        ,
+     : PRIMME_checkpointFile                         ,
+     : PRIMME_checkpointInterval                     ,
+     : PRIMME_checkpointRequest                      ,
+     : PRIMME_profileTable                           ,
+     : PRIMME_traceFile                              ,
+     : PRIMME_dynamicBlockSize                       ,
+     : PRIMME_tuningFile                             ,
+     : PRIMME_stats_numReplicatedMismatches          
 
       parameter(
      : PRIMME_n                                      = 1  ,
@@ -258,7 +276,25 @@ C-------------------------------------------------------
      : PRIMME_monitorFun_type                        = 86  ,
      : PRIMME_monitor                                = 87  ,
      : PRIMME_queue                                  = 88  ,
-     : PRIMME_profile                                = 89  
+     : PRIMME_profile                                = 89  ,
+     : PRIMME_memoryArena                            = 90  ,
+     : PRIMME_globalSumRealStart                     = 91  ,
+     : PRIMME_globalSumRealWait                      = 92  ,
+     : PRIMME_stats_numGlobalSumRequested            = 93  ,
+     : PRIMME_correctionParams_innerPrecision        = 94  ,
+     : PRIMME_projectionParams_partialSolve          = 95  ,
+     : PRIMME_projectionParams_replicatedSolve       = 96  ,
+     : PRIMME_correctionParams_chebyshevDegree       = 97  ,
+     : PRIMME_storagePrecision                       = 98  ,
+     : PRIMME_basisStorageDir                        = 99  ,
+     : PRIMME_checkpointFile                         = 100 ,
+     : PRIMME_checkpointInterval                     = 101 ,
+     : PRIMME_checkpointRequest                      = 102 ,
+     : PRIMME_profileTable                           = 103 ,
+     : PRIMME_traceFile                              = 104 ,
+     : PRIMME_dynamicBlockSize                       = 105 ,
+     : PRIMME_tuningFile                             = 106 ,
+     : PRIMME_stats_numReplicatedMismatches          = 107 
      : )
 
 C-------------------------------------------------------
@@ -296,7 +332,8 @@ C-------------------------------------------------------
      : primme_op_float,
      : primme_op_double,
      : primme_op_quad,
-     : primme_op_int
+     : primme_op_int,
+     : primme_op_auto
 
       parameter(
      : primme_smallest = 0,
@@ -328,5 +365,6 @@ C-------------------------------------------------------
      : primme_op_float = 2,
      : primme_op_double = 3,
      : primme_op_quad = 4,
-     : primme_op_int = 5
+     : primme_op_int = 5,
+     : primme_op_auto = 6
      : )
@@ -80,6 +80,7 @@ typedef struct primme_svds_stats {
    double timeGlobalSum;            /* time expend by globalSumReal  */
    double timeBroadcast;            /* time expend by broadcastReal  */
    PRIMME_INT lockingIssue;         /* Some converged with a weak criterion */
+   PRIMME_INT numGlobalSumRequested; /* reductions requested before coalescing */
 } primme_svds_stats;
 
 typedef struct primme_svds_params {
@@ -97,6 +98,9 @@ typedef struct primme_svds_params {
       (void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize,
        int *transpose, struct primme_svds_params *primme_svds, int *ierr);
    primme_op_datatype matrixMatvec_type;
+   void (*matrixMatvecNormal) /* optional, y = A'*A*x or A*A'*x at once */
+      (void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize,
+       int *transpose, struct primme_svds_params *primme_svds, int *ierr);
    void (*applyPreconditioner)
       (void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize,
        int *transpose, struct primme_svds_params *primme_svds, int *ierr);
@@ -160,6 +164,7 @@ typedef struct primme_svds_params {
    void *monitor;
    void *queue;   	/* magma device queue (magma_queue_t*) */
    const char *profile; /* regex expression with functions to monitor times */
+   const char *traceFile; /* if set, write the timeline of the solve */
 } primme_svds_params;
 
 typedef enum {
@@ -226,7 +231,10 @@ typedef enum {
    PRIMME_SVDS_monitorFun_type              = 59,
    PRIMME_SVDS_monitor                      = 60,
    PRIMME_SVDS_queue                        = 61,
-   PRIMME_SVDS_profile                      = 62 
+   PRIMME_SVDS_profile                      = 62,
+   PRIMME_SVDS_stats_numGlobalSumRequested  = 63,
+   PRIMME_SVDS_matrixMatvecNormal           = 64,
+   PRIMME_SVDS_traceFile                    = 65 
 } primme_svds_params_label;
 
 int hprimme_svds(PRIMME_HALF *svals, PRIMME_HALF *svecs, PRIMME_HALF *resNorms,
@@ -281,6 +289,12 @@ int primme_svds_member_info(primme_svds_params_label *label,
 int primme_svds_constant_info(const char* label_name, int *value);
 int primme_svds_enum_member_info(
       primme_svds_params_label label, int *value, const char **value_name);
+void primme_csr_svds_matvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, int *transpose, primme_svds_params *primme_svds,
+      int *ierr);
+void primme_csr_svds_matvec_normal(void *x, PRIMME_INT *ldx, void *y,
+      PRIMME_INT *ldy, int *blockSize, int *transpose,
+      primme_svds_params *primme_svds, int *ierr);
 
 #ifdef __cplusplus
 }
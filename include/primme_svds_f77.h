@@ -117,7 +117,10 @@ C-------------------------------------------------------
      : PRIMME_SVDS_monitorFun_type              ,
      : PRIMME_SVDS_monitor                      ,
      : PRIMME_SVDS_queue                        ,
-     : PRIMME_SVDS_profile                       
+     : PRIMME_SVDS_profile                      ,
+     : PRIMME_SVDS_stats_numGlobalSumRequested  ,
+     : PRIMME_SVDS_matrixMatvecNormal           ,
+     : PRIMME_SVDS_traceFile                     
 
       parameter(
      : PRIMME_SVDS_primme                       = 1,
@@ -181,7 +184,10 @@ C-------------------------------------------------------
      : PRIMME_SVDS_monitorFun_type              = 59,
      : PRIMME_SVDS_monitor                      = 60,
      : PRIMME_SVDS_queue                        = 61,
-     : PRIMME_SVDS_profile                      = 62 
+     : PRIMME_SVDS_profile                      = 62,
+     : PRIMME_SVDS_stats_numGlobalSumRequested  = 63,
+     : PRIMME_SVDS_matrixMatvecNormal           = 64,
+     : PRIMME_SVDS_traceFile                    = 65 
      :)
 
 C-------------------------------------------------------
@@ -38,7 +38,7 @@
 #define THIS_FILE "../eigs/auxiliary_eigs.c"
 #endif
 
-#include <string.h> /* memset */
+#include <string.h> /* memset, memcpy */
 #include "common_eigs.h"
 #include "numerical.h"
 /* Keep automatically generated headers under this section  */
@@ -103,8 +103,16 @@ primme_context primme_get_context(primme_params *primme) {
       ctx.mpicomm = primme->commInfo;
       ctx.globalSum = globalSum_Tprimme;
       ctx.bcast = broadcast_Tprimme; 
+      if (primme->numProcs > 1 && MALLOC_PRIMME(1, &ctx.sumQueue) == 0) {
+         *ctx.sumQueue = NULL;
+      }
       ctx.queue = primme->queue;
       ctx.report = monitor_report;
+      if (primme->memoryArena && Mem_arena_create(&ctx) != 0) {
+         /* Without an arena, the temporaries go to the system allocator */
+         ctx.arena = NULL;
+         PRINTF(1, "Warning: could not create the memory arena");
+      }
 #ifdef PRIMME_PROFILE
       if (primme->profile) {
          /* Compile regex. If there is no errors, set path to a nonzero       */
@@ -125,6 +133,17 @@ primme_context primme_get_context(primme_params *primme) {
       } else {
          ctx.path = NULL;
       }
+#else
+      if (primme->profile) {
+         /* Keep the times in primme->profileTable, so that they are */
+         /* returned by primme_get_profile after the call            */
+
+         if (Profile_create(primme->profile, &primme->profileTable) == 0) {
+            ctx.prof = primme->profileTable;
+         } else {
+            ctx.report("Invalid pattern in profile", -1, ctx);
+         }
+      }
 #endif
    }
 
@@ -151,6 +170,14 @@ void primme_free_context(primme_context ctx) {
 
    Mem_pop_frame(&ctx);
 
+   /* Free the arena, if it is not owned by a workspace */
+
+   if (!ctx.ws) Mem_arena_destroy(&ctx);
+
+   /* Free the queue of deferred reductions */
+
+   if (ctx.sumQueue) free(ctx.sumQueue);
+
    /* Free profiler */
 
 #ifdef PRIMME_PROFILE
@@ -224,6 +251,7 @@ int matrixMatvec_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
    if (Wb != W0) CHKERR(Num_free_Sprimme((SCALAR*)W0, ctx));
 
    primme->stats.timeMatvec += primme_wTimer() - t0;
+   Trace_span("matvec", t0, ctx.trace);
    primme->stats.numMatvecs += blockSize;
 
    return 0;
@@ -291,6 +319,7 @@ int massMatrixMatvec_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
    if (BVb != BV0) CHKERR(Num_free_Sprimme((SCALAR*)BV0, ctx));
 
    primme->stats.timeMatvec += primme_wTimer() - t0;
+   Trace_span("massMatvec", t0, ctx.trace);
    primme->stats.numMatvecs += blockSize;
 
    return 0;
@@ -359,6 +388,7 @@ int applyPreconditioner_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
    }
 
    primme->stats.timePrecond += primme_wTimer() - t0;
+   Trace_span("precond", t0, ctx.trace);
 
    return 0;
 }
@@ -375,6 +405,17 @@ int globalSum_Sprimme(SCALAR *buffer, int count, primme_context ctx) {
    return globalSum_Tprimme(buffer, PRIMME_OP_SCALAR, count, ctx);
 }
 
+TEMPLATE_PLEASE
+int globalSumStart_Sprimme(SCALAR *buffer, int count, primme_reduction *r,
+      primme_context ctx) {
+
+#ifdef USE_COMPLEX
+   count *= 2;
+#endif
+
+   return globalSumStart_Tprimme(buffer, PRIMME_OP_SCALAR, count, r, ctx);
+}
+
 TEMPLATE_PLEASE
 int broadcast_Sprimme(SCALAR *buffer, int count, primme_context ctx) {
 
@@ -385,6 +426,17 @@ int broadcast_Sprimme(SCALAR *buffer, int count, primme_context ctx) {
    return broadcast_Tprimme(buffer, PRIMME_OP_SCALAR, count, ctx);
 }
 
+TEMPLATE_PLEASE
+int broadcastStart_Sprimme(SCALAR *buffer, int count, primme_reduction *r,
+      primme_context ctx) {
+
+#ifdef USE_COMPLEX
+   count *= 2;
+#endif
+
+   return broadcastStart_Tprimme(buffer, PRIMME_OP_SCALAR, count, r, ctx);
+}
+
 #ifdef USE_DOUBLE
 
 TEMPLATE_PLEASE
@@ -399,6 +451,14 @@ int globalSum_Tprimme(
       return 0;
    }
 
+   /* If there are deferred reductions, send this one with them */
+
+   if (ctx.sumQueue && *ctx.sumQueue) {
+      primme_reduction r;
+      CHKERR(globalSumStart_Tprimme(buffer, buffert, count, &r, ctx));
+      CHKERR(globalSumWait_Tprimme(&r, ctx));
+      return 0;
+   }
 
    double t0 = primme_wTimer();
 
@@ -420,12 +480,236 @@ int globalSum_Tprimme(
          -1 /* dealloc */, 1 /* copy */, ctx));
 
    primme->stats.numGlobalSum++;
+   primme->stats.numGlobalSumRequested++;
    primme->stats.timeGlobalSum += primme_wTimer() - t0;
+   Trace_span("globalSum", t0, ctx.trace);
    primme->stats.volumeGlobalSum += count;
 
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine globalSumStart - start the sum of buffer among all processes.
+ *    The result is in buffer after calling globalSumWait with the same r.
+ *    Buffer should not be accessed in between.
+ *
+ *    If the user provides globalSumRealStart and globalSumRealWait, the
+ *    reduction is started here. Otherwise, the reduction is queued in
+ *    ctx.sumQueue, and all queued reductions are sent packed in a single
+ *    call to globalSumReal by the first globalSumWait or globalSum.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * buffer   array to reduce
+ * buffert  type of buffer
+ * count    number of elements in buffer
+ * r        (output) handle to pass to globalSumWait
+ * ctx      primme context
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int globalSumStart_Tprimme(void *buffer, primme_op_datatype buffert, int count,
+      primme_reduction *r, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   r->buffer = buffer;
+   r->buffert = buffert;
+   r->buffer0 = NULL;
+   r->count = count;
+   r->request = NULL;
+   r->pending = 0;
+   r->deferred = 0;
+   r->next = NULL;
+
+   /* Quick exit */
+
+   if (count == 0 || !primme || primme->numProcs == 1 ||
+         !primme->globalSumReal) {
+      return 0;
+   }
+
+   int async = primme->globalSumRealStart && primme->globalSumRealWait;
+
+   /* Do a blocking reduction if the reduction cannot be started or queued */
+
+   if (!async && !ctx.sumQueue) {
+      return globalSum_Tprimme(buffer, buffert, count, ctx);
+   }
+
+   double t0 = primme_wTimer();
+
+   /* Cast buffer; buffer0 is freed by globalSumWait */
+
+   Mem_keep_frame(ctx);
+   CHKERR(Num_matrix_astype_Rprimme(buffer, 1, count, 1, buffert, &r->buffer0,
+         NULL, primme->globalSumReal_type, 1 /* alloc */, 1 /* copy */, ctx));
+   primme->stats.numGlobalSumRequested++;
+
+   if (async) {
+      int ierr = 0;
+      CHKERRM((primme->globalSumRealStart(r->buffer0, r->buffer0, &r->count,
+                     &r->request, primme, &ierr),
+                    ierr),
+            PRIMME_USER_FAILURE, "Error returned by 'globalSumRealStart' %d",
+            ierr);
+      r->pending = 1;
+      primme->stats.numGlobalSum++;
+      primme->stats.volumeGlobalSum += count;
+   } else {
+      /* Append r to the queue */
+
+      primme_reduction **last = ctx.sumQueue;
+      while (*last) last = &(*last)->next;
+      *last = r;
+      r->pending = 1;
+      r->deferred = 1;
+   }
+
+   primme->stats.timeGlobalSum += primme_wTimer() - t0;
+   Trace_span("globalSumStart", t0, ctx.trace);
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine globalSumFlush - reduce all reductions queued by globalSumStart
+ *    with a single call to globalSumReal.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * ctx      primme context
+ *
+ ******************************************************************************/
+
+STATIC int globalSumFlush(primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   primme_reduction *q = *ctx.sumQueue, *r;
+
+   /* Quick exit */
+
+   if (!q) return 0;
+
+   /* Pack all buffers, unless there is only one */
+
+   int count = 0;
+   for (r = q; r; r = r->next) count += r->count;
+   size_t s;
+   CHKERR(Num_sizeof_Rprimme(primme->globalSumReal_type, &s));
+   char *buffer = (char *)q->buffer0;
+   if (q->next) {
+      CHKERR(Mem_malloc(s * count, (void **)&buffer, ctx));
+      char *p = buffer;
+      for (r = q; r; p += s * r->count, r = r->next) {
+         memcpy(p, r->buffer0, s * r->count);
+      }
+   }
+
+   int ierr = 0;
+   primme->globalSumReal(buffer, buffer, &count, primme, &ierr);
+
+   /* Unpack the buffers and empty the queue */
+
+   char *p = buffer;
+   for (r = q; r; p += s * r->count, r = r->next) {
+      if (q->next) memcpy(r->buffer0, p, s * r->count);
+      r->deferred = 0;
+   }
+   if (q->next) Mem_free(buffer, ctx);
+   *ctx.sumQueue = NULL;
+   CHKERRM(ierr, PRIMME_USER_FAILURE, "Error returned by 'globalSumReal' %d",
+         ierr);
+
+   primme->stats.numGlobalSum++;
+   primme->stats.volumeGlobalSum += count;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine globalSumWait - finish a reduction started by globalSumStart.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * r        handle returned by globalSumStart
+ * ctx      primme context
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int globalSumWait_Tprimme(primme_reduction *r, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   /* Quick exit */
+
+   if (!r->pending) return 0;
+
+   double t0 = primme_wTimer();
+
+   r->pending = 0;
+   if (r->deferred) {
+      CHKERR(globalSumFlush(ctx));
+   } else if (primme->globalSumRealStart && primme->globalSumRealWait) {
+      int ierr = 0;
+      CHKERRM((primme->globalSumRealWait(r->request, primme, &ierr), ierr),
+            PRIMME_USER_FAILURE, "Error returned by 'globalSumRealWait' %d",
+            ierr);
+   }
+
+   /* Copy back buffer0 */
+
+   CHKERR(Num_matrix_astype_Rprimme(r->buffer0, 1, r->count, 1,
+         primme->globalSumReal_type, &r->buffer, NULL, r->buffert,
+         -1 /* dealloc */, 1 /* copy */, ctx));
+
+   primme->stats.timeGlobalSum += primme_wTimer() - t0;
+   Trace_span("globalSumWait", t0, ctx.trace);
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine globalSumCancel - abandon reductions started by globalSumStart,
+ *    usually because of an error before calling globalSumWait. The queued
+ *    reductions are removed from ctx.sumQueue, and the ones started with
+ *    globalSumRealStart are waited for, so that no reduction refers to the
+ *    buffers of the caller after it returns. The content of the buffers is
+ *    undefined.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * r        handles returned by globalSumStart
+ * n        number of handles in r
+ * ctx      primme context
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int globalSumCancel_Tprimme(primme_reduction *r, int n, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int i;
+
+   for (i = 0; i < n; i++) {
+      if (r[i].deferred) {
+         primme_reduction **q = ctx.sumQueue;
+         while (*q && *q != &r[i]) q = &(*q)->next;
+         if (*q) *q = r[i].next;
+         r[i].deferred = 0;
+      } else if (r[i].pending && primme->globalSumRealStart &&
+                 primme->globalSumRealWait) {
+         int ierr = 0;
+         primme->globalSumRealWait(r[i].request, primme, &ierr);
+      }
+      r[i].pending = 0;
+   }
+
+   return 0;
+}
+
 TEMPLATE_PLEASE
 int broadcast_Tprimme(
       void *buffer, primme_op_datatype buffert, int count, primme_context ctx) {
@@ -467,6 +751,7 @@ int broadcast_Tprimme(
 
    primme->stats.numBroadcast++;
    primme->stats.timeBroadcast += primme_wTimer() - t0;
+   Trace_span("broadcast", t0, ctx.trace);
    primme->stats.volumeBroadcast += count;
 
    return 0;
@@ -479,6 +764,59 @@ int broadcast_iprimme(int *buffer, int count, primme_context ctx) {
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine broadcastStart - start broadcasting buffer from process 0.
+ *    The result is in buffer after calling globalSumWait with the same r.
+ *
+ *    If the user does not provide broadcastReal, the broadcast is done with
+ *    globalSumStart, so it may be sent together with other reductions.
+ *    Otherwise, the broadcast is done here and globalSumWait does nothing.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * buffer   array to broadcast
+ * buffert  type of buffer
+ * count    number of elements in buffer
+ * r        (output) handle to pass to globalSumWait
+ * ctx      primme context
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int broadcastStart_Tprimme(void *buffer, primme_op_datatype buffert, int count,
+      primme_reduction *r, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   r->pending = 0;
+   r->deferred = 0;
+   if (!primme || primme->numProcs == 1 || primme->broadcastReal) {
+      return broadcast_Tprimme(buffer, buffert, count, ctx);
+   }
+
+   double t0 = primme_wTimer();
+
+   if (primme->procID != 0) {
+      CHKERR(Num_zero_matrix_Tprimme(buffer, buffert, 1, count, 1, ctx));
+   }
+   Mem_keep_frame(ctx); /* Keep the allocations done by globalSumStart */
+   CHKERR(globalSumStart_Tprimme(buffer, buffert, count, r, ctx));
+
+   primme->stats.numBroadcast++;
+   primme->stats.timeBroadcast += primme_wTimer() - t0;
+   Trace_span("broadcastStart", t0, ctx.trace);
+   primme->stats.volumeBroadcast += count;
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int broadcastStart_iprimme(
+      int *buffer, int count, primme_reduction *r, primme_context ctx) {
+
+   return broadcastStart_Tprimme(buffer, primme_op_int, count, r, ctx);
+}
+
 #endif /* USE_DOUBLE */
 
 #endif /* USE_HOST */
@@ -705,5 +1043,44 @@ int Num_dist_dots_real_Sprimme(SCALAR *x, PRIMME_INT ldx, SCALAR *y,
    return 0;
 }
 
+/*******************************************************************************
+ * Function dist_dots_realStart - Computes several dot products in parallel,
+ *    but only starts the reduction of the result. The result is valid after
+ *    calling globalSumWait on r. Returns only the real part.
+ *
+ * Input Parameters
+ * ----------------
+ * x, y     Operands of the dot product operations
+ *
+ * ldx, ldy Leading dimension of x and y
+ *
+ * m        Length of the vectors x and y
+ *
+ * n        Number of columns in x and y
+ *
+ * ctx      Structure containing various solver parameters
+ *
+ * result   The inner products
+ *
+ * r        (output) handle to pass to globalSumWait
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int Num_dist_dots_realStart_Sprimme(SCALAR *x, PRIMME_INT ldx, SCALAR *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, HREAL *result, primme_reduction *r,
+      primme_context ctx) {
+
+   int i;
+   for (i=0; i<n; i++) {
+      result[i] =
+            REAL_PART(Num_dot_Sprimme(m, &x[ldx * i], 1, &y[ldy * i], 1, ctx));
+   }
+   Mem_keep_frame(ctx); /* Keep the allocations done by globalSumStart */
+   CHKERR(globalSumStart_RHprimme(result, n, r, ctx));
+
+   return 0;
+}
+
  
 #endif /* SUPPORTED_TYPE */
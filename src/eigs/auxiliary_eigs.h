@@ -584,6 +584,98 @@ int applyPreconditioner_dprimme(dummy_type_dprimme *V, PRIMME_INT nLocal, PRIMME
 #  define globalSum_RHqprimme CONCAT(globalSum_,CONCAT(CONCAT(CONCAT(,q),primme),))
 #endif
 int globalSum_dprimme(dummy_type_dprimme *buffer, int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_Sprimme)
+#  define globalSumStart_Sprimme CONCAT(globalSumStart_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_Rprimme)
+#  define globalSumStart_Rprimme CONCAT(globalSumStart_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_SHprimme)
+#  define globalSumStart_SHprimme CONCAT(globalSumStart_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_RHprimme)
+#  define globalSumStart_RHprimme CONCAT(globalSumStart_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_SXprimme)
+#  define globalSumStart_SXprimme CONCAT(globalSumStart_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_RXprimme)
+#  define globalSumStart_RXprimme CONCAT(globalSumStart_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_Shprimme)
+#  define globalSumStart_Shprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_Rhprimme)
+#  define globalSumStart_Rhprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_Ssprimme)
+#  define globalSumStart_Ssprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_Rsprimme)
+#  define globalSumStart_Rsprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_Sdprimme)
+#  define globalSumStart_Sdprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_Rdprimme)
+#  define globalSumStart_Rdprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_Sqprimme)
+#  define globalSumStart_Sqprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_Rqprimme)
+#  define globalSumStart_Rqprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_SXhprimme)
+#  define globalSumStart_SXhprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_RXhprimme)
+#  define globalSumStart_RXhprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_SXsprimme)
+#  define globalSumStart_SXsprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_RXsprimme)
+#  define globalSumStart_RXsprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_SXdprimme)
+#  define globalSumStart_SXdprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_RXdprimme)
+#  define globalSumStart_RXdprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_SXqprimme)
+#  define globalSumStart_SXqprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_RXqprimme)
+#  define globalSumStart_RXqprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_SHhprimme)
+#  define globalSumStart_SHhprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_RHhprimme)
+#  define globalSumStart_RHhprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_SHsprimme)
+#  define globalSumStart_SHsprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_RHsprimme)
+#  define globalSumStart_RHsprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_SHdprimme)
+#  define globalSumStart_SHdprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_RHdprimme)
+#  define globalSumStart_RHdprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_SHqprimme)
+#  define globalSumStart_SHqprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_RHqprimme)
+#  define globalSumStart_RHqprimme CONCAT(globalSumStart_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSumStart_dprimme(dummy_type_dprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(broadcast_Sprimme)
 #  define broadcast_Sprimme CONCAT(broadcast_,SCALAR_SUF)
 #endif
@@ -675,6 +767,98 @@ int globalSum_dprimme(dummy_type_dprimme *buffer, int count, primme_context ctx)
 #  define broadcast_RHqprimme CONCAT(broadcast_,CONCAT(CONCAT(CONCAT(,q),primme),))
 #endif
 int broadcast_dprimme(dummy_type_dprimme *buffer, int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_Sprimme)
+#  define broadcastStart_Sprimme CONCAT(broadcastStart_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_Rprimme)
+#  define broadcastStart_Rprimme CONCAT(broadcastStart_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_SHprimme)
+#  define broadcastStart_SHprimme CONCAT(broadcastStart_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_RHprimme)
+#  define broadcastStart_RHprimme CONCAT(broadcastStart_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_SXprimme)
+#  define broadcastStart_SXprimme CONCAT(broadcastStart_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_RXprimme)
+#  define broadcastStart_RXprimme CONCAT(broadcastStart_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_Shprimme)
+#  define broadcastStart_Shprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_Rhprimme)
+#  define broadcastStart_Rhprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_Ssprimme)
+#  define broadcastStart_Ssprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_Rsprimme)
+#  define broadcastStart_Rsprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_Sdprimme)
+#  define broadcastStart_Sdprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_Rdprimme)
+#  define broadcastStart_Rdprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_Sqprimme)
+#  define broadcastStart_Sqprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_Rqprimme)
+#  define broadcastStart_Rqprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_SXhprimme)
+#  define broadcastStart_SXhprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_RXhprimme)
+#  define broadcastStart_RXhprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_SXsprimme)
+#  define broadcastStart_SXsprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_RXsprimme)
+#  define broadcastStart_RXsprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_SXdprimme)
+#  define broadcastStart_SXdprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_RXdprimme)
+#  define broadcastStart_RXdprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_SXqprimme)
+#  define broadcastStart_SXqprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_RXqprimme)
+#  define broadcastStart_RXqprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_SHhprimme)
+#  define broadcastStart_SHhprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_RHhprimme)
+#  define broadcastStart_RHhprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_SHsprimme)
+#  define broadcastStart_SHsprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_RHsprimme)
+#  define broadcastStart_RHsprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_SHdprimme)
+#  define broadcastStart_SHdprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_RHdprimme)
+#  define broadcastStart_RHdprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_SHqprimme)
+#  define broadcastStart_SHqprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_RHqprimme)
+#  define broadcastStart_RHqprimme CONCAT(broadcastStart_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int broadcastStart_dprimme(dummy_type_dprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSprimme)
 #  define globalSum_TprimmeSprimme CONCAT(globalSum_Tprimme,SCALAR_SUF)
 #endif
@@ -767,6 +951,284 @@ int broadcast_dprimme(dummy_type_dprimme *buffer, int count, primme_context ctx)
 #endif
 int globalSum_Tprimme(
       void *buffer, primme_op_datatype buffert, int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSprimme)
+#  define globalSumStart_TprimmeSprimme CONCAT(globalSumStart_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRprimme)
+#  define globalSumStart_TprimmeRprimme CONCAT(globalSumStart_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSHprimme)
+#  define globalSumStart_TprimmeSHprimme CONCAT(globalSumStart_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRHprimme)
+#  define globalSumStart_TprimmeRHprimme CONCAT(globalSumStart_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSXprimme)
+#  define globalSumStart_TprimmeSXprimme CONCAT(globalSumStart_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRXprimme)
+#  define globalSumStart_TprimmeRXprimme CONCAT(globalSumStart_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeShprimme)
+#  define globalSumStart_TprimmeShprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRhprimme)
+#  define globalSumStart_TprimmeRhprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSsprimme)
+#  define globalSumStart_TprimmeSsprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRsprimme)
+#  define globalSumStart_TprimmeRsprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSdprimme)
+#  define globalSumStart_TprimmeSdprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRdprimme)
+#  define globalSumStart_TprimmeRdprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSqprimme)
+#  define globalSumStart_TprimmeSqprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRqprimme)
+#  define globalSumStart_TprimmeRqprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSXhprimme)
+#  define globalSumStart_TprimmeSXhprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRXhprimme)
+#  define globalSumStart_TprimmeRXhprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSXsprimme)
+#  define globalSumStart_TprimmeSXsprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRXsprimme)
+#  define globalSumStart_TprimmeRXsprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSXdprimme)
+#  define globalSumStart_TprimmeSXdprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRXdprimme)
+#  define globalSumStart_TprimmeRXdprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSXqprimme)
+#  define globalSumStart_TprimmeSXqprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRXqprimme)
+#  define globalSumStart_TprimmeRXqprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSHhprimme)
+#  define globalSumStart_TprimmeSHhprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRHhprimme)
+#  define globalSumStart_TprimmeRHhprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSHsprimme)
+#  define globalSumStart_TprimmeSHsprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRHsprimme)
+#  define globalSumStart_TprimmeRHsprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSHdprimme)
+#  define globalSumStart_TprimmeSHdprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRHdprimme)
+#  define globalSumStart_TprimmeRHdprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeSHqprimme)
+#  define globalSumStart_TprimmeSHqprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumStart_TprimmeRHqprimme)
+#  define globalSumStart_TprimmeRHqprimme CONCAT(globalSumStart_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSumStart_Tprimme(void *buffer, primme_op_datatype buffert, int count,
+      primme_reduction *r, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumFlush)
+#  define globalSumFlush CONCAT(globalSumFlush,SCALAR_SUF)
+#endif
+int globalSumFlushdprimme(primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSprimme)
+#  define globalSumWait_TprimmeSprimme CONCAT(globalSumWait_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRprimme)
+#  define globalSumWait_TprimmeRprimme CONCAT(globalSumWait_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSHprimme)
+#  define globalSumWait_TprimmeSHprimme CONCAT(globalSumWait_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRHprimme)
+#  define globalSumWait_TprimmeRHprimme CONCAT(globalSumWait_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSXprimme)
+#  define globalSumWait_TprimmeSXprimme CONCAT(globalSumWait_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRXprimme)
+#  define globalSumWait_TprimmeRXprimme CONCAT(globalSumWait_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeShprimme)
+#  define globalSumWait_TprimmeShprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRhprimme)
+#  define globalSumWait_TprimmeRhprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSsprimme)
+#  define globalSumWait_TprimmeSsprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRsprimme)
+#  define globalSumWait_TprimmeRsprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSdprimme)
+#  define globalSumWait_TprimmeSdprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRdprimme)
+#  define globalSumWait_TprimmeRdprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSqprimme)
+#  define globalSumWait_TprimmeSqprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRqprimme)
+#  define globalSumWait_TprimmeRqprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSXhprimme)
+#  define globalSumWait_TprimmeSXhprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRXhprimme)
+#  define globalSumWait_TprimmeRXhprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSXsprimme)
+#  define globalSumWait_TprimmeSXsprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRXsprimme)
+#  define globalSumWait_TprimmeRXsprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSXdprimme)
+#  define globalSumWait_TprimmeSXdprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRXdprimme)
+#  define globalSumWait_TprimmeRXdprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSXqprimme)
+#  define globalSumWait_TprimmeSXqprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRXqprimme)
+#  define globalSumWait_TprimmeRXqprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSHhprimme)
+#  define globalSumWait_TprimmeSHhprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRHhprimme)
+#  define globalSumWait_TprimmeRHhprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSHsprimme)
+#  define globalSumWait_TprimmeSHsprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRHsprimme)
+#  define globalSumWait_TprimmeRHsprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSHdprimme)
+#  define globalSumWait_TprimmeSHdprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRHdprimme)
+#  define globalSumWait_TprimmeRHdprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeSHqprimme)
+#  define globalSumWait_TprimmeSHqprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumWait_TprimmeRHqprimme)
+#  define globalSumWait_TprimmeRHqprimme CONCAT(globalSumWait_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSumWait_Tprimme(primme_reduction *r, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSprimme)
+#  define globalSumCancel_TprimmeSprimme CONCAT(globalSumCancel_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRprimme)
+#  define globalSumCancel_TprimmeRprimme CONCAT(globalSumCancel_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSHprimme)
+#  define globalSumCancel_TprimmeSHprimme CONCAT(globalSumCancel_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRHprimme)
+#  define globalSumCancel_TprimmeRHprimme CONCAT(globalSumCancel_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSXprimme)
+#  define globalSumCancel_TprimmeSXprimme CONCAT(globalSumCancel_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRXprimme)
+#  define globalSumCancel_TprimmeRXprimme CONCAT(globalSumCancel_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeShprimme)
+#  define globalSumCancel_TprimmeShprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRhprimme)
+#  define globalSumCancel_TprimmeRhprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSsprimme)
+#  define globalSumCancel_TprimmeSsprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRsprimme)
+#  define globalSumCancel_TprimmeRsprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSdprimme)
+#  define globalSumCancel_TprimmeSdprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRdprimme)
+#  define globalSumCancel_TprimmeRdprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSqprimme)
+#  define globalSumCancel_TprimmeSqprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRqprimme)
+#  define globalSumCancel_TprimmeRqprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSXhprimme)
+#  define globalSumCancel_TprimmeSXhprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRXhprimme)
+#  define globalSumCancel_TprimmeRXhprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSXsprimme)
+#  define globalSumCancel_TprimmeSXsprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRXsprimme)
+#  define globalSumCancel_TprimmeRXsprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSXdprimme)
+#  define globalSumCancel_TprimmeSXdprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRXdprimme)
+#  define globalSumCancel_TprimmeRXdprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSXqprimme)
+#  define globalSumCancel_TprimmeSXqprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRXqprimme)
+#  define globalSumCancel_TprimmeRXqprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSHhprimme)
+#  define globalSumCancel_TprimmeSHhprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRHhprimme)
+#  define globalSumCancel_TprimmeRHhprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSHsprimme)
+#  define globalSumCancel_TprimmeSHsprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRHsprimme)
+#  define globalSumCancel_TprimmeRHsprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSHdprimme)
+#  define globalSumCancel_TprimmeSHdprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRHdprimme)
+#  define globalSumCancel_TprimmeRHdprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeSHqprimme)
+#  define globalSumCancel_TprimmeSHqprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSumCancel_TprimmeRHqprimme)
+#  define globalSumCancel_TprimmeRHqprimme CONCAT(globalSumCancel_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSumCancel_Tprimme(primme_reduction *r, int n, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(broadcast_TprimmeSprimme)
 #  define broadcast_TprimmeSprimme CONCAT(broadcast_Tprimme,SCALAR_SUF)
 #endif
@@ -950,6 +1412,190 @@ int broadcast_Tprimme(
 #  define broadcast_iprimmeRHqprimme CONCAT(broadcast_iprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
 #endif
 int broadcast_iprimme(int *buffer, int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSprimme)
+#  define broadcastStart_TprimmeSprimme CONCAT(broadcastStart_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRprimme)
+#  define broadcastStart_TprimmeRprimme CONCAT(broadcastStart_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSHprimme)
+#  define broadcastStart_TprimmeSHprimme CONCAT(broadcastStart_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRHprimme)
+#  define broadcastStart_TprimmeRHprimme CONCAT(broadcastStart_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSXprimme)
+#  define broadcastStart_TprimmeSXprimme CONCAT(broadcastStart_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRXprimme)
+#  define broadcastStart_TprimmeRXprimme CONCAT(broadcastStart_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeShprimme)
+#  define broadcastStart_TprimmeShprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRhprimme)
+#  define broadcastStart_TprimmeRhprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSsprimme)
+#  define broadcastStart_TprimmeSsprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRsprimme)
+#  define broadcastStart_TprimmeRsprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSdprimme)
+#  define broadcastStart_TprimmeSdprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRdprimme)
+#  define broadcastStart_TprimmeRdprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSqprimme)
+#  define broadcastStart_TprimmeSqprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRqprimme)
+#  define broadcastStart_TprimmeRqprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSXhprimme)
+#  define broadcastStart_TprimmeSXhprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRXhprimme)
+#  define broadcastStart_TprimmeRXhprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSXsprimme)
+#  define broadcastStart_TprimmeSXsprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRXsprimme)
+#  define broadcastStart_TprimmeRXsprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSXdprimme)
+#  define broadcastStart_TprimmeSXdprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRXdprimme)
+#  define broadcastStart_TprimmeRXdprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSXqprimme)
+#  define broadcastStart_TprimmeSXqprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRXqprimme)
+#  define broadcastStart_TprimmeRXqprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSHhprimme)
+#  define broadcastStart_TprimmeSHhprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRHhprimme)
+#  define broadcastStart_TprimmeRHhprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSHsprimme)
+#  define broadcastStart_TprimmeSHsprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRHsprimme)
+#  define broadcastStart_TprimmeRHsprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSHdprimme)
+#  define broadcastStart_TprimmeSHdprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRHdprimme)
+#  define broadcastStart_TprimmeRHdprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeSHqprimme)
+#  define broadcastStart_TprimmeSHqprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_TprimmeRHqprimme)
+#  define broadcastStart_TprimmeRHqprimme CONCAT(broadcastStart_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int broadcastStart_Tprimme(void *buffer, primme_op_datatype buffert, int count,
+      primme_reduction *r, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSprimme)
+#  define broadcastStart_iprimmeSprimme CONCAT(broadcastStart_iprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRprimme)
+#  define broadcastStart_iprimmeRprimme CONCAT(broadcastStart_iprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSHprimme)
+#  define broadcastStart_iprimmeSHprimme CONCAT(broadcastStart_iprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRHprimme)
+#  define broadcastStart_iprimmeRHprimme CONCAT(broadcastStart_iprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSXprimme)
+#  define broadcastStart_iprimmeSXprimme CONCAT(broadcastStart_iprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRXprimme)
+#  define broadcastStart_iprimmeRXprimme CONCAT(broadcastStart_iprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeShprimme)
+#  define broadcastStart_iprimmeShprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRhprimme)
+#  define broadcastStart_iprimmeRhprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSsprimme)
+#  define broadcastStart_iprimmeSsprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRsprimme)
+#  define broadcastStart_iprimmeRsprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSdprimme)
+#  define broadcastStart_iprimmeSdprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRdprimme)
+#  define broadcastStart_iprimmeRdprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSqprimme)
+#  define broadcastStart_iprimmeSqprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRqprimme)
+#  define broadcastStart_iprimmeRqprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSXhprimme)
+#  define broadcastStart_iprimmeSXhprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRXhprimme)
+#  define broadcastStart_iprimmeRXhprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSXsprimme)
+#  define broadcastStart_iprimmeSXsprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRXsprimme)
+#  define broadcastStart_iprimmeRXsprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSXdprimme)
+#  define broadcastStart_iprimmeSXdprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRXdprimme)
+#  define broadcastStart_iprimmeRXdprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSXqprimme)
+#  define broadcastStart_iprimmeSXqprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRXqprimme)
+#  define broadcastStart_iprimmeRXqprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSHhprimme)
+#  define broadcastStart_iprimmeSHhprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRHhprimme)
+#  define broadcastStart_iprimmeRHhprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSHsprimme)
+#  define broadcastStart_iprimmeSHsprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRHsprimme)
+#  define broadcastStart_iprimmeRHsprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSHdprimme)
+#  define broadcastStart_iprimmeSHdprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRHdprimme)
+#  define broadcastStart_iprimmeRHdprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeSHqprimme)
+#  define broadcastStart_iprimmeSHqprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcastStart_iprimmeRHqprimme)
+#  define broadcastStart_iprimmeRHqprimme CONCAT(broadcastStart_iprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int broadcastStart_iprimme(
+      int *buffer, int count, primme_reduction *r, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(machineEpsMatrix_Sprimme)
 #  define machineEpsMatrix_Sprimme CONCAT(machineEpsMatrix_,SCALAR_SUF)
 #endif
@@ -1500,6 +2146,99 @@ int Num_dist_dots_dprimme(dummy_type_dprimme *x, PRIMME_INT ldx, dummy_type_dpri
 #endif
 int Num_dist_dots_real_dprimme(dummy_type_dprimme *x, PRIMME_INT ldx, dummy_type_dprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_Sprimme)
+#  define Num_dist_dots_realStart_Sprimme CONCAT(Num_dist_dots_realStart_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_Rprimme)
+#  define Num_dist_dots_realStart_Rprimme CONCAT(Num_dist_dots_realStart_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_SHprimme)
+#  define Num_dist_dots_realStart_SHprimme CONCAT(Num_dist_dots_realStart_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_RHprimme)
+#  define Num_dist_dots_realStart_RHprimme CONCAT(Num_dist_dots_realStart_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_SXprimme)
+#  define Num_dist_dots_realStart_SXprimme CONCAT(Num_dist_dots_realStart_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_RXprimme)
+#  define Num_dist_dots_realStart_RXprimme CONCAT(Num_dist_dots_realStart_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_Shprimme)
+#  define Num_dist_dots_realStart_Shprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_Rhprimme)
+#  define Num_dist_dots_realStart_Rhprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_Ssprimme)
+#  define Num_dist_dots_realStart_Ssprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_Rsprimme)
+#  define Num_dist_dots_realStart_Rsprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_Sdprimme)
+#  define Num_dist_dots_realStart_Sdprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_Rdprimme)
+#  define Num_dist_dots_realStart_Rdprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_Sqprimme)
+#  define Num_dist_dots_realStart_Sqprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_Rqprimme)
+#  define Num_dist_dots_realStart_Rqprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_SXhprimme)
+#  define Num_dist_dots_realStart_SXhprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_RXhprimme)
+#  define Num_dist_dots_realStart_RXhprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_SXsprimme)
+#  define Num_dist_dots_realStart_SXsprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_RXsprimme)
+#  define Num_dist_dots_realStart_RXsprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_SXdprimme)
+#  define Num_dist_dots_realStart_SXdprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_RXdprimme)
+#  define Num_dist_dots_realStart_RXdprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_SXqprimme)
+#  define Num_dist_dots_realStart_SXqprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_RXqprimme)
+#  define Num_dist_dots_realStart_RXqprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_SHhprimme)
+#  define Num_dist_dots_realStart_SHhprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_RHhprimme)
+#  define Num_dist_dots_realStart_RHhprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_SHsprimme)
+#  define Num_dist_dots_realStart_SHsprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_RHsprimme)
+#  define Num_dist_dots_realStart_RHsprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_SHdprimme)
+#  define Num_dist_dots_realStart_SHdprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_RHdprimme)
+#  define Num_dist_dots_realStart_RHdprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_SHqprimme)
+#  define Num_dist_dots_realStart_SHqprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_dist_dots_realStart_RHqprimme)
+#  define Num_dist_dots_realStart_RHqprimme CONCAT(Num_dist_dots_realStart_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Num_dist_dots_realStart_dprimme(dummy_type_dprimme *x, PRIMME_INT ldx, dummy_type_dprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_hprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_hprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1509,7 +2248,11 @@ int massMatrixMatvec_hprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_IN
 int applyPreconditioner_hprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_hprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
 int globalSum_hprimme(dummy_type_hprimme *buffer, int count, primme_context ctx);
+int globalSumStart_hprimme(dummy_type_hprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 int broadcast_hprimme(dummy_type_hprimme *buffer, int count, primme_context ctx);
+int broadcastStart_hprimme(dummy_type_hprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 int machineEpsMatrix_hprimme(double *eps, primme_context ctx);
 int machineEpsOrth_hprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_hprimme(
@@ -1520,6 +2263,9 @@ int Num_dist_dots_hprimme(dummy_type_hprimme *x, PRIMME_INT ldx, dummy_type_hpri
       PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
 int Num_dist_dots_real_hprimme(dummy_type_hprimme *x, PRIMME_INT ldx, dummy_type_hprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_hprimme(dummy_type_hprimme *x, PRIMME_INT ldx, dummy_type_hprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_kprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_kprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1529,7 +2275,11 @@ int massMatrixMatvec_kprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_IN
 int applyPreconditioner_kprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_kprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
 int globalSum_kprimme(dummy_type_kprimme *buffer, int count, primme_context ctx);
+int globalSumStart_kprimme(dummy_type_kprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 int broadcast_kprimme(dummy_type_kprimme *buffer, int count, primme_context ctx);
+int broadcastStart_kprimme(dummy_type_kprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 int machineEpsMatrix_kprimme(double *eps, primme_context ctx);
 int machineEpsOrth_kprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_kprimme(
@@ -1540,6 +2290,9 @@ int Num_dist_dots_kprimme(dummy_type_kprimme *x, PRIMME_INT ldx, dummy_type_kpri
       PRIMME_INT m, int n, dummy_type_cprimme *result, primme_context ctx);
 int Num_dist_dots_real_kprimme(dummy_type_kprimme *x, PRIMME_INT ldx, dummy_type_kprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_kprimme(dummy_type_kprimme *x, PRIMME_INT ldx, dummy_type_kprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_sprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_sprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1549,7 +2302,11 @@ int massMatrixMatvec_sprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_IN
 int applyPreconditioner_sprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_sprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
 int globalSum_sprimme(dummy_type_sprimme *buffer, int count, primme_context ctx);
+int globalSumStart_sprimme(dummy_type_sprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 int broadcast_sprimme(dummy_type_sprimme *buffer, int count, primme_context ctx);
+int broadcastStart_sprimme(dummy_type_sprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 int machineEpsMatrix_sprimme(double *eps, primme_context ctx);
 int machineEpsOrth_sprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_sprimme(
@@ -1560,6 +2317,9 @@ int Num_dist_dots_sprimme(dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type_spri
       PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
 int Num_dist_dots_real_sprimme(dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_sprimme(dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_cprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_cprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1569,7 +2329,11 @@ int massMatrixMatvec_cprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_IN
 int applyPreconditioner_cprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_cprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
 int globalSum_cprimme(dummy_type_cprimme *buffer, int count, primme_context ctx);
+int globalSumStart_cprimme(dummy_type_cprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 int broadcast_cprimme(dummy_type_cprimme *buffer, int count, primme_context ctx);
+int broadcastStart_cprimme(dummy_type_cprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 int machineEpsMatrix_cprimme(double *eps, primme_context ctx);
 int machineEpsOrth_cprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_cprimme(
@@ -1580,6 +2344,9 @@ int Num_dist_dots_cprimme(dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_cpri
       PRIMME_INT m, int n, dummy_type_cprimme *result, primme_context ctx);
 int Num_dist_dots_real_cprimme(dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_cprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_cprimme(dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_cprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_zprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_zprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1589,7 +2356,11 @@ int massMatrixMatvec_zprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_IN
 int applyPreconditioner_zprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_zprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
 int globalSum_zprimme(dummy_type_zprimme *buffer, int count, primme_context ctx);
+int globalSumStart_zprimme(dummy_type_zprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 int broadcast_zprimme(dummy_type_zprimme *buffer, int count, primme_context ctx);
+int broadcastStart_zprimme(dummy_type_zprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
 int machineEpsMatrix_zprimme(double *eps, primme_context ctx);
 int machineEpsOrth_zprimme(double *eps, primme_context ctx);
 dummy_type_dprimme problemNorm_zprimme(
@@ -1600,6 +2371,63 @@ int Num_dist_dots_zprimme(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_zpri
       PRIMME_INT m, int n, dummy_type_zprimme *result, primme_context ctx);
 int Num_dist_dots_real_zprimme(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_zprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_zprimme(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_zprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_reduction *r,
+      primme_context ctx);
+int matrixMatvec_dh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dh_sprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_dh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_dh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dh_sprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int globalSum_dh_sprimme(dummy_type_dh_sprimme *buffer, int count, primme_context ctx);
+int globalSumStart_dh_sprimme(dummy_type_dh_sprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
+int broadcast_dh_sprimme(dummy_type_dh_sprimme *buffer, int count, primme_context ctx);
+int broadcastStart_dh_sprimme(dummy_type_dh_sprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
+int machineEpsMatrix_dh_sprimme(double *eps, primme_context ctx);
+int machineEpsOrth_dh_sprimme(double *eps, primme_context ctx);
+dummy_type_dprimme problemNorm_dh_sprimme(
+      int overrideUserEstimations, struct primme_params *primme);
+dummy_type_dprimme deltaEig_dh_sprimme(
+      int overrideUserEstimations, primme_context ctx);
+int Num_dist_dots_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT ldx, dummy_type_dh_sprimme *y, PRIMME_INT ldy,
+      PRIMME_INT m, int n, dummy_type_dprimme *result, primme_context ctx);
+int Num_dist_dots_real_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT ldx, dummy_type_dh_sprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT ldx, dummy_type_dh_sprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_reduction *r,
+      primme_context ctx);
+int matrixMatvec_dh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dh_cprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_dh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_dh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dh_cprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int globalSum_dh_cprimme(dummy_type_dh_cprimme *buffer, int count, primme_context ctx);
+int globalSumStart_dh_cprimme(dummy_type_dh_cprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
+int broadcast_dh_cprimme(dummy_type_dh_cprimme *buffer, int count, primme_context ctx);
+int broadcastStart_dh_cprimme(dummy_type_dh_cprimme *buffer, int count, primme_reduction *r,
+      primme_context ctx);
+int machineEpsMatrix_dh_cprimme(double *eps, primme_context ctx);
+int machineEpsOrth_dh_cprimme(double *eps, primme_context ctx);
+dummy_type_dprimme problemNorm_dh_cprimme(
+      int overrideUserEstimations, struct primme_params *primme);
+dummy_type_dprimme deltaEig_dh_cprimme(
+      int overrideUserEstimations, primme_context ctx);
+int Num_dist_dots_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT ldx, dummy_type_dh_cprimme *y, PRIMME_INT ldy,
+      PRIMME_INT m, int n, dummy_type_zprimme *result, primme_context ctx);
+int Num_dist_dots_real_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT ldx, dummy_type_dh_cprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT ldx, dummy_type_dh_cprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_hprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1618,6 +2446,9 @@ int Num_dist_dots_magma_hprimme(dummy_type_magma_hprimme *x, PRIMME_INT ldx, dum
       PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
 int Num_dist_dots_real_magma_hprimme(dummy_type_magma_hprimme *x, PRIMME_INT ldx, dummy_type_magma_hprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_magma_hprimme(dummy_type_magma_hprimme *x, PRIMME_INT ldx, dummy_type_magma_hprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_kprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1636,6 +2467,9 @@ int Num_dist_dots_magma_kprimme(dummy_type_magma_kprimme *x, PRIMME_INT ldx, dum
       PRIMME_INT m, int n, dummy_type_cprimme *result, primme_context ctx);
 int Num_dist_dots_real_magma_kprimme(dummy_type_magma_kprimme *x, PRIMME_INT ldx, dummy_type_magma_kprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_magma_kprimme(dummy_type_magma_kprimme *x, PRIMME_INT ldx, dummy_type_magma_kprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_sprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1654,6 +2488,9 @@ int Num_dist_dots_magma_sprimme(dummy_type_magma_sprimme *x, PRIMME_INT ldx, dum
       PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
 int Num_dist_dots_real_magma_sprimme(dummy_type_magma_sprimme *x, PRIMME_INT ldx, dummy_type_magma_sprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_magma_sprimme(dummy_type_magma_sprimme *x, PRIMME_INT ldx, dummy_type_magma_sprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_cprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1672,6 +2509,9 @@ int Num_dist_dots_magma_cprimme(dummy_type_magma_cprimme *x, PRIMME_INT ldx, dum
       PRIMME_INT m, int n, dummy_type_cprimme *result, primme_context ctx);
 int Num_dist_dots_real_magma_cprimme(dummy_type_magma_cprimme *x, PRIMME_INT ldx, dummy_type_magma_cprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_magma_cprimme(dummy_type_magma_cprimme *x, PRIMME_INT ldx, dummy_type_magma_cprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_sprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_dprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1690,6 +2530,9 @@ int Num_dist_dots_magma_dprimme(dummy_type_magma_dprimme *x, PRIMME_INT ldx, dum
       PRIMME_INT m, int n, dummy_type_dprimme *result, primme_context ctx);
 int Num_dist_dots_real_magma_dprimme(dummy_type_magma_dprimme *x, PRIMME_INT ldx, dummy_type_magma_dprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_magma_dprimme(dummy_type_magma_dprimme *x, PRIMME_INT ldx, dummy_type_magma_dprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_reduction *r,
+      primme_context ctx);
 int matrixMatvec_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_zprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
@@ -1708,4 +2551,7 @@ int Num_dist_dots_magma_zprimme(dummy_type_magma_zprimme *x, PRIMME_INT ldx, dum
       PRIMME_INT m, int n, dummy_type_zprimme *result, primme_context ctx);
 int Num_dist_dots_real_magma_zprimme(dummy_type_magma_zprimme *x, PRIMME_INT ldx, dummy_type_magma_zprimme *y,
       PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_context ctx);
+int Num_dist_dots_realStart_magma_zprimme(dummy_type_magma_zprimme *x, PRIMME_INT ldx, dummy_type_magma_zprimme *y,
+      PRIMME_INT ldy, PRIMME_INT m, int n, dummy_type_dprimme *result, primme_reduction *r,
+      primme_context ctx);
 #endif
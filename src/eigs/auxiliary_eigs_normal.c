@@ -39,6 +39,9 @@
 #endif
 
 #include <string.h> /* memset */
+#ifdef PRIMME_WITH_OPENMP
+#include <omp.h>
+#endif
 #include "common_eigs.h"
 #include "numerical.h"
 #include "template_normal.h"
@@ -98,6 +101,114 @@ int Num_compute_residuals_Sprimme(PRIMME_INT m, int n, HEVAL *eval,
    return 0;
 }
 
+/******************************************************************************
+ * Function compute_residuals_norms - This subroutine performs the next
+ *    operations in a single pass over the rows of Ax and Bx:
+ *
+ *    r = Ax - Bx*diag(eval),  rnorms += norms(r)^2
+ *
+ * PARAMETERS
+ * ---------------------------
+ * m           The number of rows of Bx, Ax and r
+ * n           The number of columns of Bx, Ax and r
+ * eval        The values to compute the residual vectors r
+ * Bx          The vectors Bx
+ * Ax          The vectors Ax
+ * r           On output r = Ax - Bx*diag(eval) (optional on CPU). It may be Ax
+ * rnorms      On output rnorms(i) += norm(r(:,i))^2 (optional)
+ *
+ ******************************************************************************/
+
+STATIC int compute_residuals_norms(PRIMME_INT m, int n, HEVAL *eval,
+      SCALAR *Bx, PRIMME_INT ldBx, SCALAR *Ax, PRIMME_INT ldAx, SCALAR *r,
+      PRIMME_INT ldr, HREAL *rnorms, primme_context ctx) {
+
+#ifdef USE_HOST
+   (void)ctx;
+   int j;
+   PRIMME_INT k;
+   for (j = 0; j < n; j++) {
+      HREAL s = 0.0;
+      if (r) {
+         for (k = 0; k < m; k++) {
+            HSCALAR rk = TO_COMPLEX(Ax[ldAx * j + k]) -
+                         eval[j] * TO_COMPLEX(Bx[ldBx * j + k]);
+            SET_COMPLEX(r[ldr * j + k], rk);
+            s += REAL_PART(CONJ(rk) * rk);
+         }
+      } else {
+         for (k = 0; k < m; k++) {
+            HSCALAR rk = TO_COMPLEX(Ax[ldAx * j + k]) -
+                         eval[j] * TO_COMPLEX(Bx[ldBx * j + k]);
+            s += REAL_PART(CONJ(rk) * rk);
+         }
+      }
+      if (rnorms) rnorms[j] += s;
+   }
+
+#else
+   int j;
+
+   assert(r);
+   CHKERR(Num_compute_residuals_Sprimme(
+         m, n, eval, Bx, ldBx, Ax, ldAx, r, ldr, ctx));
+   if (rnorms) for (j = 0; j < n; j++) {
+      rnorms[j] += REAL_PART(
+            Num_dot_Sprimme(m, &r[ldr * j], 1, &r[ldr * j], 1, ctx));
+   }
+#endif
+
+   return 0;
+}
+
+/******************************************************************************
+ * Function overlap_matrices - Return whether the memory of the first m rows of
+ *    the nx columns of x overlaps the memory of the first m rows of the ny
+ *    columns of y.
+ *
+ ******************************************************************************/
+
+STATIC int overlap_matrices(SCALAR *x, int nx, PRIMME_INT ldx, SCALAR *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m) {
+
+   if (!x || !y || nx <= 0 || ny <= 0 || m <= 0) return 0;
+   return x < y + ldy * (ny - 1) + m && y < x + ldx * (nx - 1) + m;
+}
+
+/******************************************************************************
+ * Function overlap_VWBV - Return whether the memory of the first mV rows of
+ *    the nx columns of x overlaps the memory of V, W or BV.
+ *
+ ******************************************************************************/
+
+STATIC int overlap_VWBV(SCALAR *x, int nx, PRIMME_INT ldx, SCALAR *V,
+      SCALAR *W, SCALAR *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV) {
+
+   return overlap_matrices(x, nx, ldx, V, nV, ldV, mV) ||
+          overlap_matrices(x, nx, ldx, W, nV, ldV, mV) ||
+          overlap_matrices(x, nx, ldx, BV, nV, ldV, mV);
+}
+
+/******************************************************************************
+ * Function overlap_outputs - Return whether the output k overlaps any other
+ *    of the n outputs. The output j has the first m rows of the nouts[j]
+ *    columns of outs[j] with leading dimension ldouts[j].
+ *
+ ******************************************************************************/
+
+STATIC int overlap_outputs(int k, SCALAR **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m) {
+
+   int j;
+   for (j = 0; j < n; j++) {
+      if (j != k && overlap_matrices(outs[k], nouts[k], ldouts[k], outs[j],
+                          nouts[j], ldouts[j], m)) {
+         return 1;
+      }
+   }
+   return 0;
+}
+
 /******************************************************************************
  * Function Num_update_VWXR - This subroutine performs the next operations:
  *
@@ -170,15 +281,110 @@ int Num_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV, PRIMME_INT mV,
 
    PRIMME_INT i;     /* Loop variables */
    int j;            /* Loop variables */
-   int m=min(PRIMME_BLOCK_SIZE, mV);   /* Number of rows in the cache */
-   int nXb, nXe, nYb, nYe, nBXb, nBXe, ldG0=0, ldH0=0;
-   PRIMME_INT ldX, ldY, ldBX;
-   SCALAR *X, *Y, *BX;
+   int ldG0=0, ldH0=0;
    HSCALAR *G0=NULL, *H0=NULL, *workGH = NULL;
 
-   assert(mV <= ldV && nh <= ldh && (!G || nG <= ldG) && (!H || nH <= ldH));
    assert(Rnorms == NULL || nRb >= nRe || nrb >= nre || Rnorms != rnorms);
 
+   double t0 = primme_wTimer();
+
+   int nGH = (G ? nG * nG : 0) + (H ? nH * nH : 0);
+   if (ctx.numProcs > 1) {
+      CHKERR(Num_malloc_SHprimme(nGH, &workGH, ctx));
+      if (G) {
+         G0 = workGH;
+         ldG0 = nG;
+      }
+      if (H) {
+         H0 = workGH + (G ? nG * nG : 0);
+         ldH0 = nH;
+      }
+   }
+   else {
+      G0 = G; ldG0 = ldG;
+      H0 = H; ldH0 = ldH;
+   }
+
+   CHKERR(update_VWXR_local(V, W, BV, mV, nV, ldV, h, nh, ldh, hVals,
+         X0, nX0b, nX0e, ldX0, X1, nX1b, nX1e, ldX1, X2, nX2b, nX2e, ldX2,
+         Wo, nWob, nWoe, ldWo, R, nRb, nRe, ldR, Rnorms, BX0, nBX0b, nBX0e,
+         ldBX0, BX1, nBX1b, nBX1e, ldBX1, BX2, nBX2b, nBX2e, ldBX2, rnorms,
+         nrb, nre, G0, nG, ldG0, H0, nH, ldH0, xnorms, nxb, nxe, ctx));
+
+   /* Reduce Rnorms, rnorms and xnorms, and G0 and H0. Both reductions are */
+   /* in flight together.                                                  */
+
+   if (ctx.numProcs > 1) {
+      primme_reduction r[2]; /* reductions of the norms, and G0 and H0 */
+      HREAL *tmp;
+      CHKERR(Num_malloc_RHprimme(nRe - nRb + nre - nrb + nxe - nxb, &tmp,
+            ctx));
+      j = 0;
+      if (Rnorms) for (i=nRb; i<nRe; i++) tmp[j++] = Rnorms[i-nRb];
+      if (rnorms) for (i=nrb; i<nre; i++) tmp[j++] = rnorms[i-nrb];
+      if (xnorms) for (i=nxb; i<nxe; i++) tmp[j++] = xnorms[i-nxb];
+      CHKERR(globalSumStart_RHprimme(tmp, j, &r[0], ctx));
+      CHKERRSUM(globalSumStart_SHprimme(workGH, nGH, &r[1], ctx), r, 1);
+
+      /* Sqrt the norms */
+
+      CHKERRSUM(globalSumWait_Tprimme(&r[0], ctx), &r[1], 1);
+      j = 0;
+      if (Rnorms) for (i=nRb; i<nRe; i++) Rnorms[i-nRb] = sqrt(tmp[j++]);
+      if (rnorms) for (i=nrb; i<nre; i++) rnorms[i-nrb] = sqrt(tmp[j++]);
+      if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = sqrt(tmp[j++]);
+      CHKERRSUM(Num_free_RHprimme(tmp, ctx), &r[1], 1);
+
+      /* Copy back G0 and H0 */
+
+      CHKERR(globalSumWait_Tprimme(&r[1], ctx));
+      if (G) CHKERR(Num_copy_matrix_SHprimme(G0, nG, nG, ldG0, G, ldG, ctx));
+      if (H) CHKERR(Num_copy_matrix_SHprimme(H0, nH, nH, ldH0, H, ldH, ctx));
+   }
+   else {
+      if (Rnorms) for (i=nRb; i<nRe; i++) Rnorms[i-nRb] = sqrt(Rnorms[i-nRb]);
+      if (rnorms) for (i=nrb; i<nre; i++) rnorms[i-nrb] = sqrt(rnorms[i-nrb]);
+      if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = sqrt(xnorms[i-nxb]);
+   }
+
+   CHKERR(Num_free_SHprimme(workGH, ctx));
+
+   if (ctx.primme) ctx.primme->stats.timeDense += primme_wTimer() - t0;
+
+   return 0; 
+}
+
+/******************************************************************************
+ * Function update_VWXR_local - Does the work of Num_update_VWXR on the local
+ *    rows, except that G, H, Rnorms, rnorms and xnorms are only the local
+ *    contributions: they are neither reduced among processes nor the squared
+ *    roots of the norms are taken. The rows are split among the OpenMP
+ *    threads, if there are more than one.
+ *
+ * The parameters are as in Num_update_VWXR.
+ *
+ ******************************************************************************/
+
+STATIC int update_VWXR_local(SCALAR *V, SCALAR *W, SCALAR *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, HSCALAR *h, int nh, int ldh, HEVAL *hVals,
+      SCALAR *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      SCALAR *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      SCALAR *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      SCALAR *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      SCALAR *R, int nRb, int nRe, PRIMME_INT ldR, HREAL *Rnorms,
+      SCALAR *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      SCALAR *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      SCALAR *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      HREAL *rnorms, int nrb, int nre,
+      HSCALAR *G, int nG, int ldG,
+      HSCALAR *H, int nH, int ldH,
+      HREAL *xnorms, int nxb, int nxe,
+      primme_context ctx) {
+
+   int nXb, nXe, nYb, nYe, nBXb, nBXe;
+
+   assert(mV <= ldV && nh <= ldh && (!G || nG <= ldG) && (!H || nH <= ldH));
+
    /* Figure out which columns of V*h, W*h and BV*h to compute */
 
    nXb = nYb = nBXb = INT_MAX;
@@ -214,7 +420,161 @@ int Num_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV, PRIMME_INT mV,
    assert(nYe <= nh || nYb >= nYe); /* Check dimension */
    assert(nBXe <= nh || nBXb >= nXe); /* Check dimension */
 
-   double t0 = primme_wTimer();
+   /* Compute the local contributions to G, H and the squared norms. With    */
+   /* OpenMP, every thread takes a contiguous range of PRIMME_BLOCK_SIZE row */
+   /* chunks, and the partial results are added up in a fixed order, so the */
+   /* result does not depend on the thread scheduling.                       */
+
+   int nThreads = 1;
+#if defined(PRIMME_WITH_OPENMP) && defined(USE_HOST)
+   PRIMME_INT nChunks = (mV + PRIMME_BLOCK_SIZE - 1) / PRIMME_BLOCK_SIZE;
+   if (!omp_in_parallel()) {
+      nThreads = (int)min(omp_get_max_threads(), nChunks);
+   }
+#endif
+
+   if (nThreads <= 1) {
+      CHKERR(update_VWXR_rows(V, W, BV, mV, nV, ldV, h, ldh, hVals,
+            X0, nX0b, nX0e, ldX0, X1, nX1b, nX1e, ldX1, X2, nX2b, nX2e, ldX2,
+            Wo, nWob, nWoe, ldWo, R, nRb, nRe, ldR, Rnorms, BX0, nBX0b, nBX0e,
+            ldBX0, BX1, nBX1b, nBX1e, ldBX1, BX2, nBX2b, nBX2e, ldBX2, rnorms,
+            nrb, nre, G, nG, ldG, H, nH, ldH, xnorms, nxb, nxe, nXb, nXe,
+            nYb, nYe, nBXb, nBXe, ctx));
+   }
+#if defined(PRIMME_WITH_OPENMP) && defined(USE_HOST)
+   else {
+      PRIMME_INT i;     /* Loop variables */
+      int j;            /* Loop variables */
+
+      /* Allocate the partial G, H and norms for every thread */
+
+      int nGHt = (G ? nG * nG : 0) + (H ? nH * nH : 0);
+      int nNt = (Rnorms ? nRe - nRb : 0) + (rnorms ? nre - nrb : 0) +
+                (xnorms ? nxe - nxb : 0);
+      HSCALAR *wGH;
+      HREAL *wN;
+      CHKERR(Num_malloc_SHprimme(nGHt * nThreads, &wGH, ctx));
+      CHKERR(Num_malloc_RHprimme(nNt * nThreads, &wN, ctx));
+
+      int ierr = 0;
+#pragma omp parallel num_threads(nThreads) reduction(min:ierr)
+      {
+         int t = omp_get_thread_num();
+         PRIMME_INT i0 = min(nChunks * t / nThreads * PRIMME_BLOCK_SIZE, mV);
+         PRIMME_INT i1 =
+               min(nChunks * (t + 1) / nThreads * PRIMME_BLOCK_SIZE, mV);
+         HSCALAR *Gt = G ? &wGH[nGHt * t] : NULL;
+         HSCALAR *Ht = H ? &wGH[nGHt * t + (G ? nG * nG : 0)] : NULL;
+         HREAL *Rnormst = Rnorms ? &wN[nNt * t] : NULL;
+         HREAL *rnormst =
+               rnorms ? &wN[nNt * t + (Rnorms ? nRe - nRb : 0)] : NULL;
+         HREAL *xnormst = xnorms ? &wN[nNt * (t + 1) - (nxe - nxb)] : NULL;
+
+         /* Give every thread its own memory frame and no arena; also     */
+         /* profiling and tracing are not thread safe                     */
+
+         primme_context ctxt = ctx;
+         primme_frame frame = {NULL, 0, NULL};
+         ctxt.mm = &frame;
+         ctxt.arena = NULL;
+         ctxt.trace = NULL;
+#ifdef PRIMME_PROFILE
+         ctxt.path = NULL;
+#else
+         ctxt.prof = NULL;
+#endif
+
+         ierr = update_VWXR_rows(V ? &V[i0] : NULL, W ? &W[i0] : NULL,
+               BV ? &BV[i0] : NULL, i1 - i0, nV, ldV, h, ldh, hVals,
+               X0 ? &X0[i0] : NULL, nX0b, nX0e, ldX0, X1 ? &X1[i0] : NULL,
+               nX1b, nX1e, ldX1, X2 ? &X2[i0] : NULL, nX2b, nX2e, ldX2,
+               Wo ? &Wo[i0] : NULL, nWob, nWoe, ldWo, R ? &R[i0] : NULL, nRb,
+               nRe, ldR, Rnormst, BX0 ? &BX0[i0] : NULL, nBX0b, nBX0e, ldBX0,
+               BX1 ? &BX1[i0] : NULL, nBX1b, nBX1e, ldBX1,
+               BX2 ? &BX2[i0] : NULL, nBX2b, nBX2e, ldBX2, rnormst, nrb, nre,
+               Gt, nG, nG, Ht, nH, nH, xnormst, nxb, nxe, nXb, nXe, nYb, nYe,
+               nBXb, nBXe, ctxt);
+         if (ierr) Mem_pop_clean_frame(ctxt);
+      }
+      CHKERR(ierr);
+
+      /* Add up the partial results with a binary tree */
+
+      int s, t, k;
+      for (s = 1; s < nThreads; s *= 2) {
+         for (t = 0; t + s < nThreads; t += 2 * s) {
+            for (k = 0; k < nGHt; k++) {
+               wGH[nGHt * t + k] += wGH[nGHt * (t + s) + k];
+            }
+            for (k = 0; k < nNt; k++) {
+               wN[nNt * t + k] += wN[nNt * (t + s) + k];
+            }
+         }
+      }
+
+      if (G) CHKERR(Num_copy_matrix_SHprimme(wGH, nG, nG, nG, G, ldG, ctx));
+      if (H) {
+         CHKERR(Num_copy_matrix_SHprimme(
+               &wGH[G ? nG * nG : 0], nH, nH, nH, H, ldH, ctx));
+      }
+      j = 0;
+      if (Rnorms) for (i=nRb; i<nRe; i++) Rnorms[i-nRb] = wN[j++];
+      if (rnorms) for (i=nrb; i<nre; i++) rnorms[i-nrb] = wN[j++];
+      if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = wN[j++];
+
+      CHKERR(Num_free_SHprimme(wGH, ctx));
+      CHKERR(Num_free_RHprimme(wN, ctx));
+   }
+#endif /* PRIMME_WITH_OPENMP && USE_HOST */
+
+   if (ctx.primme) ctx.primme->stats.flopsDense +=
+         mV * (nXe - nXb) * nV + mV * (nYe - nYb) * nV +
+         (BV ? mV * (nBXe - nBXb) * nV : 0) + (G ? mV * nG * nG : 0) +
+         (H ? mV * nH * nH : 0) + (xnorms ? (nxe - nxb) * mV : 0) +
+         (R ? (nRe - nRb) * mV : 0) + ((R && Rnorms) ? (nRe - nRb) * mV : 0) +
+         (R ? (nre - nrb) * mV : 0);
+
+   return 0;
+}
+
+/******************************************************************************
+ * Function update_VWXR_rows - Does the work of Num_update_VWXR on the rows of
+ *    V, W and BV given, except that G, H, Rnorms, rnorms and xnorms are only
+ *    the local contributions: they are neither reduced among processes nor
+ *    the squared roots of the norms are taken.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * nXb, nXe       Range of columns of h to compute V*h
+ * nYb, nYe       Range of columns of h to compute W*h
+ * nBXb, nBXe     Range of columns of h to compute BV*h
+ *
+ * The rest of the parameters are as in Num_update_VWXR.
+ *
+ ******************************************************************************/
+
+STATIC int update_VWXR_rows(SCALAR *V, SCALAR *W, SCALAR *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, HSCALAR *h, int ldh, HEVAL *hVals,
+      SCALAR *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      SCALAR *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      SCALAR *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      SCALAR *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      SCALAR *R, int nRb, int nRe, PRIMME_INT ldR, HREAL *Rnorms,
+      SCALAR *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      SCALAR *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      SCALAR *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      HREAL *rnorms, int nrb, int nre,
+      HSCALAR *G, int nG, int ldG,
+      HSCALAR *H, int nH, int ldH,
+      HREAL *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx) {
+
+   PRIMME_INT i;     /* Loop variables */
+   int j;            /* Loop variables */
+   int m=min(PRIMME_BLOCK_SIZE, mV);   /* Number of rows in the cache */
+   PRIMME_INT ldX, ldY, ldBX;
+   SCALAR *X, *Y, *BX;
 
    CHKERR(Num_malloc_Sprimme(m * (nXe - nXb), &X, ctx));
    CHKERR(Num_malloc_Sprimme(m * (nYe - nYb), &Y, ctx));
@@ -224,165 +584,177 @@ int Num_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV, PRIMME_INT mV,
    CHKERR(Num_zero_matrix_Sprimme(Y, m, nYe - nYb, ldY, ctx));
    CHKERR(Num_zero_matrix_Sprimme(BX, m, nBXe - nBXb, ldBX, ctx));
 
-   int nGH = (G ? nG * nG : 0) + (H ? nH * nH : 0);
-   if (ctx.numProcs > 1) {
-      CHKERR(Num_malloc_SHprimme(nGH, &workGH, ctx));
-      if (G) {
-         G0 = workGH;
-         ldG0 = nG;
-      }
-      if (H) {
-         H0 = workGH + (G ? nG * nG : 0);
-         ldH0 = nH;
-      }
-   }
-   else {
-      G0 = G; ldG0 = ldG;
-      H0 = H; ldH0 = ldH;
-   }
-
    if (Rnorms) for (i=nRb; i<nRe; i++) Rnorms[i-nRb] = 0.0;
    if (rnorms) for (i=nrb; i<nre; i++) rnorms[i-nrb] = 0.0;
-   if (G) CHKERR(Num_zero_matrix_SHprimme(G0, nG, nG, ldG0, ctx));
-   if (H) CHKERR(Num_zero_matrix_SHprimme(H0, nH, nH, ldH0, ctx));
+   if (G) CHKERR(Num_zero_matrix_SHprimme(G, nG, nG, ldG, ctx));
+   if (H) CHKERR(Num_zero_matrix_SHprimme(H, nH, nH, ldH, ctx));
    if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = 0.0;
 
+   /* Write V*h, W*h and BV*h directly on an output matrix with all the    */
+   /* needed columns if that matrix does not overlap V, W, BV or the other  */
+   /* outputs; otherwise use the work matrices X, Y and BX and copy them    */
+   /* into the outputs. The other outputs are written from the direct one, */
+   /* and R is computed from it, so they should not share memory with it   */
+
+   SCALAR *outs[8] = {X0, X1, X2, Wo, BX0, BX1, BX2, R};
+   int nouts[8] = {nX0e - nX0b, nX1e - nX1b, nX2e - nX2b, nWoe - nWob,
+         nBX0e - nBX0b, nBX1e - nBX1b, nBX2e - nBX2b, nRe - nRb};
+   PRIMME_INT ldouts[8] = {ldX0, ldX1, ldX2, ldWo, ldBX0, ldBX1, ldBX2, ldR};
+
+   SCALAR *Xo = NULL, *Yo = NULL, *BXo = NULL;
+   PRIMME_INT ldXo = 0, ldYo = 0, ldBXo = 0;
+   if (X0 && nX0b == nXb && nX0e == nXe &&
+         !overlap_VWBV(X0, nX0e - nX0b, ldX0, V, W, BV, mV, nV, ldV) &&
+         !overlap_outputs(0, outs, nouts, ldouts, 8, mV)) {
+      Xo = X0, ldXo = ldX0;
+   } else if (X1 && nX1b == nXb && nX1e == nXe &&
+         !overlap_VWBV(X1, nX1e - nX1b, ldX1, V, W, BV, mV, nV, ldV) &&
+         !overlap_outputs(1, outs, nouts, ldouts, 8, mV)) {
+      Xo = X1, ldXo = ldX1;
+   } else if (X2 && nX2b == nXb && nX2e == nXe &&
+         !overlap_VWBV(X2, nX2e - nX2b, ldX2, V, W, BV, mV, nV, ldV) &&
+         !overlap_outputs(2, outs, nouts, ldouts, 8, mV)) {
+      Xo = X2, ldXo = ldX2;
+   }
+   if (Wo && nWob == nYb && nWoe == nYe &&
+         !overlap_VWBV(Wo, nWoe - nWob, ldWo, V, W, BV, mV, nV, ldV) &&
+         !overlap_outputs(3, outs, nouts, ldouts, 8, mV)
+#ifndef USE_HOST
+         /* rnorms is computed in place on Y */
+         && !(rnorms && nrb < nre)
+#endif
+   ) {
+      Yo = Wo, ldYo = ldWo;
+   }
+   if (BX0 && nBX0b == nBXb && nBX0e == nBXe &&
+         !overlap_VWBV(BX0, nBX0e - nBX0b, ldBX0, V, W, BV, mV, nV, ldV) &&
+         !overlap_outputs(4, outs, nouts, ldouts, 8, mV)) {
+      BXo = BX0, ldBXo = ldBX0;
+   } else if (BX1 && nBX1b == nBXb && nBX1e == nBXe &&
+         !overlap_VWBV(BX1, nBX1e - nBX1b, ldBX1, V, W, BV, mV, nV, ldV) &&
+         !overlap_outputs(5, outs, nouts, ldouts, 8, mV)) {
+      BXo = BX1, ldBXo = ldBX1;
+   } else if (BX2 && nBX2b == nBXb && nBX2e == nBXe &&
+         !overlap_VWBV(BX2, nBX2e - nBX2b, ldBX2, V, W, BV, mV, nV, ldV) &&
+         !overlap_outputs(6, outs, nouts, ldouts, 8, mV)) {
+      BXo = BX2, ldBXo = ldBX2;
+   }
+
    for (i=0; i < mV; i+=m, m=min(m,mV-i)) {
+      SCALAR *Xi = Xo ? &Xo[i] : X, *Yi = Yo ? &Yo[i] : Y;
+      SCALAR *BXi = BXo ? &BXo[i] : BX;
+      PRIMME_INT ldXi = Xo ? ldXo : ldX, ldYi = Yo ? ldYo : ldY;
+      PRIMME_INT ldBXi = BXo ? ldBXo : ldBX;
+
+      /* Start reading the next rows of V, W and BV if they are on files */
+      if (i % PRIMME_PREFETCH_ROWS == 0 && i + m < mV) {
+         PRIMME_INT mn = min(PRIMME_PREFETCH_ROWS, mV - i - m);
+         CHKERR(Num_prefetch_matrix_Sprimme(&V[i + m], mn, nV, ldV, ctx));
+         if (nYb < nYe) {
+            CHKERR(Num_prefetch_matrix_Sprimme(&W[i + m], mn, nV, ldV, ctx));
+         }
+         if (BV) {
+            CHKERR(Num_prefetch_matrix_Sprimme(&BV[i + m], mn, nV, ldV, ctx));
+         }
+      }
+
       /* X = V*h(nXb:nXe-1) */
       CHKERR(Num_gemm_dhd_Sprimme("N", "N", m, nXe-nXb, nV, 1.0,
-         &V[i], ldV, &h[nXb*ldh], ldh, 0.0, X, ldX, ctx));
+         &V[i], ldV, &h[nXb*ldh], ldh, 0.0, Xi, ldXi, ctx));
 
       /* X0 = X(nX0b-nXb:nX0e-nXb-1) */
-      if (X0)
-         CHKERR(Num_copy_matrix_Sprimme(
-               &X[ldX * (nX0b - nXb)], m, nX0e - nX0b, ldX, &X0[i], ldX0, ctx));
+      if (X0 && X0 != Xo)
+         CHKERR(Num_copy_matrix_Sprimme(&Xi[ldXi * (nX0b - nXb)], m,
+               nX0e - nX0b, ldXi, &X0[i], ldX0, ctx));
 
       /* X1 = X(nX1b-nXb:nX1e-nXb-1) */
-      if (X1) CHKERR(Num_copy_matrix_Sprimme(&X[ldX*(nX1b-nXb)], m, nX1e-nX1b,
-            ldX, &X1[i], ldX1, ctx));
+      if (X1 && X1 != Xo)
+         CHKERR(Num_copy_matrix_Sprimme(&Xi[ldXi * (nX1b - nXb)], m,
+               nX1e - nX1b, ldXi, &X1[i], ldX1, ctx));
 
       /* X2 = X(nX2b-nXb:nX2e-nXb-1) */
-      if (X2) CHKERR(Num_copy_matrix_Sprimme(&X[ldX*(nX2b-nXb)], m, nX2e-nX2b,
-            ldX, &X2[i], ldX2, ctx));
+      if (X2 && X2 != Xo)
+         CHKERR(Num_copy_matrix_Sprimme(&Xi[ldXi * (nX2b - nXb)], m,
+               nX2e - nX2b, ldXi, &X2[i], ldX2, ctx));
 
       /* Y = W*h(nYb:nYe-1) */
       if (nYb < nYe) CHKERR(Num_gemm_dhd_Sprimme("N", "N", m, nYe-nYb, nV,
-            1.0, &W[i], ldV, &h[nYb*ldh], ldh, 0.0, Y, ldY, ctx));
+            1.0, &W[i], ldV, &h[nYb*ldh], ldh, 0.0, Yi, ldYi, ctx));
 
       /* Wo = Y(nWob-nYb:nWoe-nYb-1) */
-      if (Wo) CHKERR(Num_copy_matrix_Sprimme(&Y[ldY*(nWob-nYb)], m, nWoe-nWob,
-            ldY, &Wo[i], ldWo, ctx));
+      if (Wo && Wo != Yo)
+         CHKERR(Num_copy_matrix_Sprimme(&Yi[ldYi * (nWob - nYb)], m,
+               nWoe - nWob, ldYi, &Wo[i], ldWo, ctx));
 
       /* BX = BV*h(nBXb:nBXe-1) */
 
       if (BV) CHKERR(Num_gemm_dhd_Sprimme("N", "N", m, nBXe-nBXb, nV, 1.0,
-         &BV[i], ldV, &h[nBXb*ldh], ldh, 0.0, BX, ldBX, ctx));
+         &BV[i], ldV, &h[nBXb*ldh], ldh, 0.0, BXi, ldBXi, ctx));
 
       /* BX0 = BX(nX0b-nXb:nX0e-nXb-1) */
-      if (BX0)
-         CHKERR(Num_copy_matrix_Sprimme(&BX[ldBX * (nBX0b - nBXb)], m,
-               nBX0e - nBX0b, ldBX, &BX0[i], ldBX0, ctx));
+      if (BX0 && BX0 != BXo)
+         CHKERR(Num_copy_matrix_Sprimme(&BXi[ldBXi * (nBX0b - nBXb)], m,
+               nBX0e - nBX0b, ldBXi, &BX0[i], ldBX0, ctx));
 
       /* BX1 = BX(nBX1b-nBXb:nBX1e-nBXb-1) */
-      if (BX1) CHKERR(Num_copy_matrix_Sprimme(&BX[ldBX*(nBX1b-nBXb)], m, nBX1e-nBX1b,
-            ldBX, &BX1[i], ldBX1, ctx));
+      if (BX1 && BX1 != BXo)
+         CHKERR(Num_copy_matrix_Sprimme(&BXi[ldBXi * (nBX1b - nBXb)], m,
+               nBX1e - nBX1b, ldBXi, &BX1[i], ldBX1, ctx));
 
       /* BX2 = BX(nBX2b-nBXb:nBX2e-nBXb-1) */
-      if (BX2) CHKERR(Num_copy_matrix_Sprimme(&BX[ldBX*(nBX2b-nBXb)], m, nBX2e-nBX2b,
-            ldBX, &BX2[i], ldBX2, ctx));
+      if (BX2 && BX2 != BXo)
+         CHKERR(Num_copy_matrix_Sprimme(&BXi[ldBXi * (nBX2b - nBXb)], m,
+               nBX2e - nBX2b, ldBXi, &BX2[i], ldBX2, ctx));
 
       /* G += X(:,0:nG-1)'*X(:,0:nG-1) */
 
       if (G) {
-         CHKERR(Num_compute_gramm_ddh_Sprimme(X, m, nG, ldX, BV ? BX : X, ldX,
-               i == 0 ? 0.0 : 1.0, G0, ldG0, 1 /* symmetric */, ctx));
+         CHKERR(Num_compute_gramm_ddh_Sprimme(Xi, m, nG, ldXi,
+               BV ? BXi : Xi, BV ? ldBXi : ldXi, i == 0 ? 0.0 : 1.0, G, ldG,
+               1 /* symmetric */, ctx));
       }
 
       /* H = X(:,0:nH-1)'*Y(:,0:nH-1) */
 
       if (H) {
-         CHKERR(Num_compute_gramm_ddh_Sprimme(X, m, nH, ldX, Y, ldY,
-               i == 0 ? 0.0 : 1.0, H0, ldH0,
+         CHKERR(Num_compute_gramm_ddh_Sprimme(Xi, m, nH, ldXi, Yi, ldYi,
+               i == 0 ? 0.0 : 1.0, H, ldH,
                KIND(1 /*symmetric*/, 0 /*not symmetric*/), ctx));
       }
 
       /* xnorms = norm(X(nxb-nXb:nxe-nXb-1)) */
       if (xnorms) for (j=nxb; j<nxe; j++) {
-            xnorms[j - nxb] += REAL_PART(Num_dot_Sprimme(
-                  m, &X[ldX * (j - nXb)], 1, &X[ldX * (j - nXb)], 1, ctx));
+            xnorms[j - nxb] += REAL_PART(Num_dot_Sprimme(m,
+                  &Xi[ldXi * (j - nXb)], 1, &Xi[ldXi * (j - nXb)], 1, ctx));
       }
 
       /* R = Y(nRb-nYb:nRe-nYb-1) - BX(nRb-nYb:nRe-nYb-1)*diag(nRb:nRe-1) */
+      /* Rnorms = norms(R)^2                                              */
       if (R) {
-         CHKERR(Num_compute_residuals_Sprimme(m, nRe - nRb, &hVals[nRb],
-               BV ? &BX[ldBX * (nRb - nBXb)] : &X[ldX * (nRb - nXb)],
-               BV ? ldBX : ldX, &Y[ldY * (nRb - nYb)], ldY, &R[i], ldR, ctx));
-         if (Rnorms) {
-            for (j = nRb; j < nRe; j++) {
-               Rnorms[j - nRb] +=
-                     REAL_PART(Num_dot_Sprimme(m, &R[i + ldR * (j - nRb)], 1,
-                           &R[i + ldR * (j - nRb)], 1, ctx));
-            }
-         }
+         CHKERR(compute_residuals_norms(m, nRe - nRb, &hVals[nRb],
+               BV ? &BXi[ldBXi * (nRb - nBXb)] : &Xi[ldXi * (nRb - nXb)],
+               BV ? ldBXi : ldXi, &Yi[ldYi * (nRb - nYb)], ldYi, &R[i], ldR,
+               Rnorms, ctx));
       }
 
-      /* rnorms = Y(nrb-nYb:nre-nYb-1) - BX(nrb-nYb:nre-nYb-1)*diag(nrb:nre-1) */
-      if (rnorms)  {
-         CHKERR(Num_compute_residuals_Sprimme(m, nre - nrb, &hVals[nrb],
-               BV ? &BX[ldBX * (nrb - nBXb)] : &X[ldX * (nrb - nXb)],
-               BV ? ldBX : ldX, &Y[ldY * (nrb - nYb)], ldY,
-               &Y[ldY * (nrb - nYb)], ldY, ctx));
-         for (j = nrb; j < nre; j++) {
-            rnorms[j - nrb] += REAL_PART(Num_dot_Sprimme(
-                  m, &Y[ldY * (j - nYb)], 1, &Y[ldY * (j - nYb)], 1, ctx));
-         }
+      /* rnorms = norms(Y(nrb-nYb:nre-nYb-1) -                            */
+      /*                BX(nrb-nYb:nre-nYb-1)*diag(nrb:nre-1))^2          */
+      /* NOTE: the residual vectors are not stored on CPU; on GPU they    */
+      /*       overwrite Y                                                */
+      if (rnorms && nrb < nre) {
+         CHKERR(compute_residuals_norms(m, nre - nrb, &hVals[nrb],
+               BV ? &BXi[ldBXi * (nrb - nBXb)] : &Xi[ldXi * (nrb - nXb)],
+               BV ? ldBXi : ldXi, &Yi[ldYi * (nrb - nYb)], ldYi,
+               IMPL(NULL, &Yi[ldYi * (nrb - nYb)]), IMPL(0, ldYi), rnorms,
+               ctx));
       }
    }
 
-   /* Reduce and copy back G0 and H0 */
-
-   if (ctx.numProcs > 1) {
-      CHKERR(globalSum_SHprimme(workGH, nGH, ctx));
-   }
-   if (G) CHKERR(Num_copy_matrix_SHprimme(G0, nG, nG, ldG0, G, ldG, ctx));
-   if (H) CHKERR(Num_copy_matrix_SHprimme(H0, nH, nH, ldH0, H, ldH, ctx));
-
-   /* Reduce Rnorms, rnorms and xnorms and sqrt the results */
-
-   if (ctx.numProcs > 1) {
-      HREAL *tmp;
-      CHKERR(Num_malloc_RHprimme(nRe - nRb + nre - nrb + nxe - nxb, &tmp, ctx));
-      j = 0;
-      if (Rnorms) for (i=nRb; i<nRe; i++) tmp[j++] = Rnorms[i-nRb];
-      if (rnorms) for (i=nrb; i<nre; i++) tmp[j++] = rnorms[i-nrb];
-      if (xnorms) for (i=nxb; i<nxe; i++) tmp[j++] = xnorms[i-nxb];
-      if (j) CHKERR(globalSum_RHprimme(tmp, j, ctx));
-      j = 0;
-      if (Rnorms) for (i=nRb; i<nRe; i++) Rnorms[i-nRb] = sqrt(tmp[j++]);
-      if (rnorms) for (i=nrb; i<nre; i++) rnorms[i-nrb] = sqrt(tmp[j++]);
-      if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = sqrt(tmp[j++]);
-      CHKERR(Num_free_RHprimme(tmp, ctx));
-   }
-   else {
-      if (Rnorms) for (i=nRb; i<nRe; i++) Rnorms[i-nRb] = sqrt(Rnorms[i-nRb]);
-      if (rnorms) for (i=nrb; i<nre; i++) rnorms[i-nrb] = sqrt(rnorms[i-nrb]);
-      if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = sqrt(xnorms[i-nxb]);
-   }
-
    CHKERR(Num_free_Sprimme(X, ctx));
    CHKERR(Num_free_Sprimme(Y, ctx));
    CHKERR(Num_free_Sprimme(BX, ctx));
-   CHKERR(Num_free_SHprimme(workGH, ctx));
 
-   if (ctx.primme) ctx.primme->stats.timeDense += primme_wTimer() - t0;
-   ctx.primme->stats.flopsDense +=
-         mV * (nXe - nXb) * nV + mV * (nYe - nYb) * nV +
-         (BV ? mV * (nBXe - nBXb) * nV : 0) + (G ? mV * nG * nG : 0) +
-         (H ? mV * nH * nH : 0) + (xnorms ? (nxe - nxb) * mV : 0) +
-         (R ? (nRe - nRb) * mV : 0) + ((R && Rnorms) ? (nRe - nRb) * mV : 0) +
-         (R ? (nre - nrb) * mV : 0);
-
-   return 0; 
+   return 0;
 }
 
 /*******************************************************************************
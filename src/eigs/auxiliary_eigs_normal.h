@@ -126,6 +126,27 @@
 int Num_compute_residuals_dprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
       dummy_type_dprimme *Bx, PRIMME_INT ldBx, dummy_type_dprimme *Ax, PRIMME_INT ldAx, dummy_type_dprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(compute_residuals_norms)
+#  define compute_residuals_norms CONCAT(compute_residuals_norms,WITH_KIND(SCALAR_SUF))
+#endif
+int compute_residuals_normsdprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
+      dummy_type_dprimme *Bx, PRIMME_INT ldBx, dummy_type_dprimme *Ax, PRIMME_INT ldAx, dummy_type_dprimme *r,
+      PRIMME_INT ldr, dummy_type_dprimme *rnorms, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(overlap_matrices)
+#  define overlap_matrices CONCAT(overlap_matrices,WITH_KIND(SCALAR_SUF))
+#endif
+int overlap_matricesdprimme(dummy_type_dprimme *x, int nx, PRIMME_INT ldx, dummy_type_dprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+#if !defined(CHECK_TEMPLATE) && !defined(overlap_VWBV)
+#  define overlap_VWBV CONCAT(overlap_VWBV,WITH_KIND(SCALAR_SUF))
+#endif
+int overlap_VWBVdprimme(dummy_type_dprimme *x, int nx, PRIMME_INT ldx, dummy_type_dprimme *V,
+      dummy_type_dprimme *W, dummy_type_dprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+#if !defined(CHECK_TEMPLATE) && !defined(overlap_outputs)
+#  define overlap_outputs CONCAT(overlap_outputs,WITH_KIND(SCALAR_SUF))
+#endif
+int overlap_outputsdprimme(int k, dummy_type_dprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 #if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_Sprimme)
 #  define Num_update_VWXR_Sprimme CONCAT(Num_update_VWXR_,WITH_KIND(SCALAR_SUF))
 #endif
@@ -231,6 +252,43 @@ int Num_update_VWXR_dprimme(dummy_type_dprimme *V, dummy_type_dprimme *W, dummy_
       dummy_type_dprimme *H, int nH, int ldH,
       dummy_type_dprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_VWXR_local)
+#  define update_VWXR_local CONCAT(update_VWXR_local,WITH_KIND(SCALAR_SUF))
+#endif
+int update_VWXR_localdprimme(dummy_type_dprimme *V, dummy_type_dprimme *W, dummy_type_dprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_dprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_dprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_dprimme *G, int nG, int ldG,
+      dummy_type_dprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_VWXR_rows)
+#  define update_VWXR_rows CONCAT(update_VWXR_rows,WITH_KIND(SCALAR_SUF))
+#endif
+int update_VWXR_rowsdprimme(dummy_type_dprimme *V, dummy_type_dprimme *W, dummy_type_dprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_dprimme *h, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_dprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_dprimme *G, int nG, int ldG,
+      dummy_type_dprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(convTestFun_Sprimme)
 #  define convTestFun_Sprimme CONCAT(convTestFun_,WITH_KIND(SCALAR_SUF))
 #endif
@@ -514,6 +572,15 @@ int insertionSort_dprimme(dummy_type_dprimme newVal, dummy_type_dprimme *evals,
 int Num_compute_residuals_hprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
       dummy_type_hprimme *Bx, PRIMME_INT ldBx, dummy_type_hprimme *Ax, PRIMME_INT ldAx, dummy_type_hprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normshprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
+      dummy_type_hprimme *Bx, PRIMME_INT ldBx, dummy_type_hprimme *Ax, PRIMME_INT ldAx, dummy_type_hprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matriceshprimme(dummy_type_hprimme *x, int nx, PRIMME_INT ldx, dummy_type_hprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVhprimme(dummy_type_hprimme *x, int nx, PRIMME_INT ldx, dummy_type_hprimme *V,
+      dummy_type_hprimme *W, dummy_type_hprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputshprimme(int k, dummy_type_hprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_hprimme(dummy_type_hprimme *V, dummy_type_hprimme *W, dummy_type_hprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
       dummy_type_hprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -529,6 +596,37 @@ int Num_update_VWXR_hprimme(dummy_type_hprimme *V, dummy_type_hprimme *W, dummy_
       dummy_type_sprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localhprimme(dummy_type_hprimme *V, dummy_type_hprimme *W, dummy_type_hprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_hprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_hprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_hprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_hprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_hprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_hprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_hprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_hprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_sprimme *G, int nG, int ldG,
+      dummy_type_sprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowshprimme(dummy_type_hprimme *V, dummy_type_hprimme *W, dummy_type_hprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_hprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_hprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_hprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_hprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_hprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_hprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_hprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_hprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_sprimme *G, int nG, int ldG,
+      dummy_type_sprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_hprimme(dummy_type_sprimme eval, dummy_type_hprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_hprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basisFlags,
@@ -542,6 +640,15 @@ int insertionSort_hprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
 int Num_compute_residuals_kprimme_normal(PRIMME_INT m, int n, dummy_type_cprimme *eval,
       dummy_type_kprimme *Bx, PRIMME_INT ldBx, dummy_type_kprimme *Ax, PRIMME_INT ldAx, dummy_type_kprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normskprimme_normal(PRIMME_INT m, int n, dummy_type_cprimme *eval,
+      dummy_type_kprimme *Bx, PRIMME_INT ldBx, dummy_type_kprimme *Ax, PRIMME_INT ldAx, dummy_type_kprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matriceskprimme_normal(dummy_type_kprimme *x, int nx, PRIMME_INT ldx, dummy_type_kprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVkprimme_normal(dummy_type_kprimme *x, int nx, PRIMME_INT ldx, dummy_type_kprimme *V,
+      dummy_type_kprimme *W, dummy_type_kprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputskprimme_normal(int k, dummy_type_kprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_kprimme_normal(dummy_type_kprimme *V, dummy_type_kprimme *W, dummy_type_kprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_cprimme *hVals,
       dummy_type_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -557,6 +664,37 @@ int Num_update_VWXR_kprimme_normal(dummy_type_kprimme *V, dummy_type_kprimme *W,
       dummy_type_cprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localkprimme_normal(dummy_type_kprimme *V, dummy_type_kprimme *W, dummy_type_kprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_cprimme *hVals,
+      dummy_type_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_kprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_kprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_kprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_kprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_kprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_kprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_kprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowskprimme_normal(dummy_type_kprimme *V, dummy_type_kprimme *W, dummy_type_kprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int ldh, dummy_type_cprimme *hVals,
+      dummy_type_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_kprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_kprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_kprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_kprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_kprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_kprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_kprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_kprimme_normal(dummy_type_cprimme eval, dummy_type_kprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_kprimme_normal(dummy_type_cprimme *basisEvals, int basisSize, int *basisFlags,
@@ -570,6 +708,15 @@ int insertionSort_kprimme_normal(dummy_type_cprimme newVal, dummy_type_cprimme *
 int Num_compute_residuals_kprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
       dummy_type_kprimme *Bx, PRIMME_INT ldBx, dummy_type_kprimme *Ax, PRIMME_INT ldAx, dummy_type_kprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normskprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
+      dummy_type_kprimme *Bx, PRIMME_INT ldBx, dummy_type_kprimme *Ax, PRIMME_INT ldAx, dummy_type_kprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matriceskprimme(dummy_type_kprimme *x, int nx, PRIMME_INT ldx, dummy_type_kprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVkprimme(dummy_type_kprimme *x, int nx, PRIMME_INT ldx, dummy_type_kprimme *V,
+      dummy_type_kprimme *W, dummy_type_kprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputskprimme(int k, dummy_type_kprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_kprimme(dummy_type_kprimme *V, dummy_type_kprimme *W, dummy_type_kprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
       dummy_type_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -585,6 +732,37 @@ int Num_update_VWXR_kprimme(dummy_type_kprimme *V, dummy_type_kprimme *W, dummy_
       dummy_type_cprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localkprimme(dummy_type_kprimme *V, dummy_type_kprimme *W, dummy_type_kprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_kprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_kprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_kprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_kprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_kprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_kprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_kprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowskprimme(dummy_type_kprimme *V, dummy_type_kprimme *W, dummy_type_kprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_kprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_kprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_kprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_kprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_kprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_kprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_kprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_kprimme(dummy_type_sprimme eval, dummy_type_kprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_kprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basisFlags,
@@ -598,6 +776,15 @@ int insertionSort_kprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
 int Num_compute_residuals_sprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
       dummy_type_sprimme *Bx, PRIMME_INT ldBx, dummy_type_sprimme *Ax, PRIMME_INT ldAx, dummy_type_sprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normssprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
+      dummy_type_sprimme *Bx, PRIMME_INT ldBx, dummy_type_sprimme *Ax, PRIMME_INT ldAx, dummy_type_sprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matricessprimme(dummy_type_sprimme *x, int nx, PRIMME_INT ldx, dummy_type_sprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVsprimme(dummy_type_sprimme *x, int nx, PRIMME_INT ldx, dummy_type_sprimme *V,
+      dummy_type_sprimme *W, dummy_type_sprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputssprimme(int k, dummy_type_sprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_sprimme(dummy_type_sprimme *V, dummy_type_sprimme *W, dummy_type_sprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
       dummy_type_sprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -613,6 +800,37 @@ int Num_update_VWXR_sprimme(dummy_type_sprimme *V, dummy_type_sprimme *W, dummy_
       dummy_type_sprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localsprimme(dummy_type_sprimme *V, dummy_type_sprimme *W, dummy_type_sprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_sprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_sprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_sprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_sprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_sprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_sprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_sprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_sprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_sprimme *G, int nG, int ldG,
+      dummy_type_sprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowssprimme(dummy_type_sprimme *V, dummy_type_sprimme *W, dummy_type_sprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_sprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_sprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_sprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_sprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_sprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_sprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_sprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_sprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_sprimme *G, int nG, int ldG,
+      dummy_type_sprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_sprimme(dummy_type_sprimme eval, dummy_type_sprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_sprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basisFlags,
@@ -626,6 +844,15 @@ int insertionSort_sprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
 int Num_compute_residuals_cprimme_normal(PRIMME_INT m, int n, dummy_type_cprimme *eval,
       dummy_type_cprimme *Bx, PRIMME_INT ldBx, dummy_type_cprimme *Ax, PRIMME_INT ldAx, dummy_type_cprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normscprimme_normal(PRIMME_INT m, int n, dummy_type_cprimme *eval,
+      dummy_type_cprimme *Bx, PRIMME_INT ldBx, dummy_type_cprimme *Ax, PRIMME_INT ldAx, dummy_type_cprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matricescprimme_normal(dummy_type_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_cprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVcprimme_normal(dummy_type_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_cprimme *V,
+      dummy_type_cprimme *W, dummy_type_cprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputscprimme_normal(int k, dummy_type_cprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_cprimme_normal(dummy_type_cprimme *V, dummy_type_cprimme *W, dummy_type_cprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_cprimme *hVals,
       dummy_type_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -641,6 +868,37 @@ int Num_update_VWXR_cprimme_normal(dummy_type_cprimme *V, dummy_type_cprimme *W,
       dummy_type_cprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localcprimme_normal(dummy_type_cprimme *V, dummy_type_cprimme *W, dummy_type_cprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_cprimme *hVals,
+      dummy_type_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowscprimme_normal(dummy_type_cprimme *V, dummy_type_cprimme *W, dummy_type_cprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int ldh, dummy_type_cprimme *hVals,
+      dummy_type_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_cprimme_normal(dummy_type_cprimme eval, dummy_type_cprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_cprimme_normal(dummy_type_cprimme *basisEvals, int basisSize, int *basisFlags,
@@ -654,6 +912,15 @@ int insertionSort_cprimme_normal(dummy_type_cprimme newVal, dummy_type_cprimme *
 int Num_compute_residuals_cprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
       dummy_type_cprimme *Bx, PRIMME_INT ldBx, dummy_type_cprimme *Ax, PRIMME_INT ldAx, dummy_type_cprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normscprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
+      dummy_type_cprimme *Bx, PRIMME_INT ldBx, dummy_type_cprimme *Ax, PRIMME_INT ldAx, dummy_type_cprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matricescprimme(dummy_type_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_cprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVcprimme(dummy_type_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_cprimme *V,
+      dummy_type_cprimme *W, dummy_type_cprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputscprimme(int k, dummy_type_cprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_cprimme(dummy_type_cprimme *V, dummy_type_cprimme *W, dummy_type_cprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
       dummy_type_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -669,6 +936,37 @@ int Num_update_VWXR_cprimme(dummy_type_cprimme *V, dummy_type_cprimme *W, dummy_
       dummy_type_cprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localcprimme(dummy_type_cprimme *V, dummy_type_cprimme *W, dummy_type_cprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowscprimme(dummy_type_cprimme *V, dummy_type_cprimme *W, dummy_type_cprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_cprimme(dummy_type_sprimme eval, dummy_type_cprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_cprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basisFlags,
@@ -682,6 +980,15 @@ int insertionSort_cprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
 int Num_compute_residuals_zprimme_normal(PRIMME_INT m, int n, dummy_type_zprimme *eval,
       dummy_type_zprimme *Bx, PRIMME_INT ldBx, dummy_type_zprimme *Ax, PRIMME_INT ldAx, dummy_type_zprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normszprimme_normal(PRIMME_INT m, int n, dummy_type_zprimme *eval,
+      dummy_type_zprimme *Bx, PRIMME_INT ldBx, dummy_type_zprimme *Ax, PRIMME_INT ldAx, dummy_type_zprimme *r,
+      PRIMME_INT ldr, dummy_type_dprimme *rnorms, primme_context ctx);
+int overlap_matriceszprimme_normal(dummy_type_zprimme *x, int nx, PRIMME_INT ldx, dummy_type_zprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVzprimme_normal(dummy_type_zprimme *x, int nx, PRIMME_INT ldx, dummy_type_zprimme *V,
+      dummy_type_zprimme *W, dummy_type_zprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputszprimme_normal(int k, dummy_type_zprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_zprimme_normal(dummy_type_zprimme *V, dummy_type_zprimme *W, dummy_type_zprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_zprimme *hVals,
       dummy_type_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -697,6 +1004,37 @@ int Num_update_VWXR_zprimme_normal(dummy_type_zprimme *V, dummy_type_zprimme *W,
       dummy_type_zprimme *H, int nH, int ldH,
       dummy_type_dprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localzprimme_normal(dummy_type_zprimme *V, dummy_type_zprimme *W, dummy_type_zprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_zprimme *hVals,
+      dummy_type_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_zprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_zprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_zprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_zprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_zprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_zprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_zprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowszprimme_normal(dummy_type_zprimme *V, dummy_type_zprimme *W, dummy_type_zprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int ldh, dummy_type_zprimme *hVals,
+      dummy_type_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_zprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_zprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_zprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_zprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_zprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_zprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_zprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_zprimme_normal(dummy_type_zprimme eval, dummy_type_zprimme *evec, int givenEvec, dummy_type_dprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_zprimme_normal(dummy_type_zprimme *basisEvals, int basisSize, int *basisFlags,
@@ -710,6 +1048,15 @@ int insertionSort_zprimme_normal(dummy_type_zprimme newVal, dummy_type_zprimme *
 int Num_compute_residuals_zprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
       dummy_type_zprimme *Bx, PRIMME_INT ldBx, dummy_type_zprimme *Ax, PRIMME_INT ldAx, dummy_type_zprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normszprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
+      dummy_type_zprimme *Bx, PRIMME_INT ldBx, dummy_type_zprimme *Ax, PRIMME_INT ldAx, dummy_type_zprimme *r,
+      PRIMME_INT ldr, dummy_type_dprimme *rnorms, primme_context ctx);
+int overlap_matriceszprimme(dummy_type_zprimme *x, int nx, PRIMME_INT ldx, dummy_type_zprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVzprimme(dummy_type_zprimme *x, int nx, PRIMME_INT ldx, dummy_type_zprimme *V,
+      dummy_type_zprimme *W, dummy_type_zprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputszprimme(int k, dummy_type_zprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_zprimme(dummy_type_zprimme *V, dummy_type_zprimme *W, dummy_type_zprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
       dummy_type_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -725,6 +1072,37 @@ int Num_update_VWXR_zprimme(dummy_type_zprimme *V, dummy_type_zprimme *W, dummy_
       dummy_type_zprimme *H, int nH, int ldH,
       dummy_type_dprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localzprimme(dummy_type_zprimme *V, dummy_type_zprimme *W, dummy_type_zprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_zprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_zprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_zprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_zprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_zprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_zprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_zprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowszprimme(dummy_type_zprimme *V, dummy_type_zprimme *W, dummy_type_zprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_zprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_zprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_zprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_zprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_zprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_zprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_zprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_zprimme(dummy_type_dprimme eval, dummy_type_zprimme *evec, int givenEvec, dummy_type_dprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_zprimme(dummy_type_dprimme *basisEvals, int basisSize, int *basisFlags,
@@ -735,9 +1113,222 @@ int monitorFun_zprimme(dummy_type_dprimme *basisEvals, int basisSize, int *basis
 int insertionSort_zprimme(dummy_type_dprimme newVal, dummy_type_dprimme *evals,
       dummy_type_dprimme newNorm, dummy_type_dprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
-int Num_compute_residuals_magma_hprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
+int Num_compute_residuals_dh_sprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
+      dummy_type_dh_sprimme *Bx, PRIMME_INT ldBx, dummy_type_dh_sprimme *Ax, PRIMME_INT ldAx, dummy_type_dh_sprimme *r,
+      PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsdh_sprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
+      dummy_type_dh_sprimme *Bx, PRIMME_INT ldBx, dummy_type_dh_sprimme *Ax, PRIMME_INT ldAx, dummy_type_dh_sprimme *r,
+      PRIMME_INT ldr, dummy_type_dprimme *rnorms, primme_context ctx);
+int overlap_matricesdh_sprimme(dummy_type_dh_sprimme *x, int nx, PRIMME_INT ldx, dummy_type_dh_sprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVdh_sprimme(dummy_type_dh_sprimme *x, int nx, PRIMME_INT ldx, dummy_type_dh_sprimme *V,
+      dummy_type_dh_sprimme *W, dummy_type_dh_sprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsdh_sprimme(int k, dummy_type_dh_sprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
+int Num_update_VWXR_dh_sprimme(dummy_type_dh_sprimme *V, dummy_type_dh_sprimme *W, dummy_type_dh_sprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_dprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_dh_sprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dh_sprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dh_sprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dh_sprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dh_sprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dh_sprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dh_sprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dh_sprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_dprimme *G, int nG, int ldG,
+      dummy_type_dprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_localdh_sprimme(dummy_type_dh_sprimme *V, dummy_type_dh_sprimme *W, dummy_type_dh_sprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_dprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_dh_sprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dh_sprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dh_sprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dh_sprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dh_sprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dh_sprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dh_sprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dh_sprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_dprimme *G, int nG, int ldG,
+      dummy_type_dprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsdh_sprimme(dummy_type_dh_sprimme *V, dummy_type_dh_sprimme *W, dummy_type_dh_sprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_dprimme *h, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_dh_sprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dh_sprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dh_sprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dh_sprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dh_sprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dh_sprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dh_sprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dh_sprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_dprimme *G, int nG, int ldG,
+      dummy_type_dprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
+int convTestFun_dh_sprimme(dummy_type_dprimme eval, dummy_type_dh_sprimme *evec, int givenEvec, dummy_type_dprimme rNorm,
+      int *isconv, primme_context ctx);
+int monitorFun_dh_sprimme(dummy_type_dprimme *basisEvals, int basisSize, int *basisFlags,
+      int *iblock, int blockSize, dummy_type_dprimme *basisNorms, int numConverged,
+      dummy_type_dprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_dprimme *lockedNorms,
+      int inner_its, dummy_type_dprimme LSRes, const char *msg, double time,
+      primme_event event, double startTime, primme_context ctx);
+int insertionSort_dh_sprimme(dummy_type_dprimme newVal, dummy_type_dprimme *evals,
+      dummy_type_dprimme newNorm, dummy_type_dprimme *resNorms, int newFlag, int *flags, int *perm, int n,
+      int initialShift, primme_params *primme);
+int Num_compute_residuals_dh_cprimme_normal(PRIMME_INT m, int n, dummy_type_zprimme *eval,
+      dummy_type_dh_cprimme *Bx, PRIMME_INT ldBx, dummy_type_dh_cprimme *Ax, PRIMME_INT ldAx, dummy_type_dh_cprimme *r,
+      PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsdh_cprimme_normal(PRIMME_INT m, int n, dummy_type_zprimme *eval,
+      dummy_type_dh_cprimme *Bx, PRIMME_INT ldBx, dummy_type_dh_cprimme *Ax, PRIMME_INT ldAx, dummy_type_dh_cprimme *r,
+      PRIMME_INT ldr, dummy_type_dprimme *rnorms, primme_context ctx);
+int overlap_matricesdh_cprimme_normal(dummy_type_dh_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_dh_cprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVdh_cprimme_normal(dummy_type_dh_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_dh_cprimme *V,
+      dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsdh_cprimme_normal(int k, dummy_type_dh_cprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
+int Num_update_VWXR_dh_cprimme_normal(dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_zprimme *hVals,
+      dummy_type_dh_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dh_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dh_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dh_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dh_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dh_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dh_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dh_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_localdh_cprimme_normal(dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_zprimme *hVals,
+      dummy_type_dh_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dh_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dh_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dh_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dh_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dh_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dh_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dh_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsdh_cprimme_normal(dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int ldh, dummy_type_zprimme *hVals,
+      dummy_type_dh_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dh_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dh_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dh_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dh_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dh_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dh_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dh_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
+int convTestFun_dh_cprimme_normal(dummy_type_zprimme eval, dummy_type_dh_cprimme *evec, int givenEvec, dummy_type_dprimme rNorm,
+      int *isconv, primme_context ctx);
+int monitorFun_dh_cprimme_normal(dummy_type_zprimme *basisEvals, int basisSize, int *basisFlags,
+      int *iblock, int blockSize, dummy_type_dprimme *basisNorms, int numConverged,
+      dummy_type_zprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_dprimme *lockedNorms,
+      int inner_its, dummy_type_dprimme LSRes, const char *msg, double time,
+      primme_event event, double startTime, primme_context ctx);
+int insertionSort_dh_cprimme_normal(dummy_type_zprimme newVal, dummy_type_zprimme *evals,
+      dummy_type_dprimme newNorm, dummy_type_dprimme *resNorms, int newFlag, int *flags, int *perm, int n,
+      int initialShift, primme_params *primme);
+int Num_compute_residuals_dh_cprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
+      dummy_type_dh_cprimme *Bx, PRIMME_INT ldBx, dummy_type_dh_cprimme *Ax, PRIMME_INT ldAx, dummy_type_dh_cprimme *r,
+      PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsdh_cprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
+      dummy_type_dh_cprimme *Bx, PRIMME_INT ldBx, dummy_type_dh_cprimme *Ax, PRIMME_INT ldAx, dummy_type_dh_cprimme *r,
+      PRIMME_INT ldr, dummy_type_dprimme *rnorms, primme_context ctx);
+int overlap_matricesdh_cprimme(dummy_type_dh_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_dh_cprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVdh_cprimme(dummy_type_dh_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_dh_cprimme *V,
+      dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsdh_cprimme(int k, dummy_type_dh_cprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
+int Num_update_VWXR_dh_cprimme(dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_dh_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dh_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dh_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dh_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dh_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dh_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dh_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dh_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_localdh_cprimme(dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_dh_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dh_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dh_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dh_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dh_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dh_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dh_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dh_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsdh_cprimme(dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_dh_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_dh_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_dh_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_dh_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_dh_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_dh_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_dh_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_dh_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
+int convTestFun_dh_cprimme(dummy_type_dprimme eval, dummy_type_dh_cprimme *evec, int givenEvec, dummy_type_dprimme rNorm,
+      int *isconv, primme_context ctx);
+int monitorFun_dh_cprimme(dummy_type_dprimme *basisEvals, int basisSize, int *basisFlags,
+      int *iblock, int blockSize, dummy_type_dprimme *basisNorms, int numConverged,
+      dummy_type_dprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_dprimme *lockedNorms,
+      int inner_its, dummy_type_dprimme LSRes, const char *msg, double time,
+      primme_event event, double startTime, primme_context ctx);
+int insertionSort_dh_cprimme(dummy_type_dprimme newVal, dummy_type_dprimme *evals,
+      dummy_type_dprimme newNorm, dummy_type_dprimme *resNorms, int newFlag, int *flags, int *perm, int n,
+      int initialShift, primme_params *primme);
+int Num_compute_residuals_magma_hprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
       dummy_type_magma_hprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_hprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_hprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsmagma_hprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
+      dummy_type_magma_hprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_hprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_hprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matricesmagma_hprimme(dummy_type_magma_hprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_hprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVmagma_hprimme(dummy_type_magma_hprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_hprimme *V,
+      dummy_type_magma_hprimme *W, dummy_type_magma_hprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsmagma_hprimme(int k, dummy_type_magma_hprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_magma_hprimme(dummy_type_magma_hprimme *V, dummy_type_magma_hprimme *W, dummy_type_magma_hprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
       dummy_type_magma_hprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -753,6 +1344,37 @@ int Num_update_VWXR_magma_hprimme(dummy_type_magma_hprimme *V, dummy_type_magma_
       dummy_type_sprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localmagma_hprimme(dummy_type_magma_hprimme *V, dummy_type_magma_hprimme *W, dummy_type_magma_hprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_magma_hprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_hprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_hprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_hprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_hprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_hprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_hprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_hprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_sprimme *G, int nG, int ldG,
+      dummy_type_sprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsmagma_hprimme(dummy_type_magma_hprimme *V, dummy_type_magma_hprimme *W, dummy_type_magma_hprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_magma_hprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_hprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_hprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_hprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_hprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_hprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_hprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_hprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_sprimme *G, int nG, int ldG,
+      dummy_type_sprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_magma_hprimme(dummy_type_sprimme eval, dummy_type_magma_hprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_magma_hprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basisFlags,
@@ -766,6 +1388,15 @@ int insertionSort_magma_hprimme(dummy_type_sprimme newVal, dummy_type_sprimme *e
 int Num_compute_residuals_magma_kprimme_normal(PRIMME_INT m, int n, dummy_type_cprimme *eval,
       dummy_type_magma_kprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_kprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_kprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsmagma_kprimme_normal(PRIMME_INT m, int n, dummy_type_cprimme *eval,
+      dummy_type_magma_kprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_kprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_kprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matricesmagma_kprimme_normal(dummy_type_magma_kprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_kprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVmagma_kprimme_normal(dummy_type_magma_kprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_kprimme *V,
+      dummy_type_magma_kprimme *W, dummy_type_magma_kprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsmagma_kprimme_normal(int k, dummy_type_magma_kprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_magma_kprimme_normal(dummy_type_magma_kprimme *V, dummy_type_magma_kprimme *W, dummy_type_magma_kprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_cprimme *hVals,
       dummy_type_magma_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -781,6 +1412,37 @@ int Num_update_VWXR_magma_kprimme_normal(dummy_type_magma_kprimme *V, dummy_type
       dummy_type_cprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localmagma_kprimme_normal(dummy_type_magma_kprimme *V, dummy_type_magma_kprimme *W, dummy_type_magma_kprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_cprimme *hVals,
+      dummy_type_magma_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_kprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_kprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_kprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_kprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_kprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_kprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_kprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsmagma_kprimme_normal(dummy_type_magma_kprimme *V, dummy_type_magma_kprimme *W, dummy_type_magma_kprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int ldh, dummy_type_cprimme *hVals,
+      dummy_type_magma_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_kprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_kprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_kprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_kprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_kprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_kprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_kprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_magma_kprimme_normal(dummy_type_cprimme eval, dummy_type_magma_kprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_magma_kprimme_normal(dummy_type_cprimme *basisEvals, int basisSize, int *basisFlags,
@@ -794,6 +1456,15 @@ int insertionSort_magma_kprimme_normal(dummy_type_cprimme newVal, dummy_type_cpr
 int Num_compute_residuals_magma_kprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
       dummy_type_magma_kprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_kprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_kprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsmagma_kprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
+      dummy_type_magma_kprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_kprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_kprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matricesmagma_kprimme(dummy_type_magma_kprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_kprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVmagma_kprimme(dummy_type_magma_kprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_kprimme *V,
+      dummy_type_magma_kprimme *W, dummy_type_magma_kprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsmagma_kprimme(int k, dummy_type_magma_kprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_magma_kprimme(dummy_type_magma_kprimme *V, dummy_type_magma_kprimme *W, dummy_type_magma_kprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
       dummy_type_magma_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -809,6 +1480,37 @@ int Num_update_VWXR_magma_kprimme(dummy_type_magma_kprimme *V, dummy_type_magma_
       dummy_type_cprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localmagma_kprimme(dummy_type_magma_kprimme *V, dummy_type_magma_kprimme *W, dummy_type_magma_kprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_magma_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_kprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_kprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_kprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_kprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_kprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_kprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_kprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsmagma_kprimme(dummy_type_magma_kprimme *V, dummy_type_magma_kprimme *W, dummy_type_magma_kprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_magma_kprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_kprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_kprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_kprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_kprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_kprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_kprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_kprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_magma_kprimme(dummy_type_sprimme eval, dummy_type_magma_kprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_magma_kprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basisFlags,
@@ -822,6 +1524,15 @@ int insertionSort_magma_kprimme(dummy_type_sprimme newVal, dummy_type_sprimme *e
 int Num_compute_residuals_magma_sprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
       dummy_type_magma_sprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_sprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_sprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsmagma_sprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
+      dummy_type_magma_sprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_sprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_sprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matricesmagma_sprimme(dummy_type_magma_sprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_sprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVmagma_sprimme(dummy_type_magma_sprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_sprimme *V,
+      dummy_type_magma_sprimme *W, dummy_type_magma_sprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsmagma_sprimme(int k, dummy_type_magma_sprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_magma_sprimme(dummy_type_magma_sprimme *V, dummy_type_magma_sprimme *W, dummy_type_magma_sprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
       dummy_type_magma_sprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -837,6 +1548,37 @@ int Num_update_VWXR_magma_sprimme(dummy_type_magma_sprimme *V, dummy_type_magma_
       dummy_type_sprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localmagma_sprimme(dummy_type_magma_sprimme *V, dummy_type_magma_sprimme *W, dummy_type_magma_sprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_magma_sprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_sprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_sprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_sprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_sprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_sprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_sprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_sprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_sprimme *G, int nG, int ldG,
+      dummy_type_sprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsmagma_sprimme(dummy_type_magma_sprimme *V, dummy_type_magma_sprimme *W, dummy_type_magma_sprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_sprimme *h, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_magma_sprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_sprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_sprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_sprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_sprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_sprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_sprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_sprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_sprimme *G, int nG, int ldG,
+      dummy_type_sprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_magma_sprimme(dummy_type_sprimme eval, dummy_type_magma_sprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_magma_sprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basisFlags,
@@ -850,6 +1592,15 @@ int insertionSort_magma_sprimme(dummy_type_sprimme newVal, dummy_type_sprimme *e
 int Num_compute_residuals_magma_cprimme_normal(PRIMME_INT m, int n, dummy_type_cprimme *eval,
       dummy_type_magma_cprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_cprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_cprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsmagma_cprimme_normal(PRIMME_INT m, int n, dummy_type_cprimme *eval,
+      dummy_type_magma_cprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_cprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_cprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matricesmagma_cprimme_normal(dummy_type_magma_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_cprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVmagma_cprimme_normal(dummy_type_magma_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_cprimme *V,
+      dummy_type_magma_cprimme *W, dummy_type_magma_cprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsmagma_cprimme_normal(int k, dummy_type_magma_cprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_magma_cprimme_normal(dummy_type_magma_cprimme *V, dummy_type_magma_cprimme *W, dummy_type_magma_cprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_cprimme *hVals,
       dummy_type_magma_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -865,6 +1616,37 @@ int Num_update_VWXR_magma_cprimme_normal(dummy_type_magma_cprimme *V, dummy_type
       dummy_type_cprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localmagma_cprimme_normal(dummy_type_magma_cprimme *V, dummy_type_magma_cprimme *W, dummy_type_magma_cprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_cprimme *hVals,
+      dummy_type_magma_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsmagma_cprimme_normal(dummy_type_magma_cprimme *V, dummy_type_magma_cprimme *W, dummy_type_magma_cprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int ldh, dummy_type_cprimme *hVals,
+      dummy_type_magma_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_magma_cprimme_normal(dummy_type_cprimme eval, dummy_type_magma_cprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_magma_cprimme_normal(dummy_type_cprimme *basisEvals, int basisSize, int *basisFlags,
@@ -878,6 +1660,15 @@ int insertionSort_magma_cprimme_normal(dummy_type_cprimme newVal, dummy_type_cpr
 int Num_compute_residuals_magma_cprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
       dummy_type_magma_cprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_cprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_cprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsmagma_cprimme(PRIMME_INT m, int n, dummy_type_sprimme *eval,
+      dummy_type_magma_cprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_cprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_cprimme *r,
+      PRIMME_INT ldr, dummy_type_sprimme *rnorms, primme_context ctx);
+int overlap_matricesmagma_cprimme(dummy_type_magma_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_cprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVmagma_cprimme(dummy_type_magma_cprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_cprimme *V,
+      dummy_type_magma_cprimme *W, dummy_type_magma_cprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsmagma_cprimme(int k, dummy_type_magma_cprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_magma_cprimme(dummy_type_magma_cprimme *V, dummy_type_magma_cprimme *W, dummy_type_magma_cprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
       dummy_type_magma_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -893,6 +1684,37 @@ int Num_update_VWXR_magma_cprimme(dummy_type_magma_cprimme *V, dummy_type_magma_
       dummy_type_cprimme *H, int nH, int ldH,
       dummy_type_sprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localmagma_cprimme(dummy_type_magma_cprimme *V, dummy_type_magma_cprimme *W, dummy_type_magma_cprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int nh, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_magma_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsmagma_cprimme(dummy_type_magma_cprimme *V, dummy_type_magma_cprimme *W, dummy_type_magma_cprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_cprimme *h, int ldh, dummy_type_sprimme *hVals,
+      dummy_type_magma_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_cprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_sprimme *Rnorms,
+      dummy_type_magma_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_cprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_sprimme *rnorms, int nrb, int nre,
+      dummy_type_cprimme *G, int nG, int ldG,
+      dummy_type_cprimme *H, int nH, int ldH,
+      dummy_type_sprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_magma_cprimme(dummy_type_sprimme eval, dummy_type_magma_cprimme *evec, int givenEvec, dummy_type_sprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_magma_cprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basisFlags,
@@ -906,6 +1728,15 @@ int insertionSort_magma_cprimme(dummy_type_sprimme newVal, dummy_type_sprimme *e
 int Num_compute_residuals_magma_dprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
       dummy_type_magma_dprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_dprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_dprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsmagma_dprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
+      dummy_type_magma_dprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_dprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_dprimme *r,
+      PRIMME_INT ldr, dummy_type_dprimme *rnorms, primme_context ctx);
+int overlap_matricesmagma_dprimme(dummy_type_magma_dprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_dprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVmagma_dprimme(dummy_type_magma_dprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_dprimme *V,
+      dummy_type_magma_dprimme *W, dummy_type_magma_dprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsmagma_dprimme(int k, dummy_type_magma_dprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_magma_dprimme(dummy_type_magma_dprimme *V, dummy_type_magma_dprimme *W, dummy_type_magma_dprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_dprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
       dummy_type_magma_dprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -921,6 +1752,37 @@ int Num_update_VWXR_magma_dprimme(dummy_type_magma_dprimme *V, dummy_type_magma_
       dummy_type_dprimme *H, int nH, int ldH,
       dummy_type_dprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localmagma_dprimme(dummy_type_magma_dprimme *V, dummy_type_magma_dprimme *W, dummy_type_magma_dprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_dprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_magma_dprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_dprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_dprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_dprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_dprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_magma_dprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_dprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_dprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_dprimme *G, int nG, int ldG,
+      dummy_type_dprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsmagma_dprimme(dummy_type_magma_dprimme *V, dummy_type_magma_dprimme *W, dummy_type_magma_dprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_dprimme *h, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_magma_dprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_dprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_dprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_dprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_dprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_magma_dprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_dprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_dprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_dprimme *G, int nG, int ldG,
+      dummy_type_dprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_magma_dprimme(dummy_type_dprimme eval, dummy_type_magma_dprimme *evec, int givenEvec, dummy_type_dprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_magma_dprimme(dummy_type_dprimme *basisEvals, int basisSize, int *basisFlags,
@@ -934,6 +1796,15 @@ int insertionSort_magma_dprimme(dummy_type_dprimme newVal, dummy_type_dprimme *e
 int Num_compute_residuals_magma_zprimme_normal(PRIMME_INT m, int n, dummy_type_zprimme *eval,
       dummy_type_magma_zprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_zprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_zprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsmagma_zprimme_normal(PRIMME_INT m, int n, dummy_type_zprimme *eval,
+      dummy_type_magma_zprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_zprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_zprimme *r,
+      PRIMME_INT ldr, dummy_type_dprimme *rnorms, primme_context ctx);
+int overlap_matricesmagma_zprimme_normal(dummy_type_magma_zprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_zprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVmagma_zprimme_normal(dummy_type_magma_zprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_zprimme *V,
+      dummy_type_magma_zprimme *W, dummy_type_magma_zprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsmagma_zprimme_normal(int k, dummy_type_magma_zprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_magma_zprimme_normal(dummy_type_magma_zprimme *V, dummy_type_magma_zprimme *W, dummy_type_magma_zprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_zprimme *hVals,
       dummy_type_magma_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -949,6 +1820,37 @@ int Num_update_VWXR_magma_zprimme_normal(dummy_type_magma_zprimme *V, dummy_type
       dummy_type_zprimme *H, int nH, int ldH,
       dummy_type_dprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localmagma_zprimme_normal(dummy_type_magma_zprimme *V, dummy_type_magma_zprimme *W, dummy_type_magma_zprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_zprimme *hVals,
+      dummy_type_magma_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_zprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_zprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_zprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_zprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_magma_zprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_zprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_zprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsmagma_zprimme_normal(dummy_type_magma_zprimme *V, dummy_type_magma_zprimme *W, dummy_type_magma_zprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int ldh, dummy_type_zprimme *hVals,
+      dummy_type_magma_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_zprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_zprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_zprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_zprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_magma_zprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_zprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_zprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_magma_zprimme_normal(dummy_type_zprimme eval, dummy_type_magma_zprimme *evec, int givenEvec, dummy_type_dprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_magma_zprimme_normal(dummy_type_zprimme *basisEvals, int basisSize, int *basisFlags,
@@ -962,6 +1864,15 @@ int insertionSort_magma_zprimme_normal(dummy_type_zprimme newVal, dummy_type_zpr
 int Num_compute_residuals_magma_zprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
       dummy_type_magma_zprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_zprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_zprimme *r,
       PRIMME_INT ldr, primme_context ctx);
+int compute_residuals_normsmagma_zprimme(PRIMME_INT m, int n, dummy_type_dprimme *eval,
+      dummy_type_magma_zprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_zprimme *Ax, PRIMME_INT ldAx, dummy_type_magma_zprimme *r,
+      PRIMME_INT ldr, dummy_type_dprimme *rnorms, primme_context ctx);
+int overlap_matricesmagma_zprimme(dummy_type_magma_zprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_zprimme *y,
+      int ny, PRIMME_INT ldy, PRIMME_INT m);
+int overlap_VWBVmagma_zprimme(dummy_type_magma_zprimme *x, int nx, PRIMME_INT ldx, dummy_type_magma_zprimme *V,
+      dummy_type_magma_zprimme *W, dummy_type_magma_zprimme *BV, PRIMME_INT mV, int nV, PRIMME_INT ldV);
+int overlap_outputsmagma_zprimme(int k, dummy_type_magma_zprimme **outs, int *nouts,
+      PRIMME_INT *ldouts, int n, PRIMME_INT m);
 int Num_update_VWXR_magma_zprimme(dummy_type_magma_zprimme *V, dummy_type_magma_zprimme *W, dummy_type_magma_zprimme *BV, PRIMME_INT mV,
       int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
       dummy_type_magma_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
@@ -977,6 +1888,37 @@ int Num_update_VWXR_magma_zprimme(dummy_type_magma_zprimme *V, dummy_type_magma_
       dummy_type_zprimme *H, int nH, int ldH,
       dummy_type_dprimme *xnorms, int nxb, int nxe,
       primme_context ctx);
+int update_VWXR_localmagma_zprimme(dummy_type_magma_zprimme *V, dummy_type_magma_zprimme *W, dummy_type_magma_zprimme *BV, PRIMME_INT mV,
+      int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_magma_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_zprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_zprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_zprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_zprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_magma_zprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_zprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_zprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      primme_context ctx);
+int update_VWXR_rowsmagma_zprimme(dummy_type_magma_zprimme *V, dummy_type_magma_zprimme *W, dummy_type_magma_zprimme *BV,
+      PRIMME_INT mV, int nV, PRIMME_INT ldV, dummy_type_zprimme *h, int ldh, dummy_type_dprimme *hVals,
+      dummy_type_magma_zprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+      dummy_type_magma_zprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+      dummy_type_magma_zprimme *X2, int nX2b, int nX2e, PRIMME_INT ldX2,
+      dummy_type_magma_zprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+      dummy_type_magma_zprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+      dummy_type_magma_zprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+      dummy_type_magma_zprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+      dummy_type_magma_zprimme *BX2, int nBX2b, int nBX2e, PRIMME_INT ldBX2,
+      dummy_type_dprimme *rnorms, int nrb, int nre,
+      dummy_type_zprimme *G, int nG, int ldG,
+      dummy_type_zprimme *H, int nH, int ldH,
+      dummy_type_dprimme *xnorms, int nxb, int nxe,
+      int nXb, int nXe, int nYb, int nYe, int nBXb, int nBXe,
+      primme_context ctx);
 int convTestFun_magma_zprimme(dummy_type_dprimme eval, dummy_type_magma_zprimme *evec, int givenEvec, dummy_type_dprimme rNorm,
       int *isconv, primme_context ctx);
 int monitorFun_magma_zprimme(dummy_type_dprimme *basisEvals, int basisSize, int *basisFlags,
@@ -52,4 +52,32 @@ enum conv_flags {
 #define EVAL_REAL_PART(X) KIND((X),REAL_PART(TO_COMPLEX(X)))
 #define EVAL_IMAGINARY_PART(X) KIND(0,IMAGINARY_PART(TO_COMPLEX(X)))
 
+/* Whether the reductions started with globalSumStart progress while doing */
+/* other work; otherwise globalSumStart does the whole reduction.          */
+#define GLOBALSUM_ASYNC(CTX)                                                   \
+   ((CTX).primme && (CTX).numProcs > 1 && (CTX).primme->globalSumReal &&       \
+         (CTX).primme->globalSumRealStart && (CTX).primme->globalSumRealWait)
+
+/**********************************************************************
+ * Macro CHKERRSUM - as CHKERR, but before returning it calls
+ *    globalSumCancel on the reductions R[0:N-1], so that none of them
+ *    is left in ctx.sumQueue pointing to the buffers of the caller.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * ERRN    Expression that returns an error code
+ * R       Array of reductions started with globalSumStart
+ * N       Number of reductions in R
+ *
+ **********************************************************************/
+
+#define CHKERRSUM(ERRN, R, N) { \
+   int __errsum; \
+   CHKERRVAL(ERRN, &__errsum); \
+   if (__errsum) { \
+      globalSumCancel_Tprimme((R), (N), ctx); \
+      return __errsum; \
+   } \
+}
+
 #endif /* COMMON_EIGS_H */
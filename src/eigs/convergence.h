@@ -207,6 +207,33 @@ int check_practical_convergencezprimme(dummy_type_zprimme *R, PRIMME_INT ldR, du
       int evecsSize, PRIMME_INT ldevecs, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_dprimme *blockNorms,
       double tol, dummy_type_zprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_dh_sprimme(dummy_type_dh_sprimme *X, PRIMME_INT ldX, int givenX, dummy_type_dh_sprimme *R,
+      PRIMME_INT ldR, int givenR, dummy_type_dh_sprimme *evecs, int numLocked,
+      PRIMME_INT ldevecs, dummy_type_dh_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *VtBV,
+      int ldVtBV, int left, int right, int *flags, dummy_type_dprimme *blockNorms,
+      dummy_type_dprimme *hVals, int *reset, int practConvCheck, primme_context ctx);
+int check_practical_convergencedh_sprimme(dummy_type_dh_sprimme *R, PRIMME_INT ldR, dummy_type_dh_sprimme *evecs,
+      int evecsSize, PRIMME_INT ldevecs, dummy_type_dh_sprimme *Bevecs, PRIMME_INT ldBevecs,
+      int left, int *iev, int numToProject, int *flags, dummy_type_dprimme *blockNorms,
+      double tol, dummy_type_dprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_dh_cprimme_normal(dummy_type_dh_cprimme *X, PRIMME_INT ldX, int givenX, dummy_type_dh_cprimme *R,
+      PRIMME_INT ldR, int givenR, dummy_type_dh_cprimme *evecs, int numLocked,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *VtBV,
+      int ldVtBV, int left, int right, int *flags, dummy_type_dprimme *blockNorms,
+      dummy_type_zprimme *hVals, int *reset, int practConvCheck, primme_context ctx);
+int check_practical_convergencedh_cprimme_normal(dummy_type_dh_cprimme *R, PRIMME_INT ldR, dummy_type_dh_cprimme *evecs,
+      int evecsSize, PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs,
+      int left, int *iev, int numToProject, int *flags, dummy_type_dprimme *blockNorms,
+      double tol, dummy_type_zprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_dh_cprimme(dummy_type_dh_cprimme *X, PRIMME_INT ldX, int givenX, dummy_type_dh_cprimme *R,
+      PRIMME_INT ldR, int givenR, dummy_type_dh_cprimme *evecs, int numLocked,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *VtBV,
+      int ldVtBV, int left, int right, int *flags, dummy_type_dprimme *blockNorms,
+      dummy_type_dprimme *hVals, int *reset, int practConvCheck, primme_context ctx);
+int check_practical_convergencedh_cprimme(dummy_type_dh_cprimme *R, PRIMME_INT ldR, dummy_type_dh_cprimme *evecs,
+      int evecsSize, PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs,
+      int left, int *iev, int numToProject, int *flags, dummy_type_dprimme *blockNorms,
+      double tol, dummy_type_zprimme *VtBV, int ldVtBV, primme_context ctx);
 int check_convergence_magma_hprimme(dummy_type_magma_hprimme *X, PRIMME_INT ldX, int givenX, dummy_type_magma_hprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_magma_hprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *VtBV,
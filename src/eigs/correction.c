@@ -122,6 +122,9 @@
  *
  * touch            Parameter used in inner solve stopping criteria
  *
+ * copies           Copies of evecs, Bevecs and evecsHat in innerPrecision
+ *                  (see inner_solve_astype); NULL if innerPrecision is not set
+ *
  * Return Value
  * ------------
  * int  Error code: 0 upon success, nonzero otherwise
@@ -137,8 +140,8 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
       PRIMME_INT ldevecsHat, HSCALAR *Mfact, int *ipivot, HEVAL *lockedEvals,
       int numLocked, int numConvergedStored, HEVAL *ritzVals,
       HEVAL *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      HREAL *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx) {
+      HREAL *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx) {
 
    KIND(, (void)lockedEvals);
    KIND(, (void)flags);
@@ -152,6 +155,7 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
    KIND(, (void)ipivot);
    KIND(, (void)numConvergedStored);
    KIND(, (void)touch);
+   KIND(, (void)copies);
    KIND(, (void)startTime);
 
    primme_params *primme = ctx.primme;
@@ -340,7 +344,19 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
       SCALAR *x = &V[ldV*basisSize];    /* All the block Ritz vectors */
       SCALAR *Bx = &BV[ldBV*basisSize]; /* B*x                        */
       
-      if ( primme->correctionParams.projectors.RightX &&
+      /* Chebyshev-Davidson: expand the basis with p(A)*x, where p damps */
+      /* the unwanted part of the spectrum; otherwise do GD as usual     */
+
+      int filtered = 0;
+      if (primme->correctionParams.chebyshevDegree > 0) {
+         CHKERR(Chebyshev_filter_block(x, ldV, ritzVals, basisSize, numLocked,
+               blockNorms, blockSize, &filtered, ctx));
+      }
+
+      if (filtered) {
+         /* x already holds p(A)*x */
+      }
+      else if ( primme->correctionParams.projectors.RightX &&
            primme->correctionParams.projectors.SkewX    ) {    
            /* Compute exact Olsen's projected preconditioner. This is */
           /* expensive and rarely improves anything! Included for completeness*/
@@ -444,13 +460,31 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
       /* value that takes for all inner_solve calls                        */
       int touch1 = touch0;
 
-      CHKERR(inner_solve_Sprimme(blockSize, x, ldV, Bx, ldBV, r, ldW,
-            blockNorms, evecs, ldevecs, Mfact, ipivot, xKinvBx, LprojectorQ,
-            ldLprojectorQ, LprojectorX, ldLprojectorX, LprojectorBQ,
-            ldLprojectorBQ, LprojectorBX, ldLprojectorBX, RprojectorQ,
-            ldRprojectorQ, RprojectorX, ldRprojectorX, sizeLprojectorQ,
-            sizeLprojectorX, sizeRprojectorQ, sizeRprojectorX, sol, ldsol,
-            blockRitzVals, blockOfShifts, &touch1, startTime, ctx));
+      /* Run the inner iterations in innerPrecision if it is set */
+
+      primme_op_datatype innerPrecision =
+            primme->correctionParams.innerPrecision;
+      double t0 = primme_wTimer();
+      if (innerPrecision == primme_op_default ||
+            innerPrecision == PRIMME_OP_SCALAR) {
+         CHKERR(inner_solve_Sprimme(blockSize, x, ldV, Bx, ldBV, r, ldW,
+               blockNorms, evecs, ldevecs, Mfact, ipivot, xKinvBx, LprojectorQ,
+               ldLprojectorQ, LprojectorX, ldLprojectorX, LprojectorBQ,
+               ldLprojectorBQ, LprojectorBX, ldLprojectorBX, RprojectorQ,
+               ldRprojectorQ, RprojectorX, ldRprojectorX, sizeLprojectorQ,
+               sizeLprojectorX, sizeRprojectorQ, sizeRprojectorX, sol, ldsol,
+               blockRitzVals, blockOfShifts, &touch1, startTime, ctx));
+      } else {
+         CHKERR(inner_solve_astype_Sprimme(innerPrecision, blockSize, x, ldV,
+               Bx, ldBV, r, ldW, blockNorms, evecs, ldevecs, Mfact, ipivot,
+               xKinvBx, LprojectorQ, ldLprojectorQ, LprojectorX, ldLprojectorX,
+               LprojectorBQ, ldLprojectorBQ, LprojectorBX, ldLprojectorBX,
+               RprojectorQ, ldRprojectorQ, RprojectorX, ldRprojectorX,
+               sizeLprojectorQ, sizeLprojectorX, sizeRprojectorQ,
+               sizeRprojectorX, sol, ldsol, blockRitzVals, blockOfShifts,
+               &touch1, copies, startTime, ctx));
+      }
+      Trace_span("inner solve", t0, ctx.trace);
       *touch = max(*touch, touch1);
 
       Num_copy_matrix_Sprimme(sol, primme->nLocal, blockSize, ldsol,
@@ -696,6 +730,160 @@ STATIC void mergeSort(HREAL *lockedEvals, int numLocked, HREAL *ritzVals,
 
 }
 
+/*******************************************************************************
+ * Subroutine Chebyshev_filter_block - This subroutine replaces the block of
+ *    Ritz vectors x by p(A)*x, where p is the Chebyshev polynomial of the first
+ *    kind mapped to the unwanted interval [lb, ub] and scaled to be one at the
+ *    wanted end of the spectrum. For primme_smallest the interval goes from
+ *    the median Ritz value of the basis, or the first one after the pairs to
+ *    converge, to aNorm or the largest value seen; and the reverse for
+ *    primme_largest.
+ *
+ *    The degree is the smallest that reduces the components in [lb, ub] by
+ *    the ratio between the largest residual norm and the tolerance, up to
+ *    correctionParams.chebyshevDegree. The three-term recurrence is the scaled
+ *    one in [Zhou and Saad, 2007], and every term is a blocked matrixMatvec.
+ *
+ * Input Parameters
+ * ----------------
+ * ritzVals   The Ritz values of the current basis
+ *
+ * basisSize  The size of the current basis
+ *
+ * numLocked  The number of locked pairs
+ *
+ * blockNorms The residual norms of the block Ritz vectors
+ *
+ * blockSize  The number of vectors in x
+ *
+ * Input/Output parameters
+ * -----------------------
+ * x          The block Ritz vectors; on output, the filtered vectors
+ *
+ * Output parameters
+ * -----------------
+ * filtered   Whether x was filtered; it is not if the bounds of the spectrum
+ *            are not good enough yet or the problem is not supported
+ *
+ ******************************************************************************/
+
+STATIC int Chebyshev_filter_block(SCALAR *x, PRIMME_INT ldx, HEVAL *ritzVals,
+      int basisSize, int numLocked, HREAL *blockNorms, int blockSize,
+      int *filtered, primme_context ctx) {
+
+#ifdef USE_HERMITIAN
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+   int i, j;
+
+   *filtered = 0;
+
+   /* Quick exit if the basis does not have Ritz values beyond the pairs */
+   /* to converge                                                       */
+
+   int icut = max((basisSize - 1) / 2, primme->numEvals - numLocked);
+   if (blockSize <= 0 || icut >= basisSize || primme->massMatrixMatvec ||
+         (primme->target != primme_smallest &&
+               primme->target != primme_largest)) {
+      return 0;
+   }
+
+   /* Set the interval [lb, ub] to damp and the wanted end */
+
+   double cut = ritzVals[icut];
+   double lb, ub, wanted;
+   if (primme->target == primme_smallest) {
+      wanted = primme->stats.estimateMinEVal;
+      lb = cut;
+      ub = primme->aNorm > 0.0 ? primme->aNorm : primme->stats.estimateMaxEVal;
+      ub += (ub - lb) * 0.01;
+   } else {
+      wanted = primme->stats.estimateMaxEVal;
+      ub = cut;
+      lb = primme->aNorm > 0.0 ? -primme->aNorm
+                               : primme->stats.estimateMinEVal;
+      lb -= (ub - lb) * 0.01;
+   }
+   double c = (ub + lb) / 2.0, e = (ub - lb) / 2.0;
+   if (!(fabs(wanted) < HUGE_VAL) || !(e > 0.0) || fabs(wanted - c) <= e) {
+      return 0;
+   }
+
+   /* Choose the degree; T_k(gamma) is the damping ratio of degree k */
+
+   double gamma = fabs(wanted - c) / e;
+   double maxNorm = 0.0;
+   for (i = 0; i < blockSize; i++) maxNorm = max(maxNorm, blockNorms[i]);
+   double tol = primme->eps * max(primme->aNorm,
+                                     primme->stats.estimateLargestSVal);
+   int degree = primme->correctionParams.chebyshevDegree;
+   if (tol > 0.0 && maxNorm > tol) {
+      degree = min(degree, (int)ceil(acosh(maxNorm / tol) / acosh(gamma)));
+   }
+
+   /* Leave room for the matvecs of the new basis vectors */
+
+   if (primme->maxMatvecs > 0) {
+      degree = (int)min(degree, (primme->maxMatvecs - primme->stats.numMatvecs)
+                                          / blockSize - 1);
+   }
+   if (degree <= 0) return 0;
+
+   /* Allocate workspaces */
+
+   PRIMME_INT ldY = primme->ldOPs;
+   SCALAR *work, *Y0, *Y, *Y1, *aux;
+   CHKERR(Num_malloc_Sprimme(ldY * blockSize * 3, &work, ctx));
+   Y0 = work;
+   Y = &Y0[ldY * blockSize];
+   Y1 = &Y[ldY * blockSize];
+
+   /* Y0 = x; Y = (A - c I) * Y0 * sigma1/e */
+
+   double sigma1 = e / (wanted - c), sigma = sigma1;
+   CHKERR(Num_copy_matrix_Sprimme(x, nLocal, blockSize, ldx, Y0, ldY, ctx));
+   CHKERR(matrixMatvec_Sprimme(Y0, nLocal, ldY, Y, ldY, 0, blockSize, ctx));
+   for (j = 0; j < blockSize; j++) {
+      Num_axpy_Sprimme(nLocal, -c, &Y0[ldY * j], 1, &Y[ldY * j], 1, ctx);
+      Num_scal_Sprimme(nLocal, sigma1 / e, &Y[ldY * j], 1, ctx);
+   }
+
+   /* Y1 = (A - c I) * Y * 2*sigma'/e - sigma*sigma' * Y0 */
+
+   for (i = 1; i < degree; i++) {
+      double sigmap = 1.0 / (2.0 / sigma1 - sigma);
+      CHKERR(matrixMatvec_Sprimme(Y, nLocal, ldY, Y1, ldY, 0, blockSize, ctx));
+      for (j = 0; j < blockSize; j++) {
+         Num_axpy_Sprimme(nLocal, -c, &Y[ldY * j], 1, &Y1[ldY * j], 1, ctx);
+         Num_scal_Sprimme(nLocal, 2.0 * sigmap / e, &Y1[ldY * j], 1, ctx);
+         Num_axpy_Sprimme(nLocal, -sigma * sigmap, &Y0[ldY * j], 1,
+               &Y1[ldY * j], 1, ctx);
+      }
+      aux = Y0, Y0 = Y, Y = Y1, Y1 = aux;
+      sigma = sigmap;
+   }
+
+   CHKERR(Num_copy_matrix_Sprimme(Y, nLocal, blockSize, ldY, x, ldx, ctx));
+   CHKERR(Num_free_Sprimme(work, ctx));
+   *filtered = 1;
+
+   return 0;
+#else
+   (void)x;
+   (void)ldx;
+   (void)ritzVals;
+   (void)basisSize;
+   (void)numLocked;
+   (void)blockNorms;
+   (void)blockSize;
+   (void)ctx;
+
+   *filtered = 0;
+
+   return 0;
+#endif /* USE_HERMITIAN */
+}
+
 /*******************************************************************************
  * Subroutine Olsen_preconditioner_block - This subroutine applies the projected
  *    preconditioner to a block of blockSize vectors r by computing:
@@ -129,8 +129,8 @@ int solve_correction_dprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_d
       PRIMME_INT ldevecsHat, dummy_type_dprimme *Mfact, int *ipivot, dummy_type_dprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_dprimme *ritzVals,
       dummy_type_dprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(computeRobustShift)
 #  define computeRobustShift CONCAT(computeRobustShift,WITH_KIND(SCALAR_SUF))
 #endif
@@ -143,6 +143,12 @@ dummy_type_dprimme computeRobustShiftdprimme(int blockIndex, double resNorm,
 void mergeSortdprimme(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
    int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+#if !defined(CHECK_TEMPLATE) && !defined(Chebyshev_filter_block)
+#  define Chebyshev_filter_block CONCAT(Chebyshev_filter_block,WITH_KIND(SCALAR_SUF))
+#endif
+int Chebyshev_filter_blockdprimme(dummy_type_dprimme *x, PRIMME_INT ldx, dummy_type_dprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_dprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(Olsen_preconditioner_block)
 #  define Olsen_preconditioner_block CONCAT(Olsen_preconditioner_block,WITH_KIND(SCALAR_SUF))
 #endif
@@ -170,14 +176,17 @@ int solve_correction_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_h
       PRIMME_INT ldevecsHat, dummy_type_sprimme *Mfact, int *ipivot, dummy_type_sprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_sprimme *ritzVals,
       dummy_type_sprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShifthprimme(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSorthprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockhprimme(dummy_type_hprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockhprimme(dummy_type_hprimme *r, PRIMME_INT ldr, dummy_type_hprimme *x,
       PRIMME_INT ldx, dummy_type_hprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -199,14 +208,17 @@ int solve_correction_kprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dummy
       PRIMME_INT ldevecsHat, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_cprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_cprimme *ritzVals,
       dummy_type_cprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftkprimme_normal(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortkprimme_normal(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockkprimme_normal(dummy_type_kprimme *x, PRIMME_INT ldx, dummy_type_cprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockkprimme_normal(dummy_type_kprimme *r, PRIMME_INT ldr, dummy_type_kprimme *x,
       PRIMME_INT ldx, dummy_type_kprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -228,14 +240,17 @@ int solve_correction_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_k
       PRIMME_INT ldevecsHat, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_sprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_sprimme *ritzVals,
       dummy_type_sprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftkprimme(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortkprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockkprimme(dummy_type_kprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockkprimme(dummy_type_kprimme *r, PRIMME_INT ldr, dummy_type_kprimme *x,
       PRIMME_INT ldx, dummy_type_kprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -257,14 +272,17 @@ int solve_correction_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_s
       PRIMME_INT ldevecsHat, dummy_type_sprimme *Mfact, int *ipivot, dummy_type_sprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_sprimme *ritzVals,
       dummy_type_sprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftsprimme(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortsprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blocksprimme(dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blocksprimme(dummy_type_sprimme *r, PRIMME_INT ldr, dummy_type_sprimme *x,
       PRIMME_INT ldx, dummy_type_sprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -286,14 +304,17 @@ int solve_correction_cprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dummy
       PRIMME_INT ldevecsHat, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_cprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_cprimme *ritzVals,
       dummy_type_cprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftcprimme_normal(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortcprimme_normal(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockcprimme_normal(dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_cprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockcprimme_normal(dummy_type_cprimme *r, PRIMME_INT ldr, dummy_type_cprimme *x,
       PRIMME_INT ldx, dummy_type_cprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -315,14 +336,17 @@ int solve_correction_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_c
       PRIMME_INT ldevecsHat, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_sprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_sprimme *ritzVals,
       dummy_type_sprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftcprimme(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortcprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockcprimme(dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockcprimme(dummy_type_cprimme *r, PRIMME_INT ldr, dummy_type_cprimme *x,
       PRIMME_INT ldx, dummy_type_cprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -344,14 +368,17 @@ int solve_correction_zprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dummy
       PRIMME_INT ldevecsHat, dummy_type_zprimme *Mfact, int *ipivot, dummy_type_zprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_zprimme *ritzVals,
       dummy_type_zprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_dprimme computeRobustShiftzprimme_normal(int blockIndex, double resNorm,
    dummy_type_dprimme *prevRitzVals, int numPrevRitzVals, dummy_type_dprimme *sortedRitzVals,
    dummy_type_dprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortzprimme_normal(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
    int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockzprimme_normal(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_zprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_dprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockzprimme_normal(dummy_type_zprimme *r, PRIMME_INT ldr, dummy_type_zprimme *x,
       PRIMME_INT ldx, dummy_type_zprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -373,14 +400,17 @@ int solve_correction_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_z
       PRIMME_INT ldevecsHat, dummy_type_zprimme *Mfact, int *ipivot, dummy_type_dprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_dprimme *ritzVals,
       dummy_type_dprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_dprimme computeRobustShiftzprimme(int blockIndex, double resNorm,
    dummy_type_dprimme *prevRitzVals, int numPrevRitzVals, dummy_type_dprimme *sortedRitzVals,
    dummy_type_dprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortzprimme(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
    int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockzprimme(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_dprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_dprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockzprimme(dummy_type_zprimme *r, PRIMME_INT ldr, dummy_type_zprimme *x,
       PRIMME_INT ldx, dummy_type_zprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -396,20 +426,119 @@ int setup_JD_projectorszprimme(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_dh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dh_sprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, dummy_type_dh_sprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dh_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *Mfact, int *ipivot, dummy_type_dprimme *lockedEvals,
+      int numLocked, int numConvergedStored, dummy_type_dprimme *ritzVals,
+      dummy_type_dprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
+      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
+dummy_type_dprimme computeRobustShiftdh_sprimme(int blockIndex, double resNorm,
+   dummy_type_dprimme *prevRitzVals, int numPrevRitzVals, dummy_type_dprimme *sortedRitzVals,
+   dummy_type_dprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
+void mergeSortdh_sprimme(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
+   int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
+   primme_params *primme);
+int Chebyshev_filter_blockdh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT ldx, dummy_type_dprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_dprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
+int Olsen_preconditioner_blockdh_sprimme(dummy_type_dh_sprimme *r, PRIMME_INT ldr, dummy_type_dh_sprimme *x,
+      PRIMME_INT ldx, dummy_type_dh_sprimme *Bx, PRIMME_INT ldBx, int blockSize,
+      primme_context ctx);
+int setup_JD_projectorsdh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT ldx, dummy_type_dh_sprimme *Bx,
+      PRIMME_INT ldBx, dummy_type_dh_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_dh_sprimme *Bevecs,
+      PRIMME_INT ldBevecs, dummy_type_dh_sprimme *evecsHat, PRIMME_INT ldevecsHat,
+      dummy_type_dh_sprimme *KinvBx, PRIMME_INT ldKinvBx, dummy_type_dprimme *xKinvBx,
+      dummy_type_dh_sprimme **LprojectorQ, PRIMME_INT *ldLprojectorQ, dummy_type_dh_sprimme **LprojectorX,
+      PRIMME_INT *ldLprojectorX, dummy_type_dh_sprimme **LprojectorBQ,
+      PRIMME_INT *ldLprojectorBQ, dummy_type_dh_sprimme **LprojectorBX,
+      PRIMME_INT *ldLprojectorBX, dummy_type_dh_sprimme **RprojectorQ,
+      PRIMME_INT *ldRprojectorQ, dummy_type_dh_sprimme **RprojectorX,
+      PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
+      int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
+      int numConverged, int blockSize, primme_context ctx);
+int solve_correction_dh_cprimme_normal(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_dh_cprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dh_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *Mfact, int *ipivot, dummy_type_zprimme *lockedEvals,
+      int numLocked, int numConvergedStored, dummy_type_zprimme *ritzVals,
+      dummy_type_zprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
+      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
+dummy_type_dprimme computeRobustShiftdh_cprimme_normal(int blockIndex, double resNorm,
+   dummy_type_dprimme *prevRitzVals, int numPrevRitzVals, dummy_type_dprimme *sortedRitzVals,
+   dummy_type_dprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
+void mergeSortdh_cprimme_normal(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
+   int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
+   primme_params *primme);
+int Chebyshev_filter_blockdh_cprimme_normal(dummy_type_dh_cprimme *x, PRIMME_INT ldx, dummy_type_zprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_dprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
+int Olsen_preconditioner_blockdh_cprimme_normal(dummy_type_dh_cprimme *r, PRIMME_INT ldr, dummy_type_dh_cprimme *x,
+      PRIMME_INT ldx, dummy_type_dh_cprimme *Bx, PRIMME_INT ldBx, int blockSize,
+      primme_context ctx);
+int setup_JD_projectorsdh_cprimme_normal(dummy_type_dh_cprimme *x, PRIMME_INT ldx, dummy_type_dh_cprimme *Bx,
+      PRIMME_INT ldBx, dummy_type_dh_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs,
+      PRIMME_INT ldBevecs, dummy_type_dh_cprimme *evecsHat, PRIMME_INT ldevecsHat,
+      dummy_type_dh_cprimme *KinvBx, PRIMME_INT ldKinvBx, dummy_type_zprimme *xKinvBx,
+      dummy_type_dh_cprimme **LprojectorQ, PRIMME_INT *ldLprojectorQ, dummy_type_dh_cprimme **LprojectorX,
+      PRIMME_INT *ldLprojectorX, dummy_type_dh_cprimme **LprojectorBQ,
+      PRIMME_INT *ldLprojectorBQ, dummy_type_dh_cprimme **LprojectorBX,
+      PRIMME_INT *ldLprojectorBX, dummy_type_dh_cprimme **RprojectorQ,
+      PRIMME_INT *ldRprojectorQ, dummy_type_dh_cprimme **RprojectorX,
+      PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
+      int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
+      int numConverged, int blockSize, primme_context ctx);
+int solve_correction_dh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_dh_cprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dh_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *Mfact, int *ipivot, dummy_type_dprimme *lockedEvals,
+      int numLocked, int numConvergedStored, dummy_type_dprimme *ritzVals,
+      dummy_type_dprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
+      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
+dummy_type_dprimme computeRobustShiftdh_cprimme(int blockIndex, double resNorm,
+   dummy_type_dprimme *prevRitzVals, int numPrevRitzVals, dummy_type_dprimme *sortedRitzVals,
+   dummy_type_dprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
+void mergeSortdh_cprimme(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
+   int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
+   primme_params *primme);
+int Chebyshev_filter_blockdh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT ldx, dummy_type_dprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_dprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
+int Olsen_preconditioner_blockdh_cprimme(dummy_type_dh_cprimme *r, PRIMME_INT ldr, dummy_type_dh_cprimme *x,
+      PRIMME_INT ldx, dummy_type_dh_cprimme *Bx, PRIMME_INT ldBx, int blockSize,
+      primme_context ctx);
+int setup_JD_projectorsdh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT ldx, dummy_type_dh_cprimme *Bx,
+      PRIMME_INT ldBx, dummy_type_dh_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs,
+      PRIMME_INT ldBevecs, dummy_type_dh_cprimme *evecsHat, PRIMME_INT ldevecsHat,
+      dummy_type_dh_cprimme *KinvBx, PRIMME_INT ldKinvBx, dummy_type_zprimme *xKinvBx,
+      dummy_type_dh_cprimme **LprojectorQ, PRIMME_INT *ldLprojectorQ, dummy_type_dh_cprimme **LprojectorX,
+      PRIMME_INT *ldLprojectorX, dummy_type_dh_cprimme **LprojectorBQ,
+      PRIMME_INT *ldLprojectorBQ, dummy_type_dh_cprimme **LprojectorBX,
+      PRIMME_INT *ldLprojectorBX, dummy_type_dh_cprimme **RprojectorQ,
+      PRIMME_INT *ldRprojectorQ, dummy_type_dh_cprimme **RprojectorX,
+      PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
+      int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
+      int numConverged, int blockSize, primme_context ctx);
 int solve_correction_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
       PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, dummy_type_magma_hprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_hprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_sprimme *Mfact, int *ipivot, dummy_type_sprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_sprimme *ritzVals,
       dummy_type_sprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftmagma_hprimme(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortmagma_hprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockmagma_hprimme(dummy_type_magma_hprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockmagma_hprimme(dummy_type_magma_hprimme *r, PRIMME_INT ldr, dummy_type_magma_hprimme *x,
       PRIMME_INT ldx, dummy_type_magma_hprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -431,14 +560,17 @@ int solve_correction_magma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_IN
       PRIMME_INT ldevecsHat, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_cprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_cprimme *ritzVals,
       dummy_type_cprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftmagma_kprimme_normal(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortmagma_kprimme_normal(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockmagma_kprimme_normal(dummy_type_magma_kprimme *x, PRIMME_INT ldx, dummy_type_cprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockmagma_kprimme_normal(dummy_type_magma_kprimme *r, PRIMME_INT ldr, dummy_type_magma_kprimme *x,
       PRIMME_INT ldx, dummy_type_magma_kprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -460,14 +592,17 @@ int solve_correction_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldevecsHat, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_sprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_sprimme *ritzVals,
       dummy_type_sprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftmagma_kprimme(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortmagma_kprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockmagma_kprimme(dummy_type_magma_kprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockmagma_kprimme(dummy_type_magma_kprimme *r, PRIMME_INT ldr, dummy_type_magma_kprimme *x,
       PRIMME_INT ldx, dummy_type_magma_kprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -489,14 +624,17 @@ int solve_correction_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldevecsHat, dummy_type_sprimme *Mfact, int *ipivot, dummy_type_sprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_sprimme *ritzVals,
       dummy_type_sprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftmagma_sprimme(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortmagma_sprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockmagma_sprimme(dummy_type_magma_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockmagma_sprimme(dummy_type_magma_sprimme *r, PRIMME_INT ldr, dummy_type_magma_sprimme *x,
       PRIMME_INT ldx, dummy_type_magma_sprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -518,14 +656,17 @@ int solve_correction_magma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_IN
       PRIMME_INT ldevecsHat, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_cprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_cprimme *ritzVals,
       dummy_type_cprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftmagma_cprimme_normal(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortmagma_cprimme_normal(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockmagma_cprimme_normal(dummy_type_magma_cprimme *x, PRIMME_INT ldx, dummy_type_cprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockmagma_cprimme_normal(dummy_type_magma_cprimme *r, PRIMME_INT ldr, dummy_type_magma_cprimme *x,
       PRIMME_INT ldx, dummy_type_magma_cprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -547,14 +688,17 @@ int solve_correction_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldevecsHat, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_sprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_sprimme *ritzVals,
       dummy_type_sprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_sprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_sprimme computeRobustShiftmagma_cprimme(int blockIndex, double resNorm,
    dummy_type_sprimme *prevRitzVals, int numPrevRitzVals, dummy_type_sprimme *sortedRitzVals,
    dummy_type_sprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortmagma_cprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockmagma_cprimme(dummy_type_magma_cprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_sprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockmagma_cprimme(dummy_type_magma_cprimme *r, PRIMME_INT ldr, dummy_type_magma_cprimme *x,
       PRIMME_INT ldx, dummy_type_magma_cprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -576,14 +720,17 @@ int solve_correction_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldevecsHat, dummy_type_dprimme *Mfact, int *ipivot, dummy_type_dprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_dprimme *ritzVals,
       dummy_type_dprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_dprimme computeRobustShiftmagma_dprimme(int blockIndex, double resNorm,
    dummy_type_dprimme *prevRitzVals, int numPrevRitzVals, dummy_type_dprimme *sortedRitzVals,
    dummy_type_dprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortmagma_dprimme(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
    int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockmagma_dprimme(dummy_type_magma_dprimme *x, PRIMME_INT ldx, dummy_type_dprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_dprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockmagma_dprimme(dummy_type_magma_dprimme *r, PRIMME_INT ldr, dummy_type_magma_dprimme *x,
       PRIMME_INT ldx, dummy_type_magma_dprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -605,14 +752,17 @@ int solve_correction_magma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_IN
       PRIMME_INT ldevecsHat, dummy_type_zprimme *Mfact, int *ipivot, dummy_type_zprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_zprimme *ritzVals,
       dummy_type_zprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_dprimme computeRobustShiftmagma_zprimme_normal(int blockIndex, double resNorm,
    dummy_type_dprimme *prevRitzVals, int numPrevRitzVals, dummy_type_dprimme *sortedRitzVals,
    dummy_type_dprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortmagma_zprimme_normal(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
    int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockmagma_zprimme_normal(dummy_type_magma_zprimme *x, PRIMME_INT ldx, dummy_type_zprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_dprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockmagma_zprimme_normal(dummy_type_magma_zprimme *r, PRIMME_INT ldr, dummy_type_magma_zprimme *x,
       PRIMME_INT ldx, dummy_type_magma_zprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -634,14 +784,17 @@ int solve_correction_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldevecsHat, dummy_type_zprimme *Mfact, int *ipivot, dummy_type_dprimme *lockedEvals,
       int numLocked, int numConvergedStored, dummy_type_dprimme *ritzVals,
       dummy_type_dprimme *prevRitzVals, int *numPrevRitzVals, int *flags, int basisSize,
-      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch, double startTime,
-      primme_context ctx);
+      dummy_type_dprimme *blockNorms, int *iev, int blockSize, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 dummy_type_dprimme computeRobustShiftmagma_zprimme(int blockIndex, double resNorm,
    dummy_type_dprimme *prevRitzVals, int numPrevRitzVals, dummy_type_dprimme *sortedRitzVals,
    dummy_type_dprimme *approxOlsenShift, int numSorted, int *ilev, primme_params *primme);
 void mergeSortmagma_zprimme(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
    int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int Chebyshev_filter_blockmagma_zprimme(dummy_type_magma_zprimme *x, PRIMME_INT ldx, dummy_type_dprimme *ritzVals,
+      int basisSize, int numLocked, dummy_type_dprimme *blockNorms, int blockSize,
+      int *filtered, primme_context ctx);
 int Olsen_preconditioner_blockmagma_zprimme(dummy_type_magma_zprimme *r, PRIMME_INT ldr, dummy_type_magma_zprimme *x,
       PRIMME_INT ldx, dummy_type_magma_zprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
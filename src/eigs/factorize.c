@@ -47,7 +47,7 @@
 
 #ifdef SUPPORTED_TYPE
 
-#if defined(USE_HOST) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF))
+#if defined(USE_HOST) && defined(BLASLAPACK_WITH_SCALAR)
 
 /******************************************************************************
  * Function UDUDecompose - This function computes an UDU decomposition of the
@@ -150,7 +150,7 @@ int UDUSolve_Sprimme(SCALAR *UDU, int *ipivot, int dim, SCALAR *rhs, int nrhs,
 
 }
 
-#endif /* defined(USE_HOST) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)) */
+#endif /* defined(USE_HOST) && defined(BLASLAPACK_WITH_SCALAR) */
 
 /*******************************************************************************
  * Subroutine update_XKinvBX - Updates the matrix M=X'*Kinv*B*X and returns
@@ -234,7 +234,7 @@ int update_XKinvBX_Sprimme(SCALAR *X, PRIMME_INT ldX, SCALAR *KinvBX,
    return 0;
 }
 
-#if defined(USE_HOST) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF))
+#if defined(USE_HOST) && defined(BLASLAPACK_WITH_SCALAR)
 
 /******************************************************************************
  * Function MSolve - This function solves a dense hermitian linear system
@@ -299,6 +299,6 @@ int MSolve_Sprimme(SCALAR *Mfact, int *ipivot, int dim, SCALAR *rhs, int nrhs,
    return 0;
 }
 
-#endif /* defined(USE_HOST) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)) */
+#endif /* defined(USE_HOST) && defined(BLASLAPACK_WITH_SCALAR) */
 
 #endif /* SUPPORTED_TYPE */
@@ -441,6 +441,14 @@ int update_XKinvBX_zprimme(dummy_type_zprimme *X, PRIMME_INT ldX, dummy_type_zpr
       primme_context ctx);
 int MSolve_zprimme(dummy_type_zprimme *Mfact, int *ipivot, int dim, dummy_type_zprimme *rhs, int nrhs,
       int ldrhs, dummy_type_zprimme *sol, int ldsol, primme_context ctx);
+int update_XKinvBX_dh_sprimme(dummy_type_dh_sprimme *X, PRIMME_INT ldX, dummy_type_dh_sprimme *KinvBX,
+      PRIMME_INT ldKinvBX, dummy_type_dprimme *M, int ldM, int numCols,
+      int blockSize, dummy_type_dprimme *Mfact, int ldMfact, int *ipivot,
+      primme_context ctx);
+int update_XKinvBX_dh_cprimme(dummy_type_dh_cprimme *X, PRIMME_INT ldX, dummy_type_dh_cprimme *KinvBX,
+      PRIMME_INT ldKinvBX, dummy_type_zprimme *M, int ldM, int numCols,
+      int blockSize, dummy_type_zprimme *Mfact, int ldMfact, int *ipivot,
+      primme_context ctx);
 int update_XKinvBX_magma_hprimme(dummy_type_magma_hprimme *X, PRIMME_INT ldX, dummy_type_magma_hprimme *KinvBX,
       PRIMME_INT ldKinvBX, dummy_type_sprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_sprimme *Mfact, int ldMfact, int *ipivot,
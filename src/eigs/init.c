@@ -185,6 +185,22 @@ int init_basis_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV, SCALAR *W,
    CHKERR(Num_copy_matrix_Sprimme(&evecs[primme->numOrthoConst * ldevecs],
          nLocal, initSize, ldevecs, V, ldV, ctx));
 
+   /* Append the basis kept by the workspace in the previous call, up to */
+   /* minRestartSize vectors in total                                    */
+
+   int numWarm = 0;
+   primme_workspace *ws = ctx.ws;
+   if (ws && ws->warmStart && ws->basis && ws->nLocal == nLocal) {
+      numWarm = min(ws->basisSize, primme->minRestartSize - initSize);
+      numWarm = max(0,
+            min(primme->n - primme->numOrthoConst - initSize, numWarm));
+      void *V0 = &V[ldV * initSize];
+      CHKERR(Num_matrix_astype_Sprimme(ws->basis, nLocal, numWarm, nLocal,
+            ws->basisType, &V0, &ldV, PRIMME_OP_SCALAR, 0 /* not alloc */,
+            1 /* copy */, ctx));
+      initSize += numWarm;
+   }
+
    switch (primme->initBasisMode) {
    case primme_init_krylov: random = 0; break;
    case primme_init_random:
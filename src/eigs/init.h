@@ -192,6 +192,28 @@ int init_block_krylovzprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_IN
       dummy_type_zprimme *W, PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_zprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_zprimme *VtBV,
       int ldVtBV, dummy_type_zprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_dh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_dh_sprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, dummy_type_dh_sprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dh_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *M, int ldM, dummy_type_dprimme *Mfact, int ldMfact,
+      int *ipivot, dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *fVtBV, int ldfVtBV,
+      int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
+      primme_context ctx);
+int init_block_krylovdh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dh_sprimme *W, PRIMME_INT ldW, dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
+      dummy_type_dh_sprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_dprimme *VtBV,
+      int ldVtBV, dummy_type_dprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_dh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_dh_cprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dh_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, int ldM, dummy_type_zprimme *Mfact, int ldMfact,
+      int *ipivot, dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *fVtBV, int ldfVtBV,
+      int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
+      primme_context ctx);
+int init_block_krylovdh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dh_cprimme *W, PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
+      dummy_type_dh_cprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_zprimme *VtBV,
+      int ldVtBV, dummy_type_zprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
 int init_basis_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
       PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, dummy_type_magma_hprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_hprimme *evecsHat,
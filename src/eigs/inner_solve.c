@@ -280,8 +280,9 @@ int inner_solve_Sprimme(int blockSize, SCALAR *x, PRIMME_INT ldx, SCALAR *Bx,
 
    for (i=0; i<blockSize; i++) Theta_prev[i] = 0.0L;
    for (i=0; i<blockSize; i++) eval_prev[i] = eval[i];
-   CHKERR(Num_dist_dots_real_Sprimme(
-         g, nLocal, d, nLocal, nLocal, blockSize, rho_prev, ctx));
+   primme_reduction reds[2];  /* Pending reductions */
+   CHKERR(Num_dist_dots_realStart_Sprimme(
+         g, nLocal, d, nLocal, nLocal, blockSize, rho_prev, &reds[0], ctx));
 
    /* Initialize recurrences used to dynamically update the eigenpair */
 
@@ -296,11 +297,14 @@ int inner_solve_Sprimme(int blockSize, SCALAR *x, PRIMME_INT ldx, SCALAR *Bx,
    if ((primme->correctionParams.convTest == primme_adaptive ||
              primme->correctionParams.convTest == primme_adaptive_ETolerance) &&
          primme->massMatrixMatvec) {
-      CHKERR(Num_dist_dots_real_Sprimme(
-            Bx, ldBx, Bx, ldBx, nLocal, blockSize, normBx, ctx));
+      CHKERRSUM(Num_dist_dots_realStart_Sprimme(Bx, ldBx, Bx, ldBx, nLocal,
+                      blockSize, normBx, &reds[1], ctx),
+            reds, 1);
+      CHKERRSUM(globalSumWait_Tprimme(&reds[1], ctx), reds, 2);
    } else {
       for (i = 0; i < blockSize; i++) normBx[i] = 1.0;
    }
+   CHKERR(globalSumWait_Tprimme(&reds[0], ctx));
 
    /*----------------------------------------------------------------------*/
    /*------------------------ Begin Inner Loop ----------------------------*/
@@ -310,6 +314,8 @@ int inner_solve_Sprimme(int blockSize, SCALAR *x, PRIMME_INT ldx, SCALAR *Bx,
    int numIts;        /* Number of inner iterations                          */
    for (numIts = 0; numIts < maxIterations && blockSize > 0; numIts++) {
 
+      double tIt = primme_wTimer(); /* Start of the iteration, for the trace */
+
       CHKERR(apply_projected_matrix(d, nLocal, shift, LprojectorQ,
             ldLprojectorQ, sizeLprojectorQ, LprojectorBQ, ldLprojectorBQ,
             LprojectorX, ldLprojectorX, LprojectorBX,
@@ -368,7 +374,10 @@ int inner_solve_Sprimme(int blockSize, SCALAR *x, PRIMME_INT ldx, SCALAR *Bx,
       blockSize -= conv;
       if (sizeLprojectorX) sizeLprojectorX -= conv;
       if (sizeRprojectorX) sizeRprojectorX -= conv;
-      if (blockSize <= 0) break;
+      if (blockSize <= 0) {
+         Trace_span("QMR iteration", tIt, ctx.trace);
+         break;
+      }
 
       CHKERR(Num_dist_dots_real_Sprimme(
             g, nLocal, g, nLocal, nLocal, blockSize, Theta, ctx));
@@ -408,18 +417,27 @@ int inner_solve_Sprimme(int blockSize, SCALAR *x, PRIMME_INT ldx, SCALAR *Bx,
 #endif
       }
 
-      if (dot_sol) CHKERR(globalSum_RHprimme(dot_sol, blockSize, ctx));
+      /* Start the reduction of dot_sol and send it together with the one of */
+      /* Bnormsol if the B-norm is needed                                     */
+
+      if (dot_sol) {
+         CHKERR(globalSumStart_RHprimme(dot_sol, blockSize, &reds[0], ctx));
+      }
 
       /* Compute B-norm of sol if adapting stopping and a generalized problem is
        * being solved */
 
       if (Bnormsol) {
-         CHKERR(massMatrixMatvec_Sprimme(
-               sol, ldsol, nLocal, w, nLocal, 0, blockSize, ctx));
-
-         CHKERR(Num_dist_dots_real_Sprimme(
-               sol, ldsol, w, nLocal, nLocal, blockSize, Bnormsol, ctx));
+         CHKERRSUM(massMatrixMatvec_Sprimme(
+                         sol, ldsol, nLocal, w, nLocal, 0, blockSize, ctx),
+               reds, dot_sol ? 1 : 0);
+
+         CHKERRSUM(Num_dist_dots_realStart_Sprimme(sol, ldsol, w, nLocal,
+                         nLocal, blockSize, Bnormsol, &reds[1], ctx),
+               reds, dot_sol ? 1 : 0);
+         CHKERRSUM(globalSumWait_Tprimme(&reds[1], ctx), reds, dot_sol ? 2 : 0);
       }
+      if (dot_sol) CHKERR(globalSumWait_Tprimme(&reds[0], ctx));
 
       for (i=0; i<blockSize; i++) p0[i] = i;
       for (i = conv = 0; i < blockSize; i++) {
@@ -604,7 +622,10 @@ int inner_solve_Sprimme(int blockSize, SCALAR *x, PRIMME_INT ldx, SCALAR *Bx,
       blockSize -= conv;
       if (sizeLprojectorX) sizeLprojectorX -= conv;
       if (sizeRprojectorX) sizeRprojectorX -= conv;
-      if (blockSize <= 0) break;
+      if (blockSize <= 0) {
+         Trace_span("QMR iteration", tIt, ctx.trace);
+         break;
+      }
 
       if (numIts + 1 < maxIterations) {
 
@@ -633,6 +654,8 @@ int inner_solve_Sprimme(int blockSize, SCALAR *x, PRIMME_INT ldx, SCALAR *Bx,
          w = ptmp;
       }
 
+      Trace_span("QMR iteration", tIt, ctx.trace);
+
      /* --------------------------------------------------------*/
    } /* End of QMR main while loop                              */
      /* --------------------------------------------------------*/
@@ -667,6 +690,233 @@ int inner_solve_Sprimme(int blockSize, SCALAR *x, PRIMME_INT ldx, SCALAR *Bx,
 
    return 0;
 }
+
+/*******************************************************************************
+ * Function inner_solve_wrapper - Call inner_solve with the arrays passed as
+ *    void pointers. Used by inner_solve_astype to run the inner iterations
+ *    in a precision other than the one of the caller.
+ *
+ * The arguments are the same as in inner_solve.
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int inner_solve_wrapper_Sprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      KIND(double, PRIMME_COMPLEX_DOUBLE) * shift, int *touch, double startTime,
+      primme_context ctx) {
+
+   return inner_solve_Sprimme(blockSize, (SCALAR *)x, ldx, (SCALAR *)Bx, ldBx,
+         (SCALAR *)r, ldr, (HREAL *)rnorm, (SCALAR *)evecs, ldevecs,
+         (HSCALAR *)Mfact, ipivot, (HSCALAR *)xKinvBx, (SCALAR *)LprojectorQ,
+         ldLprojectorQ, (SCALAR *)LprojectorX, ldLprojectorX,
+         (SCALAR *)LprojectorBQ, ldLprojectorBQ, (SCALAR *)LprojectorBX,
+         ldLprojectorBX, (SCALAR *)RprojectorQ, ldRprojectorQ,
+         (SCALAR *)RprojectorX, ldRprojectorX, sizeLprojectorQ,
+         sizeLprojectorX, sizeRprojectorQ, sizeRprojectorX, (SCALAR *)sol,
+         ldsol, (HEVAL *)eval, shift, touch, startTime, ctx);
+}
+
+/*******************************************************************************
+ * Function inner_solve_astype - Cast the vectors and the small matrices to
+ *    the precision t, call inner_solve in that precision, and cast the
+ *    solution back into sol.
+ *
+ *    Arrays passed several times (for instance x and LprojectorX, or evecs
+ *    and LprojectorQ) are cast once and the copy is shared, so that inner_solve
+ *    sees the same aliasing as when it is called directly.
+ *
+ *    The arrays in copies->src are not cast again if copies->copy already
+ *    has their columns in the precision t.
+ *
+ * Input parameters
+ * ----------------
+ * t       The precision of the inner iterations
+ *
+ * Input/Output parameters
+ * -----------------------
+ * copies  Copies of evecs, Bevecs and evecsHat in t kept by the caller;
+ *         if NULL, all arrays are cast
+ *
+ * The rest of arguments are the same as in inner_solve.
+ *
+ ******************************************************************************/
+
+#define INNER_SOLVE_NVECS 10
+
+TEMPLATE_PLEASE
+int inner_solve_astype_Sprimme(primme_op_datatype t, int blockSize, SCALAR *x,
+      PRIMME_INT ldx, SCALAR *Bx, PRIMME_INT ldBx, SCALAR *r, PRIMME_INT ldr,
+      HREAL *rnorm, SCALAR *evecs, PRIMME_INT ldevecs, HSCALAR *Mfact,
+      int *ipivot, HSCALAR *xKinvBx, SCALAR *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, SCALAR *LprojectorX, PRIMME_INT ldLprojectorX,
+      SCALAR *LprojectorBQ, PRIMME_INT ldLprojectorBQ, SCALAR *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, SCALAR *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      SCALAR *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      SCALAR *sol, PRIMME_INT ldsol, HEVAL *eval,
+      KIND(double, PRIMME_COMPLEX_DOUBLE) * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+
+   /* The host type of half precision is float */
+
+   primme_op_datatype ht = (t == primme_op_half ? primme_op_float : t);
+
+   /* Cast the vectors. v[i] is used with at most n[i] columns */
+
+   SCALAR *v[INNER_SOLVE_NVECS] = {x, Bx, r, evecs, LprojectorQ, LprojectorX,
+         LprojectorBQ, LprojectorBX, RprojectorQ, RprojectorX};
+   PRIMME_INT ldv[INNER_SOLVE_NVECS] = {ldx, ldBx, ldr, ldevecs, ldLprojectorQ,
+         ldLprojectorX, ldLprojectorBQ, ldLprojectorBX, ldRprojectorQ,
+         ldRprojectorX};
+   int n[INNER_SOLVE_NVECS] = {blockSize, blockSize, blockSize,
+         sizeRprojectorQ, sizeLprojectorQ, sizeLprojectorX, sizeLprojectorQ,
+         sizeLprojectorX, sizeRprojectorQ, sizeRprojectorX};
+   void *vt[INNER_SOLVE_NVECS];
+   PRIMME_INT ldvt[INNER_SOLVE_NVECS];
+   int owner[INNER_SOLVE_NVECS]; /* index of the first alias of v[i] */
+   int kept[INNER_SOLVE_NVECS];  /* whether vt[i] is in copies */
+
+   int i, j;
+   for (i = 0; i < INNER_SOLVE_NVECS; i++) {
+      owner[i] = i;
+      for (j = 0; j < i; j++) {
+         if (v[j] == v[i]) {
+            owner[i] = j;
+            n[j] = max(n[j], n[i]);
+            break;
+         }
+      }
+   }
+   for (i = 0; i < INNER_SOLVE_NVECS; i++) {
+      vt[i] = NULL;
+      ldvt[i] = nLocal;
+      kept[i] = 0;
+      if (owner[i] < i) {
+         vt[i] = vt[owner[i]];
+         ldvt[i] = ldvt[owner[i]];
+         continue;
+      }
+      if (!v[i] || n[i] <= 0) continue;
+
+      /* Reuse the copy kept by the caller; cast v[i] again only if the */
+      /* number of columns has changed since the last restart           */
+
+      for (j = 0; copies && j < 3; j++) {
+         if (copies->copy[j] && copies->src[j] == (void *)v[i]) break;
+      }
+      if (copies && j < 3) {
+         if (copies->n[j] != n[i]) {
+            CHKERR(Num_matrix_astype_Sprimme(v[i], nLocal, n[i], ldv[i],
+                  PRIMME_OP_SCALAR, &copies->copy[j], &copies->ldcopy[j], t,
+                  0 /* not alloc */, 1 /* copy */, ctx));
+            copies->n[j] = n[i];
+         }
+         vt[i] = copies->copy[j];
+         ldvt[i] = copies->ldcopy[j];
+         kept[i] = 1;
+      } else {
+         CHKERR(Num_matrix_astype_Sprimme(v[i], nLocal, n[i], ldv[i],
+               PRIMME_OP_SCALAR, &vt[i], &ldvt[i], t, 1 /* alloc */,
+               1 /* copy */, ctx));
+      }
+   }
+
+   /* Cast the small arrays */
+
+   void *Mfactt = NULL, *xKinvBxt = NULL, *rnormt = NULL, *evalt = NULL;
+   if (Mfact && sizeRprojectorQ > 0) {
+      CHKERR(Num_matrix_astype_SHprimme(Mfact, sizeRprojectorQ,
+            sizeRprojectorQ, sizeRprojectorQ, PRIMME_OP_HSCALAR, &Mfactt, NULL,
+            ht, 1 /* alloc */, 1 /* copy */, ctx));
+   }
+   CHKERR(Num_matrix_astype_SHprimme(xKinvBx, 1, blockSize, 1,
+         PRIMME_OP_HSCALAR, &xKinvBxt, NULL, ht, 1 /* alloc */, 1 /* copy */,
+         ctx));
+   CHKERR(Num_matrix_astype_RHprimme(rnorm, 1, blockSize, 1, PRIMME_OP_HREAL,
+         &rnormt, NULL, ht, 1 /* alloc */, 1 /* copy */, ctx));
+   CHKERR(Num_matrix_astype_RHprimme(eval, 1, blockSize, 1, PRIMME_OP_HREAL,
+         &evalt, NULL, ht, 1 /* alloc */, 1 /* copy */, ctx));
+
+   /* Allocate the solution */
+
+   void *solt = NULL;
+   PRIMME_INT ldsolt;
+   CHKERR(Num_matrix_astype_Sprimme(sol, nLocal, blockSize, ldsol,
+         PRIMME_OP_SCALAR, &solt, &ldsolt, t, 1 /* alloc */, 0 /* not copy */,
+         ctx));
+
+   /* Call inner_solve in the precision t */
+
+   switch (t) {
+#  ifdef SUPPORTED_HALF_TYPE
+   case primme_op_half:
+      CHKERR(inner_solve_wrapper_Shprimme(blockSize, vt[0], ldvt[0], vt[1],
+            ldvt[1], vt[2], ldvt[2], rnormt, vt[3], ldvt[3], Mfactt, ipivot,
+            xKinvBxt, vt[4], ldvt[4], vt[5], ldvt[5], vt[6], ldvt[6], vt[7],
+            ldvt[7], vt[8], ldvt[8], vt[9], ldvt[9], sizeLprojectorQ,
+            sizeLprojectorX, sizeRprojectorQ, sizeRprojectorX, solt, ldsolt,
+            evalt, shift, touch, startTime, ctx));
+      break;
+#  endif
+#  ifndef PRIMME_WITHOUT_FLOAT
+   case primme_op_float:
+      CHKERR(inner_solve_wrapper_Ssprimme(blockSize, vt[0], ldvt[0], vt[1],
+            ldvt[1], vt[2], ldvt[2], rnormt, vt[3], ldvt[3], Mfactt, ipivot,
+            xKinvBxt, vt[4], ldvt[4], vt[5], ldvt[5], vt[6], ldvt[6], vt[7],
+            ldvt[7], vt[8], ldvt[8], vt[9], ldvt[9], sizeLprojectorQ,
+            sizeLprojectorX, sizeRprojectorQ, sizeRprojectorX, solt, ldsolt,
+            evalt, shift, touch, startTime, ctx));
+      break;
+#  endif
+   case primme_op_double:
+      CHKERR(inner_solve_wrapper_Sdprimme(blockSize, vt[0], ldvt[0], vt[1],
+            ldvt[1], vt[2], ldvt[2], rnormt, vt[3], ldvt[3], Mfactt, ipivot,
+            xKinvBxt, vt[4], ldvt[4], vt[5], ldvt[5], vt[6], ldvt[6], vt[7],
+            ldvt[7], vt[8], ldvt[8], vt[9], ldvt[9], sizeLprojectorQ,
+            sizeLprojectorX, sizeRprojectorQ, sizeRprojectorX, solt, ldsolt,
+            evalt, shift, touch, startTime, ctx));
+      break;
+#  ifdef PRIMME_WITH_NATIVE_QUAD
+   case primme_op_quad:
+      CHKERR(inner_solve_wrapper_Sqprimme(blockSize, vt[0], ldvt[0], vt[1],
+            ldvt[1], vt[2], ldvt[2], rnormt, vt[3], ldvt[3], Mfactt, ipivot,
+            xKinvBxt, vt[4], ldvt[4], vt[5], ldvt[5], vt[6], ldvt[6], vt[7],
+            ldvt[7], vt[8], ldvt[8], vt[9], ldvt[9], sizeLprojectorQ,
+            sizeLprojectorX, sizeRprojectorQ, sizeRprojectorX, solt, ldsolt,
+            evalt, shift, touch, startTime, ctx));
+      break;
+#  endif
+   default: CHKERR(PRIMME_FUNCTION_UNAVAILABLE);
+   }
+
+   /* Copy back the solution and destroy the copies */
+
+   CHKERR(Num_matrix_astype_Sprimme(solt, nLocal, blockSize, ldsolt, t,
+         (void **)&sol, &ldsol, PRIMME_OP_SCALAR, -1 /* destroy */,
+         1 /* copy */, ctx));
+   for (i = 0; i < INNER_SOLVE_NVECS; i++) {
+      if (owner[i] == i && !kept[i]) {
+         CHKERR(Num_free_Sprimme((SCALAR *)vt[i], ctx));
+      }
+   }
+   CHKERR(Num_free_SHprimme((HSCALAR *)Mfactt, ctx));
+   CHKERR(Num_free_SHprimme((HSCALAR *)xKinvBxt, ctx));
+   CHKERR(Num_free_RHprimme((HREAL *)rnormt, ctx));
+   CHKERR(Num_free_RHprimme((HREAL *)evalt, ctx));
+
+   return 0;
+}
    
 
 /*******************************************************************************
@@ -803,6 +1053,7 @@ STATIC int apply_skew_projector(SCALAR *Q, PRIMME_INT ldQ, SCALAR *Qhat,
    CHKERR(Num_free_SHprimme(overlaps, ctx));
 
    if (primme) primme->stats.timeOrtho += primme_wTimer() - t0;
+   Trace_span("ortho", t0, ctx.trace);
 
    return 0;
 }
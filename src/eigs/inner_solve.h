@@ -134,6 +134,209 @@ int inner_solve_dprimme(int blockSize, dummy_type_dprimme *x, PRIMME_INT ldx, du
       int sizeRprojectorX, dummy_type_dprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_Sprimme)
+#  define inner_solve_wrapper_Sprimme CONCAT(inner_solve_wrapper_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_Rprimme)
+#  define inner_solve_wrapper_Rprimme CONCAT(inner_solve_wrapper_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_SHprimme)
+#  define inner_solve_wrapper_SHprimme CONCAT(inner_solve_wrapper_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_RHprimme)
+#  define inner_solve_wrapper_RHprimme CONCAT(inner_solve_wrapper_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_SXprimme)
+#  define inner_solve_wrapper_SXprimme CONCAT(inner_solve_wrapper_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_RXprimme)
+#  define inner_solve_wrapper_RXprimme CONCAT(inner_solve_wrapper_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_Shprimme)
+#  define inner_solve_wrapper_Shprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_Rhprimme)
+#  define inner_solve_wrapper_Rhprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_Ssprimme)
+#  define inner_solve_wrapper_Ssprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_Rsprimme)
+#  define inner_solve_wrapper_Rsprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_Sdprimme)
+#  define inner_solve_wrapper_Sdprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_Rdprimme)
+#  define inner_solve_wrapper_Rdprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_Sqprimme)
+#  define inner_solve_wrapper_Sqprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_Rqprimme)
+#  define inner_solve_wrapper_Rqprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_SXhprimme)
+#  define inner_solve_wrapper_SXhprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_RXhprimme)
+#  define inner_solve_wrapper_RXhprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_SXsprimme)
+#  define inner_solve_wrapper_SXsprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_RXsprimme)
+#  define inner_solve_wrapper_RXsprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_SXdprimme)
+#  define inner_solve_wrapper_SXdprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_RXdprimme)
+#  define inner_solve_wrapper_RXdprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_SXqprimme)
+#  define inner_solve_wrapper_SXqprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_RXqprimme)
+#  define inner_solve_wrapper_RXqprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_SHhprimme)
+#  define inner_solve_wrapper_SHhprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_RHhprimme)
+#  define inner_solve_wrapper_RHhprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_SHsprimme)
+#  define inner_solve_wrapper_SHsprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_RHsprimme)
+#  define inner_solve_wrapper_RHsprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_SHdprimme)
+#  define inner_solve_wrapper_SHdprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_RHdprimme)
+#  define inner_solve_wrapper_RHdprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_SHqprimme)
+#  define inner_solve_wrapper_SHqprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_wrapper_RHqprimme)
+#  define inner_solve_wrapper_RHqprimme CONCAT(inner_solve_wrapper_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int inner_solve_wrapper_dprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_Sprimme)
+#  define inner_solve_astype_Sprimme CONCAT(inner_solve_astype_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_Rprimme)
+#  define inner_solve_astype_Rprimme CONCAT(inner_solve_astype_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_SHprimme)
+#  define inner_solve_astype_SHprimme CONCAT(inner_solve_astype_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_RHprimme)
+#  define inner_solve_astype_RHprimme CONCAT(inner_solve_astype_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_SXprimme)
+#  define inner_solve_astype_SXprimme CONCAT(inner_solve_astype_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_RXprimme)
+#  define inner_solve_astype_RXprimme CONCAT(inner_solve_astype_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_Shprimme)
+#  define inner_solve_astype_Shprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_Rhprimme)
+#  define inner_solve_astype_Rhprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_Ssprimme)
+#  define inner_solve_astype_Ssprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_Rsprimme)
+#  define inner_solve_astype_Rsprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_Sdprimme)
+#  define inner_solve_astype_Sdprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_Rdprimme)
+#  define inner_solve_astype_Rdprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_Sqprimme)
+#  define inner_solve_astype_Sqprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_Rqprimme)
+#  define inner_solve_astype_Rqprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_SXhprimme)
+#  define inner_solve_astype_SXhprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_RXhprimme)
+#  define inner_solve_astype_RXhprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_SXsprimme)
+#  define inner_solve_astype_SXsprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_RXsprimme)
+#  define inner_solve_astype_RXsprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_SXdprimme)
+#  define inner_solve_astype_SXdprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_RXdprimme)
+#  define inner_solve_astype_RXdprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_SXqprimme)
+#  define inner_solve_astype_SXqprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_RXqprimme)
+#  define inner_solve_astype_RXqprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_SHhprimme)
+#  define inner_solve_astype_SHhprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_RHhprimme)
+#  define inner_solve_astype_RHhprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_SHsprimme)
+#  define inner_solve_astype_SHsprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_RHsprimme)
+#  define inner_solve_astype_RHsprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_SHdprimme)
+#  define inner_solve_astype_SHdprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_RHdprimme)
+#  define inner_solve_astype_RHdprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_SHqprimme)
+#  define inner_solve_astype_SHqprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_astype_RHqprimme)
+#  define inner_solve_astype_RHqprimme CONCAT(inner_solve_astype_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int inner_solve_astype_dprimme(primme_op_datatype t, int blockSize, dummy_type_dprimme *x,
+      PRIMME_INT ldx, dummy_type_dprimme *Bx, PRIMME_INT ldBx, dummy_type_dprimme *r, PRIMME_INT ldr,
+      dummy_type_dprimme *rnorm, dummy_type_dprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *Mfact,
+      int *ipivot, dummy_type_dprimme *xKinvBx, dummy_type_dprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_dprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_dprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_dprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_dprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_dprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_dprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(apply_projected_preconditioner)
 #  define apply_projected_preconditioner CONCAT(apply_projected_preconditioner,WITH_KIND(SCALAR_SUF))
 #endif
@@ -171,6 +374,29 @@ int inner_solve_hprimme(int blockSize, dummy_type_hprimme *x, PRIMME_INT ldx, du
       int sizeRprojectorX, dummy_type_hprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_hprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_hprimme(primme_op_datatype t, int blockSize, dummy_type_hprimme *x,
+      PRIMME_INT ldx, dummy_type_hprimme *Bx, PRIMME_INT ldBx, dummy_type_hprimme *r, PRIMME_INT ldr,
+      dummy_type_sprimme *rnorm, dummy_type_hprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *Mfact,
+      int *ipivot, dummy_type_sprimme *xKinvBx, dummy_type_hprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_hprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_hprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_hprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_hprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_hprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_hprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionerhprimme(dummy_type_hprimme *v, PRIMME_INT ldv, dummy_type_hprimme *Q,
       PRIMME_INT ldQ, dummy_type_hprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_hprimme *x,
       PRIMME_INT ldx, dummy_type_hprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -196,6 +422,29 @@ int inner_solve_kprimme(int blockSize, dummy_type_kprimme *x, PRIMME_INT ldx, du
       int sizeRprojectorX, dummy_type_kprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_kprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_kprimme(primme_op_datatype t, int blockSize, dummy_type_kprimme *x,
+      PRIMME_INT ldx, dummy_type_kprimme *Bx, PRIMME_INT ldBx, dummy_type_kprimme *r, PRIMME_INT ldr,
+      dummy_type_sprimme *rnorm, dummy_type_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *Mfact,
+      int *ipivot, dummy_type_cprimme *xKinvBx, dummy_type_kprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_kprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_kprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_kprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_kprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_kprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_kprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionerkprimme(dummy_type_kprimme *v, PRIMME_INT ldv, dummy_type_kprimme *Q,
       PRIMME_INT ldQ, dummy_type_kprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_kprimme *x,
       PRIMME_INT ldx, dummy_type_kprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -221,6 +470,29 @@ int inner_solve_sprimme(int blockSize, dummy_type_sprimme *x, PRIMME_INT ldx, du
       int sizeRprojectorX, dummy_type_sprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_sprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_sprimme(primme_op_datatype t, int blockSize, dummy_type_sprimme *x,
+      PRIMME_INT ldx, dummy_type_sprimme *Bx, PRIMME_INT ldBx, dummy_type_sprimme *r, PRIMME_INT ldr,
+      dummy_type_sprimme *rnorm, dummy_type_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *Mfact,
+      int *ipivot, dummy_type_sprimme *xKinvBx, dummy_type_sprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_sprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_sprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_sprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_sprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_sprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_sprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionersprimme(dummy_type_sprimme *v, PRIMME_INT ldv, dummy_type_sprimme *Q,
       PRIMME_INT ldQ, dummy_type_sprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_sprimme *x,
       PRIMME_INT ldx, dummy_type_sprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -246,6 +518,29 @@ int inner_solve_cprimme(int blockSize, dummy_type_cprimme *x, PRIMME_INT ldx, du
       int sizeRprojectorX, dummy_type_cprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_cprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_cprimme(primme_op_datatype t, int blockSize, dummy_type_cprimme *x,
+      PRIMME_INT ldx, dummy_type_cprimme *Bx, PRIMME_INT ldBx, dummy_type_cprimme *r, PRIMME_INT ldr,
+      dummy_type_sprimme *rnorm, dummy_type_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *Mfact,
+      int *ipivot, dummy_type_cprimme *xKinvBx, dummy_type_cprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_cprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_cprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_cprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_cprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_cprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_cprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionercprimme(dummy_type_cprimme *v, PRIMME_INT ldv, dummy_type_cprimme *Q,
       PRIMME_INT ldQ, dummy_type_cprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_cprimme *x,
       PRIMME_INT ldx, dummy_type_cprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -271,6 +566,29 @@ int inner_solve_zprimme(int blockSize, dummy_type_zprimme *x, PRIMME_INT ldx, du
       int sizeRprojectorX, dummy_type_zprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_zprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_zprimme(primme_op_datatype t, int blockSize, dummy_type_zprimme *x,
+      PRIMME_INT ldx, dummy_type_zprimme *Bx, PRIMME_INT ldBx, dummy_type_zprimme *r, PRIMME_INT ldr,
+      dummy_type_dprimme *rnorm, dummy_type_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *Mfact,
+      int *ipivot, dummy_type_zprimme *xKinvBx, dummy_type_zprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_zprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_zprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_zprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_zprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_zprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_zprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionerzprimme(dummy_type_zprimme *v, PRIMME_INT ldv, dummy_type_zprimme *Q,
       PRIMME_INT ldQ, dummy_type_zprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_zprimme *x,
       PRIMME_INT ldx, dummy_type_zprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -285,6 +603,102 @@ int apply_projected_matrixzprimme(dummy_type_zprimme *v, PRIMME_INT ldv, double
       PRIMME_INT ldX, dummy_type_zprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_zprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_poszprimme(int *p, int val, int pos, int n);
+int inner_solve_dh_sprimme(int blockSize, dummy_type_dh_sprimme *x, PRIMME_INT ldx, dummy_type_dh_sprimme *Bx,
+      PRIMME_INT ldBx, dummy_type_dh_sprimme *r, PRIMME_INT ldr, dummy_type_dprimme *rnorm, dummy_type_dh_sprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dprimme *Mfact, int *ipivot, dummy_type_dprimme *xKinvBx,
+      dummy_type_dh_sprimme *LprojectorQ, PRIMME_INT ldLprojectorQ, dummy_type_dh_sprimme *LprojectorX,
+      PRIMME_INT ldLprojectorX, dummy_type_dh_sprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      dummy_type_dh_sprimme *LprojectorBX, PRIMME_INT ldLprojectorBX, dummy_type_dh_sprimme *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, dummy_type_dh_sprimme *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, dummy_type_dh_sprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_wrapper_dh_sprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_dh_sprimme(primme_op_datatype t, int blockSize, dummy_type_dh_sprimme *x,
+      PRIMME_INT ldx, dummy_type_dh_sprimme *Bx, PRIMME_INT ldBx, dummy_type_dh_sprimme *r, PRIMME_INT ldr,
+      dummy_type_dprimme *rnorm, dummy_type_dh_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *Mfact,
+      int *ipivot, dummy_type_dprimme *xKinvBx, dummy_type_dh_sprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_dh_sprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_dh_sprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_dh_sprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_dh_sprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_dh_sprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_dh_sprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
+int apply_projected_preconditionerdh_sprimme(dummy_type_dh_sprimme *v, PRIMME_INT ldv, dummy_type_dh_sprimme *Q,
+      PRIMME_INT ldQ, dummy_type_dh_sprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_dh_sprimme *x,
+      PRIMME_INT ldx, dummy_type_dh_sprimme *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeRprojectorQ, int sizeRprojectorX, dummy_type_dprimme *xKinvBx,
+      dummy_type_dprimme *Mfact, int *ipivot, dummy_type_dh_sprimme *result, PRIMME_INT ldresult,
+      int blockSize, primme_context ctx);
+int apply_skew_projectordh_sprimme(dummy_type_dh_sprimme *Q, PRIMME_INT ldQ, dummy_type_dh_sprimme *Qhat,
+      PRIMME_INT ldQhat, dummy_type_dprimme *Mfact, int *ipivot, int numCols, dummy_type_dh_sprimme *v,
+      PRIMME_INT ldv, int blockSize, primme_context ctx);
+int apply_projected_matrixdh_sprimme(dummy_type_dh_sprimme *v, PRIMME_INT ldv, double *shift,
+      dummy_type_dh_sprimme *Q, PRIMME_INT ldQ, int nQ, dummy_type_dh_sprimme *BQ, PRIMME_INT ldBQ, dummy_type_dh_sprimme *X,
+      PRIMME_INT ldX, dummy_type_dh_sprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
+      dummy_type_dh_sprimme *result, PRIMME_INT ldresult, primme_context ctx);
+int perm_set_value_on_posdh_sprimme(int *p, int val, int pos, int n);
+int inner_solve_dh_cprimme(int blockSize, dummy_type_dh_cprimme *x, PRIMME_INT ldx, dummy_type_dh_cprimme *Bx,
+      PRIMME_INT ldBx, dummy_type_dh_cprimme *r, PRIMME_INT ldr, dummy_type_dprimme *rnorm, dummy_type_dh_cprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_zprimme *Mfact, int *ipivot, dummy_type_zprimme *xKinvBx,
+      dummy_type_dh_cprimme *LprojectorQ, PRIMME_INT ldLprojectorQ, dummy_type_dh_cprimme *LprojectorX,
+      PRIMME_INT ldLprojectorX, dummy_type_dh_cprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      dummy_type_dh_cprimme *LprojectorBX, PRIMME_INT ldLprojectorBX, dummy_type_dh_cprimme *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, dummy_type_dh_cprimme *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, dummy_type_dh_cprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_wrapper_dh_cprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_dh_cprimme(primme_op_datatype t, int blockSize, dummy_type_dh_cprimme *x,
+      PRIMME_INT ldx, dummy_type_dh_cprimme *Bx, PRIMME_INT ldBx, dummy_type_dh_cprimme *r, PRIMME_INT ldr,
+      dummy_type_dprimme *rnorm, dummy_type_dh_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *Mfact,
+      int *ipivot, dummy_type_zprimme *xKinvBx, dummy_type_dh_cprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_dh_cprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_dh_cprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_dh_cprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_dh_cprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_dh_cprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_dh_cprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
+int apply_projected_preconditionerdh_cprimme(dummy_type_dh_cprimme *v, PRIMME_INT ldv, dummy_type_dh_cprimme *Q,
+      PRIMME_INT ldQ, dummy_type_dh_cprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_dh_cprimme *x,
+      PRIMME_INT ldx, dummy_type_dh_cprimme *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeRprojectorQ, int sizeRprojectorX, dummy_type_zprimme *xKinvBx,
+      dummy_type_zprimme *Mfact, int *ipivot, dummy_type_dh_cprimme *result, PRIMME_INT ldresult,
+      int blockSize, primme_context ctx);
+int apply_skew_projectordh_cprimme(dummy_type_dh_cprimme *Q, PRIMME_INT ldQ, dummy_type_dh_cprimme *Qhat,
+      PRIMME_INT ldQhat, dummy_type_zprimme *Mfact, int *ipivot, int numCols, dummy_type_dh_cprimme *v,
+      PRIMME_INT ldv, int blockSize, primme_context ctx);
+int apply_projected_matrixdh_cprimme(dummy_type_dh_cprimme *v, PRIMME_INT ldv, double *shift,
+      dummy_type_dh_cprimme *Q, PRIMME_INT ldQ, int nQ, dummy_type_dh_cprimme *BQ, PRIMME_INT ldBQ, dummy_type_dh_cprimme *X,
+      PRIMME_INT ldX, dummy_type_dh_cprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
+      dummy_type_dh_cprimme *result, PRIMME_INT ldresult, primme_context ctx);
+int perm_set_value_on_posdh_cprimme(int *p, int val, int pos, int n);
 int inner_solve_magma_hprimme(int blockSize, dummy_type_magma_hprimme *x, PRIMME_INT ldx, dummy_type_magma_hprimme *Bx,
       PRIMME_INT ldBx, dummy_type_magma_hprimme *r, PRIMME_INT ldr, dummy_type_sprimme *rnorm, dummy_type_magma_hprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_sprimme *Mfact, int *ipivot, dummy_type_sprimme *xKinvBx,
@@ -296,6 +710,29 @@ int inner_solve_magma_hprimme(int blockSize, dummy_type_magma_hprimme *x, PRIMME
       int sizeRprojectorX, dummy_type_magma_hprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_magma_hprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_magma_hprimme(primme_op_datatype t, int blockSize, dummy_type_magma_hprimme *x,
+      PRIMME_INT ldx, dummy_type_magma_hprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_hprimme *r, PRIMME_INT ldr,
+      dummy_type_sprimme *rnorm, dummy_type_magma_hprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *Mfact,
+      int *ipivot, dummy_type_sprimme *xKinvBx, dummy_type_magma_hprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_magma_hprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_magma_hprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_magma_hprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_magma_hprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_magma_hprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_magma_hprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionermagma_hprimme(dummy_type_magma_hprimme *v, PRIMME_INT ldv, dummy_type_magma_hprimme *Q,
       PRIMME_INT ldQ, dummy_type_magma_hprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_magma_hprimme *x,
       PRIMME_INT ldx, dummy_type_magma_hprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -321,6 +758,29 @@ int inner_solve_magma_kprimme(int blockSize, dummy_type_magma_kprimme *x, PRIMME
       int sizeRprojectorX, dummy_type_magma_kprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_magma_kprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_magma_kprimme(primme_op_datatype t, int blockSize, dummy_type_magma_kprimme *x,
+      PRIMME_INT ldx, dummy_type_magma_kprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_kprimme *r, PRIMME_INT ldr,
+      dummy_type_sprimme *rnorm, dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *Mfact,
+      int *ipivot, dummy_type_cprimme *xKinvBx, dummy_type_magma_kprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_magma_kprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_magma_kprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_magma_kprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_magma_kprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_magma_kprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_magma_kprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionermagma_kprimme(dummy_type_magma_kprimme *v, PRIMME_INT ldv, dummy_type_magma_kprimme *Q,
       PRIMME_INT ldQ, dummy_type_magma_kprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_magma_kprimme *x,
       PRIMME_INT ldx, dummy_type_magma_kprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -346,6 +806,29 @@ int inner_solve_magma_sprimme(int blockSize, dummy_type_magma_sprimme *x, PRIMME
       int sizeRprojectorX, dummy_type_magma_sprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_magma_sprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_magma_sprimme(primme_op_datatype t, int blockSize, dummy_type_magma_sprimme *x,
+      PRIMME_INT ldx, dummy_type_magma_sprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_sprimme *r, PRIMME_INT ldr,
+      dummy_type_sprimme *rnorm, dummy_type_magma_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *Mfact,
+      int *ipivot, dummy_type_sprimme *xKinvBx, dummy_type_magma_sprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_magma_sprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_magma_sprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_magma_sprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_magma_sprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_magma_sprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_magma_sprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionermagma_sprimme(dummy_type_magma_sprimme *v, PRIMME_INT ldv, dummy_type_magma_sprimme *Q,
       PRIMME_INT ldQ, dummy_type_magma_sprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_magma_sprimme *x,
       PRIMME_INT ldx, dummy_type_magma_sprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -371,6 +854,29 @@ int inner_solve_magma_cprimme(int blockSize, dummy_type_magma_cprimme *x, PRIMME
       int sizeRprojectorX, dummy_type_magma_cprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_magma_cprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_magma_cprimme(primme_op_datatype t, int blockSize, dummy_type_magma_cprimme *x,
+      PRIMME_INT ldx, dummy_type_magma_cprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_cprimme *r, PRIMME_INT ldr,
+      dummy_type_sprimme *rnorm, dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *Mfact,
+      int *ipivot, dummy_type_cprimme *xKinvBx, dummy_type_magma_cprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_magma_cprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_magma_cprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_magma_cprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_magma_cprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_magma_cprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_magma_cprimme *sol, PRIMME_INT ldsol, dummy_type_sprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionermagma_cprimme(dummy_type_magma_cprimme *v, PRIMME_INT ldv, dummy_type_magma_cprimme *Q,
       PRIMME_INT ldQ, dummy_type_magma_cprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_magma_cprimme *x,
       PRIMME_INT ldx, dummy_type_magma_cprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -396,6 +902,29 @@ int inner_solve_magma_dprimme(int blockSize, dummy_type_magma_dprimme *x, PRIMME
       int sizeRprojectorX, dummy_type_magma_dprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_magma_dprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_magma_dprimme(primme_op_datatype t, int blockSize, dummy_type_magma_dprimme *x,
+      PRIMME_INT ldx, dummy_type_magma_dprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_dprimme *r, PRIMME_INT ldr,
+      dummy_type_dprimme *rnorm, dummy_type_magma_dprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *Mfact,
+      int *ipivot, dummy_type_dprimme *xKinvBx, dummy_type_magma_dprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_magma_dprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_magma_dprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_magma_dprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_magma_dprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_magma_dprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_magma_dprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionermagma_dprimme(dummy_type_magma_dprimme *v, PRIMME_INT ldv, dummy_type_magma_dprimme *Q,
       PRIMME_INT ldQ, dummy_type_magma_dprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_magma_dprimme *x,
       PRIMME_INT ldx, dummy_type_magma_dprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -421,6 +950,29 @@ int inner_solve_magma_zprimme(int blockSize, dummy_type_magma_zprimme *x, PRIMME
       int sizeRprojectorX, dummy_type_magma_zprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
       double * shift, int *touch, double startTime,
       primme_context ctx);
+int inner_solve_wrapper_magma_zprimme(int blockSize, void *x, PRIMME_INT ldx,
+      void *Bx, PRIMME_INT ldBx, void *r, PRIMME_INT ldr, void *rnorm,
+      void *evecs, PRIMME_INT ldevecs, void *Mfact, int *ipivot, void *xKinvBx,
+      void *LprojectorQ, PRIMME_INT ldLprojectorQ, void *LprojectorX,
+      PRIMME_INT ldLprojectorX, void *LprojectorBQ, PRIMME_INT ldLprojectorBQ,
+      void *LprojectorBX, PRIMME_INT ldLprojectorBX, void *RprojectorQ,
+      PRIMME_INT ldRprojectorQ, void *RprojectorX, PRIMME_INT ldRprojectorX,
+      int sizeLprojectorQ, int sizeLprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, void *sol, PRIMME_INT ldsol, void *eval,
+      double * shift, int *touch, double startTime,
+      primme_context ctx);
+int inner_solve_astype_magma_zprimme(primme_op_datatype t, int blockSize, dummy_type_magma_zprimme *x,
+      PRIMME_INT ldx, dummy_type_magma_zprimme *Bx, PRIMME_INT ldBx, dummy_type_magma_zprimme *r, PRIMME_INT ldr,
+      dummy_type_dprimme *rnorm, dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *Mfact,
+      int *ipivot, dummy_type_zprimme *xKinvBx, dummy_type_magma_zprimme *LprojectorQ,
+      PRIMME_INT ldLprojectorQ, dummy_type_magma_zprimme *LprojectorX, PRIMME_INT ldLprojectorX,
+      dummy_type_magma_zprimme *LprojectorBQ, PRIMME_INT ldLprojectorBQ, dummy_type_magma_zprimme *LprojectorBX,
+      PRIMME_INT ldLprojectorBX, dummy_type_magma_zprimme *RprojectorQ, PRIMME_INT ldRprojectorQ,
+      dummy_type_magma_zprimme *RprojectorX, PRIMME_INT ldRprojectorX, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      dummy_type_magma_zprimme *sol, PRIMME_INT ldsol, dummy_type_dprimme *eval,
+      double * shift, int *touch,
+      primme_inner_copies *copies, double startTime, primme_context ctx);
 int apply_projected_preconditionermagma_zprimme(dummy_type_magma_zprimme *v, PRIMME_INT ldv, dummy_type_magma_zprimme *Q,
       PRIMME_INT ldQ, dummy_type_magma_zprimme *RprojectorQ, PRIMME_INT ldRprojectorQ, dummy_type_magma_zprimme *x,
       PRIMME_INT ldx, dummy_type_magma_zprimme *RprojectorX, PRIMME_INT ldRprojectorX,
@@ -107,7 +107,46 @@ typedef struct {
    double accum_jdq;      /* Accumulates jdq_times += ratio*(gdk+MV+PR)       */
    double accum_gdk;      /* Accumulates gdk_times += gdk+MV+PR               */
 
+   /* Block size tuning. Updated every outer iteration if dynamicBlockSize>0 */
+   int maxBlockSize;      /* Current limit of the block size                  */
+   int bs_probing;        /* 0: done, 1: measuring bs_best, 2: bs_candidate   */
+   int bs_best;           /* Block size with the fastest reduction measured   */
+   double bs_best_rate;   /* -log(residual reduction) per second of bs_best   */
+   int bs_candidate;      /* Block size compared with bs_best, 0 if none yet  */
+   double bs_candidate_rate; /* -log(residual reduction) per second of it    */
+   int bs_numIt;          /* Outer iterations since maxBlockSize was set      */
+   double bs_time;        /* Time of the iterations measured since then       */
+   double bs_sum_logResReductions; /* Sum of log(residual reductions) in them*/
+   double bs_timer_0;     /* Time at the last update                          */
+   double bs_logResNorms_0; /* Sum of log(residual norms) of the block and   */
+   int bs_blockSize_0;    /*   block size at the last update                  */
+
 } primme_CostModel;
+
+/* A piece of the solver state with fixed size saved in a checkpoint */
+typedef struct {
+   void *p;               /* Pointer to the data                              */
+   size_t size;           /* Number of bytes                                  */
+} checkpoint_item;
+
+/* A matrix with nLocal rows of the solver state saved in a checkpoint */
+typedef struct {
+   void *p;               /* Pointer to the first column                      */
+   PRIMME_INT ld;         /* Leading dimension                                */
+   int *n;                /* Number of columns                                */
+   int maxn;              /* Maximum number of columns                        */
+} checkpoint_matrix;
+
+/* The tuning of a solve saved in primme->tuningFile for the next solves */
+#define TUNING_MODEL_SIZE 22
+typedef struct {
+   int method;            /* Method recommendation (dynamicMethodSwitch on    */
+                          /*   exit), or 0 if the method was not tuned        */
+   int blockSize;         /* Block size chosen, or 0 if it was not tuned      */
+   int maxBlockSize;      /* Block size limit of the solve                    */
+   int maxBasisSize;      /* Basis size of the solve that measured model      */
+   double model[TUNING_MODEL_SIZE]; /* Measurements of the primme_CostModel  */
+} tuning_record;
 #endif /* MAIN_ITER_PRIVATE_H */
 
 
@@ -199,6 +238,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    int LockingProblem;      /* Flag==1 if practically converged pairs locked */
    int restartLimitReached; /* True when maximum restarts performed          */
    int nprevhVecs;          /* Number of vectors stored in prevhVecs         */
+   int numhVecs;            /* Number of leading columns computed in hVecs   */
    int numArbitraryVecs;    /* Columns in hVecs computed with RR instead of  */
                             /* the current extraction method.                */
    int maxEvecsSize;        /* Maximum capacity of evecs array               */
@@ -231,6 +271,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    PRIMME_INT ldBevecs;     /* Leading dimension of Bevecs                   */
    SCALAR *evecsHat = NULL; /* K^{-1}*B*evecs                                   */
    PRIMME_INT ldevecsHat=0; /* The leading dimension of evecsHat             */
+   primme_inner_copies innerCopies; /* copies in innerPrecision             */
    HSCALAR *hVecs;          /* Eigenvectors of H                             */
    HSCALAR *hU = NULL;      /* Left singular vectors of R                    */
    HSCALAR *prevhVecs=NULL; /* hVecs from previous iteration                 */
@@ -253,6 +294,15 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    int reset=0;             /* Flag to reset V and W                         */
    int restartsSinceReset=0;/* Restart since last reset of V and W           */
    int wholeSpace=0;        /* search subspace reach max size                */
+   int resumed=0;           /* the state has been read from a checkpoint     */
+   int stalled=0;           /* the residual norms stopped decreasing         */
+   int stallIts=0;          /* iterations since the last progress, and the   */
+   int stallConverged=0;    /*   converged pairs and the smallest residual   */
+   double stallNorm=HUGE_VAL; /* norm in the block then (see check_stall)    */
+   double ckFingerprint[2]; /* fingerprint of the matrix in the checkpoints  */
+   int tuneMethod=0;        /* save the method tuning in tuningFile          */
+   int tuneBlockSize=0;     /* save the block size tuning in tuningFile      */
+   tuning_record tuning;    /* tuning of the previous solves                 */
 
    /* Runtime measurement variables for dynamic method switching             */
    primme_CostModel CostModel; /* Structure holding the runtime estimates of */
@@ -277,12 +327,15 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    ldV = ldW = ldBV = ldQ = primme->ldOPs;
    ldBevecs = primme->massMatrixMatvec ? primme->ldOPs : ldevecs;
    if (primme->massMatrixMatvec) {
-      CHKERR(Num_malloc_Sprimme(ldBV*primme->maxBasisSize, &BV, ctx));
+      CHKERR(Num_malloc_mapped_Sprimme(ldBV*primme->maxBasisSize, &BV, ctx));
    }
-   CHKERR(Num_malloc_Sprimme(primme->ldOPs*primme->maxBasisSize, &V, ctx));
-   CHKERR(Num_malloc_Sprimme(primme->ldOPs*primme->maxBasisSize, &W, ctx));
+   CHKERR(Num_malloc_mapped_Sprimme(
+         primme->ldOPs * primme->maxBasisSize, &V, ctx));
+   CHKERR(Num_malloc_mapped_Sprimme(
+         primme->ldOPs * primme->maxBasisSize, &W, ctx));
    if (numQR > 0) {
-      CHKERR(Num_malloc_Sprimme(primme->ldOPs*primme->maxBasisSize*numQR, &Q, ctx));
+      CHKERR(Num_malloc_mapped_Sprimme(
+            primme->ldOPs * primme->maxBasisSize * numQR, &Q, ctx));
       CHKERR(Num_malloc_SHprimme(
           primme->maxBasisSize * primme->maxBasisSize * numQR, &R, ctx));
       CHKERR(Num_malloc_SHprimme(
@@ -302,13 +355,13 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    } else {
       maxRank = primme->numOrthoConst + primme->maxBasisSize;
    }
-   if (primme->orth == primme_orth_explicit_I) {
+   if (primme->orth != primme_orth_implicit_I) {
       CHKERR(Num_malloc_SHprimme(maxRank * maxRank, &VtBV, ctx));
       CHKERR(Num_malloc_SHprimme(maxRank * maxRank, &fVtBV, ctx));
    }
    int ldVtBV = maxRank;
    int ldfVtBV = maxRank;
-   if (primme->orth == primme_orth_explicit_I && numQR) {
+   if (primme->orth != primme_orth_implicit_I && numQR) {
       CHKERR(Num_malloc_SHprimme(
             primme->maxBasisSize * primme->maxBasisSize * numQR, &QtQ, ctx));
       CHKERR(Num_malloc_SHprimme(
@@ -334,6 +387,30 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    if (primme->massMatrixMatvec && primme->locking) {
       CHKERR(Num_malloc_Sprimme(ldBevecs * maxEvecsSize, &Bevecs, ctx));
    }
+
+   /* If the inner iterations run in another precision, keep the copies of */
+   /* evecs, Bevecs and evecsHat in that precision between inner solves    */
+
+   primme_op_datatype innerPrecision = primme->correctionParams.innerPrecision;
+   for (i = 0; i < 3; i++) {
+      innerCopies.src[i] = innerCopies.copy[i] = NULL;
+      innerCopies.ldcopy[i] = primme->nLocal;
+      innerCopies.n[i] = 0;
+   }
+   if (innerPrecision != primme_op_default &&
+         innerPrecision != PRIMME_OP_SCALAR &&
+         primme->correctionParams.maxInnerIterations != 0) {
+      innerCopies.src[0] = evecs;
+      innerCopies.src[1] = Bevecs;
+      innerCopies.src[2] = evecsHat;
+      for (i = 0; i < 3; i++) {
+         if (!innerCopies.src[i]) continue;
+         CHKERR(Num_matrix_astype_Sprimme(NULL, primme->nLocal, maxEvecsSize,
+               primme->nLocal, PRIMME_OP_SCALAR, &innerCopies.copy[i],
+               &innerCopies.ldcopy[i], innerPrecision, 1 /* alloc */,
+               0 /* don't copy */, ctx));
+      }
+   }
    CHKERR(Num_malloc_SHprimme(
          primme->maxBasisSize * primme->maxBasisSize, &prevhVecs, ctx));
 
@@ -360,6 +437,73 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    CHKERR(Num_malloc_iprimme(primme->maxBlockSize, &iev, ctx));
    CHKERR(Num_malloc_iprimme(maxEvecsSize, &ipivot, ctx));
 
+   /* -------------------------------------------------------------- */
+   /* Pieces of the state saved in the checkpoints. They are taken   */
+   /* after restarting, when the state is the smallest.              */
+   /* -------------------------------------------------------------- */
+
+   size_t mbs2 = (size_t)primme->maxBasisSize * primme->maxBasisSize;
+   size_t mbs = primme->maxBasisSize, nev = primme->numEvals;
+   int numCheckpointBasis = 0;  /* Columns of V, W and BV, with the block */
+   int numCheckpointEvecs = 0;  /* Columns of evecs in the checkpoint */
+   int numCheckpointLocked = 0; /* Columns of Bevecs and evecsHat     */
+   int maxCheckpointEvecs =     /* Columns of evecs, as in Sprimme   */
+         primme->numOrthoConst + max(primme->numEvals, primme->initSize);
+   checkpoint_item ckItems[] = {
+         {&basisSize, sizeof(int)}, {&numLocked, sizeof(int)},
+         {&numConverged, sizeof(int)}, {&numConvergedStored, sizeof(int)},
+         {&numGuesses, sizeof(int)}, {&nextGuess, sizeof(int)},
+         {&targetShiftIndex, sizeof(int)}, {&restartsSinceReset, sizeof(int)},
+         {&numArbitraryVecs, sizeof(int)}, {&numhVecs, sizeof(int)},
+         {&blockSize, sizeof(int)}, {&touch, sizeof(int)},
+         {&numPrevRitzVals, sizeof(int)}, {&LockingProblem, sizeof(int)},
+         {&wholeSpace, sizeof(int)}, {&smallestResNorm, sizeof(double)},
+         {&primme->initSize, sizeof(int)},
+         {&primme->dynamicMethodSwitch, sizeof(int)},
+         {&primme->correctionParams.maxInnerIterations, sizeof(int)},
+         {primme->iseed, sizeof(primme->iseed)},
+         {&primme->stats, sizeof(primme_stats)},
+         {&CostModel, sizeof(primme_CostModel)},
+         {flags, sizeof(int) * mbs}, {map, sizeof(int) * mbs},
+         {iev, sizeof(int) * primme->maxBlockSize}, {perm, sizeof(int) * nev},
+         {lockedFlags, lockedFlags ? sizeof(int) * nev : 0},
+         {ipivot, sizeof(int) * maxEvecsSize},
+         {H, sizeof(HSCALAR) * mbs2}, {hVecs, sizeof(HSCALAR) * mbs2},
+         {prevhVecs, sizeof(HSCALAR) * mbs2},
+         {VtBV, VtBV ? sizeof(HSCALAR) * maxRank * maxRank : 0},
+         {fVtBV, fVtBV ? sizeof(HSCALAR) * maxRank * maxRank : 0},
+         {QtQ, QtQ ? sizeof(HSCALAR) * mbs2 * numQR : 0},
+         {fQtQ, fQtQ ? sizeof(HSCALAR) * mbs2 * numQR : 0},
+         {R, R ? sizeof(HSCALAR) * mbs2 * numQR : 0},
+         {hU, hU ? sizeof(HSCALAR) * mbs2 * numQR : 0},
+         {QtV, QtV ? sizeof(HSCALAR) * mbs2 * numQR : 0},
+         {hVecsRot, hVecsRot ? sizeof(HSCALAR) * mbs2 : 0},
+         {M, M ? sizeof(HSCALAR) * maxEvecsSize * maxEvecsSize : 0},
+         {Mfact, Mfact ? sizeof(HSCALAR) * maxEvecsSize * maxEvecsSize : 0},
+         {hVals, sizeof(HEVAL) * mbs},
+         {hSVals, hSVals ? sizeof(HREAL) * mbs : 0},
+         {prevRitzVals, sizeof(HEVAL) * (mbs + nev)},
+         {blockNorms, sizeof(HREAL) * primme->maxBlockSize},
+         {basisNorms, sizeof(HREAL) * mbs}, {evals, sizeof(HEVAL) * nev},
+         {resNorms, sizeof(HREAL) * nev}};
+   checkpoint_matrix ckMats[] = {
+         {V, ldV, &numCheckpointBasis, primme->maxBasisSize},
+         {W, ldW, &numCheckpointBasis, primme->maxBasisSize},
+         {BV, ldBV, &numCheckpointBasis, primme->maxBasisSize},
+         {Q, ldQ, &basisSize, primme->maxBasisSize},
+         {evecs, ldevecs, &numCheckpointEvecs, maxCheckpointEvecs},
+         {Bevecs, ldBevecs, &numCheckpointLocked, maxEvecsSize},
+         {evecsHat, ldevecsHat, &numCheckpointLocked, maxEvecsSize}};
+   int nCkItems = sizeof(ckItems) / sizeof(ckItems[0]);
+   int nCkMats = sizeof(ckMats) / sizeof(ckMats[0]);
+
+   /* Identify the problem for the checkpoint before zeroing the counters, */
+   /* so that the matvec of the fingerprint is not counted in the solve   */
+
+   if (primme->checkpointFile && primme->numEvals > 0) {
+      CHKERR(checkpoint_fingerprint(ckFingerprint, ctx));
+   }
+
    /* -------------------------------------------------------------- */
    /* Initialize counters and flags                                  */
    /* -------------------------------------------------------------- */
@@ -369,6 +513,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    primme->stats.numMatvecs                    = 0;
    primme->stats.numPreconds                   = 0;
    primme->stats.numGlobalSum                  = 0;
+   primme->stats.numGlobalSumRequested         = 0;
    primme->stats.numBroadcast                  = 0;
    primme->stats.volumeGlobalSum               = 0;
    primme->stats.volumeBroadcast               = 0;
@@ -389,15 +534,21 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    primme->stats.maxConvTol                    = 0.0;
    primme->stats.estimateResidualError         = 0.0;
    primme->stats.lockingIssue                  = 0;
+   primme->stats.numReplicatedMismatches       = 0;
 
    numLocked = 0;
    LockingProblem = 0;
 
    blockSize = 0; 
+   basisSize = 0;
    *numRet = 0;
 
    for (i=0; i<primme->numEvals; i++) perm[i] = i;
 
+   /* The block size limit is in the model; the checkpoint may replace it */
+
+   initializeBlockSizeModel(&CostModel, primme);
+
    /* -------------------------------------- */
    /* Quick return for matrix of dimension 1 */
    /* -------------------------------------- */
@@ -408,24 +559,59 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
       goto clean;
    }
 
+   /* ----------------------------------------------------------------- */
+   /* Resume from the checkpoint if there is one, and continue the      */
+   /* iteration after the restart where it was saved                    */
+   /* ----------------------------------------------------------------- */
+
+   if (primme->checkpointFile) {
+      CHKERR(checkpoint_state(0 /* read */, ckItems, nCkItems, ckMats,
+            nCkMats, ckFingerprint, &resumed, ctx));
+   }
+
+   /* ----------------------------------------------------------------- */
+   /* Read the tuning of the previous solves of the same problem, and   */
+   /* start with the block size chosen then                             */
+   /* ----------------------------------------------------------------- */
+
+   if (primme->tuningFile) {
+      tuneMethod = (primme->dynamicMethodSwitch > 0);
+      tuneBlockSize = (primme->dynamicBlockSize > 0);
+      CHKERR(tuning_cache(0 /* read */, &tuning, ctx));
+      if (tuneBlockSize && tuning.blockSize > 0 && !resumed) {
+         CostModel.maxBlockSize = CostModel.bs_best =
+               min(tuning.blockSize, primme->maxBlockSize);
+         CostModel.bs_probing = 0;
+         PRINTF(3, "Block size %d from the tuning file", CostModel.bs_best);
+      }
+   }
+
    /* -------------------- */
    /* Initialize the basis */
    /* -------------------- */
 
-   CHKERR(init_basis_Sprimme(V, primme->nLocal, ldV, W, ldW, BV, ldBV, evecs,
-         ldevecs, Bevecs, ldBevecs, evecsHat, primme->nLocal, M, maxEvecsSize,
-         Mfact, 0, ipivot, VtBV, ldVtBV, fVtBV, ldfVtBV, maxRank, &basisSize,
-         &nextGuess, &numGuesses, ctx));
+   if (!resumed) {
+      CHKERR(init_basis_Sprimme(V, primme->nLocal, ldV, W, ldW, BV, ldBV,
+            evecs, ldevecs, Bevecs, ldBevecs, evecsHat, primme->nLocal, M,
+            maxEvecsSize, Mfact, 0, ipivot, VtBV, ldVtBV, fVtBV, ldfVtBV,
+            maxRank, &basisSize, &nextGuess, &numGuesses, ctx));
 
-   /* Now initSize will store the number of converged pairs */
-   primme->initSize = 0;
+      /* Now initSize will store the number of converged pairs */
+      primme->initSize = 0;
+   }
 
    /* ----------------------------------------------------------- */
    /* Dynamic method switch means we need to decide whether to    */
    /* allow inner iterations based on runtime timing measurements */
    /* ----------------------------------------------------------- */
-   if (primme->dynamicMethodSwitch > 0) {
+   if (primme->dynamicMethodSwitch > 0 && !resumed) {
       initializeModel(&CostModel, primme);
+      int seeded = 0;
+      if (tuneMethod && tuning.method != 0 &&
+            tuning.maxBasisSize == primme->maxBasisSize) {
+         seedModel(&CostModel, tuning.model);
+         seeded = 1;
+      }
       CostModel.MV = primme->stats.timeMatvec/primme->stats.numMatvecs;
       if (primme->numEvals < 5 ||
             primme->maxBasisSize + (primme->locking ? primme->numEvals : 0) >=
@@ -434,6 +620,20 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
       else
          primme->dynamicMethodSwitch = 3;   /* Start GD+k for 1st pair */
       primme->correctionParams.maxInnerIterations = 0; 
+
+      /* Start with JDQMR if the previous solves found it faster */
+      if (seeded && CostModel.accum_jdq_gdk < 1.0 &&
+            primme->maxBasisSize + (primme->locking ? primme->numEvals : 0) <
+                  primme->n) {
+         primme->dynamicMethodSwitch++;     /* 1->2 and 3->4 */
+         primme->correctionParams.maxInnerIterations = -1;
+         primme->correctionParams.projectors.RightX = 0;
+      }
+      if (seeded) {
+         PRINTF(3, "Ratio: %e from the tuning file. Start with %s",
+               CostModel.accum_jdq_gdk,
+               primme->correctionParams.maxInnerIterations ? "JDQMR" : "GD+k");
+      }
    }
 
    /* ---------------------------------------------------------------------- */
@@ -444,55 +644,66 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    while (
          primme->stats.numMatvecs < primme->maxMatvecs &&
          (primme->maxOuterIterations == 0 ||
-               primme->stats.numOuterIterations < primme->maxOuterIterations)) {
+               primme->stats.numOuterIterations < primme->maxOuterIterations) &&
+         !stalled) {
 
       if (reset > 0) PRINTF(5, "Resetting V, W and QR");
 
-      /* Reset convergence flags. This may only reoccur without locking */
+      /* Skip the initialization if the state was read from a checkpoint */
 
-      primme->initSize = numConverged = numConvergedStored = numLocked;
-      reset = 0;
-      for (i=0; i<primme->maxBasisSize; i++)
-         flags[i] = UNCONVERGED;
+      if (resumed) {
+         resumed = 0;
+      } else {
+         /* Reset convergence flags. This may only reoccur without locking */
 
-      /* Compute the initial H and solve for its eigenpairs */
+         primme->initSize = numConverged = numConvergedStored = numLocked;
+         reset = 0;
+         for (i = 0; i < 3; i++) innerCopies.n[i] = 0;
+         for (i=0; i<primme->maxBasisSize; i++)
+            flags[i] = UNCONVERGED;
 
-      targetShiftIndex = 0;
-      if (numQR) {
-         int nQ = 0;
-         CHKERR(update_Q_Sprimme(BV ? BV : V, primme->nLocal, ldBV, W, ldW, Q,
-               ldQ, R, primme->maxBasisSize, QtQ, ldQtQ, fQtQ, ldfQtQ,
-               primme->targetShifts[targetShiftIndex], 0, basisSize, &nQ, ctx));
-         CHKERRM(numQR && basisSize != nQ, -1, "Not supported deficient QR");
-      }
+         /* Compute the initial H and solve for its eigenpairs */
 
-      if (H)
-         CHKERR(update_projection_Sprimme(V, ldV, W, ldW, H,
-               primme->maxBasisSize, primme->nLocal, 0, basisSize,
-               KIND(1 /*symmetric*/, 0 /* unsymmetric */), ctx));
+         targetShiftIndex = 0;
+         if (numQR) {
+            int nQ = 0;
+            CHKERR(update_Q_Sprimme(BV ? BV : V, primme->nLocal, ldBV, W, ldW,
+                  Q, ldQ, R, primme->maxBasisSize, QtQ, ldQtQ, fQtQ, ldfQtQ,
+                  primme->targetShifts[targetShiftIndex], 0, basisSize, &nQ,
+                  ctx));
+            CHKERRM(numQR && basisSize != nQ, -1,
+                  "Not supported deficient QR");
+         }
 
-      if (QtV) {
-        CHKERR(update_projection_Sprimme(
-            Q, ldQ, V, ldV, QtV, primme->maxBasisSize, primme->nLocal, 0,
-            basisSize, 0 /*unsymmetric*/, ctx));
-      }
+         if (H)
+            CHKERR(update_projection_Sprimme(V, ldV, W, ldW, H,
+                  primme->maxBasisSize, primme->nLocal, 0, basisSize,
+                  KIND(1 /*symmetric*/, 0 /* unsymmetric */), ctx));
 
-      CHKERR(solve_H_SHprimme(H, basisSize, primme->maxBasisSize,
-            VtBV
-                  ? &VtBV[(primme->numOrthoConst + numLocked) * ldVtBV +
-                                    primme->numOrthoConst + numLocked]
-                  : NULL,
-            ldVtBV, R, primme->maxBasisSize, QtV, primme->maxBasisSize, QtQ,
-            ldQtQ, hU, basisSize, hVecs, basisSize, hVals, hSVals,
-            numConverged, ctx));
-
-      numArbitraryVecs = 0;
-      maxRecentlyConverged = availableBlockSize = blockSize = 0;
-      smallestResNorm = HUGE_VAL;
-      primme->stats.estimateResidualError = 0.0;
-      if (!primme->locking) primme->stats.maxConvTol = 0.0;
-      blockSize = 0;
-      restartsSinceReset = 0;
+         if (QtV) {
+           CHKERR(update_projection_Sprimme(
+               Q, ldQ, V, ldV, QtV, primme->maxBasisSize, primme->nLocal, 0,
+               basisSize, 0 /*unsymmetric*/, ctx));
+         }
+
+         CHKERR(solve_H_SHprimme(H, basisSize, primme->maxBasisSize,
+               VtBV
+                     ? &VtBV[(primme->numOrthoConst + numLocked) * ldVtBV +
+                                       primme->numOrthoConst + numLocked]
+                     : NULL,
+               ldVtBV, R, primme->maxBasisSize, QtV, primme->maxBasisSize, QtQ,
+               ldQtQ, hU, basisSize, hVecs, basisSize, hVals, hSVals,
+               numConverged, ctx));
+         numhVecs = basisSize;
+
+         numArbitraryVecs = 0;
+         maxRecentlyConverged = availableBlockSize = blockSize = 0;
+         smallestResNorm = HUGE_VAL;
+         primme->stats.estimateResidualError = 0.0;
+         if (!primme->locking) primme->stats.maxConvTol = 0.0;
+         blockSize = 0;
+         restartsSinceReset = 0;
+      }
 
       /* -------------------------------------------------------------- */
       /* Begin the iterative process.  Keep restarting until all of the */
@@ -503,7 +714,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
              (primme->maxOuterIterations == 0 ||
                    primme->stats.numOuterIterations <
                          primme->maxOuterIterations) &&
-             !wholeSpace) {
+             !wholeSpace && !stalled) {
 
          nprevhVecs = 0;
          int candidates_prepared = 0;  /* Has prepare_candidates been called? */
@@ -514,11 +725,15 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
          /* maximum size or the basis plus the locked vectors span the entire */
          /* space. Once this happens, restart with a smaller basis.           */
          /* ----------------------------------------------------------------- */
+         double tIt = 0.0; /* Start of the current iteration, for the trace */
          while (basisSize < primme->maxBasisSize &&
                 primme->stats.numMatvecs < primme->maxMatvecs &&
                 ( primme->maxOuterIterations == 0 ||
-                  primme->stats.numOuterIterations < primme->maxOuterIterations) ) {
+                  primme->stats.numOuterIterations < primme->maxOuterIterations) &&
+                !stalled) {
 
+            if (tIt > 0.0) Trace_span("iteration", tIt, ctx.trace);
+            tIt = primme_wTimer();
             primme->stats.numOuterIterations++;
 
             /* When QR are computed and there are more than one target shift, */
@@ -529,7 +744,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                maxRecentlyConverged = numConverged-numLocked+1;
             }
             else {
-               availableBlockSize = primme->maxBlockSize;
+               availableBlockSize = CostModel.maxBlockSize;
                maxRecentlyConverged = max(0, primme->numEvals-numConverged);
             }
 
@@ -541,6 +756,11 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
 
             availableBlockSize = min(availableBlockSize, maxRecentlyConverged+1);
 
+            /* If dynamic block size lowered the limit, discard the residuals */
+            /* computed at restart for the pairs beyond it                    */
+
+            blockSize = min(blockSize, availableBlockSize);
+
             /* Set the block with the first unconverged pairs */
             if (availableBlockSize > 0) {
                /* If locking with GD and no preconditioning is running, don't */
@@ -551,7 +771,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                   practConvCheck = 1;
                } else if (primme->locking && !primme->massMatrixMatvec &&
                           !primme->correctionParams.precondition &&
-                          primme->correctionParams.maxInnerIterations == 0) {
+                          primme->correctionParams.maxInnerIterations == 0 &&
+                          primme->correctionParams.chebyshevDegree <= 0) {
                   practConvCheck = -1;
                }
                CHKERR(prepare_candidates(V, ldV, W, ldW, BV, ldBV,
@@ -559,7 +780,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                      &V[basisSize * ldV], &W[basisSize * ldW],
                      BV ? &BV[basisSize * ldBV] : NULL,
                      1 /* compute approx vectors and residuals */, hVecs,
-                     basisSize, hVals, hSVals, flags, maxRecentlyConverged,
+                     basisSize, hVals, hSVals, &numhVecs, flags,
+                     maxRecentlyConverged,
                      blockNorms, blockSize, availableBlockSize, evecs,
                      numLocked, ldevecs, Bevecs, ldBevecs, evals, resNorms,
                      targetShiftIndex, iev, &blockSize, &recentlyConverged,
@@ -589,11 +811,25 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
 
             /* Report iteration */
 
-            CHKERR(monitorFun_Sprimme(hVals, basisSize, flags, iev, blockSize,
+            CHKERR(monitorFun_Sprimme(hVals, numhVecs, flags, iev, blockSize,
                   basisNorms, numConverged, evals, numLocked, lockedFlags,
                   resNorms, -1, -1.0, NULL, 0.0, primme_event_outer_iteration,
                   startTime, ctx));
 
+            /* In the first stage of internalPrecision = primme_op_auto, */
+            /* stop after this iteration if the residual norms do not    */
+            /* decrease anymore                                          */
+
+            if (ctx.stalled && !stalled) {
+               stalled = check_stall(blockNorms, blockSize, numConverged,
+                     &stallNorm, &stallConverged, &stallIts, primme);
+               if (stalled) {
+                  *ctx.stalled = 1;
+                  PRINTF(3, "Stopping because the residual norms stalled at "
+                            "%g", stallNorm);
+               }
+            }
+
             /* Reset touch every time an eigenpair converges */
 
             if (recentlyConverged > 0) touch = 0;
@@ -622,6 +858,14 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                }
             }
 
+            /* If dynamic block size, measure the current block size and */
+            /* consider trying the next one                              */
+
+            if (primme->dynamicBlockSize > 0 && blockSize > 0) {
+               CHKERR(update_block_size(&CostModel, recentlyConverged,
+                     blockNorms, blockSize, ctx));
+            }
+
             if (numConverged >= primme->numEvals ||
                   (primme->locking && numConverged > numLocked &&
                         primme->target != primme_smallest &&
@@ -661,7 +905,9 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                      Bevecs ? ldBevecs : ldevecs, evecsHat, ldevecsHat, Mfact,
                      ipivot, evals, numLocked, numConvergedStored, hVals,
                      prevRitzVals, &numPrevRitzVals, flags, basisSize,
-                     blockNorms, iev, blockSize, &touch, startTime, ctx));
+                     blockNorms, iev, blockSize, &touch,
+                     innerCopies.copy[0] ? &innerCopies : NULL, startTime,
+                     ctx));
 
                /* ------------------------------------------------------ */
                /* If dynamic method switch, accumulate inner method time */
@@ -681,7 +927,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
             int blockSize0 = blockSize;
             if (primme->locking && !primme->massMatrixMatvec &&
                   !primme->correctionParams.precondition &&
-                  primme->correctionParams.maxInnerIterations == 0) {
+                  primme->correctionParams.maxInnerIterations == 0 &&
+                  primme->correctionParams.chebyshevDegree <= 0) {
                CHKERR(
                      Num_malloc_SHprimme(ldRlocked * blockSize, &Rlocked, ctx));
             }
@@ -722,7 +969,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                blockSize = 0;
                if (primme->locking && !primme->massMatrixMatvec &&
                      !primme->correctionParams.precondition &&
-                     primme->correctionParams.maxInnerIterations == 0) {
+                     primme->correctionParams.maxInnerIterations == 0 &&
+                  primme->correctionParams.chebyshevDegree <= 0) {
                   CHKERR(Num_free_SHprimme(Rlocked, ctx));
                }
                break;
@@ -741,12 +989,13 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
 
             if (primme->locking && !primme->massMatrixMatvec &&
                   !primme->correctionParams.precondition &&
-                  primme->correctionParams.maxInnerIterations == 0) {
+                  primme->correctionParams.maxInnerIterations == 0 &&
+                  primme->correctionParams.chebyshevDegree <= 0) {
                if (numLocked > 0) {
                   for (i = 0; i < blockSize0 && numConverged < primme->numEvals;
                         i++) {
                      HREAL normXx = 0.0;
-                     if (primme->orth == primme_orth_explicit_I) {
+                     if (primme->orth != primme_orth_implicit_I) {
                         HSCALAR *Xx = NULL;
                         CHKERR(Num_malloc_SHprimme(numLocked, &Xx, ctx));
                         CHKERR(Num_zero_matrix_SHprimme(
@@ -776,7 +1025,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                         flags[iev[i]] = PRACTICALLY_CONVERGED;
                         numConverged++;
                         /* Report a pair was soft converged */
-                        CHKERR(monitorFun_Sprimme(hVals, basisSize, flags,
+                        CHKERR(monitorFun_Sprimme(hVals, numhVecs, flags,
                               &iev[i], 1, basisNorms, numConverged, NULL, 0,
                               NULL, NULL, -1, -1.0, NULL, 0.0,
                               primme_event_converged, startTime, ctx));
@@ -830,24 +1079,39 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
 
             /* Copy hVecs into prevhVecs */
 
-            CHKERR(Num_copy_matrix_SHprimme(hVecs, basisSize, basisSize,
+            CHKERR(Num_copy_matrix_SHprimme(hVecs, basisSize, numhVecs,
                   basisSize, prevhVecs, primme->maxBasisSize, ctx));
             CHKERR(Num_zero_matrix_SHprimme(&prevhVecs[basisSize],
-                  primme->maxBasisSize - basisSize, basisSize,
+                  primme->maxBasisSize - basisSize, numhVecs,
                   primme->maxBasisSize, ctx));
-            nprevhVecs = basisSize;
+            nprevhVecs = numhVecs;
 
             basisSize += blockSize;
             blockSize = 0;
 
-            CHKERR(solve_H_SHprimme(H, basisSize, primme->maxBasisSize,
-                  VtBV
-                        ? &VtBV[(primme->numOrthoConst + numLocked) * ldVtBV +
-                                          primme->numOrthoConst + numLocked]
-                        : NULL,
-                  ldVtBV, R, primme->maxBasisSize, QtV, primme->maxBasisSize,
-                  QtQ, ldQtQ, hU, basisSize, hVecs, basisSize, hVals, hSVals,
-                  numConverged, ctx));
+            /* If allowed, compute only the Ritz pairs that may be selected */
+            /* as candidates; prepare_candidates and restart complete the   */
+            /* solution if they need more                                   */
+
+            numhVecs = partial_solve_size(basisSize, numLocked, primme);
+            if (numhVecs < basisSize) {
+               CHKERR(solve_H_RR_partial_SHprimme(H, primme->maxBasisSize,
+                     VtBV ? &VtBV[(primme->numOrthoConst + numLocked) *
+                                        ldVtBV +
+                                  primme->numOrthoConst + numLocked]
+                          : NULL,
+                     ldVtBV, hVecs, basisSize, hVals, basisSize, 0, numhVecs,
+                     ctx));
+            } else {
+               CHKERR(solve_H_SHprimme(H, basisSize, primme->maxBasisSize,
+                     VtBV ? &VtBV[(primme->numOrthoConst + numLocked) *
+                                        ldVtBV +
+                                  primme->numOrthoConst + numLocked]
+                          : NULL,
+                     ldVtBV, R, primme->maxBasisSize, QtV, primme->maxBasisSize,
+                     QtQ, ldQtQ, hU, basisSize, hVecs, basisSize, hVals, hSVals,
+                     numConverged, ctx));
+            }
 
             numArbitraryVecs = 0;
             candidates_prepared = 0;
@@ -887,6 +1151,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
          } /* while (basisSize<maxBasisSize && basisSize<n-orthoConst-numLocked)
             * --------------------------------------------------------------- */
 
+         if (tIt > 0.0) Trace_span("iteration", tIt, ctx.trace);
+
          /* If wholeSpace, reset if the accumulated errors on the residual    */
          /* vectors are too large                                             */
 
@@ -897,6 +1163,11 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
 
          if (reset > 0) break;
 
+         /* Restarting needs all Ritz pairs */
+
+         CHKERR(complete_hVecs(H, primme->maxBasisSize, VtBV, ldVtBV, numLocked,
+               hVecs, basisSize, hVals, flags, basisSize, &numhVecs, ctx));
+
          /* ----------------------------------------------------------------- */
          /* Restart basis will need the final coefficient vectors in hVecs    */
          /* to lock out converged vectors and to compute X and R for the next */
@@ -938,7 +1209,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
 
                /* Limit blockSize to vacant vectors in the basis */
 
-               availableBlockSize = max(0, min(primme->maxBlockSize, primme->maxBasisSize-(numConverged-numLocked)));
+               availableBlockSize = max(0, min(CostModel.maxBlockSize, primme->maxBasisSize-(numConverged-numLocked)));
 
                /* Limit blockSize to remaining values to converge plus one */
 
@@ -984,7 +1255,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                      primme->nLocal, H, primme->maxBasisSize, basisSize, NULL,
                      NULL, NULL,
                      0 /* Not compute approx vectors and residuals */, hVecs,
-                     basisSize, hVals, hSVals, flags, maxRecentlyConverged,
+                     basisSize, hVals, hSVals, &numhVecs, flags,
+                     maxRecentlyConverged,
                      blockNorms, blockSize, availableBlockSize, evecs,
                      numLocked, ldevecs, Bevecs, ldBevecs, evals, resNorms,
                      targetShiftIndex, iev, &blockSize, &recentlyConverged,
@@ -1083,6 +1355,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
          /* ------------------ */
 
          assert(ldV == ldW); /* this function assumes ldV == ldW */
+         double tRestart = primme_wTimer();
          CHKERR(restart_Sprimme(V, W, BV, primme->nLocal, basisSize, ldV, hVals,
                hSVals, flags, iev, &blockSize, blockNorms, evecs, ldevecs,
                Bevecs, ldBevecs, perm, evals, resNorms, evecsHat,
@@ -1095,7 +1368,9 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                hVecs, basisSize, 0, &basisSize, &targetShiftIndex,
                &numArbitraryVecs, hVecsRot, primme->maxBasisSize,
                &restartsSinceReset, startTime, ctx));
+         Trace_span("restart", tRestart, ctx.trace);
          restartsSinceReset++;
+         for (i = 0; i < 3; i++) innerCopies.n[i] = 0;
 
          /* If there are any initial guesses remaining, then copy it */
          /* into the basis.                                          */
@@ -1168,6 +1443,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                   QtQ, ldQtQ, hU, basisSize, hVecs, basisSize, hVals,
                   hSVals, numConverged, ctx));
          }
+         numhVecs = basisSize;
  
          primme->stats.numRestarts++;
 
@@ -1190,6 +1466,27 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
 
          for (i = 0; i < primme->maxBasisSize; i++) map[i] = i;
 
+         /* Save the state every checkpointInterval restarts or if asked */
+
+         if (primme->checkpointFile) {
+            int request = primme->checkpointRequest ||
+                          (primme->checkpointInterval > 0 &&
+                                primme->stats.numRestarts %
+                                            primme->checkpointInterval ==
+                                      0);
+            CHKERR(broadcast_iprimme(&request, 1, ctx));
+            if (request) {
+               numCheckpointBasis = basisSize + blockSize;
+               numCheckpointLocked =
+                     primme->numOrthoConst + numLocked + numConvergedStored;
+               numCheckpointEvecs =
+                     max(numCheckpointLocked, nextGuess + numGuesses);
+               CHKERR(checkpoint_state(1 /* write */, ckItems, nCkItems,
+                     ckMats, nCkMats, ckFingerprint, NULL, ctx));
+               primme->checkpointRequest = 0;
+            }
+         }
+
          /* ----------------------------------------------------------- */
       } /* while ((numConverged < primme->numEvals)  (restarting loop)
          * ----------------------------------------------------------- */
@@ -1250,7 +1547,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
          if (primme->stats.numMatvecs < primme->maxMatvecs &&
                (primme->maxOuterIterations == 0 ||
                      primme->stats.numOuterIterations <
-                           primme->maxOuterIterations))
+                           primme->maxOuterIterations) &&
+               !stalled)
             restartLimitReached = 0;
          else
             restartLimitReached = 1;
@@ -1341,6 +1639,29 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
       * -------------------------------------------------------------- */
 
 clean:
+   /* If dynamic block size, give block size recommendation for future runs */
+   if (primme->dynamicBlockSize > 0) {
+      primme->dynamicBlockSize = -CostModel.bs_best;
+   }
+
+   /* A converged solve does not resume from its checkpoint */
+   if (*ret == 0 && primme->checkpointFile) {
+      CHKERR(checkpoint_state(
+            -1 /* remove */, NULL, 0, NULL, 0, NULL, NULL, ctx));
+   }
+
+   /* Save the tuning for the next solves of the same problem */
+   if (*ret == 0 && (tuneMethod || tuneBlockSize)) {
+      if (tuneMethod && primme->dynamicMethodSwitch < 0) {
+         tuning.method = primme->dynamicMethodSwitch;
+         tuning.maxBasisSize = primme->maxBasisSize;
+         copyModel(&CostModel, tuning.model, 1 /* pack */);
+      }
+      if (tuneBlockSize) tuning.blockSize = CostModel.bs_best;
+      tuning.maxBlockSize = primme->maxBlockSize;
+      CHKERR(tuning_cache(1 /* write */, &tuning, ctx));
+   }
+
    if (primme->aNorm <= 0.0L) {
       primme->aNorm =
             primme->stats.estimateLargestSVal / primme->stats.estimateInvBNorm;
@@ -1356,13 +1677,20 @@ clean:
             primme->nLocal, primme->initSize, primme->ldevecs, perm,
             ctx));
 
+   /* Keep the locked pairs and the basis for the next call */
+
+   if (ctx.ws && ctx.ws->warmStart) {
+      CHKERR(save_basis(&evecs[primme->numOrthoConst * ldevecs], ldevecs,
+            primme->locking ? primme->initSize : 0, V, ldV, basisSize, ctx));
+   }
+
    if (primme->massMatrixMatvec) {
-      CHKERR(Num_free_Sprimme(BV, ctx));
+      CHKERR(Num_free_mapped_Sprimme(BV, ctx));
    }
-   CHKERR(Num_free_Sprimme(V, ctx));
-   CHKERR(Num_free_Sprimme(W, ctx));
+   CHKERR(Num_free_mapped_Sprimme(V, ctx));
+   CHKERR(Num_free_mapped_Sprimme(W, ctx));
    if (numQR > 0) {
-      CHKERR(Num_free_Sprimme(Q, ctx));
+      CHKERR(Num_free_mapped_Sprimme(Q, ctx));
       CHKERR(Num_free_SHprimme(R, ctx));
       CHKERR(Num_free_SHprimme(hU, ctx));
    }
@@ -1371,7 +1699,7 @@ clean:
    }
    CHKERR(Num_free_SHprimme(H, ctx));
    CHKERR(Num_free_SHprimme(hVecs, ctx));
-   if (primme->orth == primme_orth_explicit_I) {
+   if (primme->orth != primme_orth_implicit_I) {
       CHKERR(Num_free_SHprimme(VtBV, ctx));
       CHKERR(Num_free_SHprimme(fVtBV, ctx));
       CHKERR(Num_free_SHprimme(QtQ, ctx));
@@ -1393,6 +1721,9 @@ clean:
    if (primme->massMatrixMatvec && primme->locking) {
       CHKERR(Num_free_Sprimme(Bevecs, ctx));
    }
+   for (i = 0; i < 3; i++) {
+      CHKERR(Num_free_Sprimme((SCALAR *)innerCopies.copy[i], ctx));
+   }
    CHKERR(Num_free_SHprimme(prevhVecs, ctx));
 
    CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(hVals, ctx));
@@ -1454,6 +1785,8 @@ clean:
  * X             The eigenvectors put in the block
  * R             The residual vectors put in the block
  * flags         Array indicating which eigenvectors have converged     
+ * numhVecs      Number of leading columns computed in hVecs; the rest are
+ *               computed if more candidates are needed
  * map           The indices of closest vectors in previous iteration
  * iev           indicates which eigenvalue each block vector corresponds to
  * blockNorms    Residual norms of the Ritz vectors being computed during the
@@ -1471,7 +1804,7 @@ STATIC int prepare_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
       PRIMME_INT ldW, SCALAR *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       HSCALAR *H, int ldH, int basisSize, SCALAR *X, SCALAR *R, SCALAR *BX,
       int computeXR, HSCALAR *hVecs, int ldhVecs, HEVAL *hVals, HREAL *hSVals,
-      int *flags, int remainedEvals, HREAL *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, HREAL *blockNorms, int blockNormsSize,
       int maxBlockSize, SCALAR *evecs, int numLocked, PRIMME_INT ldevecs,
       SCALAR *Bevecs, PRIMME_INT ldBevecs, HEVAL *evals, HREAL *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -1521,8 +1854,10 @@ STATIC int prepare_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
     * angle */
 
    if (ctx.procID == 0) {
-      CHKERR(map_vecs_SHprimme(prevhVecs, basisSize, nprevhVecs, ldprevhVecs,
-            hVecs, 0, basisSize, ldhVecs, map, ctx));
+      CHKERR(map_vecs_SHprimme(prevhVecs, basisSize,
+            min(nprevhVecs, *numhVecs), ldprevhVecs, hVecs, 0, *numhVecs,
+            ldhVecs, map, ctx));
+      for (i = *numhVecs; i < basisSize; i++) map[i] = i;
    }
    CHKERR(broadcast_iprimme(map, basisSize, ctx));
 
@@ -1598,7 +1933,7 @@ STATIC int prepare_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
                     primme->numEvals + 1 - (*recentlyConverged) - numConverged);
 
             /* Report a pair was soft converged */
-            CHKERR(monitorFun_Sprimme(hVals, basisSize, flags, &iev[blki], 1,
+            CHKERR(monitorFun_Sprimme(hVals, *numhVecs, flags, &iev[blki], 1,
                   basisNorms, numConverged + *recentlyConverged, NULL, 0, NULL,
                   NULL, -1, -1.0, NULL, 0.0, primme_event_converged, startTime,
                   ctx));
@@ -1639,10 +1974,20 @@ STATIC int prepare_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
 
       /* Find next candidates, starting from iev(*blockSize)+1 */
 
-      for (i=lasti+1; i<basisSize && blki < maxBlockSize; i++) {
+      for (i=lasti+1; i<*numhVecs && blki < maxBlockSize; i++) {
          if (flags[i] == UNCONVERGED) iev[blki++] = i;
       }
 
+      /* If the computed Ritz pairs ran out of candidates, compute the rest */
+
+      if (blki < maxBlockSize && *numhVecs < basisSize) {
+         CHKERR(complete_hVecs(H, ldH, VtBV, ldVtBV, numLocked, hVecs, ldhVecs,
+               hVals, flags, basisSize, numhVecs, ctx));
+         for (; i<basisSize && blki < maxBlockSize; i++) {
+            if (flags[i] == UNCONVERGED) iev[blki++] = i;
+         }
+      }
+
       /* If no new candidates or all required solutions converged yet, go out */
 
       if (blki == *blockSize || *recentlyConverged >= remainedEvals) break;
@@ -1708,6 +2053,92 @@ STATIC int prepare_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
    return 0;
 }
 
+/*******************************************************************************
+ * Function partial_solve_size - Return the number of leading Ritz pairs that
+ *    the solve of the projected problem inside the main loop has to compute.
+ *    If projectionParams.partialSolve is set, the extraction is Rayleigh-Ritz
+ *    and the target is the smallest or the largest eigenvalues, the candidates
+ *    are among the first remaining pairs to converge plus a block. Otherwise
+ *    return basisSize.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * basisSize      Size of the basis V
+ * numLocked      The number of vectors currently locked
+ *
+ * RETURN
+ * ------
+ * number of Ritz pairs to compute
+ *
+ ******************************************************************************/
+
+STATIC int partial_solve_size(int basisSize, int numLocked,
+      primme_params *primme) {
+
+#ifdef USE_HERMITIAN
+   if (primme->projectionParams.partialSolve &&
+         primme->projectionParams.projection == primme_proj_RR &&
+         (primme->target == primme_smallest ||
+               primme->target == primme_largest)) {
+      return max(0, min(basisSize, primme->numEvals - numLocked +
+                                         primme->maxBlockSize + 1));
+   }
+#else
+   (void)numLocked;
+   (void)primme;
+#endif
+
+   return basisSize;
+}
+
+/*******************************************************************************
+ * Subroutine complete_hVecs - Compute the Ritz pairs numhVecs:basisSize-1
+ *    that a partial solve of the projected problem skipped, and mark them as
+ *    unconverged.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * H              The matrix V'*A*V
+ * ldH            The leading dimension of H
+ * VtBV           The matrix V'*B*V, including the locked vectors
+ * ldVtBV         The leading dimension of VtBV
+ * numLocked      The number of vectors currently locked
+ * ldhVecs        The leading dimension of hVecs
+ * basisSize      Size of the basis V
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * hVecs          The projected vectors
+ * hVals          The Ritz values
+ * flags          Array indicating which Ritz pairs have converged
+ * numhVecs       Number of leading columns computed in hVecs
+ *
+ * RETURN
+ * ------
+ * error code
+ *
+ ******************************************************************************/
+
+STATIC int complete_hVecs(HSCALAR *H, int ldH, HSCALAR *VtBV, int ldVtBV,
+      int numLocked, HSCALAR *hVecs, int ldhVecs, HEVAL *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int i;
+
+   if (*numhVecs >= basisSize) return 0;
+
+   CHKERR(solve_H_RR_partial_SHprimme(H, ldH,
+         VtBV ? &VtBV[(primme->numOrthoConst + numLocked) * ldVtBV +
+                      primme->numOrthoConst + numLocked]
+              : NULL,
+         ldVtBV, hVecs, ldhVecs, hVals, basisSize, *numhVecs, basisSize, ctx));
+   for (i = *numhVecs; i < basisSize; i++) flags[i] = UNCONVERGED;
+   *numhVecs = basisSize;
+
+   return 0;
+}
+
 /*******************************************************************************
  * Subroutine copy_back_candidates - This subroutine copy into evecs, evals
  *    and resNorms unconverged Ritz pairs, up to numEvals. The uninitalized
@@ -1754,9 +2185,10 @@ STATIC int copy_back_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
 
    primme_params *primme = ctx.primme;
 
-   // Quick exit
+   // Quick exit; the locked pairs are already in evecs
 
    if (numConverged >= primme->numEvals || basisSize <= 0) {
+      *numRet = numConverged;
       return 0;
    }
 
@@ -1894,6 +2326,439 @@ STATIC int verify_norms(SCALAR *V, PRIMME_INT ldV, SCALAR *W, PRIMME_INT ldW,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine save_basis - Keep the vectors X and the basis V in the workspace,
+ *    so that the next call can use them as initial guesses.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * X            Locked vectors
+ * nX           Number of columns of X
+ * V            The orthonormal basis
+ * nV           Number of columns of V
+ *
+ ******************************************************************************/
+
+STATIC int save_basis(SCALAR *X, PRIMME_INT ldX, int nX, SCALAR *V,
+      PRIMME_INT ldV, int nV, primme_context ctx) {
+
+   primme_workspace *ws = ctx.ws;
+   PRIMME_INT nLocal = ctx.primme->nLocal;
+
+   if (ws->basis) free(ws->basis);
+   ws->basis = NULL;
+   ws->basisSize = 0;
+
+#ifdef USE_HOST
+   if (nX + nV <= 0 || nLocal <= 0) return 0;
+
+   /* The warm start is optional, so do not complain if malloc fails */
+
+   SCALAR *basis = (SCALAR *)malloc(sizeof(SCALAR) * nLocal * (nX + nV));
+   if (!basis) return 0;
+
+   CHKERR(Num_copy_matrix_Sprimme(X, nLocal, nX, ldX, basis, nLocal, ctx));
+   CHKERR(Num_copy_matrix_Sprimme(
+         V, nLocal, nV, ldV, &basis[nLocal * nX], nLocal, ctx));
+   ws->basis = basis;
+   ws->basisType = PRIMME_OP_SCALAR;
+   ws->nLocal = nLocal;
+   ws->basisSize = nX + nV;
+#else
+   (void)X;
+   (void)ldX;
+   (void)V;
+   (void)ldV;
+#endif
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Function check_stall - Return whether the residual norms have stalled, that
+ *    is, if no pair has converged and the smallest residual norm in the block
+ *    has not halved in the last maxBasisSize outer iterations, a whole
+ *    restart cycle. It is used in the first stage of internalPrecision =
+ *    primme_op_auto, to move to the working precision when the lower one
+ *    cannot reduce the residual norms further, instead of stopping at a
+ *    fixed multiple of its machine epsilon.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * blockNorms    The residual norms of the block
+ * blockSize     The size of the block
+ * numConverged  The number of converged pairs
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * stallNorm, stallConverged  The smallest residual norm and the converged
+ *               pairs at the last progress; initially HUGE_VAL and 0
+ * stallIts      The iterations since the last progress; initially 0
+ *
+ ******************************************************************************/
+
+STATIC int check_stall(HREAL *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme) {
+
+   int i;
+   double r = HUGE_VAL;
+   for (i = 0; i < blockSize; i++) r = min(r, (double)blockNorms[i]);
+
+   if (numConverged > *stallConverged || r < *stallNorm * .5) {
+      *stallNorm = r;
+      *stallConverged = numConverged;
+      *stallIts = 0;
+      return 0;
+   }
+
+   return ++*stallIts >= primme->maxBasisSize;
+}
+
+/*******************************************************************************
+ * Subroutine checkpoint_fingerprint - Return values that identify the matrix
+ *    in the checkpoints, x'*A*x and |A*x|^2 for a random vector x with a
+ *    fixed seed. It costs a matrix-vector product, and the values are local
+ *    to the process, as the checkpoint file.
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * fingerprint  The two values
+ *
+ ******************************************************************************/
+
+STATIC int checkpoint_fingerprint(double *fingerprint, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+   PRIMME_INT iseed[4] = {1, 3, 5, 7};
+
+   SCALAR *x, *Ax;
+   CHKERR(Num_malloc_Sprimme(nLocal, &x, ctx));
+   CHKERR(Num_malloc_Sprimme(nLocal, &Ax, ctx));
+   CHKERR(Num_larnv_Sprimme(2, iseed, nLocal, x, ctx));
+   CHKERR(matrixMatvec_Sprimme(x, nLocal, nLocal, Ax, nLocal, 0, 1, ctx));
+   fingerprint[0] = REAL_PART(Num_dot_Sprimme(nLocal, x, 1, Ax, 1, ctx));
+   fingerprint[1] = REAL_PART(Num_dot_Sprimme(nLocal, Ax, 1, Ax, 1, ctx));
+   CHKERR(Num_free_Sprimme(x, ctx));
+   CHKERR(Num_free_Sprimme(Ax, ctx));
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine checkpoint_state - Write the solver state into the file
+ *    primme->checkpointFile, read it from that file if it exists, or remove
+ *    the file after the solve converges.
+ *
+ *    The file starts with a header that identifies the problem and the
+ *    options that change the layout of the state or the solution: the
+ *    sizes, target, eps, the shifts and a fingerprint of the matrix. Then
+ *    the items follow as they are in memory, and the matrices column by
+ *    column. The file is
+ *    written with a temporary name and then renamed, so that an interrupted
+ *    write keeps the previous checkpoint. With several processes, every
+ *    process has its own file, with the suffix ".<procID>".
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * save     If positive, write the state; if zero, read it; and if negative,
+ *          remove the file
+ * items    Pieces of the state with fixed size
+ * nItems   Number of items
+ * mats     Matrices with nLocal rows. When reading, the number of columns
+ *          is set from the file
+ * nMats    Number of matrices
+ * fingerprint  Values returned by checkpoint_fingerprint
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * found    When reading, whether the state has been read
+ *
+ ******************************************************************************/
+
+#define CHECKPOINT_MAGIC 0x4b435043454d4d50LL /* "PMMECPCK" */
+#define CHECKPOINT_VERSION 2
+
+STATIC int checkpoint_state(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx) {
+
+   checkpoint_item *items = (checkpoint_item *)items_;
+   checkpoint_matrix *mats = (checkpoint_matrix *)mats_;
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+   int i;
+   PRIMME_INT j;
+
+   if (found) *found = 0;
+
+#ifdef USE_HOST
+   /* Describe the problem and the layout of the state */
+
+   PRIMME_INT itemsSize = 0;
+   for (i = 0; i < nItems; i++) itemsSize += (PRIMME_INT)items[i].size;
+   PRIMME_INT header[] = {(PRIMME_INT)CHECKPOINT_MAGIC, CHECKPOINT_VERSION,
+         PRIMME_OP_SCALAR, (PRIMME_INT)sizeof(SCALAR),
+         (PRIMME_INT)sizeof(HSCALAR), primme->n, nLocal, primme->numEvals,
+         primme->maxBasisSize, primme->maxBlockSize, primme->numOrthoConst,
+         primme->locking, primme->projectionParams.projection, ctx.numProcs,
+         ctx.procID, primme->target, primme->numTargetShifts, itemsSize};
+   double headerd[] = {primme->eps, fingerprint ? fingerprint[0] : 0.0,
+         fingerprint ? fingerprint[1] : 0.0};
+   size_t nShifts = primme->targetShifts ? primme->numTargetShifts : 0;
+
+   /* Compose the file names */
+
+   size_t len = strlen(primme->checkpointFile) + 32;
+   char *path = (char *)malloc(len * 2);
+   if (!path) return PRIMME_MALLOC_FAILURE;
+   char *tmp = path + len;
+   if (ctx.numProcs > 1) {
+      snprintf(path, len, "%s.%d", primme->checkpointFile, ctx.procID);
+      snprintf(tmp, len, "%s.%d.tmp", primme->checkpointFile, ctx.procID);
+   } else {
+      snprintf(path, len, "%s", primme->checkpointFile);
+      snprintf(tmp, len, "%s.tmp", primme->checkpointFile);
+   }
+
+   if (save < 0) {
+      if (remove(path) == 0) PRINTF(3, "Removed checkpoint '%s'", path);
+      free(path);
+      return 0;
+   }
+
+   if (save) {
+      FILE *f = fopen(tmp, "wb");
+      int ok = (f != NULL);
+      if (ok) ok = fwrite(header, sizeof(header), 1, f) == 1;
+      if (ok) ok = fwrite(headerd, sizeof(headerd), 1, f) == 1;
+      if (ok && nShifts > 0) {
+         ok = fwrite(primme->targetShifts, sizeof(double), nShifts, f) ==
+              nShifts;
+      }
+      for (i = 0; ok && i < nItems; i++) {
+         if (items[i].size == 0) continue;
+         ok = fwrite(items[i].p, items[i].size, 1, f) == 1;
+      }
+      for (i = 0; ok && i < nMats; i++) {
+         if (!mats[i].p) continue;
+         SCALAR *x = (SCALAR *)mats[i].p;
+         ok = fwrite(mats[i].n, sizeof(int), 1, f) == 1;
+         for (j = 0; ok && j < *mats[i].n; j++) {
+            ok = fwrite(&x[mats[i].ld * j], sizeof(SCALAR), (size_t)nLocal,
+                       f) == (size_t)nLocal;
+         }
+      }
+      if (f && fclose(f) != 0) ok = 0;
+      if (ok) ok = (rename(tmp, path) == 0);
+      if (!ok) {
+         /* A failed checkpoint does not stop the solver */
+         if (f) remove(tmp);
+         PRINTF(1, "Warning: could not write the checkpoint '%s'", path);
+      } else {
+         PRINTF(3, "Saved checkpoint '%s'", path);
+      }
+      free(path);
+      return 0;
+   }
+
+   /* Read the state if the file exists */
+
+   FILE *f = fopen(path, "rb");
+   int ok = 1, read = (f != NULL);
+   if (read) {
+      PRIMME_INT header0[sizeof(header) / sizeof(header[0])];
+      double headerd0[sizeof(headerd) / sizeof(headerd[0])], shift;
+      ok = fread(header0, sizeof(header), 1, f) == 1 &&
+           memcmp(header, header0, sizeof(header)) == 0 &&
+           fread(headerd0, sizeof(headerd), 1, f) == 1 &&
+           headerd0[0] == headerd[0];
+      for (j = 0; ok && j < (PRIMME_INT)nShifts; j++) {
+         ok = fread(&shift, sizeof(double), 1, f) == 1 &&
+              shift == primme->targetShifts[j];
+      }
+
+      /* The fingerprint may change in the last digits if the matrix-vector */
+      /* product does the sums in other order, for instance with a different */
+      /* number of threads                                                   */
+
+      double tol = sqrt(MACHINE_EPSILON);
+      ok = ok &&
+           fabs(headerd0[1] - headerd[1]) <= tol * sqrt(nLocal * headerd[2]) &&
+           fabs(headerd0[2] - headerd[2]) <= tol * headerd[2];
+      for (i = 0; ok && i < nItems; i++) {
+         if (items[i].size == 0) continue;
+         ok = fread(items[i].p, items[i].size, 1, f) == 1;
+      }
+      for (i = 0; ok && i < nMats; i++) {
+         if (!mats[i].p) continue;
+         SCALAR *x = (SCALAR *)mats[i].p;
+         int n;
+         ok = fread(&n, sizeof(int), 1, f) == 1 && n >= 0 && n <= mats[i].maxn;
+         if (ok) *mats[i].n = n;
+         for (j = 0; ok && j < n; j++) {
+            ok = fread(&x[mats[i].ld * j], sizeof(SCALAR), (size_t)nLocal,
+                       f) == (size_t)nLocal;
+         }
+      }
+      fclose(f);
+      if (!ok) {
+         PRINTF(1, "Error: the checkpoint '%s' does not match the problem",
+               path);
+      } else {
+         PRINTF(3, "Resumed from checkpoint '%s'", path);
+      }
+   }
+   free(path);
+
+   /* All processes should resume, or none; and all fail if some process */
+   /* has an invalid checkpoint                                          */
+
+   double numRead[2] = {(double)read, (double)!ok};
+   CHKERR(globalSum_Tprimme(numRead, primme_op_double, 2, ctx));
+   CHKERRM(numRead[1] != 0, PRIMME_UNEXPECTED_FAILURE, "Invalid checkpoint");
+   CHKERRM(numRead[0] != 0 && numRead[0] != ctx.numProcs,
+         PRIMME_UNEXPECTED_FAILURE, "Some processes do not have a checkpoint");
+   if (found) *found = read;
+#else
+   (void)save;
+   (void)items;
+   (void)nItems;
+   (void)mats;
+   (void)nMats;
+   (void)fingerprint;
+   (void)nLocal;
+   (void)i;
+   (void)j;
+   (void)primme;
+#endif
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine tuning_cache - Read the tuning of the previous solves of the same
+ *    problem from the file primme->tuningFile, or save the tuning of this
+ *    solve into that file.
+ *
+ *    The file is text, with a record per line. A record starts with the
+ *    signature of the problem: the version of the format, n, numEvals,
+ *    target, the number of processes and the precision. Then the method
+ *    recommendation, the block size chosen, maxBlockSize, maxBasisSize and
+ *    the measurements of the primme_CostModel follow. Saving replaces the
+ *    record with the same signature and keeps the others; as with
+ *    checkpoint_state, the file is written with a temporary name and then
+ *    renamed. Only the process 0 reads and writes the file, and the record
+ *    read is broadcast to the other processes.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * save     If nonzero, write the record; otherwise read it
+ * tuning   The record. When reading, it is all zeros if no record matches
+ *
+ ******************************************************************************/
+
+#define TUNING_VERSION 1
+#define TUNING_LINE_SIZE 4096
+
+STATIC int tuning_cache(int save, void *tuning_, primme_context ctx) {
+
+   tuning_record *tuning = (tuning_record *)tuning_;
+   primme_params *primme = ctx.primme;
+   double x[4 + TUNING_MODEL_SIZE]; /* The record after the signature */
+   int nx = sizeof(x) / sizeof(x[0]), i;
+
+   /* Pack the record, or set no record if reading */
+
+   x[0] = save ? tuning->method : 0;
+   x[1] = save ? tuning->blockSize : 0;
+   x[2] = save ? tuning->maxBlockSize : 0;
+   x[3] = save ? tuning->maxBasisSize : 0;
+   for (i = 0; i < TUNING_MODEL_SIZE; i++) {
+      x[4 + i] = save ? tuning->model[i] : 0.0;
+   }
+
+#ifdef USE_HOST
+   PRIMME_INT key[] = {TUNING_VERSION, primme->n, primme->numEvals,
+         primme->target, ctx.numProcs, PRIMME_OP_SCALAR,
+         (PRIMME_INT)sizeof(SCALAR)};
+   int nkey = sizeof(key) / sizeof(key[0]);
+
+   if (ctx.procID == 0) {
+      const char *path = primme->tuningFile;
+      size_t len = strlen(path) + 8;
+      char *tmp = (char *)malloc(len + TUNING_LINE_SIZE);
+      if (!tmp) return PRIMME_MALLOC_FAILURE;
+      char *line = tmp + len;
+      snprintf(tmp, len, "%s.tmp", path);
+
+      /* If saving, copy the records with a different signature; otherwise */
+      /* parse the record with the same signature                          */
+
+      FILE *f = fopen(path, "r"), *ft = NULL;
+      int ok = 1, found = 0;
+      if (save) ok = ((ft = fopen(tmp, "w")) != NULL);
+      while (ok && !found && f && fgets(line, TUNING_LINE_SIZE, f)) {
+         char *s = line, *e;
+         int match = 1;
+         for (i = 0; i < nkey && match; i++, s = e) {
+            match = ((PRIMME_INT)strtoll(s, &e, 10) == key[i] && e != s);
+         }
+         if (save && !match) {
+            ok = (fputs(line, ft) >= 0);
+         } else if (!save && match) {
+            for (i = 0; i < nx && match; i++, s = e) {
+               x[i] = strtod(s, &e);
+               match = (e != s);
+            }
+            found = match;
+            if (!match) for (i = 0; i < nx; i++) x[i] = 0.0;
+         }
+      }
+      if (f) fclose(f);
+
+      if (save) {
+         for (i = 0; ok && i < nkey; i++) {
+            ok = fprintf(ft, "%" PRIMME_INT_P " ", key[i]) > 0;
+         }
+         for (i = 0; ok && i < nx; i++) {
+            ok = fprintf(ft, "%.17g%s", x[i], i < nx - 1 ? " " : "\n") > 0;
+         }
+         if (ft && fclose(ft) != 0) ok = 0;
+         if (ok) ok = (rename(tmp, path) == 0);
+         if (!ok) {
+            /* A failed save does not stop the solver */
+            if (ft) remove(tmp);
+            PRINTF(1, "Warning: could not write the tuning file '%s'", path);
+         } else {
+            PRINTF(3, "Saved the tuning in '%s'", path);
+         }
+      } else if (found) {
+         PRINTF(3, "Read the tuning from '%s'", path);
+      }
+      free(tmp);
+   }
+   if (save) return 0;
+
+   /* Broadcast the record read and unpack it */
+
+   CHKERR(broadcast_Tprimme(x, primme_op_double, nx, ctx));
+#else
+   (void)primme;
+   (void)nx;
+#endif
+
+   if (!save) {
+      tuning->method = (int)x[0];
+      tuning->blockSize = (int)x[1];
+      tuning->maxBlockSize = (int)x[2];
+      tuning->maxBasisSize = (int)x[3];
+      for (i = 0; i < TUNING_MODEL_SIZE; i++) tuning->model[i] = x[4 + i];
+   }
+
+   return 0;
+}
+
 /******************************************************************************
            Dynamic Method Switching uses the following functions 
     ---------------------------------------------------------------------
@@ -2340,6 +3205,138 @@ STATIC int update_statistics(void *model_, primme_params *primme,
    return 1;
 }
 
+/******************************************************************************
+ * Function update_block_size - 
+ *
+ *    If primme->dynamicBlockSize > 0, measures the residual reduction per
+ *    second with the current limit of the block size, and decides the limit
+ *    for the next outer iterations. Called every outer iteration after the
+ *    block is chosen.
+ *
+ *    The Algorithm
+ *    -------------
+ *    Block sizes 1, 2, 4, ... up to min(maxBlockSize, numEvals+1) are tried
+ *    in turn, each during BLOCK_SIZE_PROBE_ITERATIONS outer iterations. For
+ *    each block size the rate
+ *
+ *          -sum log(residual reduction) / time
+ *
+ *    is measured, where the sum is over the pairs in the block and over the
+ *    iterations, because a larger block reduces the residuals of more pairs
+ *    at a time. Only the iterations that keep the same pairs in the block
+ *    count, that is, no pair converged and the block size did not change.
+ *    As in update_statistics, residual norm increases are not recorded.
+ *    The time of an iteration includes the matvecs, the orthogonalization,
+ *    the inner solver and the restart, so the best rate minimizes the
+ *    expected time to convergence whether the operator is memory bound or
+ *    not.
+ *
+ *    The residuals decrease slower as the iteration goes on. To not favor
+ *    the block sizes tried first, the best block size so far is measured
+ *    again after every candidate, and the candidate wins if its rate is
+ *    larger than the average of the measurements before and after it:
+ *
+ *       1 (best) -> 2 (candidate) -> 1 -> 2 wins -> 4 -> 2 -> 4 loses, done
+ *
+ *    Probing stops at the first candidate that loses, and the best block size
+ *    is the limit used in the remaining iterations.
+ *
+ * INPUT
+ * -----
+ * recentConv       Number of converged pairs since last update_block_size
+ * blockNorms       Residual norms of the pairs in the block
+ * blockSize        Number of pairs in the block
+ *
+ * INPUT/OUTPUT
+ * ------------
+ * model            The model parameters updated
+ *
+ ******************************************************************************/
+
+#define BLOCK_SIZE_PROBE_ITERATIONS 4
+
+STATIC int update_block_size(void *model_, int recentConv, HREAL *blockNorms,
+      int blockSize, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   primme_CostModel *model = (primme_CostModel *)model_;
+   double current_time = primme_wTimer();
+
+   if (!model->bs_probing) return 0;
+
+   /* Accumulate the residual reduction and the time since the last update */
+   /* if the block has the same pairs                                      */
+
+   int i;
+   double logResNorms = 0.0;
+   for (i = 0; i < blockSize; i++) {
+      if (blockNorms[i] > 0.0) logResNorms += log(blockNorms[i]);
+   }
+   if (recentConv == 0 && blockSize == model->bs_blockSize_0) {
+      if (logResNorms < model->bs_logResNorms_0) {
+         model->bs_sum_logResReductions +=
+               logResNorms - model->bs_logResNorms_0;
+      }
+      model->bs_time += current_time - model->bs_timer_0;
+      model->bs_numIt++;
+   }
+   model->bs_timer_0 = current_time;
+   model->bs_logResNorms_0 = logResNorms;
+   model->bs_blockSize_0 = blockSize;
+   if (model->bs_numIt < BLOCK_SIZE_PROBE_ITERATIONS) return 0;
+
+   /* Compare the rate with the best so far */
+
+   HREAL rate = model->bs_time > 0.0 ?
+      -model->bs_sum_logResReductions / model->bs_time : 0.0;
+
+   /* Average the rate among the processes */
+   CHKERR(globalSum_RHprimme(&rate, 1, ctx));
+   rate /= (HREAL)primme->numProcs;
+   int maxBlockSize = min(primme->maxBlockSize, primme->numEvals + 1);
+   PRINTF(3, "Block size %d reduces the residuals %e per second",
+         model->maxBlockSize, rate);
+
+   if (model->bs_probing == 2) {
+      /* Measure the best block size again */
+      model->bs_candidate_rate = rate;
+      model->bs_probing = 1;
+   }
+   else if (model->bs_candidate == 0 ||
+            model->bs_candidate_rate > (model->bs_best_rate + rate) / 2.0) {
+      /* The candidate wins; try the next block size if any */
+      if (model->bs_candidate == 0) {
+         model->bs_best_rate = rate;
+      } else {
+         model->bs_best = model->bs_candidate;
+         model->bs_best_rate = model->bs_candidate_rate;
+      }
+      if (model->bs_best < maxBlockSize) {
+         model->bs_candidate = min(model->bs_best * 2, maxBlockSize);
+         model->bs_probing = 2;
+      } else {
+         model->bs_probing = 0;
+      }
+   }
+   else {
+      model->bs_probing = 0;
+   }
+   model->maxBlockSize =
+         model->bs_probing == 2 ? model->bs_candidate : model->bs_best;
+   if (model->bs_probing == 0) {
+      PRINTF(3, "Block size %d chosen", model->maxBlockSize);
+   }
+
+   /* Start measuring the new block size */
+
+   model->bs_numIt = 0;
+   model->bs_time = 0.0;
+   model->bs_sum_logResReductions = 0.0;
+   model->bs_blockSize_0 = 0;
+
+   return 0;
+}
+
 /******************************************************************************
  * Function ratio_JDQMR_GDpk -
  *    Using model parameters, computes the ratio of expected times:
@@ -2439,6 +3436,80 @@ STATIC void initializeModel(void *model_, primme_params *primme) {
    model->accum_jdq_gdk  = 1.0L;
 }
 
+/******************************************************************************
+ * Function initializeBlockSizeModel - Initializes the block size limit, and
+ *    the model parameters used by update_block_size
+ ******************************************************************************/
+
+STATIC void initializeBlockSizeModel(void *model_, primme_params *primme) {
+   primme_CostModel *model = (primme_CostModel *)model_;
+   model->maxBlockSize   = primme->maxBlockSize;
+   model->bs_probing     = 0;
+   model->bs_best        = primme->maxBlockSize;
+   model->bs_best_rate   = 0.0;
+   model->bs_candidate   = 0;
+   model->bs_candidate_rate = 0.0;
+   model->bs_numIt       = 0;
+   model->bs_time        = 0.0;
+   model->bs_sum_logResReductions = 0.0;
+   model->bs_timer_0     = 0.0;
+   model->bs_logResNorms_0 = 0.0;
+   model->bs_blockSize_0 = 0;
+
+   if (primme->dynamicBlockSize > 0 &&
+         min(primme->maxBlockSize, primme->numEvals + 1) > 1) {
+      model->maxBlockSize = model->bs_best = 1;
+      model->bs_probing = 1;
+   }
+}
+
+/******************************************************************************
+ * Function copyModel - Copies the measurements of the model into x, or sets
+ *    them from x. The counters of the current measurement are not copied.
+ ******************************************************************************/
+
+STATIC void copyModel(void *model_, double *x, int pack) {
+   primme_CostModel *model = (primme_CostModel *)model_;
+   double *v[] = {&model->MV_PR, &model->MV, &model->PR, &model->qmr_only,
+         &model->qmr_plus_MV_PR, &model->gdk_plus_MV_PR, &model->gdk_plus_MV,
+         &model->project_locked, &model->reortho_locked, &model->gdk_conv_rate,
+         &model->jdq_conv_rate, &model->JDQMR_slowdown, &model->ratio_MV_outer,
+         &model->gdk_sum_logResReductions, &model->jdq_sum_logResReductions,
+         &model->gdk_sum_MV, &model->jdq_sum_MV, &model->accum_jdq_gdk,
+         &model->accum_jdq, &model->accum_gdk};
+   int *iv[] = {&model->nevals_by_gdk, &model->nevals_by_jdq};
+   int nv = sizeof(v) / sizeof(v[0]), niv = sizeof(iv) / sizeof(iv[0]), i;
+
+   assert(nv + niv == TUNING_MODEL_SIZE);
+   for (i = 0; i < nv; i++) {
+      if (pack) x[i] = *v[i]; else *v[i] = x[i];
+   }
+   for (i = 0; i < niv; i++) {
+      if (pack) x[nv + i] = *iv[i]; else *iv[i] = (int)x[nv + i];
+   }
+}
+
+/******************************************************************************
+ * Function seedModel - Sets the measurements of the model from a previous
+ *    solve. As when the averaging window is reset in update_statistics, the
+ *    previous convergence rates and time ratio count as a single pair, so
+ *    that the measurements of this solve are not dominated by them.
+ ******************************************************************************/
+
+STATIC void seedModel(void *model_, double *x) {
+   primme_CostModel *model = (primme_CostModel *)model_;
+
+   copyModel(model, x, 0 /* unpack */);
+   model->gdk_sum_logResReductions /= max(1, model->nevals_by_gdk);
+   model->gdk_sum_MV /= max(1, model->nevals_by_gdk);
+   model->jdq_sum_logResReductions /= max(1, model->nevals_by_jdq);
+   model->jdq_sum_MV /= max(1, model->nevals_by_jdq);
+   model->nevals_by_gdk = 1;
+   model->nevals_by_jdq = 1;
+   model->accum_gdk = model->gdk_plus_MV_PR;
+   model->accum_jdq = model->gdk_plus_MV_PR * model->accum_jdq_gdk;
+}
+
 #if 0
 /******************************************************************************
  *
@@ -133,7 +133,7 @@ int prepare_candidatesdprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_
       PRIMME_INT ldW, dummy_type_dprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_dprimme *H, int ldH, int basisSize, dummy_type_dprimme *X, dummy_type_dprimme *R, dummy_type_dprimme *BX,
       int computeXR, dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_dprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -142,6 +142,17 @@ int prepare_candidatesdprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(partial_solve_size)
+#  define partial_solve_size CONCAT(partial_solve_size,WITH_KIND(SCALAR_SUF))
+#endif
+int partial_solve_sizedprimme(int basisSize, int numLocked,
+      primme_params *primme);
+#if !defined(CHECK_TEMPLATE) && !defined(complete_hVecs)
+#  define complete_hVecs CONCAT(complete_hVecs,WITH_KIND(SCALAR_SUF))
+#endif
+int complete_hVecsdprimme(dummy_type_dprimme *H, int ldH, dummy_type_dprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(copy_back_candidates)
 #  define copy_back_candidates CONCAT(copy_back_candidates,WITH_KIND(SCALAR_SUF))
 #endif
@@ -157,6 +168,30 @@ int copy_back_candidatesdprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normsdprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *W, PRIMME_INT ldW,
       dummy_type_dprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(save_basis)
+#  define save_basis CONCAT(save_basis,WITH_KIND(SCALAR_SUF))
+#endif
+int save_basisdprimme(dummy_type_dprimme *X, PRIMME_INT ldX, int nX, dummy_type_dprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(check_stall)
+#  define check_stall CONCAT(check_stall,WITH_KIND(SCALAR_SUF))
+#endif
+int check_stalldprimme(dummy_type_dprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_fingerprint)
+#  define checkpoint_fingerprint CONCAT(checkpoint_fingerprint,WITH_KIND(SCALAR_SUF))
+#endif
+int checkpoint_fingerprintdprimme(double *fingerprint, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_state)
+#  define checkpoint_state CONCAT(checkpoint_state,WITH_KIND(SCALAR_SUF))
+#endif
+int checkpoint_statedprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(tuning_cache)
+#  define tuning_cache CONCAT(tuning_cache,WITH_KIND(SCALAR_SUF))
+#endif
+int tuning_cachedprimme(int save, void *tuning_, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(switch_from_JDQMR)
 #  define switch_from_JDQMR CONCAT(switch_from_JDQMR,WITH_KIND(SCALAR_SUF))
 #endif
@@ -171,6 +206,11 @@ int switch_from_GDpkdprimme(void *model_, primme_context ctx);
 int update_statisticsdprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+#if !defined(CHECK_TEMPLATE) && !defined(update_block_size)
+#  define update_block_size CONCAT(update_block_size,WITH_KIND(SCALAR_SUF))
+#endif
+int update_block_sizedprimme(void *model_, int recentConv, dummy_type_dprimme *blockNorms,
+      int blockSize, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(ratio_JDQMR_GDpk)
 #  define ratio_JDQMR_GDpk CONCAT(ratio_JDQMR_GDpk,WITH_KIND(SCALAR_SUF))
 #endif
@@ -184,6 +224,18 @@ void update_slowdowndprimme(void *model_);
 #  define initializeModel CONCAT(initializeModel,WITH_KIND(SCALAR_SUF))
 #endif
 void initializeModeldprimme(void *model_, primme_params *primme);
+#if !defined(CHECK_TEMPLATE) && !defined(initializeBlockSizeModel)
+#  define initializeBlockSizeModel CONCAT(initializeBlockSizeModel,WITH_KIND(SCALAR_SUF))
+#endif
+void initializeBlockSizeModeldprimme(void *model_, primme_params *primme);
+#if !defined(CHECK_TEMPLATE) && !defined(copyModel)
+#  define copyModel CONCAT(copyModel,WITH_KIND(SCALAR_SUF))
+#endif
+void copyModeldprimme(void *model_, double *x, int pack);
+#if !defined(CHECK_TEMPLATE) && !defined(seedModel)
+#  define seedModel CONCAT(seedModel,WITH_KIND(SCALAR_SUF))
+#endif
+void seedModeldprimme(void *model_, double *x);
 int main_iter_hprimme(dummy_type_sprimme *evals, dummy_type_hprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -191,7 +243,7 @@ int prepare_candidateshprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_
       PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_hprimme *X, dummy_type_hprimme *R, dummy_type_hprimme *BX,
       int computeXR, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_hprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -200,6 +252,11 @@ int prepare_candidateshprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizehprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecshprimme(dummy_type_sprimme *H, int ldH, dummy_type_sprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidateshprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W,
       PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_sprimme *hVecs, int ldhVecs,
@@ -209,15 +266,29 @@ int copy_back_candidateshprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normshprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W, PRIMME_INT ldW,
       dummy_type_hprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basishprimme(dummy_type_hprimme *X, PRIMME_INT ldX, int nX, dummy_type_hprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallhprimme(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprinthprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statehprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachehprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRhprimme(void *model_, primme_context ctx);
 int switch_from_GDpkhprimme(void *model_, primme_context ctx);
 int update_statisticshprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizehprimme(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkhprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownhprimme(void *model_);
 void initializeModelhprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelhprimme(void *model_, primme_params *primme);
+void copyModelhprimme(void *model_, double *x, int pack);
+void seedModelhprimme(void *model_, double *x);
 int main_iter_kprimme_normal(dummy_type_cprimme *evals, dummy_type_kprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -225,7 +296,7 @@ int prepare_candidateskprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dumm
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_kprimme *X, dummy_type_kprimme *R, dummy_type_kprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_kprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -234,6 +305,11 @@ int prepare_candidateskprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dumm
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizekprimme_normal(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecskprimme_normal(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidateskprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -243,15 +319,29 @@ int copy_back_candidateskprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, du
 int verify_normskprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W, PRIMME_INT ldW,
       dummy_type_kprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basiskprimme_normal(dummy_type_kprimme *X, PRIMME_INT ldX, int nX, dummy_type_kprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallkprimme_normal(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintkprimme_normal(double *fingerprint, primme_context ctx);
+int checkpoint_statekprimme_normal(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachekprimme_normal(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRkprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkkprimme_normal(void *model_, primme_context ctx);
 int update_statisticskprimme_normal(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizekprimme_normal(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkkprimme_normal(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownkprimme_normal(void *model_);
 void initializeModelkprimme_normal(void *model_, primme_params *primme);
+void initializeBlockSizeModelkprimme_normal(void *model_, primme_params *primme);
+void copyModelkprimme_normal(void *model_, double *x, int pack);
+void seedModelkprimme_normal(void *model_, double *x);
 int main_iter_kprimme(dummy_type_sprimme *evals, dummy_type_kprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -259,7 +349,7 @@ int prepare_candidateskprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_kprimme *X, dummy_type_kprimme *R, dummy_type_kprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_kprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -268,6 +358,11 @@ int prepare_candidateskprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizekprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecskprimme(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidateskprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -277,15 +372,29 @@ int copy_back_candidateskprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normskprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W, PRIMME_INT ldW,
       dummy_type_kprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basiskprimme(dummy_type_kprimme *X, PRIMME_INT ldX, int nX, dummy_type_kprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallkprimme(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintkprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statekprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachekprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRkprimme(void *model_, primme_context ctx);
 int switch_from_GDpkkprimme(void *model_, primme_context ctx);
 int update_statisticskprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizekprimme(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkkprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownkprimme(void *model_);
 void initializeModelkprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelkprimme(void *model_, primme_params *primme);
+void copyModelkprimme(void *model_, double *x, int pack);
+void seedModelkprimme(void *model_, double *x);
 int main_iter_sprimme(dummy_type_sprimme *evals, dummy_type_sprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -293,7 +402,7 @@ int prepare_candidatessprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_
       PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_sprimme *X, dummy_type_sprimme *R, dummy_type_sprimme *BX,
       int computeXR, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_sprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -302,6 +411,11 @@ int prepare_candidatessprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizesprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecssprimme(dummy_type_sprimme *H, int ldH, dummy_type_sprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatessprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W,
       PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_sprimme *hVecs, int ldhVecs,
@@ -311,15 +425,29 @@ int copy_back_candidatessprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normssprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W, PRIMME_INT ldW,
       dummy_type_sprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basissprimme(dummy_type_sprimme *X, PRIMME_INT ldX, int nX, dummy_type_sprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallsprimme(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintsprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statesprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachesprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRsprimme(void *model_, primme_context ctx);
 int switch_from_GDpksprimme(void *model_, primme_context ctx);
 int update_statisticssprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizesprimme(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpksprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownsprimme(void *model_);
 void initializeModelsprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelsprimme(void *model_, primme_params *primme);
+void copyModelsprimme(void *model_, double *x, int pack);
+void seedModelsprimme(void *model_, double *x);
 int main_iter_cprimme_normal(dummy_type_cprimme *evals, dummy_type_cprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -327,7 +455,7 @@ int prepare_candidatescprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dumm
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *X, dummy_type_cprimme *R, dummy_type_cprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_cprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -336,6 +464,11 @@ int prepare_candidatescprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dumm
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizecprimme_normal(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecscprimme_normal(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatescprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -345,15 +478,29 @@ int copy_back_candidatescprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, du
 int verify_normscprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W, PRIMME_INT ldW,
       dummy_type_cprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basiscprimme_normal(dummy_type_cprimme *X, PRIMME_INT ldX, int nX, dummy_type_cprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallcprimme_normal(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintcprimme_normal(double *fingerprint, primme_context ctx);
+int checkpoint_statecprimme_normal(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachecprimme_normal(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRcprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkcprimme_normal(void *model_, primme_context ctx);
 int update_statisticscprimme_normal(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizecprimme_normal(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkcprimme_normal(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdowncprimme_normal(void *model_);
 void initializeModelcprimme_normal(void *model_, primme_params *primme);
+void initializeBlockSizeModelcprimme_normal(void *model_, primme_params *primme);
+void copyModelcprimme_normal(void *model_, double *x, int pack);
+void seedModelcprimme_normal(void *model_, double *x);
 int main_iter_cprimme(dummy_type_sprimme *evals, dummy_type_cprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -361,7 +508,7 @@ int prepare_candidatescprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *X, dummy_type_cprimme *R, dummy_type_cprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_cprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -370,6 +517,11 @@ int prepare_candidatescprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizecprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecscprimme(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatescprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -379,15 +531,29 @@ int copy_back_candidatescprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normscprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W, PRIMME_INT ldW,
       dummy_type_cprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basiscprimme(dummy_type_cprimme *X, PRIMME_INT ldX, int nX, dummy_type_cprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallcprimme(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintcprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statecprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachecprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRcprimme(void *model_, primme_context ctx);
 int switch_from_GDpkcprimme(void *model_, primme_context ctx);
 int update_statisticscprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizecprimme(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkcprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdowncprimme(void *model_);
 void initializeModelcprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelcprimme(void *model_, primme_params *primme);
+void copyModelcprimme(void *model_, double *x, int pack);
+void seedModelcprimme(void *model_, double *x);
 int main_iter_zprimme_normal(dummy_type_zprimme *evals, dummy_type_zprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -395,7 +561,7 @@ int prepare_candidateszprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dumm
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *X, dummy_type_zprimme *R, dummy_type_zprimme *BX,
       int computeXR, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_zprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -404,6 +570,11 @@ int prepare_candidateszprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dumm
       dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizezprimme_normal(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecszprimme_normal(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidateszprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *hVecs, int ldhVecs,
@@ -413,15 +584,29 @@ int copy_back_candidateszprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, du
 int verify_normszprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W, PRIMME_INT ldW,
       dummy_type_zprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basiszprimme_normal(dummy_type_zprimme *X, PRIMME_INT ldX, int nX, dummy_type_zprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallzprimme_normal(dummy_type_dprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintzprimme_normal(double *fingerprint, primme_context ctx);
+int checkpoint_statezprimme_normal(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachezprimme_normal(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRzprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkzprimme_normal(void *model_, primme_context ctx);
 int update_statisticszprimme_normal(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizezprimme_normal(void *model_, int recentConv, dummy_type_dprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkzprimme_normal(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownzprimme_normal(void *model_);
 void initializeModelzprimme_normal(void *model_, primme_params *primme);
+void initializeBlockSizeModelzprimme_normal(void *model_, primme_params *primme);
+void copyModelzprimme_normal(void *model_, double *x, int pack);
+void seedModelzprimme_normal(void *model_, double *x);
 int main_iter_zprimme(dummy_type_dprimme *evals, dummy_type_zprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -429,7 +614,7 @@ int prepare_candidateszprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *X, dummy_type_zprimme *R, dummy_type_zprimme *BX,
       int computeXR, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_zprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -438,6 +623,11 @@ int prepare_candidateszprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizezprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecszprimme(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidateszprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *hVecs, int ldhVecs,
@@ -447,15 +637,188 @@ int copy_back_candidateszprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normszprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W, PRIMME_INT ldW,
       dummy_type_zprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basiszprimme(dummy_type_zprimme *X, PRIMME_INT ldX, int nX, dummy_type_zprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallzprimme(dummy_type_dprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintzprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statezprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachezprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRzprimme(void *model_, primme_context ctx);
 int switch_from_GDpkzprimme(void *model_, primme_context ctx);
 int update_statisticszprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizezprimme(void *model_, int recentConv, dummy_type_dprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkzprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownzprimme(void *model_);
 void initializeModelzprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelzprimme(void *model_, primme_params *primme);
+void copyModelzprimme(void *model_, double *x, int pack);
+void seedModelzprimme(void *model_, double *x);
+int main_iter_dh_sprimme(dummy_type_dprimme *evals, dummy_type_dh_sprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
+      primme_context ctx);
+int prepare_candidatesdh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dh_sprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
+      dummy_type_dprimme *H, int ldH, int basisSize, dummy_type_dh_sprimme *X, dummy_type_dh_sprimme *R, dummy_type_dh_sprimme *BX,
+      int computeXR, dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
+      int maxBlockSize, dummy_type_dh_sprimme *evecs, int numLocked, PRIMME_INT ldevecs,
+      dummy_type_dh_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
+      int *numArbitraryVecs, double *smallestResNorm, dummy_type_dprimme *hVecsRot,
+      int ldhVecsRot, int numConverged, dummy_type_dprimme *basisNorms, int *reset,
+      dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *prevhVecs, int nprevhVecs,
+      int ldprevhVecs, int practConvChecking, int *map, double startTime,
+      primme_context ctx);
+int partial_solve_sizedh_sprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsdh_sprimme(dummy_type_dprimme *H, int ldH, dummy_type_dprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
+int copy_back_candidatesdh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dh_sprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
+      dummy_type_dprimme *H, int ldH, int basisSize, dummy_type_dprimme *hVecs, int ldhVecs,
+      dummy_type_dprimme *hVals, dummy_type_dh_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals,
+      dummy_type_dprimme *resNorms, int targetShiftIndex, int numConverged, dummy_type_dprimme *VtBV,
+      int ldVtBV, int *numRet, primme_context ctx);
+int verify_normsdh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dh_sprimme *W, PRIMME_INT ldW,
+      dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
+      int *flags, int *numConverged, primme_context ctx);
+int save_basisdh_sprimme(dummy_type_dh_sprimme *X, PRIMME_INT ldX, int nX, dummy_type_dh_sprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stalldh_sprimme(dummy_type_dprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintdh_sprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statedh_sprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachedh_sprimme(int save, void *tuning_, primme_context ctx);
+int switch_from_JDQMRdh_sprimme(void *model_, primme_context ctx);
+int switch_from_GDpkdh_sprimme(void *model_, primme_context ctx);
+int update_statisticsdh_sprimme(void *model_, primme_params *primme,
+      double current_time, int recentConv, int calledAtRestart,
+      int numConverged, double currentResNorm);
+int update_block_sizedh_sprimme(void *model_, int recentConv, dummy_type_dprimme *blockNorms,
+      int blockSize, primme_context ctx);
+double ratio_JDQMR_GDpkdh_sprimme(void *model_, int numLocked,
+   double estimate_slowdown, double estimate_ratio_MV_outer);
+void update_slowdowndh_sprimme(void *model_);
+void initializeModeldh_sprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModeldh_sprimme(void *model_, primme_params *primme);
+void copyModeldh_sprimme(void *model_, double *x, int pack);
+void seedModeldh_sprimme(void *model_, double *x);
+int main_iter_dh_cprimme_normal(dummy_type_zprimme *evals, dummy_type_dh_cprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
+      primme_context ctx);
+int prepare_candidatesdh_cprimme_normal(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
+      dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_dh_cprimme *X, dummy_type_dh_cprimme *R, dummy_type_dh_cprimme *BX,
+      int computeXR, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
+      int maxBlockSize, dummy_type_dh_cprimme *evecs, int numLocked, PRIMME_INT ldevecs,
+      dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
+      int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
+      int *numArbitraryVecs, double *smallestResNorm, dummy_type_zprimme *hVecsRot,
+      int ldhVecsRot, int numConverged, dummy_type_dprimme *basisNorms, int *reset,
+      dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *prevhVecs, int nprevhVecs,
+      int ldprevhVecs, int practConvChecking, int *map, double startTime,
+      primme_context ctx);
+int partial_solve_sizedh_cprimme_normal(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsdh_cprimme_normal(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
+int copy_back_candidatesdh_cprimme_normal(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
+      dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *hVecs, int ldhVecs,
+      dummy_type_zprimme *hVals, dummy_type_dh_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *evals,
+      dummy_type_dprimme *resNorms, int targetShiftIndex, int numConverged, dummy_type_zprimme *VtBV,
+      int ldVtBV, int *numRet, primme_context ctx);
+int verify_normsdh_cprimme_normal(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W, PRIMME_INT ldW,
+      dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
+      int *flags, int *numConverged, primme_context ctx);
+int save_basisdh_cprimme_normal(dummy_type_dh_cprimme *X, PRIMME_INT ldX, int nX, dummy_type_dh_cprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stalldh_cprimme_normal(dummy_type_dprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintdh_cprimme_normal(double *fingerprint, primme_context ctx);
+int checkpoint_statedh_cprimme_normal(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachedh_cprimme_normal(int save, void *tuning_, primme_context ctx);
+int switch_from_JDQMRdh_cprimme_normal(void *model_, primme_context ctx);
+int switch_from_GDpkdh_cprimme_normal(void *model_, primme_context ctx);
+int update_statisticsdh_cprimme_normal(void *model_, primme_params *primme,
+      double current_time, int recentConv, int calledAtRestart,
+      int numConverged, double currentResNorm);
+int update_block_sizedh_cprimme_normal(void *model_, int recentConv, dummy_type_dprimme *blockNorms,
+      int blockSize, primme_context ctx);
+double ratio_JDQMR_GDpkdh_cprimme_normal(void *model_, int numLocked,
+   double estimate_slowdown, double estimate_ratio_MV_outer);
+void update_slowdowndh_cprimme_normal(void *model_);
+void initializeModeldh_cprimme_normal(void *model_, primme_params *primme);
+void initializeBlockSizeModeldh_cprimme_normal(void *model_, primme_params *primme);
+void copyModeldh_cprimme_normal(void *model_, double *x, int pack);
+void seedModeldh_cprimme_normal(void *model_, double *x);
+int main_iter_dh_cprimme(dummy_type_dprimme *evals, dummy_type_dh_cprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
+      primme_context ctx);
+int prepare_candidatesdh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
+      dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_dh_cprimme *X, dummy_type_dh_cprimme *R, dummy_type_dh_cprimme *BX,
+      int computeXR, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
+      int maxBlockSize, dummy_type_dh_cprimme *evecs, int numLocked, PRIMME_INT ldevecs,
+      dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
+      int *numArbitraryVecs, double *smallestResNorm, dummy_type_zprimme *hVecsRot,
+      int ldhVecsRot, int numConverged, dummy_type_dprimme *basisNorms, int *reset,
+      dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *prevhVecs, int nprevhVecs,
+      int ldprevhVecs, int practConvChecking, int *map, double startTime,
+      primme_context ctx);
+int partial_solve_sizedh_cprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsdh_cprimme(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
+int copy_back_candidatesdh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
+      dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *hVecs, int ldhVecs,
+      dummy_type_dprimme *hVals, dummy_type_dh_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals,
+      dummy_type_dprimme *resNorms, int targetShiftIndex, int numConverged, dummy_type_zprimme *VtBV,
+      int ldVtBV, int *numRet, primme_context ctx);
+int verify_normsdh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W, PRIMME_INT ldW,
+      dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
+      int *flags, int *numConverged, primme_context ctx);
+int save_basisdh_cprimme(dummy_type_dh_cprimme *X, PRIMME_INT ldX, int nX, dummy_type_dh_cprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stalldh_cprimme(dummy_type_dprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintdh_cprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statedh_cprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachedh_cprimme(int save, void *tuning_, primme_context ctx);
+int switch_from_JDQMRdh_cprimme(void *model_, primme_context ctx);
+int switch_from_GDpkdh_cprimme(void *model_, primme_context ctx);
+int update_statisticsdh_cprimme(void *model_, primme_params *primme,
+      double current_time, int recentConv, int calledAtRestart,
+      int numConverged, double currentResNorm);
+int update_block_sizedh_cprimme(void *model_, int recentConv, dummy_type_dprimme *blockNorms,
+      int blockSize, primme_context ctx);
+double ratio_JDQMR_GDpkdh_cprimme(void *model_, int numLocked,
+   double estimate_slowdown, double estimate_ratio_MV_outer);
+void update_slowdowndh_cprimme(void *model_);
+void initializeModeldh_cprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModeldh_cprimme(void *model_, primme_params *primme);
+void copyModeldh_cprimme(void *model_, double *x, int pack);
+void seedModeldh_cprimme(void *model_, double *x);
 int main_iter_magma_hprimme(dummy_type_sprimme *evals, dummy_type_magma_hprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -463,7 +826,7 @@ int prepare_candidatesmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_magma_hprimme *X, dummy_type_magma_hprimme *R, dummy_type_magma_hprimme *BX,
       int computeXR, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_hprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -472,6 +835,11 @@ int prepare_candidatesmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV,
       dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizemagma_hprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsmagma_hprimme(dummy_type_sprimme *H, int ldH, dummy_type_sprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatesmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
       PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_sprimme *hVecs, int ldhVecs,
@@ -481,15 +849,29 @@ int copy_back_candidatesmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ld
 int verify_normsmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W, PRIMME_INT ldW,
       dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basismagma_hprimme(dummy_type_magma_hprimme *X, PRIMME_INT ldX, int nX, dummy_type_magma_hprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallmagma_hprimme(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintmagma_hprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statemagma_hprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachemagma_hprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRmagma_hprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_hprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_hprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizemagma_hprimme(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkmagma_hprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownmagma_hprimme(void *model_);
 void initializeModelmagma_hprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelmagma_hprimme(void *model_, primme_params *primme);
+void copyModelmagma_hprimme(void *model_, double *x, int pack);
+void seedModelmagma_hprimme(void *model_, double *x);
 int main_iter_magma_kprimme_normal(dummy_type_cprimme *evals, dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -497,7 +879,7 @@ int prepare_candidatesmagma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_I
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_magma_kprimme *X, dummy_type_magma_kprimme *R, dummy_type_magma_kprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_kprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -506,6 +888,11 @@ int prepare_candidatesmagma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_I
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizemagma_kprimme_normal(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsmagma_kprimme_normal(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatesmagma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -515,15 +902,29 @@ int copy_back_candidatesmagma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME
 int verify_normsmagma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W, PRIMME_INT ldW,
       dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basismagma_kprimme_normal(dummy_type_magma_kprimme *X, PRIMME_INT ldX, int nX, dummy_type_magma_kprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallmagma_kprimme_normal(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintmagma_kprimme_normal(double *fingerprint, primme_context ctx);
+int checkpoint_statemagma_kprimme_normal(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachemagma_kprimme_normal(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRmagma_kprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_kprimme_normal(void *model_, primme_context ctx);
 int update_statisticsmagma_kprimme_normal(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizemagma_kprimme_normal(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkmagma_kprimme_normal(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownmagma_kprimme_normal(void *model_);
 void initializeModelmagma_kprimme_normal(void *model_, primme_params *primme);
+void initializeBlockSizeModelmagma_kprimme_normal(void *model_, primme_params *primme);
+void copyModelmagma_kprimme_normal(void *model_, double *x, int pack);
+void seedModelmagma_kprimme_normal(void *model_, double *x);
 int main_iter_magma_kprimme(dummy_type_sprimme *evals, dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -531,7 +932,7 @@ int prepare_candidatesmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_magma_kprimme *X, dummy_type_magma_kprimme *R, dummy_type_magma_kprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_kprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -540,6 +941,11 @@ int prepare_candidatesmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV,
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizemagma_kprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsmagma_kprimme(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatesmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -549,15 +955,29 @@ int copy_back_candidatesmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ld
 int verify_normsmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W, PRIMME_INT ldW,
       dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basismagma_kprimme(dummy_type_magma_kprimme *X, PRIMME_INT ldX, int nX, dummy_type_magma_kprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallmagma_kprimme(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintmagma_kprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statemagma_kprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachemagma_kprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRmagma_kprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_kprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_kprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizemagma_kprimme(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkmagma_kprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownmagma_kprimme(void *model_);
 void initializeModelmagma_kprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelmagma_kprimme(void *model_, primme_params *primme);
+void copyModelmagma_kprimme(void *model_, double *x, int pack);
+void seedModelmagma_kprimme(void *model_, double *x);
 int main_iter_magma_sprimme(dummy_type_sprimme *evals, dummy_type_magma_sprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -565,7 +985,7 @@ int prepare_candidatesmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_magma_sprimme *X, dummy_type_magma_sprimme *R, dummy_type_magma_sprimme *BX,
       int computeXR, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_sprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_magma_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -574,6 +994,11 @@ int prepare_candidatesmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV,
       dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizemagma_sprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsmagma_sprimme(dummy_type_sprimme *H, int ldH, dummy_type_sprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatesmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
       PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_sprimme *hVecs, int ldhVecs,
@@ -583,15 +1008,29 @@ int copy_back_candidatesmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ld
 int verify_normsmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W, PRIMME_INT ldW,
       dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basismagma_sprimme(dummy_type_magma_sprimme *X, PRIMME_INT ldX, int nX, dummy_type_magma_sprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallmagma_sprimme(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintmagma_sprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statemagma_sprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachemagma_sprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRmagma_sprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_sprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_sprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizemagma_sprimme(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkmagma_sprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownmagma_sprimme(void *model_);
 void initializeModelmagma_sprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelmagma_sprimme(void *model_, primme_params *primme);
+void copyModelmagma_sprimme(void *model_, double *x, int pack);
+void seedModelmagma_sprimme(void *model_, double *x);
 int main_iter_magma_cprimme_normal(dummy_type_cprimme *evals, dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -599,7 +1038,7 @@ int prepare_candidatesmagma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_I
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_magma_cprimme *X, dummy_type_magma_cprimme *R, dummy_type_magma_cprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_cprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -608,6 +1047,11 @@ int prepare_candidatesmagma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_I
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizemagma_cprimme_normal(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsmagma_cprimme_normal(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatesmagma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -617,15 +1061,29 @@ int copy_back_candidatesmagma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME
 int verify_normsmagma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W, PRIMME_INT ldW,
       dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basismagma_cprimme_normal(dummy_type_magma_cprimme *X, PRIMME_INT ldX, int nX, dummy_type_magma_cprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallmagma_cprimme_normal(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintmagma_cprimme_normal(double *fingerprint, primme_context ctx);
+int checkpoint_statemagma_cprimme_normal(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachemagma_cprimme_normal(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRmagma_cprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_cprimme_normal(void *model_, primme_context ctx);
 int update_statisticsmagma_cprimme_normal(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizemagma_cprimme_normal(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkmagma_cprimme_normal(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownmagma_cprimme_normal(void *model_);
 void initializeModelmagma_cprimme_normal(void *model_, primme_params *primme);
+void initializeBlockSizeModelmagma_cprimme_normal(void *model_, primme_params *primme);
+void copyModelmagma_cprimme_normal(void *model_, double *x, int pack);
+void seedModelmagma_cprimme_normal(void *model_, double *x);
 int main_iter_magma_cprimme(dummy_type_sprimme *evals, dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -633,7 +1091,7 @@ int prepare_candidatesmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_magma_cprimme *X, dummy_type_magma_cprimme *R, dummy_type_magma_cprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_cprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -642,6 +1100,11 @@ int prepare_candidatesmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV,
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizemagma_cprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsmagma_cprimme(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatesmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -651,15 +1114,29 @@ int copy_back_candidatesmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ld
 int verify_normsmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W, PRIMME_INT ldW,
       dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basismagma_cprimme(dummy_type_magma_cprimme *X, PRIMME_INT ldX, int nX, dummy_type_magma_cprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallmagma_cprimme(dummy_type_sprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintmagma_cprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statemagma_cprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachemagma_cprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRmagma_cprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_cprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_cprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizemagma_cprimme(void *model_, int recentConv, dummy_type_sprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkmagma_cprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownmagma_cprimme(void *model_);
 void initializeModelmagma_cprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelmagma_cprimme(void *model_, primme_params *primme);
+void copyModelmagma_cprimme(void *model_, double *x, int pack);
+void seedModelmagma_cprimme(void *model_, double *x);
 int main_iter_magma_dprimme(dummy_type_dprimme *evals, dummy_type_magma_dprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -667,7 +1144,7 @@ int prepare_candidatesmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_dprimme *H, int ldH, int basisSize, dummy_type_magma_dprimme *X, dummy_type_magma_dprimme *R, dummy_type_magma_dprimme *BX,
       int computeXR, dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_dprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_magma_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -676,6 +1153,11 @@ int prepare_candidatesmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV,
       dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizemagma_dprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsmagma_dprimme(dummy_type_dprimme *H, int ldH, dummy_type_dprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatesmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
       PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_dprimme *H, int ldH, int basisSize, dummy_type_dprimme *hVecs, int ldhVecs,
@@ -685,15 +1167,29 @@ int copy_back_candidatesmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ld
 int verify_normsmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W, PRIMME_INT ldW,
       dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basismagma_dprimme(dummy_type_magma_dprimme *X, PRIMME_INT ldX, int nX, dummy_type_magma_dprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallmagma_dprimme(dummy_type_dprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintmagma_dprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statemagma_dprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachemagma_dprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRmagma_dprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_dprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_dprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizemagma_dprimme(void *model_, int recentConv, dummy_type_dprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkmagma_dprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownmagma_dprimme(void *model_);
 void initializeModelmagma_dprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelmagma_dprimme(void *model_, primme_params *primme);
+void copyModelmagma_dprimme(void *model_, double *x, int pack);
+void seedModelmagma_dprimme(void *model_, double *x);
 int main_iter_magma_zprimme_normal(dummy_type_zprimme *evals, dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -701,7 +1197,7 @@ int prepare_candidatesmagma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_I
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_magma_zprimme *X, dummy_type_magma_zprimme *R, dummy_type_magma_zprimme *BX,
       int computeXR, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_zprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -710,6 +1206,11 @@ int prepare_candidatesmagma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_I
       dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizemagma_zprimme_normal(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsmagma_zprimme_normal(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatesmagma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *hVecs, int ldhVecs,
@@ -719,15 +1220,29 @@ int copy_back_candidatesmagma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME
 int verify_normsmagma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W, PRIMME_INT ldW,
       dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basismagma_zprimme_normal(dummy_type_magma_zprimme *X, PRIMME_INT ldX, int nX, dummy_type_magma_zprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallmagma_zprimme_normal(dummy_type_dprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintmagma_zprimme_normal(double *fingerprint, primme_context ctx);
+int checkpoint_statemagma_zprimme_normal(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachemagma_zprimme_normal(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRmagma_zprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_zprimme_normal(void *model_, primme_context ctx);
 int update_statisticsmagma_zprimme_normal(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizemagma_zprimme_normal(void *model_, int recentConv, dummy_type_dprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkmagma_zprimme_normal(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownmagma_zprimme_normal(void *model_);
 void initializeModelmagma_zprimme_normal(void *model_, primme_params *primme);
+void initializeBlockSizeModelmagma_zprimme_normal(void *model_, primme_params *primme);
+void copyModelmagma_zprimme_normal(void *model_, double *x, int pack);
+void seedModelmagma_zprimme_normal(void *model_, double *x);
 int main_iter_magma_zprimme(dummy_type_dprimme *evals, dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
@@ -735,7 +1250,7 @@ int prepare_candidatesmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV,
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_magma_zprimme *X, dummy_type_magma_zprimme *R, dummy_type_magma_zprimme *BX,
       int computeXR, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
-      int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
+      int *numhVecs, int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_zprimme *evecs, int numLocked, PRIMME_INT ldevecs,
       dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
       int targetShiftIndex, int *iev, int *blockSize, int *recentlyConverged,
@@ -744,6 +1259,11 @@ int prepare_candidatesmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV,
       dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int partial_solve_sizemagma_zprimme(int basisSize, int numLocked,
+      primme_params *primme);
+int complete_hVecsmagma_zprimme(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      int numLocked, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int *flags,
+      int basisSize, int *numhVecs, primme_context ctx);
 int copy_back_candidatesmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *hVecs, int ldhVecs,
@@ -753,13 +1273,27 @@ int copy_back_candidatesmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ld
 int verify_normsmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W, PRIMME_INT ldW,
       dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int save_basismagma_zprimme(dummy_type_magma_zprimme *X, PRIMME_INT ldX, int nX, dummy_type_magma_zprimme *V,
+      PRIMME_INT ldV, int nV, primme_context ctx);
+int check_stallmagma_zprimme(dummy_type_dprimme *blockNorms, int blockSize, int numConverged,
+      double *stallNorm, int *stallConverged, int *stallIts,
+      primme_params *primme);
+int checkpoint_fingerprintmagma_zprimme(double *fingerprint, primme_context ctx);
+int checkpoint_statemagma_zprimme(int save, void *items_, int nItems, void *mats_,
+      int nMats, double *fingerprint, int *found, primme_context ctx);
+int tuning_cachemagma_zprimme(int save, void *tuning_, primme_context ctx);
 int switch_from_JDQMRmagma_zprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_zprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_zprimme(void *model_, primme_params *primme,
       double current_time, int recentConv, int calledAtRestart,
       int numConverged, double currentResNorm);
+int update_block_sizemagma_zprimme(void *model_, int recentConv, dummy_type_dprimme *blockNorms,
+      int blockSize, primme_context ctx);
 double ratio_JDQMR_GDpkmagma_zprimme(void *model_, int numLocked,
    double estimate_slowdown, double estimate_ratio_MV_outer);
 void update_slowdownmagma_zprimme(void *model_);
 void initializeModelmagma_zprimme(void *model_, primme_params *primme);
+void initializeBlockSizeModelmagma_zprimme(void *model_, primme_params *primme);
+void copyModelmagma_zprimme(void *model_, double *x, int pack);
+void seedModelmagma_zprimme(void *model_, double *x);
 #endif
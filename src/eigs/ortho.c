@@ -319,6 +319,7 @@ int Bortho_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *R, int ldR,
 
 clean:
    if (primme) primme->stats.timeOrtho += primme_wTimer() - t0;
+   Trace_span("ortho", t0, ctx.trace);
 
    CHKERR(Num_free_SHprimme(overlaps, ctx));
    if (B) CHKERR(Num_free_Sprimme(Bx, ctx));
@@ -519,6 +520,13 @@ STATIC int Bortho_block_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *VLtBVL,
    double eps_orth;
    CHKERR(machineEpsOrth_Sprimme(&eps_orth, ctx));
 
+   /* With primme_orth_lowsync, every process factorizes the reduced Gram  */
+   /* matrix instead of process 0 broadcasting the factors. The processes  */
+   /* only reduce a hash of the factors, and they fall back to the         */
+   /* broadcast if some process got different factors.                     */
+
+   int replicate = primme && primme->orth == primme_orth_lowsync;
+
    if (VLtBVL == NULL) {
       CHKERR(Bortho_gen_Sprimme(V, ldV, R, ldR, b1, b2 - 1, locked, ldLocked,
             numLocked, RLocked, ldRLocked, nLocal, B, Bctx, primme->iseed,
@@ -664,7 +672,7 @@ STATIC int Bortho_block_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *VLtBVL,
          else plus1 = min(its + 1, plus1);
       }
 
-      if (ctx.procID == 0) {
+      if (ctx.procID == 0 || replicate) {
          // If the norm of the vector overflows, discard the inner product with
          // other vectors and set the maximum value as the norm
          for (i = 0; i < b2 - b1; i++) {
@@ -709,11 +717,29 @@ STATIC int Bortho_block_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *VLtBVL,
          }
       }
 
-      CHKERR(broadcast_SHprimme(VLtBVLdA, nVL*(b2-b1), ctx));
-      CHKERR(broadcast_RHprimme(N, b2-b1, ctx));
-      CHKERR(broadcast_RHprimme(D, b2-b1, ctx));
-      CHKERR(broadcast_SHprimme(Y, (b2 - b1) * (b2 - b1), ctx));
-      CHKERR(broadcast_iprimme(&Yortho, 1, ctx));
+      int same = 0;
+      if (replicate) {
+         uint32_t hash = 5381;
+         hash = hash_buffer(hash, VLtBVLdA, sizeof(HSCALAR) * nVL * (b2 - b1));
+         hash = hash_buffer(hash, N, sizeof(HREAL) * (b2 - b1));
+         hash = hash_buffer(hash, D, sizeof(HREAL) * (b2 - b1));
+         hash = hash_buffer(hash, Y, sizeof(HSCALAR) * (b2 - b1) * (b2 - b1));
+         hash = hash_buffer(hash, &Yortho, sizeof(int));
+         CHKERR(replicated_check_Sprimme(hash, &same, ctx));
+      }
+      if (!same) {
+         primme_reduction r[5];
+         CHKERR(broadcastStart_SHprimme(VLtBVLdA, nVL*(b2-b1), &r[0], ctx));
+         CHKERRSUM(broadcastStart_RHprimme(N, b2-b1, &r[1], ctx), r, 1);
+         CHKERRSUM(broadcastStart_RHprimme(D, b2-b1, &r[2], ctx), r, 2);
+         CHKERRSUM(broadcastStart_SHprimme(
+                         Y, (b2 - b1) * (b2 - b1), &r[3], ctx),
+               r, 3);
+         CHKERRSUM(broadcastStart_iprimme(&Yortho, 1, &r[4], ctx), r, 4);
+         for (i = 0; i < 5; i++) {
+            CHKERRSUM(globalSumWait_Tprimme(&r[i], ctx), r, 5);
+         }
+      }
 
       if (RLocked) {
          /* R(0:b1-1,:) += VtBV\Vc'*Xc*gi = VtBV\A(0:b1-1,:)*R(b1:b2-1,:) */
@@ -798,6 +824,7 @@ STATIC int Bortho_block_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *VLtBVL,
          numLocked + b1, numLocked + b2, ctx));
 
    if (primme) primme->stats.timeOrtho += primme_wTimer() - t0;
+   Trace_span("ortho", t0, ctx.trace);
 
    return 0;
 }
@@ -820,6 +847,13 @@ STATIC int Bortho_block_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *VLtBVL,
  * rwork           Auxiliary space
  * lrwork          Available rwork
  *
+ * NOTE: with primme_orth_lowsync and B=I (BQ == Q), X'X is reduced together
+ * with Q'X and the norms of X(i) - Q*y, with y=Q'X(i), are computed as
+ * ||X(i)||^2 - 2||y||^2 + y'*QtBQ*y. That is exact only because B=I makes
+ * QtBQ the Gram matrix Q'Q; without QtBQ, Q is taken as orthonormal and the
+ * norms are ||X(i)||^2 - ||y||^2. A second reduction is done only if that
+ * suffers from cancellation.
+ *
  ****************************************************************************/
 
 TEMPLATE_PLEASE
@@ -843,14 +877,30 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, int nQ, PRIMME_INT ldQ,
       }
    }
 
-   /* y = Q'*X */
+   /* Compute the norms from the same reduction as Q'*X if possible. That */
+   /* needs B=I, so that QtBQ, if given, is Q'*Q.                         */
+
+   int pythagoras =
+         norms && BQ == Q && primme->orth == primme_orth_lowsync;
 
-   HSCALAR *y;
-   CHKERR(Num_malloc_SHprimme(nQ * nX, &y, ctx));
+   /* y = Q'*X; xx(i) = X(i)'*X(i), stored after y */
+
+   HSCALAR *y, *xx = NULL;
+   CHKERR(Num_malloc_SHprimme((nQ + (pythagoras ? 1 : 0)) * nX, &y, ctx));
    CHKERR(Num_zero_matrix_SHprimme(y, nQ, nX, nQ, ctx));
+   if (pythagoras) {
+      xx = &y[nQ * nX];
+      for (i = 0; i < nX; i++) xx[i] = 0.0;
+   }
    if (!inX) {
       CHKERR(Num_gemm_ddh_Sprimme(
             "C", "N", nQ, nX, mQ, 1.0, Q, ldQ, X, ldX, 0.0, y, nQ, ctx));
+      if (pythagoras) {
+         for (j = 0; j < nX; j++) {
+            xx[j] = REAL_PART(Num_dot_Sprimme(
+                  mQ, &X[j * ldX], 1, &X[j * ldX], 1, ctx));
+         }
+      }
    }
    else {
       int m=min(M, mQ);
@@ -862,25 +912,69 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, int nQ, PRIMME_INT ldQ,
                &X[i], m, inX, nX, ldX, X0, NULL, m, ctx));
          CHKERR(Num_gemm_ddh_Sprimme(
                "C", "N", nQ, nX, m, 1.0, &Q[i], ldQ, X0, m, 1.0, y, nQ, ctx));
+         if (pythagoras) {
+            for (j = 0; j < nX; j++) {
+               xx[j] += REAL_PART(Num_dot_Sprimme(
+                     m, &X0[j * m], 1, &X0[j * m], 1, ctx));
+            }
+         }
       }
       CHKERR(Num_free_Sprimme(X0, ctx));
    }
    primme->stats.numOrthoInnerProds += nQ*nX;
 
-   /* Reduction on y */
+   /* Reduction on y and xx. QtBQ is factorized in the meantime */
 
-   CHKERR(globalSum_SHprimme(y, nQ*nX, ctx));
+   primme_reduction r;
+   CHKERR(globalSumStart_SHprimme(
+         y, (nQ + (pythagoras ? 1 : 0)) * nX, &r, ctx));
+   HSCALAR *fQtBQ = NULL;
+   int *pQtBQ = NULL;
+   if (QtBQ) {
+      CHKERRSUM(Num_malloc_SHprimme(nQ * nQ, &fQtBQ, ctx), &r, 1);
+      CHKERRSUM(Num_malloc_iprimme(nQ, &pQtBQ, ctx), &r, 1);
+      CHKERRSUM(UDUDecompose_SHprimme(
+                      QtBQ, ldQtBQ, fQtBQ, nQ, pQtBQ, nQ, ctx),
+            &r, 1);
+   }
+   CHKERR(globalSumWait_Tprimme(&r, ctx));
+
+   /* X is updated below as X - Q*y, so with Q'Q = QtBQ,                   */
+   /* norms(i) = sqrt(xx(i) - 2*y(:,i)'*y(:,i) + y(:,i)'*QtBQ*y(:,i)), and */
+   /* for orthonormal Q (no QtBQ) norms(i) = sqrt(xx(i) - y(:,i)'*y(:,i)). */
+   /* If the result is small compared to xx(i), too many digits are lost,  */
+   /* and the norms are computed after updating X as usual.                */
+
+   if (pythagoras) {
+      double eps_orth;
+      CHKERR(machineEpsOrth_Sprimme(&eps_orth, ctx));
+      for (j = 0; j < nX; j++) {
+         HSCALAR *yj = &y[nQ * j];
+         HREAL r2 = REAL_PART(xx[j]), yy = 0.0;
+         int k;
+         for (i = 0; i < nQ; i++) {
+            yy += REAL_PART(CONJ(yj[i]) * yj[i]);
+            if (!QtBQ) continue;
+            r2 += REAL_PART(QtBQ[ldQtBQ * i + i]) *
+                  REAL_PART(CONJ(yj[i]) * yj[i]);
+            for (k = 0; k < i; k++) {
+               r2 += 2.0 *
+                     REAL_PART(CONJ(yj[k]) * QtBQ[ldQtBQ * i + k] * yj[i]);
+            }
+         }
+         r2 -= (QtBQ ? 2.0 : 1.0) * yy;
+         if (!(r2 >= sqrt(eps_orth) * REAL_PART(xx[j]))) break;
+         norms[j] = sqrt(r2);
+      }
+      if (j < nX) pythagoras = 0;
+      else primme->stats.numOrthoInnerProds += nX;
+   }
    
    /* z = QtBQ\y */
 
    HSCALAR *z = NULL;
    if (QtBQ) {
-      HSCALAR *fQtBQ;
-      int *pQtBQ;
       CHKERR(Num_malloc_SHprimme(nQ * nX, &z, ctx));
-      CHKERR(Num_malloc_SHprimme(nQ * nQ, &fQtBQ, ctx));
-      CHKERR(Num_malloc_iprimme(nQ, &pQtBQ, ctx));
-      CHKERR(UDUDecompose_SHprimme(QtBQ, ldQtBQ, fQtBQ, nQ, pQtBQ, nQ, ctx));
       CHKERR(UDUSolve_SHprimme(fQtBQ, pQtBQ, nQ, y, nX, nQ, z, nQ, ctx));
       CHKERR(Num_free_SHprimme(fQtBQ, ctx));
       CHKERR(Num_free_iprimme(pQtBQ, ctx));
@@ -890,14 +984,14 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, int nQ, PRIMME_INT ldQ,
 
    if (QtBQ) CHKERR(Num_free_SHprimme(z, ctx));
 
-   /* X = X - BQ*(QtBQ\y); norms(i) = norm(X(i)) */
+   /* X = X - BQ*y; norms(i) = norm(X(i)) */
 
    SCALAR *X0 = NULL;
    int m=min(M, mQ);
    if (inX) {
       CHKERR(Num_malloc_Sprimme(m*nX, &X0, ctx));
    }
-   if (norms) for (i=0; i<nX; i++) norms[i] = 0.0;
+   if (norms && !pythagoras) for (i=0; i<nX; i++) norms[i] = 0.0;
    for (i=0; i < mQ; i+=m, m=min(m,mQ-i)) {
       if (inX) {
          CHKERR(Num_copy_matrix_columns_Sprimme(
@@ -909,7 +1003,7 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, int nQ, PRIMME_INT ldQ,
          CHKERR(Num_copy_matrix_columns_Sprimme(
                X0, m, NULL, nX, m, &X[i], inX, ldX, ctx));
       }
-      if (norms) {
+      if (norms && !pythagoras) {
          for (j = 0; j < nX; j++) {
             SCALAR *x = inX ? &X0[j * m] : &X[j * ldX + i];
             norms[j] += REAL_PART(Num_dot_Sprimme(m, x, 1, x, 1, ctx));
@@ -917,7 +1011,7 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, int nQ, PRIMME_INT ldQ,
       }
    }
 
-   if (norms) {
+   if (norms && !pythagoras) {
       /* Store the reduction of norms */
       CHKERR(globalSum_RHprimme(norms, nX, ctx));
  
@@ -929,6 +1023,7 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, int nQ, PRIMME_INT ldQ,
    CHKERR(Num_free_Sprimme(X0, ctx));
 
    primme->stats.timeOrtho += primme_wTimer() - t0;
+   Trace_span("ortho", t0, ctx.trace);
 
    return 0;
 }
@@ -991,9 +1086,12 @@ STATIC int Num_ortho_kernel(SCALAR *Q, PRIMME_INT M, int nQ, PRIMME_INT ldQ,
       m = M;
    }
 
+   /* Reduce B only if it is requested */
+
+   int reduce = (ctx.numProcs > 1 && W && B);
    HSCALAR *Bo;
    int ldBo;
-   if (ctx.numProcs == 1) {
+   if (!reduce) {
       Bo = B;
       ldBo = ldB;
    } else {
@@ -1013,6 +1111,18 @@ STATIC int Num_ortho_kernel(SCALAR *Q, PRIMME_INT M, int nQ, PRIMME_INT ldQ,
    }
 
    for (i=0; i < M; i+=m, m=min(m,M-i)) {
+      /* Start reading the next rows of Q, V and W if they are on files */
+      if (i % PRIMME_PREFETCH_ROWS == 0 && i + m < M) {
+         PRIMME_INT mn = min(PRIMME_PREFETCH_ROWS, M - i - m);
+         if (nQ > 0) {
+            CHKERR(Num_prefetch_matrix_Sprimme(&Q[i + m], mn, nQ, ldQ, ctx));
+         }
+         CHKERR(Num_prefetch_matrix_Sprimme(&V[i + m], mn, b2, ldV, ctx));
+         if (W) {
+            CHKERR(Num_prefetch_matrix_Sprimme(&W[i + m], mn, nX, ldW, ctx));
+         }
+      }
+
       if (D && Y) {
          /* X = X - Q*A(0:nQ,:) */
          if (nQ > 0) {
@@ -1060,12 +1170,11 @@ STATIC int Num_ortho_kernel(SCALAR *Q, PRIMME_INT M, int nQ, PRIMME_INT ldQ,
    }
 
    /* B = globalSum(Bo) */
-   if (ctx.numProcs > 1) {
+   if (reduce) {
       CHKERR(globalSum_SHprimme(Bo, (nQ + b2) * nX, ctx));
       CHKERR(Num_copy_matrix_SHprimme(Bo, nQ+b2, nX, nQ+b2, B, ldB, ctx));
+      CHKERR(Num_free_SHprimme(Bo, ctx));
    }
-
-   if (ctx.numProcs > 1) CHKERR(Num_free_SHprimme(Bo, ctx));
    if (D && Y && Yortho) CHKERR(Num_free_Sprimme(Xo, ctx));
 
    return 0;
@@ -1200,9 +1309,14 @@ TEMPLATE_PLEASE
 int update_cholesky_Sprimme(HSCALAR *VtV, int ldVtV, HSCALAR *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx) {
 
+   /* With primme_orth_lowsync all processes compute the factor, and they */
+   /* check that all got the same one as in Bortho_block_gen               */
+
+   int replicate = ctx.primme && ctx.primme->orth == primme_orth_lowsync;
+
    HSCALAR *A;
    CHKERR(Num_malloc_SHprimme(n * (n - n0), &A, ctx));
-   if (ctx.procID == 0) {
+   if (ctx.procID == 0 || replicate) {
       CHKERR(Num_copy_matrix_SHprimme(&VtV[ldVtV * n0], n,
             n - n0, ldVtV, A, n, ctx));
       CHKERR(Num_trsm_SHprimme("L", "U", "C", "N", n0, n - n0, 1.0, fVtV,
@@ -1211,7 +1325,12 @@ int update_cholesky_Sprimme(HSCALAR *VtV, int ldVtV, HSCALAR *fVtV, int ldfVtV,
             1.0, &A[n0], n, ctx));
       CHKERR(Num_potrf_SHprimme("U", n - n0, &A[n0], n, NULL, ctx));
    }
-   CHKERR(broadcast_SHprimme(A, n * (n - n0), ctx));
+   int same = 0;
+   if (replicate) {
+      CHKERR(replicated_check_Sprimme(
+            hash_buffer(5381, A, sizeof(HSCALAR) * n * (n - n0)), &same, ctx));
+   }
+   if (!same) CHKERR(broadcast_SHprimme(A, n * (n - n0), ctx));
    CHKERR(Num_copy_matrix_SHprimme(
          A, n, n - n0, n, &fVtV[ldfVtV * n0], ldfVtV, ctx));
    CHKERR(Num_free_SHprimme(A, ctx));
@@ -1219,4 +1338,48 @@ int update_cholesky_Sprimme(HSCALAR *VtV, int ldVtV, HSCALAR *fVtV, int ldfVtV,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine replicated_check - Check whether all processes computed the same
+ *    factors with primme_orth_lowsync, as solve_H_check does for the
+ *    projected problem. Every byte b of the hash of the factors is reduced
+ *    as b and b^2 in a single globalSum; all processes have the same byte
+ *    iff numProcs * sum(b^2) == sum(b)^2, which is exact in double.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * hash          The hash of the factors on this process
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * same          1 if all processes have the same hash, 0 otherwise
+ *
+ ******************************************************************************/
+
+STATIC int replicated_check_Sprimme(uint32_t hash, int *same,
+      primme_context ctx) {
+
+   int i;
+
+   *same = 1;
+   if (ctx.numProcs <= 1) return 0;
+
+   double s[8];
+   for (i = 0; i < 4; i++) {
+      s[2 * i] = (double)((hash >> (8 * i)) & 0xFFu);
+      s[2 * i + 1] = s[2 * i] * s[2 * i];
+   }
+   CHKERR(globalSum_Tprimme(s, primme_op_double, 8, ctx));
+   for (i = 0; i < 4; i++) {
+      if (ctx.numProcs * s[2 * i + 1] != s[2 * i] * s[2 * i]) *same = 0;
+   }
+
+   if (!*same) {
+      ctx.primme->stats.numReplicatedMismatches++;
+      PRINTF(2, "Processes computed different orthogonalization factors; "
+                "broadcasting the ones of process 0");
+   }
+
+   return 0;
+}
+
 #endif /* SUPPORTED_TYPE */
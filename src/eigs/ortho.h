@@ -725,6 +725,11 @@ int rank_estimationdprimme(dummy_type_dprimme *V, int n0, int n1, int n, int ldV
 #endif
 int update_cholesky_dprimme(dummy_type_dprimme *VtV, int ldVtV, dummy_type_dprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(replicated_check_Sprimme)
+#  define replicated_check_Sprimme CONCAT(replicated_check_Sprimme,SCALAR_SUF)
+#endif
+int replicated_check_Sprimmedprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR,
       int b1, int b2, dummy_type_hprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -769,6 +774,8 @@ int decompositionhprimme(dummy_type_sprimme *H, int n, int ldH, dummy_type_sprim
 int rank_estimationhprimme(dummy_type_sprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_hprimme(dummy_type_sprimme *VtV, int ldVtV, dummy_type_sprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmehprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR,
       int b1, int b2, dummy_type_kprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -813,6 +820,8 @@ int decompositionkprimme(dummy_type_cprimme *H, int n, int ldH, dummy_type_cprim
 int rank_estimationkprimme(dummy_type_cprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_kprimme(dummy_type_cprimme *VtV, int ldVtV, dummy_type_cprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmekprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR,
       int b1, int b2, dummy_type_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -857,6 +866,8 @@ int decompositionsprimme(dummy_type_sprimme *H, int n, int ldH, dummy_type_sprim
 int rank_estimationsprimme(dummy_type_sprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_sprimme(dummy_type_sprimme *VtV, int ldVtV, dummy_type_sprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmesprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR,
       int b1, int b2, dummy_type_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -901,6 +912,8 @@ int decompositioncprimme(dummy_type_cprimme *H, int n, int ldH, dummy_type_cprim
 int rank_estimationcprimme(dummy_type_cprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_cprimme(dummy_type_cprimme *VtV, int ldVtV, dummy_type_cprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmecprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *R, int ldR,
       int b1, int b2, dummy_type_zprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_zprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -945,6 +958,100 @@ int decompositionzprimme(dummy_type_zprimme *H, int n, int ldH, dummy_type_zprim
 int rank_estimationzprimme(dummy_type_zprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_zprimme(dummy_type_zprimme *VtV, int ldVtV, dummy_type_zprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmezprimme(uint32_t hash, int *same,
+      primme_context ctx);
+int Bortho_gen_dh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dprimme *R, int ldR,
+      int b1, int b2, dummy_type_dh_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
+      dummy_type_dprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_dh_sprimme *, PRIMME_INT, dummy_type_dh_sprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int ortho_dh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dprimme *R, int ldR, int b1, int b2,
+                  dummy_type_dh_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
+                  PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int local_matvecdh_sprimme(dummy_type_dprimme *x, PRIMME_INT ldx, dummy_type_dprimme *y, PRIMME_INT ldy,
+      int bs, void *Bctx_);
+int Bortho_local_dh_sprimme(dummy_type_dprimme *V, int ldV, dummy_type_dprimme *R,
+      int ldR, int b1, int b2, dummy_type_dprimme *locked, int ldLocked,
+      int numLocked, PRIMME_INT nLocal, dummy_type_dprimme *B, int ldB, PRIMME_INT *iseed,
+      primme_context ctx);
+int B_matvecdh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT ldx, dummy_type_dh_sprimme *y, PRIMME_INT ldy,
+      int bs, void *ctx_);
+int Bortho_block_dh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dprimme *VLtBVL,
+      int ldVLtBVL, dummy_type_dprimme *fVLtBVL, int ldfVLtBVL, dummy_type_dprimme *R, PRIMME_INT ldR,
+      int b1, int b2, dummy_type_dh_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
+      dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *RLocked, int ldRLocked,
+      PRIMME_INT nLocal, int maxRank, int *b2_out, primme_context ctx);
+int ortho_block_dh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dprimme *VLtBVL,
+      int ldVLtBVL, dummy_type_dprimme *fVLtBVL, int ldfVLtBVL, dummy_type_dprimme *R, PRIMME_INT ldR,
+      int b1, int b2, dummy_type_dh_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
+      dummy_type_dprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
+      int *b2_out, primme_context ctx);
+int Bortho_block_gen_Sprimmedh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dprimme *VLtBVL,
+      int ldVLtBVL, dummy_type_dprimme *fVLtBVL, int ldfVLtBVL, dummy_type_dprimme *R, PRIMME_INT ldR,
+      int b1, int b2, dummy_type_dh_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
+      int (*B)(dummy_type_dh_sprimme *, PRIMME_INT, dummy_type_dh_sprimme *, PRIMME_INT, int, void *),
+      void *Bctx, dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *RLocked, int ldRLocked,
+      PRIMME_INT nLocal, int maxRank, int *b2_out, primme_context ctx);
+int ortho_single_iteration_dh_sprimme(dummy_type_dh_sprimme *Q, int nQ, PRIMME_INT ldQ,
+      dummy_type_dh_sprimme *BQ, PRIMME_INT ldBQ, dummy_type_dprimme *QtBQ, int ldQtBQ, dummy_type_dh_sprimme *X,
+      int *inX, int nX, PRIMME_INT ldX, dummy_type_dprimme *norms, primme_context ctx);
+int Num_ortho_kerneldh_sprimme(dummy_type_dh_sprimme *Q, PRIMME_INT M, int nQ, PRIMME_INT ldQ,
+      dummy_type_dh_sprimme *V, int b1, int b2, PRIMME_INT ldV, dummy_type_dprimme *A, int ldA, dummy_type_dprimme *D,
+      dummy_type_dprimme *Y, int ldY, int Yortho, dummy_type_dh_sprimme *W, PRIMME_INT ldW, dummy_type_dprimme *B,
+      int ldB, primme_context ctx);
+int decompositiondh_sprimme(dummy_type_dprimme *H, int n, int ldH, dummy_type_dprimme *Y, int ldY,
+      dummy_type_dprimme *evals, int *Yortho, primme_context ctx);
+int rank_estimationdh_sprimme(dummy_type_dprimme *V, int n0, int n1, int n, int ldV);
+int update_cholesky_dh_sprimme(dummy_type_dprimme *VtV, int ldVtV, dummy_type_dprimme *fVtV, int ldfVtV,
+      int n0, int n, primme_context ctx);
+int replicated_check_Sprimmedh_sprimme(uint32_t hash, int *same,
+      primme_context ctx);
+int Bortho_gen_dh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_zprimme *R, int ldR,
+      int b1, int b2, dummy_type_dh_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
+      dummy_type_zprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_dh_cprimme *, PRIMME_INT, dummy_type_dh_cprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int ortho_dh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_zprimme *R, int ldR, int b1, int b2,
+                  dummy_type_dh_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
+                  PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int local_matvecdh_cprimme(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_zprimme *y, PRIMME_INT ldy,
+      int bs, void *Bctx_);
+int Bortho_local_dh_cprimme(dummy_type_zprimme *V, int ldV, dummy_type_zprimme *R,
+      int ldR, int b1, int b2, dummy_type_zprimme *locked, int ldLocked,
+      int numLocked, PRIMME_INT nLocal, dummy_type_zprimme *B, int ldB, PRIMME_INT *iseed,
+      primme_context ctx);
+int B_matvecdh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT ldx, dummy_type_dh_cprimme *y, PRIMME_INT ldy,
+      int bs, void *ctx_);
+int Bortho_block_dh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_zprimme *VLtBVL,
+      int ldVLtBVL, dummy_type_zprimme *fVLtBVL, int ldfVLtBVL, dummy_type_zprimme *R, PRIMME_INT ldR,
+      int b1, int b2, dummy_type_dh_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
+      dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *RLocked, int ldRLocked,
+      PRIMME_INT nLocal, int maxRank, int *b2_out, primme_context ctx);
+int ortho_block_dh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_zprimme *VLtBVL,
+      int ldVLtBVL, dummy_type_zprimme *fVLtBVL, int ldfVLtBVL, dummy_type_zprimme *R, PRIMME_INT ldR,
+      int b1, int b2, dummy_type_dh_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
+      dummy_type_zprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
+      int *b2_out, primme_context ctx);
+int Bortho_block_gen_Sprimmedh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_zprimme *VLtBVL,
+      int ldVLtBVL, dummy_type_zprimme *fVLtBVL, int ldfVLtBVL, dummy_type_zprimme *R, PRIMME_INT ldR,
+      int b1, int b2, dummy_type_dh_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
+      int (*B)(dummy_type_dh_cprimme *, PRIMME_INT, dummy_type_dh_cprimme *, PRIMME_INT, int, void *),
+      void *Bctx, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *RLocked, int ldRLocked,
+      PRIMME_INT nLocal, int maxRank, int *b2_out, primme_context ctx);
+int ortho_single_iteration_dh_cprimme(dummy_type_dh_cprimme *Q, int nQ, PRIMME_INT ldQ,
+      dummy_type_dh_cprimme *BQ, PRIMME_INT ldBQ, dummy_type_zprimme *QtBQ, int ldQtBQ, dummy_type_dh_cprimme *X,
+      int *inX, int nX, PRIMME_INT ldX, dummy_type_dprimme *norms, primme_context ctx);
+int Num_ortho_kerneldh_cprimme(dummy_type_dh_cprimme *Q, PRIMME_INT M, int nQ, PRIMME_INT ldQ,
+      dummy_type_dh_cprimme *V, int b1, int b2, PRIMME_INT ldV, dummy_type_zprimme *A, int ldA, dummy_type_dprimme *D,
+      dummy_type_zprimme *Y, int ldY, int Yortho, dummy_type_dh_cprimme *W, PRIMME_INT ldW, dummy_type_zprimme *B,
+      int ldB, primme_context ctx);
+int decompositiondh_cprimme(dummy_type_zprimme *H, int n, int ldH, dummy_type_zprimme *Y, int ldY,
+      dummy_type_dprimme *evals, int *Yortho, primme_context ctx);
+int rank_estimationdh_cprimme(dummy_type_zprimme *V, int n0, int n1, int n, int ldV);
+int update_cholesky_dh_cprimme(dummy_type_zprimme *VtV, int ldVtV, dummy_type_zprimme *fVtV, int ldfVtV,
+      int n0, int n, primme_context ctx);
+int replicated_check_Sprimmedh_cprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_hprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -983,6 +1090,8 @@ int decompositionmagma_hprimme(dummy_type_sprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_hprimme(dummy_type_sprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_hprimme(dummy_type_sprimme *VtV, int ldVtV, dummy_type_sprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmemagma_hprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_kprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -1021,6 +1130,8 @@ int decompositionmagma_kprimme(dummy_type_cprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_kprimme(dummy_type_cprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_kprimme(dummy_type_cprimme *VtV, int ldVtV, dummy_type_cprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmemagma_kprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -1059,6 +1170,8 @@ int decompositionmagma_sprimme(dummy_type_sprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_sprimme(dummy_type_sprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_sprimme(dummy_type_sprimme *VtV, int ldVtV, dummy_type_sprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmemagma_sprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -1097,6 +1210,8 @@ int decompositionmagma_cprimme(dummy_type_cprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_cprimme(dummy_type_cprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_cprimme(dummy_type_cprimme *VtV, int ldVtV, dummy_type_cprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmemagma_cprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_dprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_dprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -1135,6 +1250,8 @@ int decompositionmagma_dprimme(dummy_type_dprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_dprimme(dummy_type_dprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_dprimme(dummy_type_dprimme *VtV, int ldVtV, dummy_type_dprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmemagma_dprimme(uint32_t hash, int *same,
+      primme_context ctx);
 int Bortho_gen_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_zprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_zprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -1173,4 +1290,6 @@ int decompositionmagma_zprimme(dummy_type_zprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_zprimme(dummy_type_zprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_zprimme(dummy_type_zprimme *VtV, int ldVtV, dummy_type_zprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int replicated_check_Sprimmemagma_zprimme(uint32_t hash, int *same,
+      primme_context ctx);
 #endif
@@ -62,6 +62,9 @@
 #include "template_normal.h"
 #include "common_eigs.h"
 #include "primme_interface.h"
+#ifdef PRIMME_WITH_OPENMP
+#include <omp.h>
+#endif
 /* Keep automatically generated headers under this section  */
 #ifndef CHECK_TEMPLATE
 #include "primme_c.h"
@@ -100,13 +103,212 @@
  *
  ******************************************************************************/
 
+/* The USE_DHOST types are only called by Xprimme_aux_Sprimme of the double */
+/* precision types when storagePrecision is primme_op_float                 */
+
+#ifndef USE_DHOST
 int Xprimme(XEVAL *evals, XSCALAR *evecs, XREAL *resNorms,
             primme_params *primme) {
 
    return Xprimme_aux_Sprimme((void *)evals, (void *)evecs, (void *)resNorms, primme,
-         PRIMME_OP_SCALAR);
+         PRIMME_OP_SCALAR, NULL, NULL);
+}
+#endif /* USE_DHOST */
+
+/*******************************************************************************
+ * Subroutine Xprimme_ws - Like Xprimme, but the memory is taken from the
+ *    workspace ws, created by primme_workspace_create, and kept there for the
+ *    next call. If the workspace was created with warmStart, the basis of the
+ *    previous call is used as initial guesses after the ones in evecs.
+ *
+ *    A workspace cannot be used by several calls at the same time.
+ *
+ ******************************************************************************/
+
+#if defined(USE_HOST) && !defined(USE_DHOST)
+#  define Xprimme_ws CONCAT(Xprimme,_ws)
+
+int Xprimme_ws(XEVAL *evals, XSCALAR *evecs, XREAL *resNorms,
+      primme_params *primme, primme_workspace *ws) {
+
+   return Xprimme_aux_Sprimme((void *)evals, (void *)evecs, (void *)resNorms,
+         primme, PRIMME_OP_SCALAR, ws, NULL);
+}
+
+#  undef Xprimme_ws
+#endif
+
+/*******************************************************************************
+ * Subroutine Xprimme_batch - Solve numProblems independent problems, calling
+ *    Xprimme on evals[i], evecs[i], resNorms[i] and primme[i]. If PRIMME is
+ *    built with OpenMP, the problems are distributed dynamically among
+ *    numThreads threads (all available threads if numThreads <= 0);
+ *    otherwise they are solved one after another.
+ *
+ *    Every solve has its own context and memory frames, so the callbacks of
+ *    each primme[i] are called only from the thread solving that problem.
+ *    Nested OpenMP regions, including the ones in PRIMME kernels and in an
+ *    OpenMP BLAS, run on a single thread unless nested parallelism is
+ *    enabled. A BLAS with its own threads (pthreads OpenBLAS, TBB MKL) is
+ *    not limited here; the caller should link a sequential BLAS or set its
+ *    number of threads to one, as the documentation says.
+ *
+ * OUTPUT
+ * ------
+ * ierrs   If not NULL, the error code returned by each solve
+ *
+ * Return Value
+ * ------------
+ *  0 if all solves succeed; otherwise the error code of the first failing
+ *  problem in the order of primme
+ * -4 - numProblems < 0 or some of the arrays is NULL
+ *
+ ******************************************************************************/
+
+#if defined(USE_HOST) && !defined(USE_DHOST)
+#  define Xprimme_batch CONCAT(Xprimme,_batch)
+
+int Xprimme_batch(XEVAL **evals, XSCALAR **evecs, XREAL **resNorms,
+      primme_params **primme, int numProblems, int numThreads, int *ierrs) {
+
+   int i;
+   int ret = 0;       /* error code of the first failing problem */
+   int iret = -1;     /* index of that problem */
+
+   if (numProblems < 0 || (numProblems > 0 &&
+         (evals == NULL || evecs == NULL || resNorms == NULL ||
+               primme == NULL))) {
+      return -4;
+   }
+
+#ifdef PRIMME_WITH_OPENMP
+   if (numThreads <= 0) numThreads = omp_get_max_threads();
+#pragma omp parallel for schedule(dynamic, 1) num_threads(numThreads)
+#else
+   (void)numThreads;
+#endif
+   for (i = 0; i < numProblems; i++) {
+      int ierr = Xprimme_aux_Sprimme((void *)evals[i], (void *)evecs[i],
+            (void *)resNorms[i], primme[i], PRIMME_OP_SCALAR, NULL, NULL);
+      if (ierrs) ierrs[i] = ierr;
+      if (ierr != 0) {
+#ifdef PRIMME_WITH_OPENMP
+#pragma omp critical(primme_batch)
+#endif
+         if (iret < 0 || i < iret) {
+            ret = ierr;
+            iret = i;
+         }
+      }
+   }
+
+   return ret;
 }
 
+#  undef Xprimme_batch
+#endif
+
+/*******************************************************************************
+ * Subroutine Xprimme_slice - Find all eigenpairs with eigenvalues in
+ *    [lower, upper] by spectrum slicing. The interval is divided into
+ *    numSlices slices, and the eigenvalues in every slice are found by an
+ *    independent solve with target primme_closest_abs and a shift at the
+ *    center of the slice. The slices are solved concurrently as in
+ *    Xprimme_batch. See slice_spectrum.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * lower, upper   The interval
+ * primme         The parameters used in every slice. numEvals is the size of
+ *                evals, resNorms and the number of columns of evecs
+ * numSlices      Number of slices at the beginning
+ * numThreads     Number of threads as in Xprimme_batch
+ *
+ * OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------
+ * evals          The eigenvalues in ascending order
+ * evecs          The eigenvectors, orthonormal (B-orthonormal with
+ *                massMatrixMatvec)
+ * resNorms       The residual norms
+ * primme.initSize  The number of eigenpairs returned
+ *
+ * Return Value
+ * ------------
+ *  0 - Success
+ * -3 - The interval has more than numEvals eigenvalues
+ * -4 - Invalid input
+ *  The error code of the first failing slice solve otherwise
+ *
+ ******************************************************************************/
+
+#if defined(USE_HOST) && defined(USE_HERMITIAN) &&                            \
+      (defined(USE_FLOAT) || defined(USE_FLOATCOMPLEX) ||                      \
+            defined(USE_DOUBLE) || defined(USE_DOUBLECOMPLEX))
+#  define Xprimme_slice CONCAT(Xprimme,_slice)
+
+int Xprimme_slice(XEVAL *evals, XSCALAR *evecs, XREAL *resNorms,
+      double lower, double upper, primme_params *primme, int numSlices,
+      int numThreads) {
+
+#ifdef SUPPORTED_TYPE
+   int i;
+
+   if (evals == NULL || evecs == NULL || resNorms == NULL || primme == NULL ||
+         numSlices < 1 || !(lower <= upper) || primme->numEvals < 1 ||
+         primme->n < 1) {
+      return -4;
+   }
+
+   double t0 = primme_wTimer();
+   if (!primme->monitorFun) {
+      primme->monitorFun = default_monitor;
+      primme->monitorFun_type = PRIMME_OP_SCALAR;
+   }
+   primme_context ctx = primme_get_context(primme);
+
+   /* Find the eigenpairs with evals and resNorms in double precision */
+
+   int ret;
+   double *devals = NULL, *dresNorms = NULL;
+   CHKERRVAL(MALLOC_PRIMME(primme->numEvals, &devals), &ret);
+   if (ret == 0) CHKERRVAL(MALLOC_PRIMME(primme->numEvals, &dresNorms), &ret);
+   if (ret == 0) {
+      CHKERRVAL(slice_spectrum(devals, (SCALAR *)evecs, dresNorms, lower,
+                      upper, numSlices, numThreads, ctx),
+            &ret);
+   }
+   if (ret == 0 || ret == PRIMME_MAIN_ITER_FAILURE) {
+      for (i = 0; i < primme->initSize; i++) {
+         evals[i] = (XEVAL)devals[i];
+         resNorms[i] = (XREAL)dresNorms[i];
+      }
+   } else {
+      primme->initSize = 0;
+   }
+   if (devals) free(devals);
+   if (dresNorms) free(dresNorms);
+
+   primme_free_context(ctx);
+   primme->stats.elapsedTime = primme_wTimer() - t0;
+
+   return ret;
+#else
+   (void)evals;
+   (void)evecs;
+   (void)resNorms;
+   (void)lower;
+   (void)upper;
+   (void)numSlices;
+   (void)numThreads;
+
+   primme->initSize = 0;
+   return PRIMME_FUNCTION_UNAVAILABLE;
+#endif /* SUPPORTED_TYPE */
+}
+
+#  undef Xprimme_slice
+#endif
+
 // Definition for *hsprimme, *ksprimme, and *kcprimme
 
 #if defined(USE_HALF) || defined(USE_HALFCOMPLEX) ||                      \
@@ -124,7 +326,7 @@ int Xsprimme(KIND(float, PRIMME_COMPLEX_FLOAT) * evals, XSCALAR *evecs,
       float *resNorms, primme_params *primme) {
 
    return Xprimme_aux_Sprimme((void *)evals, (void *)evecs, (void *)resNorms, primme,
-         primme_op_float);
+         primme_op_float, NULL, NULL);
 }
 
 #  undef Xsprimme
@@ -149,6 +351,12 @@ int Xsprimme(KIND(float, PRIMME_COMPLEX_FLOAT) * evals, XSCALAR *evecs,
  *
  * evals_resNorms_type The type of the arrays evals and resNorsm.
  *
+ * ws     workspace to reuse, or NULL
+ *
+ * trace  trace of the caller where to add the spans of this call, or NULL.
+ *        If NULL and primme->traceFile is set, the spans are written into
+ *        that file at the end.
+ *
  * Return Value
  * ------------
  * return  error code
@@ -156,14 +364,34 @@ int Xsprimme(KIND(float, PRIMME_COMPLEX_FLOAT) * evals, XSCALAR *evecs,
 
 TEMPLATE_PLEASE
 int Xprimme_aux_Sprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type) {
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace) {
 
 #ifdef SUPPORTED_TYPE
 
+   double t0 = primme_wTimer();
+
    /* Generate context */
 
    primme_context ctx = primme_get_context(primme);
 
+   /* Record the spans of the call. If the trace cannot be created, the */
+   /* solver goes on without it                                         */
+
+   if (trace) {
+      ctx.trace = trace;
+   } else if (primme->traceFile) {
+      Trace_create(&ctx.trace);
+   }
+
+   /* Take the memory from the workspace, if given */
+
+   if (ws) {
+      Mem_arena_destroy(&ctx);
+      ctx.arena = &ws->arena;
+      ctx.ws = ws;
+   }
+
    /* Set the current type as the default type for user's operators */
 
    if (primme->matrixMatvec && primme->matrixMatvec_type == primme_op_default)
@@ -185,39 +413,42 @@ int Xprimme_aux_Sprimme(void *evals, void *evecs, void *resNorms,
 
    int outInitSize = 0;
 
-   /* call primme for the internal working precision */
+   /* call primme for the internal working precision. With primme_op_auto, */
+   /* find the pairs first in single precision and refine them in the      */
+   /* precision of the call.                                               */
 
    int ret;
    primme_op_datatype t = primme->internalPrecision;
-   if (t == primme_op_default) t = PRIMME_OP_SCALAR;
-   switch (t) {
-#  ifdef SUPPORTED_HALF_TYPE
-   case primme_op_half:
-      CHKERRVAL(wrapper_Shprimme(evals, evecs, resNorms, evals_resNorms_type,
-                      PRIMME_OP_SCALAR, &outInitSize, ctx),
-            &ret);
-      break;
-#  endif
-#  ifndef PRIMME_WITHOUT_FLOAT
-   case primme_op_float:
-      CHKERRVAL(wrapper_Ssprimme(evals, evecs, resNorms, evals_resNorms_type,
-                      PRIMME_OP_SCALAR, &outInitSize, ctx),
-            &ret);
-      break;
-#  endif
-   case primme_op_double:
-      CHKERRVAL(wrapper_Sdprimme(evals, evecs, resNorms, evals_resNorms_type,
-                      PRIMME_OP_SCALAR, &outInitSize, ctx),
+   primme_op_datatype ts = t;
+   if (t == primme_op_default || t == primme_op_auto) t = ts = PRIMME_OP_SCALAR;
+#ifndef PRIMME_WITHOUT_FLOAT
+   if (primme->internalPrecision == primme_op_auto) {
+      ts = min(t, primme_op_float);
+   }
+#endif
+   if (ts < t && primme->convTestFun == NULL) {
+      CHKERRVAL(staged_precision_solve(t, ts, evals, evecs, resNorms,
+                      evals_resNorms_type, &outInitSize, ctx),
             &ret);
-      break;
-#  ifdef PRIMME_WITH_NATIVE_QUAD
-   case primme_op_quad:
-      CHKERRVAL(wrapper_Sqprimme(evals, evecs, resNorms, evals_resNorms_type,
-                      PRIMME_OP_SCALAR, &outInitSize, ctx),
+   } else {
+      CHKERRVAL(wrapper_astype(t, evals, evecs, resNorms, evals_resNorms_type,
+                      &outInitSize, ctx),
             &ret);
-      break;
-#  endif
-   default: ret = PRIMME_FUNCTION_UNAVAILABLE;
+   }
+
+   /* Write the trace if it is not the caller's */
+
+   if (ctx.trace && ctx.trace != trace) {
+      Trace_span("primme", t0, ctx.trace);
+      if (Trace_write(primme->traceFile, ctx.numProcs, ctx.procID,
+                ctx.trace) != 0) {
+         PRINTF(1, "Warning: could not write the trace '%s'",
+               primme->traceFile);
+      } else if (ctx.trace->dropped > 0) {
+         PRINTF(1, "Warning: %d spans were not kept in the trace '%s'",
+               ctx.trace->dropped, primme->traceFile);
+      }
+      Trace_destroy(ctx.trace);
    }
 
    /* Free context */
@@ -235,6 +466,8 @@ int Xprimme_aux_Sprimme(void *evals, void *evecs, void *resNorms,
    (void)evecs;
    (void)resNorms;
    (void)evals_resNorms_type;
+   (void)ws;
+   (void)trace;
 
    primme->initSize = 0;
    return PRIMME_FUNCTION_UNAVAILABLE;
@@ -371,6 +604,31 @@ int wrapper_Sprimme(void *evals, void *evecs, void *resNorms,
    CHKERR(coordinated_exit(check_params_coherence(ctx), ctx));
    CHKERR(check_input(evals, evecs, resNorms, primme))
        
+   /* Reserve the arena for temporaries. The budget covers a few blocks of */
+   /* vectors (residuals, inner solver and orthogonalization work), the    */
+   /* chunks of rows used when updating the basis, and the small matrices  */
+   /* of the projected problem. A workspace also keeps the basis (V, W, Q  */
+   /* and BV) and the copy of evecs. Larger requests go to malloc, and a   */
+   /* workspace grows for the next call if that happens.                   */
+
+   if (ctx.arena) {
+      size_t n = (size_t)primme->nLocal, m = (size_t)primme->maxBasisSize,
+             b = (size_t)primme->maxBlockSize;
+      size_t vecs = IMPL(
+            sizeof(SCALAR) * (n * b * 8 + min(n, PRIMME_BLOCK_SIZE) * m * 3),
+            0);
+      if (ctx.ws) {
+         vecs += IMPL(sizeof(SCALAR) *
+                            ((size_t)primme->ldOPs * m *
+                                        (primme->massMatrixMatvec ? 4 : 3) +
+                                  n * (size_t)(primme->numOrthoConst +
+                                                 primme->numEvals)),
+               0);
+      }
+      CHKERR(Mem_arena_reserve(
+            vecs + sizeof(HSCALAR) * m * m * 8 + 65536, ctx));
+   }
+
    /* Cast evals, evecs and resNorms to working precision */
 
    HEVAL *evals0;
@@ -397,6 +655,13 @@ int wrapper_Sprimme(void *evals, void *evecs, void *resNorms,
                                  resNorms0, t0, &ret, &numRet, ctx),
          ctx));
 
+   /* Report the use of the memory arena */
+
+   if (ctx.arena) {
+      PRINTF(3, "Memory arena: %zu requests served from %zu bytes",
+            ctx.arena->served, ctx.arena->size);
+   }
+
    /* Copy back evals, evecs and resNorms */
 
    CHKERR(KIND(Num_matrix_astype_RHprimme, Num_matrix_astype_SHprimme)(evals0,
@@ -421,6 +686,254 @@ int wrapper_Sprimme(void *evals, void *evecs, void *resNorms,
 }
 
 
+/*******************************************************************************
+ * Subroutine wrapper_astype - call wrapper_Sprimme with working precision t.
+ *    If storagePrecision is single and t is double, call the version that
+ *    stores the basis in single precision and works in double precision
+ *    (see USE_DHOST in template.h).
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * t      The working precision
+ *
+ * Rest of the arguments as in wrapper_Sprimme
+ *
+ * Return Value
+ * ------------
+ * return  error code
+ ******************************************************************************/
+
+#if defined(USE_HOST) && !defined(PRIMME_WITHOUT_FLOAT)
+#  define wrapper_Sdhprimme                                                    \
+      CONCAT(wrapper_, CONCAT(CONCAT(CONCAT(dh_, USE_ARITH(s, c)), primme),    \
+                             KIND_C))
+#endif
+
+STATIC int wrapper_astype(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx) {
+
+   primme_op_datatype ts = ctx.primme->storagePrecision;
+   if (ts != primme_op_default && ts < t) {
+#if defined(USE_HOST) && !defined(PRIMME_WITHOUT_FLOAT)
+      if (ts == primme_op_float && t == primme_op_double) {
+         return wrapper_Sdhprimme(evals, evecs, resNorms, evals_resNorms_type,
+               PRIMME_OP_SCALAR, outInitSize, ctx);
+      }
+#endif
+      return PRIMME_FUNCTION_UNAVAILABLE;
+   }
+
+   switch (t) {
+#  ifdef SUPPORTED_HALF_TYPE
+   case primme_op_half:
+      return wrapper_Shprimme(evals, evecs, resNorms, evals_resNorms_type,
+            PRIMME_OP_SCALAR, outInitSize, ctx);
+#  endif
+#  ifndef PRIMME_WITHOUT_FLOAT
+   case primme_op_float:
+      return wrapper_Ssprimme(evals, evecs, resNorms, evals_resNorms_type,
+            PRIMME_OP_SCALAR, outInitSize, ctx);
+#  endif
+   case primme_op_double:
+      return wrapper_Sdprimme(evals, evecs, resNorms, evals_resNorms_type,
+            PRIMME_OP_SCALAR, outInitSize, ctx);
+#  ifdef PRIMME_WITH_NATIVE_QUAD
+   case primme_op_quad:
+      return wrapper_Sqprimme(evals, evecs, resNorms, evals_resNorms_type,
+            PRIMME_OP_SCALAR, outInitSize, ctx);
+#  endif
+   default: return PRIMME_FUNCTION_UNAVAILABLE;
+   }
+}
+
+#undef wrapper_Sdhprimme
+
+/*******************************************************************************
+ * Subroutine staged_precision_solve - find the eigenpairs in the precision ts,
+ *    and refine them in the working precision t if eps asks for more than ts
+ *    resolves. It is used when internalPrecision is primme_op_auto, with ts
+ *    being single precision.
+ *
+ *    The first run is a whole solve in ts that stops when the pairs converge
+ *    or when their residual norms stall (see check_stall); the vectors are
+ *    cast to the types of the callbacks. The refinement is a second solve in
+ *    t that starts from the returned vectors. The statistics are the sum of
+ *    both runs.
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * t      The working precision
+ *
+ * ts     The precision of the first run
+ *
+ * Rest of the arguments as in wrapper_Sprimme
+ *
+ * Return Value
+ * ------------
+ * return  error code
+ ******************************************************************************/
+
+STATIC int staged_precision_solve(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   /* Set the default eps as wrapper_Sprimme does for the working precision */
+
+   double eps_t, eps_ts;
+   CHKERR(Num_machine_epsilon_Sprimme(t, &eps_t));
+   CHKERR(Num_machine_epsilon_Sprimme(ts, &eps_ts));
+   double eps = primme->eps;
+   if (eps == 0.0) {
+      eps = eps_t * 1e4;
+      if (eps >= 1.0) eps = 0.1;
+   }
+
+   /* Find the pairs in the precision ts until they converge or their    */
+   /* residual norms do not decrease anymore. The tolerance cannot be      */
+   /* smaller than the machine epsilon of ts; stalling stops the run then  */
+
+   primme_params primme0 = *primme;
+   primme->eps = max(eps, eps_ts);
+   int stalled = 0;
+   primme_context ctx0 = ctx;
+   ctx0.stalled = &stalled;
+
+   /* The checkpoints of the first run go to another file, because they do */
+   /* not match the refinement's                                           */
+
+   char *checkpointFile = NULL;
+   if (primme->checkpointFile) {
+      size_t len = strlen(primme->checkpointFile) + 8;
+      checkpointFile = (char *)malloc(len);
+      if (!checkpointFile) return PRIMME_MALLOC_FAILURE;
+      snprintf(checkpointFile, len, "%s.first", primme->checkpointFile);
+      primme->checkpointFile = checkpointFile;
+   }
+   int ret = wrapper_astype(
+         ts, evals, evecs, resNorms, evals_resNorms_type, outInitSize, ctx0);
+   primme->checkpointFile = primme0.checkpointFile;
+   if (checkpointFile) free(checkpointFile);
+
+   /* Return if the first run failed other than by stalling, or if it     */
+   /* converged to eps, which the default convergence test in ts accepts  */
+   /* if eps is at least twice its machine epsilon                        */
+
+   primme->eps = eps;
+   if ((ret != 0 && !(stalled && ret == PRIMME_MAIN_ITER_FAILURE)) ||
+         (ret == 0 && eps >= eps_ts * 2)) {
+      return ret;
+   }
+
+   primme_stats stats0 = primme->stats;
+
+   /* Refine the pairs in the working precision with the input parameters, */
+   /* the found vectors as initial guesses and the remaining budget.       */
+   /* Without locking, a stalled run returns all numEvals vectors          */
+
+   *primme = primme0;
+   primme->eps = eps;
+   primme->initSize = *outInitSize;
+   if (stalled && !primme->locking) primme->initSize = primme->numEvals;
+   primme->maxMatvecs -= stats0.numMatvecs;
+
+   /* The refinement starts with few vectors, and its estimation of |A| may */
+   /* be much smaller than the first run's. Keep the later so that eps is   */
+   /* relative to the same norm in both runs                                */
+
+   if (primme->aNorm <= 0.0 && !primme->massMatrixMatvec &&
+         stats0.estimateLargestSVal > 0.0) {
+      primme->aNorm = stats0.estimateLargestSVal;
+   }
+   if (primme->maxOuterIterations > 0) {
+      primme->maxOuterIterations =
+            max(1, primme->maxOuterIterations - stats0.numOuterIterations);
+   }
+   ret = wrapper_astype(
+         t, evals, evecs, resNorms, evals_resNorms_type, outInitSize, ctx);
+
+   /* Restore the limits and add up the statistics of both runs */
+
+   primme->maxMatvecs = primme0.maxMatvecs;
+   primme->maxOuterIterations = primme0.maxOuterIterations;
+   primme->aNorm = primme0.aNorm;
+
+   add_stats(&primme->stats, &stats0);
+
+   return ret;
+}
+
+/*******************************************************************************
+ * Subroutine clear_stats - Set the statistics as before any solve, so that
+ *    add_stats accumulates on them.
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * stats   The statistics
+ *
+ ******************************************************************************/
+
+STATIC void clear_stats(primme_stats *stats) {
+
+   memset(stats, 0, sizeof(primme_stats));
+   stats->estimateMinEVal = HUGE_VAL;
+   stats->estimateMaxEVal = -HUGE_VAL;
+   stats->estimateLargestSVal = -HUGE_VAL;
+   stats->estimateBNorm = -HUGE_VAL;
+   stats->estimateInvBNorm = -HUGE_VAL;
+}
+
+/*******************************************************************************
+ * Subroutine add_stats - Add the statistics of a solve to the ones of other
+ *    solves of the same problem, as the stages of staged_precision_solve or
+ *    the slices of slice_spectrum. The counters, volumes and times are added
+ *    up, and the estimations and the bounds keep the extreme values. The
+ *    caller sets elapsedTime if the solves ran concurrently.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * stats   The statistics to update
+ * from    The statistics of the solve
+ *
+ ******************************************************************************/
+
+STATIC void add_stats(primme_stats *stats, primme_stats *from) {
+
+   stats->numOuterIterations += from->numOuterIterations;
+   stats->numRestarts += from->numRestarts;
+   stats->numMatvecs += from->numMatvecs;
+   stats->numPreconds += from->numPreconds;
+   stats->numGlobalSum += from->numGlobalSum;
+   stats->numBroadcast += from->numBroadcast;
+   stats->volumeGlobalSum += from->volumeGlobalSum;
+   stats->volumeBroadcast += from->volumeBroadcast;
+   stats->flopsDense += from->flopsDense;
+   stats->numOrthoInnerProds += from->numOrthoInnerProds;
+   stats->elapsedTime += from->elapsedTime;
+   stats->timeMatvec += from->timeMatvec;
+   stats->timePrecond += from->timePrecond;
+   stats->timeOrtho += from->timeOrtho;
+   stats->timeGlobalSum += from->timeGlobalSum;
+   stats->timeBroadcast += from->timeBroadcast;
+   stats->timeDense += from->timeDense;
+   stats->estimateMinEVal = min(stats->estimateMinEVal, from->estimateMinEVal);
+   stats->estimateMaxEVal = max(stats->estimateMaxEVal, from->estimateMaxEVal);
+   stats->estimateLargestSVal =
+         max(stats->estimateLargestSVal, from->estimateLargestSVal);
+   stats->estimateBNorm = max(stats->estimateBNorm, from->estimateBNorm);
+   stats->estimateInvBNorm =
+         max(stats->estimateInvBNorm, from->estimateInvBNorm);
+   stats->maxConvTol = max(stats->maxConvTol, from->maxConvTol);
+   stats->estimateResidualError =
+         max(stats->estimateResidualError, from->estimateResidualError);
+   stats->lockingIssue += from->lockingIssue;
+   stats->numGlobalSumRequested += from->numGlobalSumRequested;
+   stats->numReplicatedMismatches += from->numReplicatedMismatches;
+}
+
 /******************************************************************************
  * Subroutine check_input - checks the value of the input arrays, evals,
  *    evecs, and resNorms and the values of primme_params.
@@ -768,6 +1281,8 @@ STATIC int check_params_coherence(primme_context ctx) {
    PARALLEL_CHECK(primme->orth);
    PARALLEL_CHECK(primme->initBasisMode);
    PARALLEL_CHECK(primme->projectionParams.projection);
+   PARALLEL_CHECK(primme->projectionParams.partialSolve);
+   PARALLEL_CHECK(primme->projectionParams.replicatedSolve);
    PARALLEL_CHECK(primme->restartingParams.maxPrevRetain);
    PARALLEL_CHECK(primme->correctionParams.precondition);
    PARALLEL_CHECK(primme->correctionParams.robustShifts);
@@ -780,6 +1295,7 @@ STATIC int check_params_coherence(primme_context ctx) {
    PARALLEL_CHECK(primme->correctionParams.projectors.SkewX);
    PARALLEL_CHECK(primme->correctionParams.convTest);
    PARALLEL_CHECK(primme->correctionParams.relTolBase);
+   PARALLEL_CHECK(primme->correctionParams.chebyshevDegree);
 
    return 0;
 }
@@ -811,4 +1327,499 @@ STATIC int coordinated_exit(int ret, primme_context ctx) {
    return ret;
 }
 
+/*******************************************************************************
+ * Subroutine slice_spectrum - Find all eigenpairs with eigenvalues in
+ *    [lower, upper] by solving independent problems on slices of the interval.
+ *
+ *    The Algorithm
+ *    -------------
+ *    The interval is divided into numSlices slices of the same width. Every
+ *    slice [lo, hi] looks for m = ceil(numEvals/numSlices) eigenvalues with
+ *    target primme_closest_abs and the shift at the center of the slice c.
+ *    There are always m eigenvalues closest to c, so the solve converges
+ *    even if the slice is at the end of the spectrum. The slices are solved
+ *    concurrently on numThreads threads, and one after another if there are
+ *    several processes, because the reductions of all slices would use the
+ *    same communicator. Every slice keeps its own profile table, which is
+ *    merged into primme->profileTable after the solve, and the slices do
+ *    not print if they run concurrently.
+ *
+ *    Let d be the largest distance from c to an eigenvalue found. The slice
+ *    is complete if d > (hi-lo)/2, because then the eigenvalues found
+ *    include all in the slice. Otherwise, the slice had more than m
+ *    eigenvalues, and the parts [lo, c-d] and [c+d, hi] are solved in the
+ *    next round. Each part is divided again into slices expected to have
+ *    about 3/4*m eigenvalues each, estimating the density of eigenvalues
+ *    from the count in [c-d, c+d]. If d is zero, the slice is solved again
+ *    looking for twice as many eigenvalues. The rounds go on until all
+ *    slices are complete.
+ *
+ *    An eigenvalue near the end of a slice may be found by two slices, and a
+ *    multiple eigenvalue may be split between two slices. So every slice
+ *    keeps the pairs whose eigenvalues are in the slice within the residual
+ *    norm, and slice_merge removes the duplicates and orthogonalizes the
+ *    eigenvectors from different slices with close eigenvalues.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * lower, upper   The interval
+ * numSlices      Number of slices in the first round
+ * numThreads     Number of threads, or all available if <= 0
+ *
+ * OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------
+ * evals          The eigenvalues in ascending order
+ * evecs          The eigenvectors, with leading dimension primme->ldevecs
+ * resNorms       The residual norms
+ * primme.initSize  The number of eigenpairs returned
+ *
+ * Return Value
+ * ------------
+ * PRIMME_MAIN_ITER_FAILURE if the interval has more than numEvals eigenvalues;
+ * the pairs returned then are the ones found so far.
+ *
+ ******************************************************************************/
+
+STATIC int slice_spectrum(double *evals, SCALAR *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int i, j;
+
+   /* Set some defaults for sequential programs */
+
+   if (primme->numProcs <= 1) {
+      primme->nLocal = primme->n;
+      primme->procID = 0;
+   }
+   PRIMME_INT nLocal = primme->nLocal;
+   PRIMME_INT ldevecs = primme->ldevecs > 0 ? primme->ldevecs : nLocal;
+   int maxEvals = primme->numEvals;
+   int m = (int)min(primme->n, (maxEvals + numSlices - 1) / numSlices);
+#ifdef PRIMME_WITH_OPENMP
+   if (primme->numProcs > 1) numThreads = 1;
+   if (numThreads <= 0) numThreads = omp_get_max_threads();
+#else
+   numThreads = 1;
+#endif
+
+   primme->initSize = 0;
+   clear_stats(&primme->stats);
+
+   /* The slices of the first round */
+
+   int nSlices = numSlices;
+   double *lo, *hi;       /* Slices [lo[i], hi[i]) */
+   int *nev;              /* Number of eigenvalues sought in every slice */
+   CHKERR(Num_malloc_dprimme(nSlices, &lo, ctx));
+   CHKERR(Num_malloc_dprimme(nSlices, &hi, ctx));
+   CHKERR(Num_malloc_iprimme(nSlices, &nev, ctx));
+   for (i = 0; i < nSlices; i++) {
+      lo[i] = lower + (upper - lower) * i / nSlices;
+      hi[i] = i < nSlices - 1 ? lower + (upper - lower) * (i + 1) / nSlices
+                              : upper;
+      nev[i] = m;
+   }
+
+   /* The pairs found, and the slice solve that found them */
+
+   int nFound = 0, maxFound = 0;
+   double *fevals = NULL, *fresNorms = NULL;
+   int *fsolve = NULL;
+   SCALAR *fV = NULL;
+   int numSolves = 0;
+
+   while (nSlices > 0) {
+
+      /* Allocate the output of the slices */
+
+      int *offset, *ierrs, *nconv;
+      CHKERR(Num_malloc_iprimme(nSlices + 1, &offset, ctx));
+      CHKERR(Num_malloc_iprimme(nSlices, &ierrs, ctx));
+      CHKERR(Num_malloc_iprimme(nSlices, &nconv, ctx));
+      offset[0] = 0;
+      for (i = 0; i < nSlices; i++) offset[i + 1] = offset[i] + nev[i];
+      double *sevals, *sresNorms;
+      SCALAR *sV;
+      CHKERR(Num_malloc_dprimme(offset[nSlices], &sevals, ctx));
+      CHKERR(Num_malloc_dprimme(offset[nSlices], &sresNorms, ctx));
+      CHKERR(Num_malloc_Sprimme(nLocal * offset[nSlices], &sV, ctx));
+
+      /* Solve the slices */
+
+#ifdef PRIMME_WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(numThreads)
+#endif
+      for (i = 0; i < nSlices; i++) {
+         primme_params p = *primme;
+         p.numEvals = nev[i];
+         p.target = primme_closest_abs;
+         p.numTargetShifts = 1;
+         double shift = (lo[i] + hi[i]) / 2;
+         p.targetShifts = &shift;
+         p.initSize = 0;
+         p.numOrthoConst = 0;
+         p.ldevecs = nLocal;
+         p.checkpointFile = NULL;
+         p.traceFile = NULL;
+         p.tuningFile = NULL;
+         p.profileTable = NULL;
+         if (numThreads > 1) p.printLevel = 0;
+         ierrs[i] = Xprimme_aux_Sprimme(&sevals[offset[i]],
+               &sV[nLocal * offset[i]], &sresNorms[offset[i]], &p,
+               primme_op_double, NULL, NULL);
+         nconv[i] = p.initSize;
+#ifdef PRIMME_WITH_OPENMP
+#pragma omp critical(primme_slice)
+#endif
+         {
+            add_stats(&primme->stats, &p.stats);
+            if (p.profileTable && primme->profileTable) {
+               if (Profile_merge(primme->profileTable, p.profileTable) != 0) {
+                  ierrs[i] = PRIMME_MALLOC_FAILURE;
+               }
+            }
+            Profile_destroy(p.profileTable);
+         }
+      }
+      for (i = 0; i < nSlices; i++) {
+         CHKERRM(ierrs[i], ierrs[i], "Error %d solving the slice [%g, %g)",
+               ierrs[i], lo[i], hi[i]);
+      }
+
+      /* Make room for the pairs of this round */
+
+      if (nFound + offset[nSlices] > maxFound) {
+         int maxFound0 = max(2 * maxFound, nFound + offset[nSlices]);
+         double *fevals0, *fresNorms0;
+         int *fsolve0;
+         SCALAR *fV0;
+         CHKERR(Num_malloc_dprimme(maxFound0, &fevals0, ctx));
+         CHKERR(Num_malloc_dprimme(maxFound0, &fresNorms0, ctx));
+         CHKERR(Num_malloc_iprimme(maxFound0, &fsolve0, ctx));
+         CHKERR(Num_malloc_Sprimme(nLocal * maxFound0, &fV0, ctx));
+         for (i = 0; i < nFound; i++) {
+            fevals0[i] = fevals[i];
+            fresNorms0[i] = fresNorms[i];
+            fsolve0[i] = fsolve[i];
+         }
+         CHKERR(Num_copy_matrix_Sprimme(
+               fV, nLocal, nFound, nLocal, fV0, nLocal, ctx));
+         CHKERR(Num_free_dprimme(fevals, ctx));
+         CHKERR(Num_free_dprimme(fresNorms, ctx));
+         CHKERR(Num_free_iprimme(fsolve, ctx));
+         CHKERR(Num_free_Sprimme(fV, ctx));
+         fevals = fevals0;
+         fresNorms = fresNorms0;
+         fsolve = fsolve0;
+         fV = fV0;
+         maxFound = maxFound0;
+      }
+
+      /* Keep the pairs in every slice, and find the incomplete slices. */
+      /* The first pass counts the new slices and the second one keeps  */
+      /* the pairs and sets the new slices                              */
+
+      int nNewSlices = 0;
+      double *newlo = NULL, *newhi = NULL;
+      int *newnev = NULL;
+      for (j = 0; j < 2; j++) {
+         for (i = 0; i < nSlices; i++) {
+            double c = (lo[i] + hi[i]) / 2, d = 0.0;
+            int k, count = 0;
+            for (k = offset[i]; k < offset[i] + nconv[i]; k++) {
+               double ev = sevals[k], r = sresNorms[k];
+               d = max(d, fabs(ev - c));
+               if (ev < lo[i] - r || ev > hi[i] + r) continue;
+               count++;
+               if (j == 1) {
+                  fevals[nFound] = ev;
+                  fresNorms[nFound] = r;
+                  fsolve[nFound] = numSolves + i;
+                  CHKERR(Num_copy_matrix_Sprimme(&sV[nLocal * k], nLocal, 1,
+                        nLocal, &fV[nLocal * nFound], nLocal, ctx));
+                  nFound++;
+               }
+            }
+            int complete = (d > (hi[i] - lo[i]) / 2 || nconv[i] >= primme->n);
+
+            /* Split the parts of an incomplete slice out of [c-d, c+d] by */
+            /* the density of eigenvalues found in it                      */
+
+            int pieces[2] = {0, 0}, side;
+            double plo[2] = {lo[i], c + d}, phi[2] = {c - d, hi[i]};
+            if (!complete && d <= 0.0) {
+               pieces[0] = 1;
+            } else if (!complete) {
+               for (side = 0; side < 2; side++) {
+                  double expected = count * (phi[side] - plo[side]) / (2 * d);
+                  pieces[side] = (int)max(1.0,
+                        min((double)numSlices, ceil(expected / (0.75 * m))));
+               }
+            }
+            if (j == 0) {
+               nNewSlices += pieces[0] + pieces[1];
+               continue;
+            }
+            if (complete) {
+               PRINTF(2, "Slice [%g, %g]: %d pairs", lo[i], hi[i], count);
+            } else if (d <= 0.0) {
+               PRINTF(2, "Slice [%g, %g]: %d pairs, solve again for %d",
+                     lo[i], hi[i], count, (int)min(primme->n, 2 * nev[i]));
+            } else {
+               PRINTF(2, "Slice [%g, %g]: %d pairs, split [%g, %g] in %d "
+                         "and [%g, %g] in %d",
+                     lo[i], hi[i], count, plo[0], phi[0], pieces[0], plo[1],
+                     phi[1], pieces[1]);
+            }
+            for (side = 0; side < 2; side++) {
+               for (k = 0; k < pieces[side]; k++) {
+                  /* If no progress, look for more eigenvalues in the slice */
+                  if (d <= 0.0) {
+                     newlo[nNewSlices] = lo[i];
+                     newhi[nNewSlices] = hi[i];
+                     newnev[nNewSlices] = (int)min(primme->n, 2 * nev[i]);
+                  } else {
+                     double w = phi[side] - plo[side];
+                     newlo[nNewSlices] = plo[side] + w * k / pieces[side];
+                     newhi[nNewSlices] = k < pieces[side] - 1
+                           ? plo[side] + w * (k + 1) / pieces[side]
+                           : phi[side];
+                     newnev[nNewSlices] = m;
+                  }
+                  nNewSlices++;
+               }
+            }
+         }
+         if (j == 0) {
+            CHKERR(Num_malloc_dprimme(nNewSlices, &newlo, ctx));
+            CHKERR(Num_malloc_dprimme(nNewSlices, &newhi, ctx));
+            CHKERR(Num_malloc_iprimme(nNewSlices, &newnev, ctx));
+            nNewSlices = 0;
+         }
+      }
+      CHKERR(Num_free_dprimme(lo, ctx));
+      CHKERR(Num_free_dprimme(hi, ctx));
+      CHKERR(Num_free_iprimme(nev, ctx));
+      lo = newlo;
+      hi = newhi;
+      nev = newnev;
+
+      numSolves += nSlices;
+      nSlices = nNewSlices;
+      CHKERR(Num_free_iprimme(offset, ctx));
+      CHKERR(Num_free_iprimme(ierrs, ctx));
+      CHKERR(Num_free_iprimme(nconv, ctx));
+      CHKERR(Num_free_dprimme(sevals, ctx));
+      CHKERR(Num_free_dprimme(sresNorms, ctx));
+      CHKERR(Num_free_Sprimme(sV, ctx));
+
+      /* Remove the duplicates, and stop if there are too many pairs */
+
+      CHKERR(slice_merge(fevals, fresNorms, fsolve, fV, nLocal, &nFound, ctx));
+      if (nFound > maxEvals) break;
+   }
+
+   /* Return the pairs */
+
+   int nRet = min(nFound, maxEvals);
+   for (i = 0; i < nRet; i++) {
+      evals[i] = fevals[i];
+      resNorms[i] = fresNorms[i];
+   }
+   CHKERR(Num_copy_matrix_Sprimme(fV, nLocal, nRet, nLocal, evecs, ldevecs,
+         ctx));
+   primme->initSize = nRet;
+
+   CHKERR(Num_free_dprimme(lo, ctx));
+   CHKERR(Num_free_dprimme(hi, ctx));
+   CHKERR(Num_free_iprimme(nev, ctx));
+   CHKERR(Num_free_dprimme(fevals, ctx));
+   CHKERR(Num_free_dprimme(fresNorms, ctx));
+   CHKERR(Num_free_iprimme(fsolve, ctx));
+   CHKERR(Num_free_Sprimme(fV, ctx));
+
+   CHKERRM(nFound > maxEvals, PRIMME_MAIN_ITER_FAILURE,
+         "There are more than numEvals=%d eigenvalues in [%g, %g]", maxEvals,
+         lower, upper);
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine slice_merge - Sort the pairs found by slice_spectrum, remove the
+ *    duplicates and orthogonalize the eigenvectors found by different slices
+ *    with close eigenvalues.
+ *
+ *    The pairs are grouped into clusters of consecutive eigenvalues whose
+ *    distance is at most the sum of their residual norms. In a cluster with
+ *    pairs from several slice solves, the eigenvectors are orthogonalized
+ *    twice with classical Gram-Schmidt in ascending order of residual norm.
+ *    With massMatrixMatvec, the inner products and the norms are the ones
+ *    induced by B, and B*V is computed for the vectors in those clusters.
+ *    An eigenvector whose norm drops below 1/2 is mostly in the span of the
+ *    previous ones, and it is removed as a duplicate. The residual norms of
+ *    the others are updated with a bound for the residual of the linear
+ *    combination.
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * evals     The eigenvalues
+ * resNorms  The residual norms
+ * solve     The index of the solve that found every pair
+ * V         The eigenvectors, with leading dimension ldV
+ * n         The number of pairs
+ *
+ ******************************************************************************/
+
+STATIC int slice_merge(double *evals, double *resNorms, int *solve, SCALAR *V,
+      PRIMME_INT ldV, int *n, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+   int i, j, k, l;
+
+   if (*n <= 1) return 0;
+
+   /* Sort the pairs by the eigenvalue */
+
+   int *perm, *drop;
+   CHKERR(Num_malloc_iprimme(*n, &perm, ctx));
+   CHKERR(Num_malloc_iprimme(*n, &drop, ctx));
+   for (i = 0; i < *n; i++) {
+      for (j = i; j > 0 && evals[perm[j - 1]] > evals[i]; j--) {
+         perm[j] = perm[j - 1];
+      }
+      perm[j] = i;
+      drop[i] = 0;
+   }
+
+   /* B*V(:,c) is stored in BV(:,c), or BV is V without massMatrixMatvec */
+
+   SCALAR *BV = V;
+   PRIMME_INT ldBV = ldV;
+   if (primme->massMatrixMatvec) {
+      if (primme->massMatrixMatvec_type == primme_op_default)
+         primme->massMatrixMatvec_type = PRIMME_OP_SCALAR;
+      CHKERR(Num_malloc_Sprimme(nLocal * *n, &BV, ctx));
+      ldBV = nLocal;
+   }
+
+   /* Process the clusters [i, j) */
+
+   HSCALAR *dots;
+   int *order;
+   CHKERR(Num_malloc_SHprimme(*n, &dots, ctx));
+   CHKERR(Num_malloc_iprimme(*n, &order, ctx));
+   for (i = 0; i < *n; i = j) {
+      int severalSolves = 0;
+      for (j = i + 1; j < *n; j++) {
+         double a = evals[perm[j - 1]], b = evals[perm[j]];
+         if (b - a > resNorms[perm[j - 1]] + resNorms[perm[j]] +
+                           MACHINE_EPSILON * max(fabs(a), fabs(b))) {
+            break;
+         }
+         if (solve[perm[j]] != solve[perm[i]]) severalSolves = 1;
+      }
+      if (!severalSolves) continue;
+
+      /* Order the pairs in the cluster by the residual norm */
+
+      int nc = j - i, nk = 0;
+      for (k = 0; k < nc; k++) {
+         int c = perm[i + k];
+         for (l = k; l > 0 && resNorms[order[l - 1]] > resNorms[c]; l--) {
+            order[l] = order[l - 1];
+         }
+         order[l] = c;
+      }
+      if (BV != V) {
+         for (k = 0; k < nc; k++) {
+            CHKERR(massMatrixMatvec_Sprimme(&V[ldV * order[k]], nLocal, ldV,
+                  &BV[ldBV * order[k]], ldBV, 0, 1, ctx));
+         }
+      }
+
+      /* Orthogonalize every vector against the previous kept ones. The */
+      /* kept ones are moved to the beginning of order                  */
+
+      for (k = 0; k < nc; k++) {
+         int c = order[k], pass;
+         double bound = resNorms[c];
+         for (pass = 0; pass < 2 && nk > 0; pass++) {
+            for (l = 0; l < nk; l++) {
+               dots[l] = Num_dot_Sprimme(nLocal, &V[ldV * order[l]], 1,
+                     &BV[ldBV * c], 1, ctx);
+            }
+            CHKERR(globalSum_SHprimme(dots, nk, ctx));
+            for (l = 0; l < nk; l++) {
+               CHKERR(Num_axpy_Sprimme(nLocal, -dots[l], &V[ldV * order[l]],
+                     1, &V[ldV * c], 1, ctx));
+               if (BV != V) {
+                  CHKERR(Num_axpy_Sprimme(nLocal, -dots[l],
+                        &BV[ldBV * order[l]], 1, &BV[ldBV * c], 1, ctx));
+               }
+               bound += ABS(dots[l]) * (resNorms[order[l]] +
+                                        fabs(evals[order[l]] - evals[c]));
+            }
+         }
+         HREAL nrm2 = REAL_PART(Num_dot_Sprimme(
+               nLocal, &V[ldV * c], 1, &BV[ldBV * c], 1, ctx));
+         CHKERR(globalSum_RHprimme(&nrm2, 1, ctx));
+         double nrm = sqrt(nrm2);
+         if (nrm < 0.5) {
+            drop[c] = 1;
+            PRINTF(3, "Removed the duplicate of the eigenvalue %g", evals[c]);
+         } else {
+            CHKERR(Num_scal_Sprimme(nLocal, 1.0 / nrm, &V[ldV * c], 1, ctx));
+            if (BV != V) {
+               CHKERR(Num_scal_Sprimme(
+                     nLocal, 1.0 / nrm, &BV[ldBV * c], 1, ctx));
+            }
+            resNorms[c] = bound / nrm;
+            order[nk++] = c;
+         }
+      }
+   }
+
+   /* Compact the pairs in sorted order */
+
+   SCALAR *V0;
+   double *evals0, *resNorms0;
+   int *solve0;
+   CHKERR(Num_malloc_Sprimme(nLocal * *n, &V0, ctx));
+   CHKERR(Num_malloc_dprimme(*n, &evals0, ctx));
+   CHKERR(Num_malloc_dprimme(*n, &resNorms0, ctx));
+   CHKERR(Num_malloc_iprimme(*n, &solve0, ctx));
+   for (i = k = 0; i < *n; i++) {
+      if (drop[perm[i]]) continue;
+      CHKERR(Num_copy_matrix_Sprimme(&V[ldV * perm[i]], nLocal, 1, ldV,
+            &V0[nLocal * k], nLocal, ctx));
+      evals0[k] = evals[perm[i]];
+      resNorms0[k] = resNorms[perm[i]];
+      solve0[k] = solve[perm[i]];
+      k++;
+   }
+   CHKERR(Num_copy_matrix_Sprimme(V0, nLocal, k, nLocal, V, ldV, ctx));
+   for (i = 0; i < k; i++) {
+      evals[i] = evals0[i];
+      resNorms[i] = resNorms0[i];
+      solve[i] = solve0[i];
+   }
+   *n = k;
+
+   CHKERR(Num_free_iprimme(perm, ctx));
+   CHKERR(Num_free_iprimme(drop, ctx));
+   CHKERR(Num_free_SHprimme(dots, ctx));
+   CHKERR(Num_free_iprimme(order, ctx));
+   if (BV != V) CHKERR(Num_free_Sprimme(BV, ctx));
+   CHKERR(Num_free_Sprimme(V0, ctx));
+   CHKERR(Num_free_dprimme(evals0, ctx));
+   CHKERR(Num_free_dprimme(resNorms0, ctx));
+   CHKERR(Num_free_iprimme(solve0, ctx));
+
+   return 0;
+}
+
 #endif /* SUPPORTED_TYPE */
@@ -124,7 +124,8 @@
 #  define Xprimme_aux_RHqprimme CONCAT(Xprimme_aux_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
 #endif
 int Xprimme_aux_dprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 #if !defined(CHECK_TEMPLATE) && !defined(wrapper_Sprimme)
 #  define wrapper_Sprimme CONCAT(wrapper_,WITH_KIND(SCALAR_SUF))
 #endif
@@ -218,6 +219,27 @@ int Xprimme_aux_dprimme(void *evals, void *evecs, void *resNorms,
 int wrapper_dprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_astype)
+#  define wrapper_astype CONCAT(wrapper_astype,WITH_KIND(SCALAR_SUF))
+#endif
+int wrapper_astypedprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(staged_precision_solve)
+#  define staged_precision_solve CONCAT(staged_precision_solve,WITH_KIND(SCALAR_SUF))
+#endif
+int staged_precision_solvedprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(clear_stats)
+#  define clear_stats CONCAT(clear_stats,WITH_KIND(SCALAR_SUF))
+#endif
+void clear_statsdprimme(primme_stats *stats);
+#if !defined(CHECK_TEMPLATE) && !defined(add_stats)
+#  define add_stats CONCAT(add_stats,WITH_KIND(SCALAR_SUF))
+#endif
+void add_statsdprimme(primme_stats *stats, primme_stats *from);
 #if !defined(CHECK_TEMPLATE) && !defined(check_input)
 #  define check_input CONCAT(check_input,WITH_KIND(SCALAR_SUF))
 #endif
@@ -244,11 +266,32 @@ int check_params_coherencedprimme(primme_context ctx);
 #  define coordinated_exit CONCAT(coordinated_exit,WITH_KIND(SCALAR_SUF))
 #endif
 int coordinated_exitdprimme(int ret, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(slice_spectrum)
+#  define slice_spectrum CONCAT(slice_spectrum,WITH_KIND(SCALAR_SUF))
+#endif
+int slice_spectrumdprimme(double *evals, dummy_type_dprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(slice_merge)
+#  define slice_merge CONCAT(slice_merge,WITH_KIND(SCALAR_SUF))
+#endif
+int slice_mergedprimme(double *evals, double *resNorms, int *solve, dummy_type_dprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_hprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_hprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypehprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvehprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statshprimme(primme_stats *stats);
+void add_statshprimme(primme_stats *stats, primme_stats *from);
 int check_inputhprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutehprimme(double *eval, void *evec, double *rNorm,
@@ -260,11 +303,26 @@ void default_monitorhprimme(void *basisEvals_, int *basisSize, int *basisFlags,
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencehprimme(primme_context ctx);
 int coordinated_exithprimme(int ret, primme_context ctx);
+int slice_spectrumhprimme(double *evals, dummy_type_hprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergehprimme(double *evals, double *resNorms, int *solve, dummy_type_hprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_kprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_kprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypekprimme_normal(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvekprimme_normal(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statskprimme_normal(primme_stats *stats);
+void add_statskprimme_normal(primme_stats *stats, primme_stats *from);
 int check_inputkprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutekprimme_normal(double *eval, void *evec, double *rNorm,
@@ -276,11 +334,26 @@ void default_monitorkprimme_normal(void *basisEvals_, int *basisSize, int *basis
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencekprimme_normal(primme_context ctx);
 int coordinated_exitkprimme_normal(int ret, primme_context ctx);
+int slice_spectrumkprimme_normal(double *evals, dummy_type_kprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergekprimme_normal(double *evals, double *resNorms, int *solve, dummy_type_kprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_kprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_kprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypekprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvekprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statskprimme(primme_stats *stats);
+void add_statskprimme(primme_stats *stats, primme_stats *from);
 int check_inputkprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutekprimme(double *eval, void *evec, double *rNorm,
@@ -292,11 +365,26 @@ void default_monitorkprimme(void *basisEvals_, int *basisSize, int *basisFlags,
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencekprimme(primme_context ctx);
 int coordinated_exitkprimme(int ret, primme_context ctx);
+int slice_spectrumkprimme(double *evals, dummy_type_kprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergekprimme(double *evals, double *resNorms, int *solve, dummy_type_kprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_sprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_sprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypesprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvesprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statssprimme(primme_stats *stats);
+void add_statssprimme(primme_stats *stats, primme_stats *from);
 int check_inputsprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutesprimme(double *eval, void *evec, double *rNorm,
@@ -308,11 +396,26 @@ void default_monitorsprimme(void *basisEvals_, int *basisSize, int *basisFlags,
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencesprimme(primme_context ctx);
 int coordinated_exitsprimme(int ret, primme_context ctx);
+int slice_spectrumsprimme(double *evals, dummy_type_sprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergesprimme(double *evals, double *resNorms, int *solve, dummy_type_sprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_cprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_cprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypecprimme_normal(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvecprimme_normal(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statscprimme_normal(primme_stats *stats);
+void add_statscprimme_normal(primme_stats *stats, primme_stats *from);
 int check_inputcprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutecprimme_normal(double *eval, void *evec, double *rNorm,
@@ -324,11 +427,26 @@ void default_monitorcprimme_normal(void *basisEvals_, int *basisSize, int *basis
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencecprimme_normal(primme_context ctx);
 int coordinated_exitcprimme_normal(int ret, primme_context ctx);
+int slice_spectrumcprimme_normal(double *evals, dummy_type_cprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergecprimme_normal(double *evals, double *resNorms, int *solve, dummy_type_cprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_cprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_cprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypecprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvecprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statscprimme(primme_stats *stats);
+void add_statscprimme(primme_stats *stats, primme_stats *from);
 int check_inputcprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutecprimme(double *eval, void *evec, double *rNorm,
@@ -340,11 +458,26 @@ void default_monitorcprimme(void *basisEvals_, int *basisSize, int *basisFlags,
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencecprimme(primme_context ctx);
 int coordinated_exitcprimme(int ret, primme_context ctx);
+int slice_spectrumcprimme(double *evals, dummy_type_cprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergecprimme(double *evals, double *resNorms, int *solve, dummy_type_cprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_zprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_zprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypezprimme_normal(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvezprimme_normal(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statszprimme_normal(primme_stats *stats);
+void add_statszprimme_normal(primme_stats *stats, primme_stats *from);
 int check_inputzprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutezprimme_normal(double *eval, void *evec, double *rNorm,
@@ -356,11 +489,26 @@ void default_monitorzprimme_normal(void *basisEvals_, int *basisSize, int *basis
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencezprimme_normal(primme_context ctx);
 int coordinated_exitzprimme_normal(int ret, primme_context ctx);
+int slice_spectrumzprimme_normal(double *evals, dummy_type_zprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergezprimme_normal(double *evals, double *resNorms, int *solve, dummy_type_zprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_zprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_zprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypezprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvezprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statszprimme(primme_stats *stats);
+void add_statszprimme(primme_stats *stats, primme_stats *from);
 int check_inputzprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutezprimme(double *eval, void *evec, double *rNorm,
@@ -372,11 +520,119 @@ void default_monitorzprimme(void *basisEvals_, int *basisSize, int *basisFlags,
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencezprimme(primme_context ctx);
 int coordinated_exitzprimme(int ret, primme_context ctx);
+int slice_spectrumzprimme(double *evals, dummy_type_zprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergezprimme(double *evals, double *resNorms, int *solve, dummy_type_zprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
+int Xprimme_aux_dh_sprimme(void *evals, void *evecs, void *resNorms,
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
+int wrapper_dh_sprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
+      int *outInitSize, primme_context ctx);
+int wrapper_astypedh_sprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvedh_sprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsdh_sprimme(primme_stats *stats);
+void add_statsdh_sprimme(primme_stats *stats, primme_stats *from);
+int check_inputdh_sprimme(
+      void *evals, void *evecs, void *resNorms, primme_params *primme);
+void convTestFunAbsolutedh_sprimme(double *eval, void *evec, double *rNorm,
+      int *isConv, primme_params *primme, int *ierr);
+void default_monitordh_sprimme(void *basisEvals_, int *basisSize, int *basisFlags,
+      int *iblock, int *blockSize, void *basisNorms_, int *numConverged,
+      void *lockedEvals_, int *numLocked, int *lockedFlags, void *lockedNorms_,
+      int *inner_its, void *LSRes_, const char *msg, double *time,
+      primme_event *event, primme_params *primme, int *err);
+int check_params_coherencedh_sprimme(primme_context ctx);
+int coordinated_exitdh_sprimme(int ret, primme_context ctx);
+int slice_spectrumdh_sprimme(double *evals, dummy_type_dh_sprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergedh_sprimme(double *evals, double *resNorms, int *solve, dummy_type_dh_sprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
+int Xprimme_aux_dh_cprimme_normal(void *evals, void *evecs, void *resNorms,
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
+int wrapper_dh_cprimme_normal(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
+      int *outInitSize, primme_context ctx);
+int wrapper_astypedh_cprimme_normal(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvedh_cprimme_normal(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsdh_cprimme_normal(primme_stats *stats);
+void add_statsdh_cprimme_normal(primme_stats *stats, primme_stats *from);
+int check_inputdh_cprimme_normal(
+      void *evals, void *evecs, void *resNorms, primme_params *primme);
+void convTestFunAbsolutedh_cprimme_normal(double *eval, void *evec, double *rNorm,
+      int *isConv, primme_params *primme, int *ierr);
+void default_monitordh_cprimme_normal(void *basisEvals_, int *basisSize, int *basisFlags,
+      int *iblock, int *blockSize, void *basisNorms_, int *numConverged,
+      void *lockedEvals_, int *numLocked, int *lockedFlags, void *lockedNorms_,
+      int *inner_its, void *LSRes_, const char *msg, double *time,
+      primme_event *event, primme_params *primme, int *err);
+int check_params_coherencedh_cprimme_normal(primme_context ctx);
+int coordinated_exitdh_cprimme_normal(int ret, primme_context ctx);
+int slice_spectrumdh_cprimme_normal(double *evals, dummy_type_dh_cprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergedh_cprimme_normal(double *evals, double *resNorms, int *solve, dummy_type_dh_cprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
+int Xprimme_aux_dh_cprimme(void *evals, void *evecs, void *resNorms,
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
+int wrapper_dh_cprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
+      int *outInitSize, primme_context ctx);
+int wrapper_astypedh_cprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvedh_cprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsdh_cprimme(primme_stats *stats);
+void add_statsdh_cprimme(primme_stats *stats, primme_stats *from);
+int check_inputdh_cprimme(
+      void *evals, void *evecs, void *resNorms, primme_params *primme);
+void convTestFunAbsolutedh_cprimme(double *eval, void *evec, double *rNorm,
+      int *isConv, primme_params *primme, int *ierr);
+void default_monitordh_cprimme(void *basisEvals_, int *basisSize, int *basisFlags,
+      int *iblock, int *blockSize, void *basisNorms_, int *numConverged,
+      void *lockedEvals_, int *numLocked, int *lockedFlags, void *lockedNorms_,
+      int *inner_its, void *LSRes_, const char *msg, double *time,
+      primme_event *event, primme_params *primme, int *err);
+int check_params_coherencedh_cprimme(primme_context ctx);
+int coordinated_exitdh_cprimme(int ret, primme_context ctx);
+int slice_spectrumdh_cprimme(double *evals, dummy_type_dh_cprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergedh_cprimme(double *evals, double *resNorms, int *solve, dummy_type_dh_cprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_magma_hprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_magma_hprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypemagma_hprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvemagma_hprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsmagma_hprimme(primme_stats *stats);
+void add_statsmagma_hprimme(primme_stats *stats, primme_stats *from);
 int check_inputmagma_hprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_hprimme(double *eval, void *evec, double *rNorm,
@@ -388,11 +644,26 @@ void default_monitormagma_hprimme(void *basisEvals_, int *basisSize, int *basisF
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencemagma_hprimme(primme_context ctx);
 int coordinated_exitmagma_hprimme(int ret, primme_context ctx);
+int slice_spectrummagma_hprimme(double *evals, dummy_type_magma_hprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergemagma_hprimme(double *evals, double *resNorms, int *solve, dummy_type_magma_hprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_magma_kprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_magma_kprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypemagma_kprimme_normal(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvemagma_kprimme_normal(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsmagma_kprimme_normal(primme_stats *stats);
+void add_statsmagma_kprimme_normal(primme_stats *stats, primme_stats *from);
 int check_inputmagma_kprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_kprimme_normal(double *eval, void *evec, double *rNorm,
@@ -404,11 +675,26 @@ void default_monitormagma_kprimme_normal(void *basisEvals_, int *basisSize, int
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencemagma_kprimme_normal(primme_context ctx);
 int coordinated_exitmagma_kprimme_normal(int ret, primme_context ctx);
+int slice_spectrummagma_kprimme_normal(double *evals, dummy_type_magma_kprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergemagma_kprimme_normal(double *evals, double *resNorms, int *solve, dummy_type_magma_kprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_magma_kprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_magma_kprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypemagma_kprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvemagma_kprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsmagma_kprimme(primme_stats *stats);
+void add_statsmagma_kprimme(primme_stats *stats, primme_stats *from);
 int check_inputmagma_kprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_kprimme(double *eval, void *evec, double *rNorm,
@@ -420,11 +706,26 @@ void default_monitormagma_kprimme(void *basisEvals_, int *basisSize, int *basisF
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencemagma_kprimme(primme_context ctx);
 int coordinated_exitmagma_kprimme(int ret, primme_context ctx);
+int slice_spectrummagma_kprimme(double *evals, dummy_type_magma_kprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergemagma_kprimme(double *evals, double *resNorms, int *solve, dummy_type_magma_kprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_magma_sprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_magma_sprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypemagma_sprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvemagma_sprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsmagma_sprimme(primme_stats *stats);
+void add_statsmagma_sprimme(primme_stats *stats, primme_stats *from);
 int check_inputmagma_sprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_sprimme(double *eval, void *evec, double *rNorm,
@@ -436,11 +737,26 @@ void default_monitormagma_sprimme(void *basisEvals_, int *basisSize, int *basisF
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencemagma_sprimme(primme_context ctx);
 int coordinated_exitmagma_sprimme(int ret, primme_context ctx);
+int slice_spectrummagma_sprimme(double *evals, dummy_type_magma_sprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergemagma_sprimme(double *evals, double *resNorms, int *solve, dummy_type_magma_sprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_magma_cprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_magma_cprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypemagma_cprimme_normal(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvemagma_cprimme_normal(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsmagma_cprimme_normal(primme_stats *stats);
+void add_statsmagma_cprimme_normal(primme_stats *stats, primme_stats *from);
 int check_inputmagma_cprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_cprimme_normal(double *eval, void *evec, double *rNorm,
@@ -452,11 +768,26 @@ void default_monitormagma_cprimme_normal(void *basisEvals_, int *basisSize, int
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencemagma_cprimme_normal(primme_context ctx);
 int coordinated_exitmagma_cprimme_normal(int ret, primme_context ctx);
+int slice_spectrummagma_cprimme_normal(double *evals, dummy_type_magma_cprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergemagma_cprimme_normal(double *evals, double *resNorms, int *solve, dummy_type_magma_cprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_magma_cprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_magma_cprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypemagma_cprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvemagma_cprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsmagma_cprimme(primme_stats *stats);
+void add_statsmagma_cprimme(primme_stats *stats, primme_stats *from);
 int check_inputmagma_cprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_cprimme(double *eval, void *evec, double *rNorm,
@@ -468,11 +799,26 @@ void default_monitormagma_cprimme(void *basisEvals_, int *basisSize, int *basisF
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencemagma_cprimme(primme_context ctx);
 int coordinated_exitmagma_cprimme(int ret, primme_context ctx);
+int slice_spectrummagma_cprimme(double *evals, dummy_type_magma_cprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergemagma_cprimme(double *evals, double *resNorms, int *solve, dummy_type_magma_cprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_magma_dprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_magma_dprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypemagma_dprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvemagma_dprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsmagma_dprimme(primme_stats *stats);
+void add_statsmagma_dprimme(primme_stats *stats, primme_stats *from);
 int check_inputmagma_dprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_dprimme(double *eval, void *evec, double *rNorm,
@@ -484,11 +830,26 @@ void default_monitormagma_dprimme(void *basisEvals_, int *basisSize, int *basisF
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencemagma_dprimme(primme_context ctx);
 int coordinated_exitmagma_dprimme(int ret, primme_context ctx);
+int slice_spectrummagma_dprimme(double *evals, dummy_type_magma_dprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergemagma_dprimme(double *evals, double *resNorms, int *solve, dummy_type_magma_dprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_magma_zprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_magma_zprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypemagma_zprimme_normal(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvemagma_zprimme_normal(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsmagma_zprimme_normal(primme_stats *stats);
+void add_statsmagma_zprimme_normal(primme_stats *stats, primme_stats *from);
 int check_inputmagma_zprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_zprimme_normal(double *eval, void *evec, double *rNorm,
@@ -500,11 +861,26 @@ void default_monitormagma_zprimme_normal(void *basisEvals_, int *basisSize, int
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencemagma_zprimme_normal(primme_context ctx);
 int coordinated_exitmagma_zprimme_normal(int ret, primme_context ctx);
+int slice_spectrummagma_zprimme_normal(double *evals, dummy_type_magma_zprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergemagma_zprimme_normal(double *evals, double *resNorms, int *solve, dummy_type_magma_zprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 int Xprimme_aux_magma_zprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_workspace *ws, primme_trace *trace);
 int wrapper_magma_zprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int wrapper_astypemagma_zprimme(primme_op_datatype t, void *evals, void *evecs,
+      void *resNorms, primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int staged_precision_solvemagma_zprimme(primme_op_datatype t, primme_op_datatype ts,
+      void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+void clear_statsmagma_zprimme(primme_stats *stats);
+void add_statsmagma_zprimme(primme_stats *stats, primme_stats *from);
 int check_inputmagma_zprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_zprimme(double *eval, void *evec, double *rNorm,
@@ -516,4 +892,9 @@ void default_monitormagma_zprimme(void *basisEvals_, int *basisSize, int *basisF
       primme_event *event, primme_params *primme, int *err);
 int check_params_coherencemagma_zprimme(primme_context ctx);
 int coordinated_exitmagma_zprimme(int ret, primme_context ctx);
+int slice_spectrummagma_zprimme(double *evals, dummy_type_magma_zprimme *evecs, double *resNorms,
+      double lower, double upper, int numSlices, int numThreads,
+      primme_context ctx);
+int slice_mergemagma_zprimme(double *evals, double *resNorms, int *solve, dummy_type_magma_zprimme *V,
+      PRIMME_INT ldV, int *n, primme_context ctx);
 #endif
@@ -53,12 +53,14 @@
  * The only difference from primme: the return value passed as parameter 
  *****************************************************************************/
 
+#ifndef USE_DHOST
 EXTERN_C void AS_FORTRAN(Xprimme)(XEVAL *evals, XSCALAR *evecs, XREAL *rnorms,
       primme_params **primme, int *ierr) {
 
    *ierr = Xprimme(evals, evecs, rnorms, *primme);
 
 } /* end of xprimme_f77 wrapper for calling from Fortran */
+#endif /* USE_DHOST */
 
 
 /* Only define these functions ones */
@@ -45,6 +45,9 @@
 #include <math.h>    
 #include <string.h>  /* strcmp */  
 #include <limits.h>    
+#ifdef PRIMME_WITH_OPENMP
+#include <omp.h>
+#endif
 #include "numerical.h"
 #include "primme_interface.h"
 
@@ -60,6 +63,9 @@ typedef union {
    void (*globalSumRealFunc_v)(
          void *, void *, int *, struct primme_params *, int *);
    void (*broadcastRealFunc_v)(void *, int *, struct primme_params *, int *);
+   void (*globalSumRealStartFunc_v)(
+         void *, void *, int *, void **, struct primme_params *, int *);
+   void (*globalSumRealWaitFunc_v)(void *, struct primme_params *, int *);
    void (*convTestFun_v)(
          double *, void *, double *, int *, struct primme_params *, int *);
    void (*monitorFun_v)(void *basisEvals, int *basisSize, int *basisFlags,
@@ -84,10 +90,308 @@ primme_params * primme_params_create(void) {
  *  * Free the internally allocated work arrays of the primme structure 
  *   *****************************************************************************/
 int primme_params_destroy(primme_params *primme) {
+    primme_free(primme);
     free(primme);
     return 0;
 }
 
+/*****************************************************************************
+ * Allocate a workspace to be reused by the calls to Xprimme_ws. If warmStart
+ * is nonzero, every call keeps its final basis to be used as initial guesses
+ * in the next call.
+ *****************************************************************************/
+primme_workspace * primme_workspace_create(int warmStart) {
+
+   primme_workspace *ws = NULL;
+   if (MALLOC_PRIMME(1, &ws) == 0) {
+      Mem_arena_init(&ws->arena);
+      ws->warmStart = warmStart;
+      ws->basis = NULL;
+      ws->basisType = primme_op_default;
+      ws->nLocal = 0;
+      ws->basisSize = 0;
+   }
+   return ws;
+}
+
+/*****************************************************************************
+ * Free the memory kept by the workspace. Return -1 and free nothing if the
+ * workspace is still in use by a call.
+ *****************************************************************************/
+int primme_workspace_destroy(primme_workspace *ws) {
+
+   if (!ws) return 0;
+   if (ws->arena.top != 0) return -1;
+
+   if (ws->arena.base) free(ws->arena.base);
+   if (ws->basis) free(ws->basis);
+   free(ws);
+   return 0;
+}
+
+/*****************************************************************************
+ * Create a sparse matrix in CSR format to be used by primme_csr_matvec and
+ * primme_csr_mm. The arrays ia, ja and a are not copied, so they should be
+ * valid until primme_csr_destroy is called.
+ *****************************************************************************/
+primme_csr * primme_csr_create(PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const void *a, int base, primme_op_datatype type,
+      int iscomplex) {
+
+   primme_csr *A = NULL;
+   if (type != primme_op_double
+#ifndef PRIMME_WITHOUT_FLOAT
+         && type != primme_op_float
+#endif
+   ) {
+      return NULL;
+   }
+   if (MALLOC_PRIMME(1, &A) == 0) {
+      A->m = m;
+      A->n = n;
+      A->ia = ia;
+      A->ja = ja;
+      A->a = a;
+      A->base = base;
+      A->type = type;
+      A->iscomplex = iscomplex ? 1 : 0;
+      A->C = 0;
+      A->cptr = NULL;
+      A->clen = NULL;
+      A->ccol = NULL;
+      A->cval = NULL;
+      A->perm = NULL;
+      A->work = NULL;
+      A->lwork = 0;
+   }
+   return A;
+}
+
+/* Sort rows by decreasing length, used by primme_csr_sell */
+
+typedef struct { int len, row; } csr_row_len;
+
+static int csr_row_len_cmp(const void *a, const void *b) {
+   const csr_row_len *x = (const csr_row_len *)a, *y = (const csr_row_len *)b;
+   if (x->len != y->len) return x->len < y->len ? 1 : -1;
+   return x->row < y->row ? -1 : (x->row > y->row ? 1 : 0);
+}
+
+/* Free the SELL-C-sigma representation of the matrix */
+
+static void csr_sell_free(primme_csr *A) {
+   free(A->cptr);
+   free(A->clen);
+   free(A->ccol);
+   free(A->cval);
+   free(A->perm);
+   A->cptr = NULL;
+   A->clen = NULL;
+   A->ccol = NULL;
+   A->cval = NULL;
+   A->perm = NULL;
+   A->C = 0;
+}
+
+/*****************************************************************************
+ * Build the SELL-C-sigma representation of the matrix, used by primme_csr_mm
+ * to compute A*x. The rows are sorted by length inside windows of sigma rows,
+ * and grouped in chunks of C rows. Larger sigma reduces the padding of the
+ * chunks but also the locality of the accesses to x.
+ *****************************************************************************/
+int primme_csr_sell(primme_csr *A, int C, int sigma) {
+
+   PRIMME_INT i, k, nc, nnz;
+   int j, r;
+   size_t s = (A->type == primme_op_double ? sizeof(double) : sizeof(float)) *
+              (A->iscomplex ? 2 : 1);
+   csr_row_len *rows = NULL;
+
+   if (C <= 0 || C > SELL_MAX_C || sigma < 1 || A->m > INT_MAX) {
+      return PRIMME_FUNCTION_UNAVAILABLE;
+   }
+
+   /* Remove the previous representation */
+
+   csr_sell_free(A);
+
+   /* Sort the rows by length inside every window of sigma rows */
+
+   nc = (A->m + C - 1) / C;
+   if (MALLOC_PRIMME(A->m, &rows) != 0 || MALLOC_PRIMME(nc + 1, &A->cptr) != 0 ||
+         MALLOC_PRIMME(nc, &A->clen) != 0 || MALLOC_PRIMME(A->m, &A->perm) != 0) {
+      free(rows);
+      csr_sell_free(A);
+      return PRIMME_MALLOC_FAILURE;
+   }
+   for (i = 0; i < A->m; i++) {
+      rows[i].len = A->ia[i + 1] - A->ia[i];
+      rows[i].row = (int)i;
+   }
+   for (i = 0; i < A->m; i += sigma) {
+      qsort(&rows[i], (size_t)min(sigma, A->m - i), sizeof(csr_row_len),
+            csr_row_len_cmp);
+   }
+
+   /* Set the number of columns and the position of every chunk */
+
+   for (i = nnz = 0; i < nc; i++) {
+      A->clen[i] = 0;
+      for (k = i * C; k < min((i + 1) * C, A->m); k++) {
+         A->clen[i] = max(A->clen[i], rows[k].len);
+      }
+      A->cptr[i] = nnz;
+      nnz += (PRIMME_INT)A->clen[i] * C;
+   }
+   A->cptr[nc] = nnz;
+
+   /* Copy the values and the column indices; padding has value 0 and index 0 */
+
+   A->ccol = (int *)calloc((size_t)max(nnz, 1), sizeof(int));
+   A->cval = calloc((size_t)max(nnz, 1), s);
+   if (!A->ccol || !A->cval) {
+      free(rows);
+      csr_sell_free(A);
+      return PRIMME_MALLOC_FAILURE;
+   }
+   for (i = 0; i < nc; i++) {
+      for (r = 0; r < C && i * C + r < A->m; r++) {
+         csr_row_len *row = &rows[i * C + r];
+         PRIMME_INT k0 = A->ia[row->row] - A->base;
+         A->perm[i * C + r] = row->row;
+         for (j = 0; j < row->len; j++) {
+            PRIMME_INT p = A->cptr[i] + (PRIMME_INT)C * j + r;
+            A->ccol[p] = A->ja[k0 + j] - A->base;
+            memcpy((char *)A->cval + s * p, (const char *)A->a + s * (k0 + j),
+                  s);
+         }
+      }
+   }
+   free(rows);
+   A->C = C;
+
+   return 0;
+}
+
+/*****************************************************************************
+ * Free the memory allocated by primme_csr_create and primme_csr_sell
+ *****************************************************************************/
+int primme_csr_destroy(primme_csr *A) {
+
+   if (!A) return 0;
+   csr_sell_free(A);
+   free(A->work);
+   free(A);
+   return 0;
+}
+
+/*****************************************************************************
+ * Compute y = A*x if trans is zero, and y = A'*x otherwise, where x and y
+ * have blockSize columns of the same type as the matrix values
+ *****************************************************************************/
+int primme_csr_mm(primme_csr *A, int trans, int blockSize, void *x,
+      PRIMME_INT ldx, void *y, PRIMME_INT ldy) {
+
+#define CSR_MM(S, T)                                                           \
+   if (A->C > 0 && !trans) {                                                   \
+      return Num_sellmm_##S##primme(A->m, A->C, A->cptr, A->clen, A->ccol,     \
+            (const T *)A->cval, A->perm, blockSize, (T *)x, ldx, (T *)y, ldy); \
+   }                                                                           \
+   return Num_csrmm_##S##primme(trans, A->m, A->n, A->ia, A->ja,               \
+         (const T *)A->a, A->base, blockSize, (T *)x, ldx, (T *)y, ldy);
+
+   switch (A->type) {
+#ifndef PRIMME_WITHOUT_FLOAT
+   case primme_op_float:
+      if (A->iscomplex) {
+         CSR_MM(c, dummy_type_cprimme);
+      } else {
+         CSR_MM(s, dummy_type_sprimme);
+      }
+#endif
+   case primme_op_double:
+      if (A->iscomplex) {
+         CSR_MM(z, dummy_type_zprimme);
+      } else {
+         CSR_MM(d, dummy_type_dprimme);
+      }
+   default: return PRIMME_FUNCTION_UNAVAILABLE;
+   }
+#undef CSR_MM
+}
+
+/*****************************************************************************
+ * Compute y = A'*A*x if trans is zero, and y = A*A'*x otherwise. The first
+ * one does not store A*x, but every thread accumulates its rows into a
+ * different part of the workspace; the second one stores A'*x in the
+ * workspace. The workspace is kept in A for the next calls, so the same A
+ * should not be used by several calls at the same time.
+ *****************************************************************************/
+int primme_csr_normal_mm(primme_csr *A, int trans, int blockSize, void *x,
+      PRIMME_INT ldx, void *y, PRIMME_INT ldy) {
+
+   size_t s = (A->type == primme_op_double ? sizeof(double) : sizeof(float)) *
+              (A->iscomplex ? 2 : 1);
+   size_t lwork = (size_t)A->n * (size_t)max(blockSize, 1);
+#ifdef PRIMME_WITH_OPENMP
+   if (!trans && !omp_in_parallel()) lwork *= (size_t)omp_get_max_threads();
+#else
+   if (!trans) lwork = 0;
+#endif
+
+   /* Grow the workspace if needed */
+
+   if (lwork > A->lwork) {
+      free(A->work);
+      A->work = malloc(s * lwork);
+      A->lwork = A->work ? lwork : 0;
+      if (!A->work) return PRIMME_MALLOC_FAILURE;
+   }
+
+   if (trans) {
+      int ierr = primme_csr_mm(A, 1, blockSize, x, ldx, A->work, A->n);
+      if (ierr == 0) {
+         ierr = primme_csr_mm(A, 0, blockSize, A->work, A->n, y, ldy);
+      }
+      return ierr;
+   }
+
+#define CSR_NORMAL_MM(S, T)                                                    \
+   return Num_csrmm_normal_##S##primme(A->m, A->n, A->ia, A->ja,               \
+         (const T *)A->a, A->base, blockSize, (T *)x, ldx, (T *)y, ldy,        \
+         (T *)A->work, A->lwork);
+
+   switch (A->type) {
+#ifndef PRIMME_WITHOUT_FLOAT
+   case primme_op_float:
+      if (A->iscomplex) {
+         CSR_NORMAL_MM(c, dummy_type_cprimme);
+      } else {
+         CSR_NORMAL_MM(s, dummy_type_sprimme);
+      }
+#endif
+   case primme_op_double:
+      if (A->iscomplex) {
+         CSR_NORMAL_MM(z, dummy_type_zprimme);
+      } else {
+         CSR_NORMAL_MM(d, dummy_type_dprimme);
+      }
+   default: return PRIMME_FUNCTION_UNAVAILABLE;
+   }
+#undef CSR_NORMAL_MM
+}
+
+/*****************************************************************************
+ * Matrix-vector product callback for primme_params.matrixMatvec that
+ * multiplies by the primme_csr in primme.matrix
+ *****************************************************************************/
+void primme_csr_matvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr) {
+
+   *ierr = primme_csr_mm(
+         (primme_csr *)primme->matrix, 0, *blockSize, x, *ldx, y, *ldy);
+}
+
 
 /*******************************************************************************
  * Subroutine primme_initialize - Set primme_params members to default values.
@@ -130,12 +434,16 @@ void primme_initialize(primme_params *primme) {
    primme->globalSumReal_type      = primme_op_default;
    primme->broadcastReal           = NULL;
    primme->broadcastReal_type      = primme_op_default;
+   primme->globalSumRealStart      = NULL;
+   primme->globalSumRealWait       = NULL;
 
    /* Initial guesses/constraints */
    primme->initSize                = 0;
    primme->numOrthoConst           = 0;
 
    primme->projectionParams.projection = primme_proj_default;
+   primme->projectionParams.partialSolve = 0;
+   primme->projectionParams.replicatedSolve = 0;
 
    primme->initBasisMode                       = primme_init_default;
 
@@ -150,6 +458,7 @@ void primme_initialize(primme_params *primme) {
    primme->restartingParams.maxPrevRetain      = -1;
    primme->orth                                = primme_orth_default;
    primme->internalPrecision                   = primme_op_default;
+   primme->storagePrecision                    = primme_op_default;
 
    /* correction parameters (inner) */
    primme->correctionParams.precondition       = -1;
@@ -163,6 +472,8 @@ void primme_initialize(primme_params *primme) {
    primme->correctionParams.projectors.SkewX   = 0;
    primme->correctionParams.relTolBase         = 0;
    primme->correctionParams.convTest           = primme_adaptive_ETolerance;
+   primme->correctionParams.innerPrecision     = primme_op_default;
+   primme->correctionParams.chebyshevDegree    = 0;
 
    /* Printing and reporting */
    primme->outputFile                          = stdout;
@@ -172,6 +483,7 @@ void primme_initialize(primme_params *primme) {
    primme->stats.numMatvecs                    = 0;
    primme->stats.numPreconds                   = 0;
    primme->stats.numGlobalSum                  = 0;
+   primme->stats.numGlobalSumRequested         = 0;
    primme->stats.flopsDense                    = 0.0;
    primme->stats.timeDense                     = 0;
    primme->stats.volumeGlobalSum               = 0;
@@ -192,6 +504,7 @@ void primme_initialize(primme_params *primme) {
    primme->stats.maxConvTol                    = 0.0;
    primme->stats.estimateResidualError         = 0.0;
    primme->stats.lockingIssue                  = 0;
+   primme->stats.numReplicatedMismatches       = 0;
 
    /* Optional user defined structures */
    primme->matrix                  = NULL;
@@ -214,6 +527,15 @@ void primme_initialize(primme_params *primme) {
    primme->monitor                 = NULL;
    primme->queue                   = NULL;
    primme->profile                 = NULL;
+   primme->memoryArena             = 0;
+   primme->basisStorageDir         = NULL;
+   primme->checkpointFile          = NULL;
+   primme->checkpointInterval      = 0;
+   primme->checkpointRequest       = 0;
+   primme->profileTable            = NULL;
+   primme->traceFile               = NULL;
+   primme->dynamicBlockSize        = 0;
+   primme->tuningFile              = NULL;
 }
 
 /*******************************************************************************
@@ -226,8 +548,87 @@ void primme_initialize(primme_params *primme) {
  ******************************************************************************/
 
 void primme_free(primme_params *primme) {
-   (void)primme;
-   /* No function */
+   Profile_destroy(primme->profileTable);
+   primme->profileTable = NULL;
+}
+
+/*******************************************************************************
+ * Subroutine primme_get_profile - Return the calls and the times of the call
+ *    sites profiled since the first call with profile set. The entries of the
+ *    same site in different precisions are merged, and they are sorted by
+ *    decreasing total time.
+ * 
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * primme      Structure containing various solver parameters and statistics
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * entries     Array with capacity for *numEntries entries. If NULL, only
+ *             *numEntries is set
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * numEntries  Capacity of entries on input; number of entries on output
+ *
+ * Return Value
+ * ------------
+ * error code
+ *
+ ******************************************************************************/
+
+static int cmp_profile_name(const void *a, const void *b) {
+   return strcmp(((const primme_profile_entry *)a)->name,
+         ((const primme_profile_entry *)b)->name);
+}
+
+static int cmp_profile_time(const void *a, const void *b) {
+   double ta = ((const primme_profile_entry *)a)->totalTime,
+          tb = ((const primme_profile_entry *)b)->totalTime;
+   return ta < tb ? 1 : (ta > tb ? -1 : 0);
+}
+
+int primme_get_profile(primme_params *primme, primme_profile_entry *entries,
+      int *numEntries) {
+
+   primme_profile *prof = primme ? primme->profileTable : NULL;
+   if (!numEntries) return PRIMME_FUNCTION_UNAVAILABLE;
+   if (!prof || prof->size == 0) {
+      *numEntries = 0;
+      return 0;
+   }
+
+   /* Gather the sites with some call */
+
+   primme_profile_entry *e;
+   int i, n = 0;
+   if (MALLOC_PRIMME(prof->size, &e)) return PRIMME_MALLOC_FAILURE;
+   for (i = 0; i < prof->size; i++) {
+      if (prof->entries[i].count > 0) e[n++] = prof->entries[i];
+   }
+
+   /* Merge the entries with the same name */
+
+   qsort(e, n, sizeof(primme_profile_entry), cmp_profile_name);
+   int m = 0;
+   for (i = 0; i < n; i++) {
+      if (m > 0 && strcmp(e[m - 1].name, e[i].name) == 0) {
+         e[m - 1].count += e[i].count;
+         e[m - 1].totalTime += e[i].totalTime;
+         e[m - 1].maxTime = max(e[m - 1].maxTime, e[i].maxTime);
+      } else {
+         e[m++] = e[i];
+      }
+   }
+   qsort(e, m, sizeof(primme_profile_entry), cmp_profile_time);
+
+   if (entries) {
+      m = min(m, *numEntries);
+      for (i = 0; i < m; i++) entries[i] = e[i];
+   }
+   *numEntries = m;
+   free(e);
+   return 0;
 }
 
 /******************************************************************************
@@ -693,6 +1094,8 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    PRINTParamsIF(projection, projection, primme_proj_RR);
    PRINTParamsIF(projection, projection, primme_proj_harmonic);
    PRINTParamsIF(projection, projection, primme_proj_refined);
+   PRINTParams(projection, partialSolve, %d);
+   PRINTParams(projection, replicatedSolve, %d);
 
    PRINTIF(initBasisMode, primme_init_default);
    PRINTIF(initBasisMode, primme_init_krylov);
@@ -714,6 +1117,9 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    PRINT(numOrthoConst, %d);
    PRINT_PRIMME_INT(ldevecs);
    PRINT_PRIMME_INT(ldOPs);
+   PRINT(memoryArena, %d);
+   PRINT(checkpointInterval, %d);
+   PRINT(dynamicBlockSize, %d);
    fprintf(outputFile, "%s.iseed =", prefix);
    for (i=0; i<4;i++) {
       fprintf(outputFile, " %" PRIMME_INT_P, primme.iseed[i]);
@@ -721,11 +1127,18 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    fprintf(outputFile, "\n");
    PRINTIF(orth, primme_orth_implicit_I);
    PRINTIF(orth, primme_orth_explicit_I);
+   PRINTIF(orth, primme_orth_lowsync);
 
    PRINTIF(internalPrecision, primme_op_half);
    PRINTIF(internalPrecision, primme_op_float);
    PRINTIF(internalPrecision, primme_op_double);
    PRINTIF(internalPrecision, primme_op_quad);
+   PRINTIF(internalPrecision, primme_op_auto);
+
+   PRINTIF(storagePrecision, primme_op_half);
+   PRINTIF(storagePrecision, primme_op_float);
+   PRINTIF(storagePrecision, primme_op_double);
+   PRINTIF(storagePrecision, primme_op_quad);
 
    PRINTParams(restarting, maxPrevRetain, %d);
 
@@ -740,6 +1153,12 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    PRINTParamsIF(correction, convTest, primme_adaptive_ETolerance);
    PRINTParamsIF(correction, convTest, primme_adaptive);
 
+   PRINTParamsIF(correction, innerPrecision, primme_op_half);
+   PRINTParamsIF(correction, innerPrecision, primme_op_float);
+   PRINTParamsIF(correction, innerPrecision, primme_op_double);
+   PRINTParamsIF(correction, innerPrecision, primme_op_quad);
+   PRINTParams(correction, chebyshevDegree, %d);
+
    fprintf(outputFile, "\n// projectors for JD cor.eq.\n");
    PRINTParams(correction, projectors.LeftQ , %d);
    PRINTParams(correction, projectors.LeftX , %d);
@@ -819,6 +1238,12 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_broadcastReal:
               v->broadcastRealFunc_v = primme->broadcastReal;
       break;
+      case PRIMME_globalSumRealStart:
+              v->globalSumRealStartFunc_v = primme->globalSumRealStart;
+      break;
+      case PRIMME_globalSumRealWait:
+              v->globalSumRealWaitFunc_v = primme->globalSumRealWait;
+      break;
       case PRIMME_numEvals:
               *(PRIMME_INT*)value = primme->numEvals;
       break;
@@ -884,6 +1309,9 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_internalPrecision:
               *(PRIMME_INT*)value = primme->internalPrecision;
       break;
+      case PRIMME_storagePrecision:
+              *(PRIMME_INT*)value = primme->storagePrecision;
+      break;
       case PRIMME_printLevel:
               *(PRIMME_INT*)value = primme->printLevel;
       break;
@@ -905,6 +1333,12 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_projectionParams_projection:
               *(PRIMME_INT*)value = primme->projectionParams.projection;
       break;
+      case PRIMME_projectionParams_partialSolve:
+              *(PRIMME_INT*)value = primme->projectionParams.partialSolve;
+      break;
+      case PRIMME_projectionParams_replicatedSolve:
+              *(PRIMME_INT*)value = primme->projectionParams.replicatedSolve;
+      break;
       case PRIMME_restartingParams_maxPrevRetain:
               *(PRIMME_INT*)value = primme->restartingParams.maxPrevRetain;
       break;
@@ -941,6 +1375,12 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_correctionParams_relTolBase:
               *(double*)value = primme->correctionParams.relTolBase;
       break;
+      case PRIMME_correctionParams_innerPrecision:
+              *(PRIMME_INT*)value = primme->correctionParams.innerPrecision;
+      break;
+      case PRIMME_correctionParams_chebyshevDegree:
+              *(PRIMME_INT*)value = primme->correctionParams.chebyshevDegree;
+      break;
       case PRIMME_stats_numOuterIterations:
               *(PRIMME_INT*)value = primme->stats.numOuterIterations;
       break;
@@ -956,6 +1396,12 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_stats_numGlobalSum:
               *(PRIMME_INT*)value = primme->stats.numGlobalSum;
       break;
+      case PRIMME_stats_numGlobalSumRequested:
+              *(PRIMME_INT*)value = primme->stats.numGlobalSumRequested;
+      break;
+      case PRIMME_stats_numReplicatedMismatches:
+              *(PRIMME_INT*)value = primme->stats.numReplicatedMismatches;
+      break;
       case PRIMME_stats_numBroadcast:
               *(PRIMME_INT*)value = primme->stats.numBroadcast;
       break;
@@ -1043,6 +1489,33 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_profile:
               *(str_v*)value = primme->profile;
       break;
+      case PRIMME_memoryArena:
+              *(PRIMME_INT*)value = primme->memoryArena;
+      break;
+      case PRIMME_basisStorageDir:
+              *(str_v*)value = primme->basisStorageDir;
+      break;
+      case PRIMME_checkpointFile:
+              *(str_v*)value = primme->checkpointFile;
+      break;
+      case PRIMME_checkpointInterval:
+              *(PRIMME_INT*)value = primme->checkpointInterval;
+      break;
+      case PRIMME_checkpointRequest:
+              *(PRIMME_INT*)value = primme->checkpointRequest;
+      break;
+      case PRIMME_profileTable:
+              *(ptr_v*)value = primme->profileTable;
+      break;
+      case PRIMME_traceFile:
+              *(str_v*)value = primme->traceFile;
+      break;
+      case PRIMME_dynamicBlockSize:
+              *(PRIMME_INT*)value = primme->dynamicBlockSize;
+      break;
+      case PRIMME_tuningFile:
+              *(str_v*)value = primme->tuningFile;
+      break;
       default :
       return 1;
    }
@@ -1118,6 +1591,12 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_broadcastReal:
               primme->broadcastReal = v.broadcastRealFunc_v;
       break;
+      case PRIMME_globalSumRealStart:
+              primme->globalSumRealStart = v.globalSumRealStartFunc_v;
+      break;
+      case PRIMME_globalSumRealWait:
+              primme->globalSumRealWait = v.globalSumRealWaitFunc_v;
+      break;
       case PRIMME_broadcastReal_type:
               primme->broadcastReal_type = (primme_op_datatype)*(PRIMME_INT*)value;
       break;
@@ -1195,6 +1674,9 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_internalPrecision:
               primme->internalPrecision = (primme_op_datatype)*(PRIMME_INT*)value;
       break;
+      case PRIMME_storagePrecision:
+              primme->storagePrecision = (primme_op_datatype)*(PRIMME_INT*)value;
+      break;
       case PRIMME_printLevel:
               if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
               primme->printLevel = (int)*(PRIMME_INT*)value;
@@ -1217,6 +1699,14 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_projectionParams_projection:
               primme->projectionParams.projection = (primme_projection)*(PRIMME_INT*)value;
       break;
+      case PRIMME_projectionParams_partialSolve:
+              if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
+              primme->projectionParams.partialSolve = (int)*(PRIMME_INT*)value;
+      break;
+      case PRIMME_projectionParams_replicatedSolve:
+              if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
+              primme->projectionParams.replicatedSolve = (int)*(PRIMME_INT*)value;
+      break;
       case PRIMME_restartingParams_maxPrevRetain:
               if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
               primme->restartingParams.maxPrevRetain = (int)*(PRIMME_INT*)value;
@@ -1263,6 +1753,14 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_correctionParams_relTolBase:
               primme->correctionParams.relTolBase = *(double*)value;
       break;
+      case PRIMME_correctionParams_innerPrecision:
+              primme->correctionParams.innerPrecision =
+                    (primme_op_datatype)*(PRIMME_INT*)value;
+      break;
+      case PRIMME_correctionParams_chebyshevDegree:
+              if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
+              primme->correctionParams.chebyshevDegree = (int)*(PRIMME_INT*)value;
+      break;
       case PRIMME_stats_numOuterIterations:
               primme->stats.numOuterIterations = *(PRIMME_INT*)value;
       break;
@@ -1359,6 +1857,33 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_profile:
               primme->profile = (str_v)value;
       break;
+      case PRIMME_memoryArena:
+              primme->memoryArena = (int)*(PRIMME_INT*)value;
+      break;
+      case PRIMME_basisStorageDir:
+              primme->basisStorageDir = (str_v)value;
+      break;
+      case PRIMME_checkpointFile:
+              primme->checkpointFile = (str_v)value;
+      break;
+      case PRIMME_checkpointInterval:
+              primme->checkpointInterval = (int)*(PRIMME_INT*)value;
+      break;
+      case PRIMME_checkpointRequest:
+              primme->checkpointRequest = (int)*(PRIMME_INT*)value;
+      break;
+      case PRIMME_profileTable:
+              primme->profileTable = (primme_profile*)value;
+      break;
+      case PRIMME_traceFile:
+              primme->traceFile = (str_v)value;
+      break;
+      case PRIMME_dynamicBlockSize:
+              primme->dynamicBlockSize = (int)*(PRIMME_INT*)value;
+      break;
+      case PRIMME_tuningFile:
+              primme->tuningFile = (str_v)value;
+      break;
       default : 
       return 1;
    }
@@ -1419,6 +1944,8 @@ int primme_member_info(primme_params_label *label, const char **label_name,
    IF_IS(nLocal                       , nLocal);
    IF_IS(globalSumReal                , globalSumReal);
    IF_IS(broadcastReal                , broadcastReal);
+   IF_IS(globalSumRealStart           , globalSumRealStart);
+   IF_IS(globalSumRealWait            , globalSumRealWait);
    IF_IS(numEvals                     , numEvals);
    IF_IS(target                       , target);
    IF_IS(numTargetShifts              , numTargetShifts);
@@ -1439,6 +1966,7 @@ int primme_member_info(primme_params_label *label, const char **label_name,
    IF_IS(eps                          , eps);
    IF_IS(orth                         , orth);
    IF_IS(internalPrecision            , internalPrecision);
+   IF_IS(storagePrecision             , storagePrecision);
    IF_IS(printLevel                   , printLevel);
    IF_IS(outputFile                   , outputFile);
    IF_IS(matrix                       , matrix);
@@ -1447,6 +1975,8 @@ int primme_member_info(primme_params_label *label, const char **label_name,
    IF_IS(ShiftsForPreconditioner      , ShiftsForPreconditioner);
    IF_IS(initBasisMode                , initBasisMode);
    IF_IS(projection_projection        , projectionParams_projection);
+   IF_IS(projection_partialSolve      , projectionParams_partialSolve);
+   IF_IS(projection_replicatedSolve   , projectionParams_replicatedSolve);
    IF_IS(restarting_maxPrevRetain     , restartingParams_maxPrevRetain);
    IF_IS(correction_precondition      , correctionParams_precondition);
    IF_IS(correction_robustShifts      , correctionParams_robustShifts);
@@ -1459,11 +1989,15 @@ int primme_member_info(primme_params_label *label, const char **label_name,
    IF_IS(correction_projectors_SkewX  , correctionParams_projectors_SkewX);
    IF_IS(correction_convTest          , correctionParams_convTest);
    IF_IS(correction_relTolBase        , correctionParams_relTolBase);
+   IF_IS(correction_innerPrecision    , correctionParams_innerPrecision);
+   IF_IS(correction_chebyshevDegree   , correctionParams_chebyshevDegree);
    IF_IS(stats_numOuterIterations     , stats_numOuterIterations);
    IF_IS(stats_numRestarts            , stats_numRestarts);
    IF_IS(stats_numMatvecs             , stats_numMatvecs);
    IF_IS(stats_numPreconds            , stats_numPreconds);
    IF_IS(stats_numGlobalSum           , stats_numGlobalSum);
+   IF_IS(stats_numGlobalSumRequested  , stats_numGlobalSumRequested);
+   IF_IS(stats_numReplicatedMismatches , stats_numReplicatedMismatches);
    IF_IS(stats_volumeGlobalSum        , stats_volumeGlobalSum);
    IF_IS(stats_numBroadcast           , stats_numBroadcast);
    IF_IS(stats_volumeBroadcast        , stats_volumeBroadcast);
@@ -1493,6 +2027,15 @@ int primme_member_info(primme_params_label *label, const char **label_name,
    IF_IS(monitor                      , monitor);
    IF_IS(queue                        , queue);
    IF_IS(profile                      , profile);
+   IF_IS(memoryArena                  , memoryArena);
+   IF_IS(basisStorageDir              , basisStorageDir);
+   IF_IS(checkpointFile               , checkpointFile);
+   IF_IS(checkpointInterval           , checkpointInterval);
+   IF_IS(checkpointRequest            , checkpointRequest);
+   IF_IS(profileTable                 , profileTable);
+   IF_IS(traceFile                    , traceFile);
+   IF_IS(dynamicBlockSize             , dynamicBlockSize);
+   IF_IS(tuningFile                   , tuningFile);
 #undef IF_IS
 
    /* Return error if no label was found */
@@ -1523,7 +2066,10 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_initBasisMode:
       case PRIMME_orth:
       case PRIMME_internalPrecision:
+      case PRIMME_storagePrecision:
       case PRIMME_projectionParams_projection:
+      case PRIMME_projectionParams_partialSolve:
+      case PRIMME_projectionParams_replicatedSolve:
       case PRIMME_restartingParams_maxPrevRetain:
       case PRIMME_correctionParams_precondition:
       case PRIMME_correctionParams_robustShifts:
@@ -1535,11 +2081,15 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_correctionParams_projectors_SkewQ:
       case PRIMME_correctionParams_projectors_SkewX:
       case PRIMME_correctionParams_convTest:
+      case PRIMME_correctionParams_innerPrecision:
+      case PRIMME_correctionParams_chebyshevDegree:
       case PRIMME_stats_numOuterIterations:
       case PRIMME_stats_numRestarts:
       case PRIMME_stats_numMatvecs:
       case PRIMME_stats_numPreconds:
       case PRIMME_stats_numGlobalSum:
+      case PRIMME_stats_numGlobalSumRequested:
+      case PRIMME_stats_numReplicatedMismatches:
       case PRIMME_stats_volumeGlobalSum:
       case PRIMME_stats_numBroadcast:
       case PRIMME_stats_volumeBroadcast:
@@ -1551,6 +2101,10 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_printLevel:
       case PRIMME_ldevecs:
       case PRIMME_ldOPs:
+      case PRIMME_memoryArena:
+      case PRIMME_checkpointInterval:
+      case PRIMME_checkpointRequest:
+      case PRIMME_dynamicBlockSize:
       case PRIMME_monitorFun_type:
       case PRIMME_convTestFun_type:
       if (type) *type = primme_int;
@@ -1601,6 +2155,8 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_commInfo:
       case PRIMME_globalSumReal:
       case PRIMME_broadcastReal:
+      case PRIMME_globalSumRealStart:
+      case PRIMME_globalSumRealWait:
       case PRIMME_massMatrixMatvec:
       case PRIMME_outputFile:
       case PRIMME_matrix:
@@ -1611,11 +2167,16 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_monitorFun:
       case PRIMME_monitor:
       case PRIMME_queue:
+      case PRIMME_profileTable:
       if (type) *type = primme_pointer;
       if (arity) *arity = 1;
       break;
 
       case PRIMME_profile:
+      case PRIMME_basisStorageDir:
+      case PRIMME_checkpointFile:
+      case PRIMME_traceFile:
+      case PRIMME_tuningFile:
       if (type) *type = primme_string;
       if (arity) *arity = 1;
       break;
@@ -1704,6 +2265,7 @@ int primme_constant_info(const char* label_name, int *value) {
    IF_IS(primme_orth_default);
    IF_IS(primme_orth_explicit_I);
    IF_IS(primme_orth_implicit_I);
+   IF_IS(primme_orth_lowsync);
 
    /* enum member from op_datatype */
    IF_IS(primme_op_default);   
@@ -1712,6 +2274,7 @@ int primme_constant_info(const char* label_name, int *value) {
    IF_IS(primme_op_float);
    IF_IS(primme_op_half);
    IF_IS(primme_op_int);
+   IF_IS(primme_op_auto);
 #undef IF_IS
 
    /* return error if label not found */
@@ -1810,6 +2373,7 @@ int primme_enum_member_info(
    IF_IS(primme_orth_default);
    IF_IS(primme_orth_explicit_I);
    IF_IS(primme_orth_implicit_I);
+   IF_IS(primme_orth_lowsync);
    break;
 
    case PRIMME_matrixMatvec_type:
@@ -1116,7 +1116,7 @@ STATIC int restart_locking_Sprimme(int *restartSize, SCALAR *V, SCALAR *W,
 
    /* Update H */
 
-   if (primme->orth == primme_orth_explicit_I) {
+   if (primme->orth != primme_orth_implicit_I) {
       CHKERR(Num_copy_matrix_columns_SHprimme(&H[left * ldH], left + numPacked,
             ifailed, failed, ldH, &H[left * ldH], NULL, ldH, ctx));
       CHKERR(Num_copy_matrix_rows_SHprimme(H + left, ifailed, failed,
@@ -1249,7 +1249,26 @@ int Num_aux_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV,
    primme_params *primme = ctx.primme;
    int i;         /* Loop variables */
 
-   CHKERR(Num_update_VWXR_Sprimme(
+   /* Start updating VtBV(0:evecsSize-1,evecsSize:) = VtBV(...)*h. It only */
+   /* needs VtBV and h, so the broadcast progresses while V, W and BV are  */
+   /* updated.                                                             */
+
+   HSCALAR *work = NULL;
+   primme_reduction r;
+   if (VtBV) {
+      assert(nVtBV == nX0e - nX0b);
+      CHKERR(Num_malloc_SHprimme((nX0e - nX0b) * evecsSize, &work, ctx));
+      if (ctx.procID == 0) {
+         Num_zero_matrix_SHprimme(work, evecsSize, nX0e - nX0b, evecsSize, ctx);
+         CHKERR(Num_gemm_SHprimme("N", "N", evecsSize, nX0e - nX0b, nV, 1.0,
+               &VtBV[evecsSize * ldVtBV], ldVtBV, h, ldh, 0.0, work, evecsSize,
+               ctx));
+      }
+      CHKERR(broadcastStart_SHprimme(
+            work, evecsSize * (nX0e - nX0b), &r, ctx));
+   }
+
+   CHKERRSUM(Num_update_VWXR_Sprimme(
             V, W, BV, mV, nV, ldV, h, nh, ldh, hVals,
             X0, nX0b, nX0e, ldX0,
             X1, nX1b, nX1e, ldX1,
@@ -1261,9 +1280,9 @@ int Num_aux_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV,
             Bevecs?&Bevecs[ldBevecs*BevecsSize]:NULL, nBX2b, nBX2e, ldBevecs,
             rnorms, nrb, nre,
             VtBV?&VtBV[evecsSize*ldVtBV+evecsSize]:NULL, nVtBV, ldVtBV,
-            KIND(primme->orth == primme_orth_explicit_I,1)?H:NULL, nH, ldH,
+            KIND(primme->orth != primme_orth_implicit_I,1)?H:NULL, nH, ldH,
             NULL, 0, 0,
-            ctx));
+            ctx), &r, VtBV ? 1 : 0);
 
    /* Don't trust residual norm smaller than the error in the residual norm */
 
@@ -1274,16 +1293,7 @@ int Num_aux_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV,
    /* Update VtBV */
 
    if (VtBV) {
-      HSCALAR *work;
-      assert(nVtBV == nX0e - nX0b);
-      CHKERR(Num_malloc_SHprimme((nX0e - nX0b) * evecsSize, &work, ctx));
-      if (ctx.procID == 0) {
-         Num_zero_matrix_SHprimme(work, evecsSize, nX0e - nX0b, evecsSize, ctx);
-         CHKERR(Num_gemm_SHprimme("N", "N", evecsSize, nX0e - nX0b, nV, 1.0,
-               &VtBV[evecsSize * ldVtBV], ldVtBV, h, ldh, 0.0, work, evecsSize,
-               ctx));
-      }
-      CHKERR(broadcast_SHprimme(work, evecsSize * (nX0e - nX0b), ctx));
+      CHKERR(globalSumWait_Tprimme(&r, ctx));
       CHKERR(Num_copy_matrix_SHprimme(work, evecsSize, nX0e - nX0b, evecsSize,
             &VtBV[evecsSize * ldVtBV], ldVtBV, ctx));
       CHKERR(Num_free_SHprimme(work, ctx));
@@ -1110,6 +1110,297 @@ int compute_residual_columnszprimme(PRIMME_INT m, dummy_type_dprimme *evals, dum
       dummy_type_zprimme *xo, dummy_type_zprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_zprimme *ro,
       PRIMME_INT ldro, dummy_type_zprimme *xd, dummy_type_zprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_zprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int restart_dh_sprimme(dummy_type_dh_sprimme *V, dummy_type_dh_sprimme *W, dummy_type_dh_sprimme *BV, PRIMME_INT nLocal,
+      int basisSize, PRIMME_INT ldV, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals, int *flags,
+      int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_dh_sprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_sprimme *Bevecs, PRIMME_INT ldBevecs, int *evecsPerm,
+      dummy_type_dprimme *evals, dummy_type_dprimme *resNorms, dummy_type_dh_sprimme *evecsHat, PRIMME_INT ldevecsHat,
+      dummy_type_dprimme *M, int ldM, dummy_type_dprimme *Mfact, int ldMfact, int *ipivot,
+      int *numConverged, int *numLocked, int *lockedFlags,
+      int *numConvergedStored, dummy_type_dprimme *prevhVecs, int nprevhVecs,
+      int ldprevhVecs, int numGuesses, dummy_type_dprimme *prevRitzVals,
+      int *numPrevRitzVals, dummy_type_dprimme *H, int ldH, dummy_type_dprimme *VtBV, int ldVtBV,
+      dummy_type_dprimme *fVtBV, int ldfVtBV, dummy_type_dh_sprimme *Q, PRIMME_INT ldQ, dummy_type_dprimme *R,
+      int ldR, dummy_type_dprimme *QtV, int ldQtV, dummy_type_dprimme *QtQ, int ldQtQ, dummy_type_dprimme *fQtQ,
+      int ldfQtQ, dummy_type_dprimme *hU, int ldhU, int newldhU, dummy_type_dprimme *hVecs,
+      int ldhVecs, int newldhVecs, int *restartSizeOutput,
+      int *targetShiftIndex, int *numArbitraryVecs, dummy_type_dprimme *hVecsRot,
+      int ldhVecsRot, int *restartsSinceReset, double startTime,
+      primme_context ctx);
+int restart_soft_locking_Sprimmedh_sprimme(int *restartSize, dummy_type_dh_sprimme *V, dummy_type_dh_sprimme *W,
+      dummy_type_dh_sprimme *BV, PRIMME_INT nLocal, int basisSize, PRIMME_INT ldV,
+      dummy_type_dprimme *hVecs, int ldhVecs, int *restartPerm, dummy_type_dprimme *hVals, int *flags,
+      int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_dh_sprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evals,
+      dummy_type_dprimme *resNorms, int *numConverged, int numPrevRetained,
+      int *indexOfPreviousVecs, int *hVecsPerm, dummy_type_dprimme *H, int ldH,
+      dummy_type_dprimme *VtBV, int ldVtBV, primme_context ctx);
+int restart_locking_Sprimmedh_sprimme(int *restartSize, dummy_type_dh_sprimme *V, dummy_type_dh_sprimme *W,
+      dummy_type_dh_sprimme *BV, PRIMME_INT nLocal, int basisSize, PRIMME_INT ldV,
+      dummy_type_dprimme *hVecs, int ldhVecs, int *restartPerm, dummy_type_dprimme *hVals, int *flags,
+      int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_dh_sprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evals,
+      int *numConverged, int *numLocked, dummy_type_dprimme *resNorms, int *lockedFlags,
+      int *evecsperm, int numPrevRetained, int *indexOfPreviousVecs,
+      int *hVecsPerm, dummy_type_dprimme *H, int ldH, dummy_type_dprimme *VtBV, int ldVtBV,
+      double startTime, primme_context ctx);
+int Num_aux_update_VWXR_dh_sprimme(dummy_type_dh_sprimme *V, dummy_type_dh_sprimme *W, dummy_type_dh_sprimme *BV,
+   PRIMME_INT mV, int nV, PRIMME_INT ldV,
+   dummy_type_dprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
+   dummy_type_dh_sprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+   dummy_type_dh_sprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+   dummy_type_dh_sprimme *evecs, int evecsSize, int nX2b, int nX2e, PRIMME_INT ldevecs,
+   dummy_type_dh_sprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+   dummy_type_dh_sprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+   dummy_type_dh_sprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+   dummy_type_dh_sprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+   dummy_type_dh_sprimme *Bevecs, int BevecsSize, int nBX2b, int nBX2e, PRIMME_INT ldBevecs,
+   dummy_type_dprimme *rnorms, int nrb, int nre,
+   dummy_type_dprimme *VtBV, int nVtBV, int ldVtBV,
+   dummy_type_dprimme *H, int nH, int ldH,
+   primme_context ctx);
+int restart_projection_Sprimmedh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dh_sprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *H, int ldH,
+      dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dh_sprimme *Q, PRIMME_INT ldQ, PRIMME_INT nLocal,
+      dummy_type_dprimme *R, int ldR, dummy_type_dprimme *QtV, int ldQtV, dummy_type_dprimme *QtQ, int ldQtQ,
+      dummy_type_dprimme *fQtQ, int ldfQtQ, dummy_type_dprimme *hU, int ldhU, int newldhU,
+      int indexOfPreviousVecsBeforeRestart, dummy_type_dprimme *hVecs, int ldhVecs,
+      int newldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals, int *restartPerm,
+      int *hVecsPerm, int restartSize, int basisSize, int numPrevRetained,
+      int indexOfPreviousVecs, dummy_type_dh_sprimme *evecs, int *evecsSize,
+      PRIMME_INT ldevecs, dummy_type_dh_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dh_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *M, int ldM, dummy_type_dprimme *Mfact, int ldMfact,
+      int *ipivot, int *targetShiftIndex, int numConverged,
+      int *numArbitraryVecs, dummy_type_dprimme *hVecsRot, int ldhVecsRot,
+      primme_context ctx);
+int restart_RRdh_sprimme(dummy_type_dprimme *H, int ldH, dummy_type_dprimme *VtBV, int ldVtBV,
+      dummy_type_dprimme *hVecs, int ldhVecs, int newldhVecs, dummy_type_dprimme *hVals, int restartSize,
+      int basisSize, int numConverged, int numPrevRetained,
+      int indexOfPreviousVecs, int *hVecsPerm, int *targetShiftIndex,
+      primme_context ctx);
+int restart_refineddh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dh_sprimme *W, PRIMME_INT ldW,
+      dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *H, int ldH, dummy_type_dh_sprimme *Q,
+      PRIMME_INT ldQ, PRIMME_INT nLocal, dummy_type_dprimme *R, int ldR, dummy_type_dprimme *QtQ,
+      int ldQtQ, dummy_type_dprimme *fQtQ, int ldfQtQ, dummy_type_dprimme *VtBV, int ldVtBV,
+      dummy_type_dprimme *hU, int ldhU, int newldhU, int indexOfPreviousVecsBeforeRestart,
+      dummy_type_dprimme *hVecs, int ldhVecs, int newldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
+      int *restartPerm, int *hVecsPerm, int restartSize, int basisSize,
+      int numPrevRetained, int indexOfPreviousVecs, int *targetShiftIndex,
+      int numConverged, int *numArbitraryVecs, dummy_type_dprimme *hVecsRot,
+      int ldhVecsRot, primme_context ctx);
+int restart_harmonicdh_sprimme(dummy_type_dh_sprimme *V, PRIMME_INT ldV, dummy_type_dh_sprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_sprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *H, int ldH,
+      dummy_type_dh_sprimme *Q, PRIMME_INT ldQ, PRIMME_INT nLocal, dummy_type_dprimme *R, int ldR,
+      dummy_type_dprimme *QtV, int ldQtV, dummy_type_dprimme *QtQ, int ldQtQ, dummy_type_dprimme *fQtQ,
+      int ldfQtQ, dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *hU, int ldhU, int newldhU,
+      dummy_type_dprimme *hVecs, int ldhVecs, int newldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
+      int *restartPerm, int *hVecsPerm, int restartSize, int basisSize,
+      int numPrevRetained, int indexOfPreviousVecs, int *targetShiftIndex,
+      int numConverged, int *numArbitraryVecs, dummy_type_dprimme *hVecsRot,
+      int ldhVecsRot, primme_context ctx);
+int ortho_coefficient_vectors_Sprimmedh_sprimme(dummy_type_dprimme *hVecs, int basisSize,
+      int ldhVecs, int indexOfPreviousVecs, dummy_type_dprimme *VtBV, int ldVtBV,
+      dummy_type_dprimme *prevhVecs, int nprevhVecs, int ldprevhVecs, int *flags,
+      int *numPrevRetained, primme_context ctx);
+int compute_residual_columnsdh_sprimme(PRIMME_INT m, dummy_type_dprimme *evals, dummy_type_dh_sprimme *x,
+      dummy_type_dh_sprimme *Bx, int n, int *p, PRIMME_INT ldx, dummy_type_dh_sprimme *Ax, PRIMME_INT ldAx,
+      dummy_type_dh_sprimme *xo, dummy_type_dh_sprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_dh_sprimme *ro,
+      PRIMME_INT ldro, dummy_type_dh_sprimme *xd, dummy_type_dh_sprimme *Bxd, int nd, int *pd,
+      PRIMME_INT ldxd, dummy_type_dh_sprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int restart_dh_cprimme_normal(dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV, PRIMME_INT nLocal,
+      int basisSize, PRIMME_INT ldV, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals, int *flags,
+      int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_dh_cprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, int *evecsPerm,
+      dummy_type_zprimme *evals, dummy_type_dprimme *resNorms, dummy_type_dh_cprimme *evecsHat, PRIMME_INT ldevecsHat,
+      dummy_type_zprimme *M, int ldM, dummy_type_zprimme *Mfact, int ldMfact, int *ipivot,
+      int *numConverged, int *numLocked, int *lockedFlags,
+      int *numConvergedStored, dummy_type_zprimme *prevhVecs, int nprevhVecs,
+      int ldprevhVecs, int numGuesses, dummy_type_zprimme *prevRitzVals,
+      int *numPrevRitzVals, dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      dummy_type_zprimme *fVtBV, int ldfVtBV, dummy_type_dh_cprimme *Q, PRIMME_INT ldQ, dummy_type_zprimme *R,
+      int ldR, dummy_type_zprimme *QtV, int ldQtV, dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ,
+      int ldfQtQ, dummy_type_zprimme *hU, int ldhU, int newldhU, dummy_type_zprimme *hVecs,
+      int ldhVecs, int newldhVecs, int *restartSizeOutput,
+      int *targetShiftIndex, int *numArbitraryVecs, dummy_type_zprimme *hVecsRot,
+      int ldhVecsRot, int *restartsSinceReset, double startTime,
+      primme_context ctx);
+int restart_soft_locking_Sprimmedh_cprimme_normal(int *restartSize, dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W,
+      dummy_type_dh_cprimme *BV, PRIMME_INT nLocal, int basisSize, PRIMME_INT ldV,
+      dummy_type_zprimme *hVecs, int ldhVecs, int *restartPerm, dummy_type_zprimme *hVals, int *flags,
+      int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_dh_cprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evals,
+      dummy_type_dprimme *resNorms, int *numConverged, int numPrevRetained,
+      int *indexOfPreviousVecs, int *hVecsPerm, dummy_type_zprimme *H, int ldH,
+      dummy_type_zprimme *VtBV, int ldVtBV, primme_context ctx);
+int restart_locking_Sprimmedh_cprimme_normal(int *restartSize, dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W,
+      dummy_type_dh_cprimme *BV, PRIMME_INT nLocal, int basisSize, PRIMME_INT ldV,
+      dummy_type_zprimme *hVecs, int ldhVecs, int *restartPerm, dummy_type_zprimme *hVals, int *flags,
+      int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_dh_cprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evals,
+      int *numConverged, int *numLocked, dummy_type_dprimme *resNorms, int *lockedFlags,
+      int *evecsperm, int numPrevRetained, int *indexOfPreviousVecs,
+      int *hVecsPerm, dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      double startTime, primme_context ctx);
+int Num_aux_update_VWXR_dh_cprimme_normal(dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV,
+   PRIMME_INT mV, int nV, PRIMME_INT ldV,
+   dummy_type_zprimme *h, int nh, int ldh, dummy_type_zprimme *hVals,
+   dummy_type_dh_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+   dummy_type_dh_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+   dummy_type_dh_cprimme *evecs, int evecsSize, int nX2b, int nX2e, PRIMME_INT ldevecs,
+   dummy_type_dh_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+   dummy_type_dh_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+   dummy_type_dh_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+   dummy_type_dh_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+   dummy_type_dh_cprimme *Bevecs, int BevecsSize, int nBX2b, int nBX2e, PRIMME_INT ldBevecs,
+   dummy_type_dprimme *rnorms, int nrb, int nre,
+   dummy_type_zprimme *VtBV, int nVtBV, int ldVtBV,
+   dummy_type_zprimme *H, int nH, int ldH,
+   primme_context ctx);
+int restart_projection_Sprimmedh_cprimme_normal(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *H, int ldH,
+      dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_dh_cprimme *Q, PRIMME_INT ldQ, PRIMME_INT nLocal,
+      dummy_type_zprimme *R, int ldR, dummy_type_zprimme *QtV, int ldQtV, dummy_type_zprimme *QtQ, int ldQtQ,
+      dummy_type_zprimme *fQtQ, int ldfQtQ, dummy_type_zprimme *hU, int ldhU, int newldhU,
+      int indexOfPreviousVecsBeforeRestart, dummy_type_zprimme *hVecs, int ldhVecs,
+      int newldhVecs, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals, int *restartPerm,
+      int *hVecsPerm, int restartSize, int basisSize, int numPrevRetained,
+      int indexOfPreviousVecs, dummy_type_dh_cprimme *evecs, int *evecsSize,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dh_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, int ldM, dummy_type_zprimme *Mfact, int ldMfact,
+      int *ipivot, int *targetShiftIndex, int numConverged,
+      int *numArbitraryVecs, dummy_type_zprimme *hVecsRot, int ldhVecsRot,
+      primme_context ctx);
+int restart_RRdh_cprimme_normal(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      dummy_type_zprimme *hVecs, int ldhVecs, int newldhVecs, dummy_type_zprimme *hVals, int restartSize,
+      int basisSize, int numConverged, int numPrevRetained,
+      int indexOfPreviousVecs, int *hVecsPerm, int *targetShiftIndex,
+      primme_context ctx);
+int restart_refineddh_cprimme_normal(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W, PRIMME_INT ldW,
+      dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *H, int ldH, dummy_type_dh_cprimme *Q,
+      PRIMME_INT ldQ, PRIMME_INT nLocal, dummy_type_zprimme *R, int ldR, dummy_type_zprimme *QtQ,
+      int ldQtQ, dummy_type_zprimme *fQtQ, int ldfQtQ, dummy_type_zprimme *VtBV, int ldVtBV,
+      dummy_type_zprimme *hU, int ldhU, int newldhU, int indexOfPreviousVecsBeforeRestart,
+      dummy_type_zprimme *hVecs, int ldhVecs, int newldhVecs, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals,
+      int *restartPerm, int *hVecsPerm, int restartSize, int basisSize,
+      int numPrevRetained, int indexOfPreviousVecs, int *targetShiftIndex,
+      int numConverged, int *numArbitraryVecs, dummy_type_zprimme *hVecsRot,
+      int ldhVecsRot, primme_context ctx);
+int restart_harmonicdh_cprimme_normal(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *H, int ldH,
+      dummy_type_dh_cprimme *Q, PRIMME_INT ldQ, PRIMME_INT nLocal, dummy_type_zprimme *R, int ldR,
+      dummy_type_zprimme *QtV, int ldQtV, dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ,
+      int ldfQtQ, dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *hU, int ldhU, int newldhU,
+      dummy_type_zprimme *hVecs, int ldhVecs, int newldhVecs, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals,
+      int *restartPerm, int *hVecsPerm, int restartSize, int basisSize,
+      int numPrevRetained, int indexOfPreviousVecs, int *targetShiftIndex,
+      int numConverged, int *numArbitraryVecs, dummy_type_zprimme *hVecsRot,
+      int ldhVecsRot, primme_context ctx);
+int ortho_coefficient_vectors_Sprimmedh_cprimme_normal(dummy_type_zprimme *hVecs, int basisSize,
+      int ldhVecs, int indexOfPreviousVecs, dummy_type_zprimme *VtBV, int ldVtBV,
+      dummy_type_zprimme *prevhVecs, int nprevhVecs, int ldprevhVecs, int *flags,
+      int *numPrevRetained, primme_context ctx);
+int compute_residual_columnsdh_cprimme_normal(PRIMME_INT m, dummy_type_zprimme *evals, dummy_type_dh_cprimme *x,
+      dummy_type_dh_cprimme *Bx, int n, int *p, PRIMME_INT ldx, dummy_type_dh_cprimme *Ax, PRIMME_INT ldAx,
+      dummy_type_dh_cprimme *xo, dummy_type_dh_cprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_dh_cprimme *ro,
+      PRIMME_INT ldro, dummy_type_dh_cprimme *xd, dummy_type_dh_cprimme *Bxd, int nd, int *pd,
+      PRIMME_INT ldxd, dummy_type_dh_cprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int restart_dh_cprimme(dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV, PRIMME_INT nLocal,
+      int basisSize, PRIMME_INT ldV, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals, int *flags,
+      int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_dh_cprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, int *evecsPerm,
+      dummy_type_dprimme *evals, dummy_type_dprimme *resNorms, dummy_type_dh_cprimme *evecsHat, PRIMME_INT ldevecsHat,
+      dummy_type_zprimme *M, int ldM, dummy_type_zprimme *Mfact, int ldMfact, int *ipivot,
+      int *numConverged, int *numLocked, int *lockedFlags,
+      int *numConvergedStored, dummy_type_zprimme *prevhVecs, int nprevhVecs,
+      int ldprevhVecs, int numGuesses, dummy_type_dprimme *prevRitzVals,
+      int *numPrevRitzVals, dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      dummy_type_zprimme *fVtBV, int ldfVtBV, dummy_type_dh_cprimme *Q, PRIMME_INT ldQ, dummy_type_zprimme *R,
+      int ldR, dummy_type_zprimme *QtV, int ldQtV, dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ,
+      int ldfQtQ, dummy_type_zprimme *hU, int ldhU, int newldhU, dummy_type_zprimme *hVecs,
+      int ldhVecs, int newldhVecs, int *restartSizeOutput,
+      int *targetShiftIndex, int *numArbitraryVecs, dummy_type_zprimme *hVecsRot,
+      int ldhVecsRot, int *restartsSinceReset, double startTime,
+      primme_context ctx);
+int restart_soft_locking_Sprimmedh_cprimme(int *restartSize, dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W,
+      dummy_type_dh_cprimme *BV, PRIMME_INT nLocal, int basisSize, PRIMME_INT ldV,
+      dummy_type_zprimme *hVecs, int ldhVecs, int *restartPerm, dummy_type_dprimme *hVals, int *flags,
+      int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_dh_cprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evals,
+      dummy_type_dprimme *resNorms, int *numConverged, int numPrevRetained,
+      int *indexOfPreviousVecs, int *hVecsPerm, dummy_type_zprimme *H, int ldH,
+      dummy_type_zprimme *VtBV, int ldVtBV, primme_context ctx);
+int restart_locking_Sprimmedh_cprimme(int *restartSize, dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W,
+      dummy_type_dh_cprimme *BV, PRIMME_INT nLocal, int basisSize, PRIMME_INT ldV,
+      dummy_type_zprimme *hVecs, int ldhVecs, int *restartPerm, dummy_type_dprimme *hVals, int *flags,
+      int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_dh_cprimme *evecs,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evals,
+      int *numConverged, int *numLocked, dummy_type_dprimme *resNorms, int *lockedFlags,
+      int *evecsperm, int numPrevRetained, int *indexOfPreviousVecs,
+      int *hVecsPerm, dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      double startTime, primme_context ctx);
+int Num_aux_update_VWXR_dh_cprimme(dummy_type_dh_cprimme *V, dummy_type_dh_cprimme *W, dummy_type_dh_cprimme *BV,
+   PRIMME_INT mV, int nV, PRIMME_INT ldV,
+   dummy_type_zprimme *h, int nh, int ldh, dummy_type_dprimme *hVals,
+   dummy_type_dh_cprimme *X0, int nX0b, int nX0e, PRIMME_INT ldX0,
+   dummy_type_dh_cprimme *X1, int nX1b, int nX1e, PRIMME_INT ldX1,
+   dummy_type_dh_cprimme *evecs, int evecsSize, int nX2b, int nX2e, PRIMME_INT ldevecs,
+   dummy_type_dh_cprimme *Wo, int nWob, int nWoe, PRIMME_INT ldWo,
+   dummy_type_dh_cprimme *R, int nRb, int nRe, PRIMME_INT ldR, dummy_type_dprimme *Rnorms,
+   dummy_type_dh_cprimme *BX0, int nBX0b, int nBX0e, PRIMME_INT ldBX0,
+   dummy_type_dh_cprimme *BX1, int nBX1b, int nBX1e, PRIMME_INT ldBX1,
+   dummy_type_dh_cprimme *Bevecs, int BevecsSize, int nBX2b, int nBX2e, PRIMME_INT ldBevecs,
+   dummy_type_dprimme *rnorms, int nrb, int nre,
+   dummy_type_zprimme *VtBV, int nVtBV, int ldVtBV,
+   dummy_type_zprimme *H, int nH, int ldH,
+   primme_context ctx);
+int restart_projection_Sprimmedh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *H, int ldH,
+      dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_dh_cprimme *Q, PRIMME_INT ldQ, PRIMME_INT nLocal,
+      dummy_type_zprimme *R, int ldR, dummy_type_zprimme *QtV, int ldQtV, dummy_type_zprimme *QtQ, int ldQtQ,
+      dummy_type_zprimme *fQtQ, int ldfQtQ, dummy_type_zprimme *hU, int ldhU, int newldhU,
+      int indexOfPreviousVecsBeforeRestart, dummy_type_zprimme *hVecs, int ldhVecs,
+      int newldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals, int *restartPerm,
+      int *hVecsPerm, int restartSize, int basisSize, int numPrevRetained,
+      int indexOfPreviousVecs, dummy_type_dh_cprimme *evecs, int *evecsSize,
+      PRIMME_INT ldevecs, dummy_type_dh_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dh_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, int ldM, dummy_type_zprimme *Mfact, int ldMfact,
+      int *ipivot, int *targetShiftIndex, int numConverged,
+      int *numArbitraryVecs, dummy_type_zprimme *hVecsRot, int ldhVecsRot,
+      primme_context ctx);
+int restart_RRdh_cprimme(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      dummy_type_zprimme *hVecs, int ldhVecs, int newldhVecs, dummy_type_dprimme *hVals, int restartSize,
+      int basisSize, int numConverged, int numPrevRetained,
+      int indexOfPreviousVecs, int *hVecsPerm, int *targetShiftIndex,
+      primme_context ctx);
+int restart_refineddh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W, PRIMME_INT ldW,
+      dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *H, int ldH, dummy_type_dh_cprimme *Q,
+      PRIMME_INT ldQ, PRIMME_INT nLocal, dummy_type_zprimme *R, int ldR, dummy_type_zprimme *QtQ,
+      int ldQtQ, dummy_type_zprimme *fQtQ, int ldfQtQ, dummy_type_zprimme *VtBV, int ldVtBV,
+      dummy_type_zprimme *hU, int ldhU, int newldhU, int indexOfPreviousVecsBeforeRestart,
+      dummy_type_zprimme *hVecs, int ldhVecs, int newldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
+      int *restartPerm, int *hVecsPerm, int restartSize, int basisSize,
+      int numPrevRetained, int indexOfPreviousVecs, int *targetShiftIndex,
+      int numConverged, int *numArbitraryVecs, dummy_type_zprimme *hVecsRot,
+      int ldhVecsRot, primme_context ctx);
+int restart_harmonicdh_cprimme(dummy_type_dh_cprimme *V, PRIMME_INT ldV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *H, int ldH,
+      dummy_type_dh_cprimme *Q, PRIMME_INT ldQ, PRIMME_INT nLocal, dummy_type_zprimme *R, int ldR,
+      dummy_type_zprimme *QtV, int ldQtV, dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ,
+      int ldfQtQ, dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *hU, int ldhU, int newldhU,
+      dummy_type_zprimme *hVecs, int ldhVecs, int newldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
+      int *restartPerm, int *hVecsPerm, int restartSize, int basisSize,
+      int numPrevRetained, int indexOfPreviousVecs, int *targetShiftIndex,
+      int numConverged, int *numArbitraryVecs, dummy_type_zprimme *hVecsRot,
+      int ldhVecsRot, primme_context ctx);
+int ortho_coefficient_vectors_Sprimmedh_cprimme(dummy_type_zprimme *hVecs, int basisSize,
+      int ldhVecs, int indexOfPreviousVecs, dummy_type_zprimme *VtBV, int ldVtBV,
+      dummy_type_zprimme *prevhVecs, int nprevhVecs, int ldprevhVecs, int *flags,
+      int *numPrevRetained, primme_context ctx);
+int compute_residual_columnsdh_cprimme(PRIMME_INT m, dummy_type_dprimme *evals, dummy_type_dh_cprimme *x,
+      dummy_type_dh_cprimme *Bx, int n, int *p, PRIMME_INT ldx, dummy_type_dh_cprimme *Ax, PRIMME_INT ldAx,
+      dummy_type_dh_cprimme *xo, dummy_type_dh_cprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_dh_cprimme *ro,
+      PRIMME_INT ldro, dummy_type_dh_cprimme *xd, dummy_type_dh_cprimme *Bxd, int nd, int *pd,
+      PRIMME_INT ldxd, dummy_type_dh_cprimme *rd, PRIMME_INT ldrd, primme_context ctx);
 int restart_magma_hprimme(dummy_type_magma_hprimme *V, dummy_type_magma_hprimme *W, dummy_type_magma_hprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_magma_hprimme *evecs,
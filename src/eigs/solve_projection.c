@@ -52,7 +52,7 @@
 
 #ifdef SUPPORTED_TYPE
 
-#if defined(USE_HOST) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF))
+#if defined(USE_HOST) && defined(BLASLAPACK_WITH_SCALAR)
 
 /*******************************************************************************
  * Subroutine solve_H - This procedure solves the project problem and return
@@ -101,9 +101,13 @@ int solve_H_Sprimme(SCALAR *H, int basisSize, int ldH, SCALAR *VtBV, int ldVtBV,
 
    /* In parallel (especially with heterogeneous processors/libraries) ensure */
    /* that every process has the same hVecs and hU. Only processor 0 solves   */
-   /* the projected problem and broadcasts the resulting matrices to the rest */
+   /* the projected problem and broadcasts the resulting matrices to the rest,*/
+   /* unless the user guarantees that all processes compute the same values.  */
 
-   if (ctx.primme->procID == 0) {
+   int replicated = ctx.primme->projectionParams.replicatedSolve;
+   double t0 = primme_wTimer();
+
+   if (ctx.primme->procID == 0 || replicated) {
       switch (ctx.primme->projectionParams.projection) {
          case primme_proj_RR:
             CHKERR(solve_H_RR_Sprimme(H, ldH, VtBV, ldVtBV, hVecs, ldhVecs,
@@ -127,10 +131,19 @@ int solve_H_Sprimme(SCALAR *H, int basisSize, int ldH, SCALAR *VtBV, int ldVtBV,
       }
    }
 
-   /* Broadcast hVecs, hU, hVals, hSVals */
+   /* Broadcast hVecs, hU, hVals and hSVals from process 0, unless every */
+   /* process solved the problem and all got the same solution           */
 
-   CHKERR(solve_H_brcast_Sprimme(basisSize, hU, ldhU, hVecs, ldhVecs, hVals,
-            hSVals, ctx));
+   int same = 0;
+   if (replicated) {
+      CHKERR(solve_H_check_Sprimme(basisSize, basisSize, hU, ldhU, hVecs,
+               ldhVecs, hVals, hSVals, &same, ctx));
+   }
+   if (!same) {
+      CHKERR(solve_H_brcast_Sprimme(basisSize, hU, ldhU, hVecs, ldhVecs, hVals,
+               hSVals, ctx));
+   }
+   Trace_span("projected solve", t0, ctx.trace);
  
    /* Return memory requirements */
 
@@ -386,6 +399,144 @@ int solve_H_RR_Sprimme(SCALAR *H, int ldH, SCALAR *VtBV, int ldVtBV,
 #endif /* USE_HERMITIAN */
 }
 
+/*******************************************************************************
+ * Subroutine solve_H_RR_partial - Compute only the Ritz pairs il:iu-1 of the
+ *       Rayleigh-Ritz projected problem, for primme.target being
+ *       primme_smallest or primme_largest. In both cases the pairs in the
+ *       target order are the eigenpairs of H (or -H) in ascending order, and
+ *       XHEEVX/XHEGVX compute just that index range. The rest of hVecs and
+ *       hVals is untouched, but hVals(iu:basisSize-1) is set to hVals(iu-1),
+ *       which bounds the values not computed yet.
+ *
+ *       Calling first with il=0 and later with il being the previous iu
+ *       completes the solution. The columns il:iu-1 are orthogonalized
+ *       against the previous ones, in case a cluster falls across il.
+ *        
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * H              The matrix V'*A*V
+ * ldH            The leading dimension of H
+ * VtBV           The matrix V'*B*V
+ * ldVtBV         The leading dimension of VtBV
+ * basisSize      The dimension of H
+ * il, iu         The range of pairs to compute
+ * 
+ * INPUT/OUTPUT ARRAYS
+ * -------------------
+ * hVecs          Columns il:iu-1 are the computed eigenvectors of H
+ * ldhVecs        The leading dimension of hVecs
+ * hVals          Values il:iu-1 are the computed eigenvalues of H
+ *
+ * Return Value
+ * ------------
+ * error code                          
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int solve_H_RR_partial_Sprimme(SCALAR *H, int ldH, SCALAR *VtBV, int ldVtBV,
+      SCALAR *hVecs, int ldhVecs, EVAL *hVals, int basisSize, int il, int iu,
+      primme_context ctx) {
+
+#ifdef USE_HERMITIAN
+   primme_params *primme = ctx.primme;
+   int i, j;
+
+   assert(primme->target == primme_smallest ||
+          primme->target == primme_largest);
+
+   iu = min(iu, basisSize);
+   if (il >= iu) return 0;
+
+   int replicated = primme->projectionParams.replicatedSolve;
+   double t0 = primme_wTimer();
+
+   if (primme->procID == 0 || replicated) {
+      /* Copy the upper triangular part of H, or -H if largest */
+
+      SCALAR *T;
+      CHKERR(Num_malloc_Sprimme(basisSize * basisSize, &T, ctx));
+      if (primme->target != primme_largest) {
+         CHKERR(Num_copy_trimatrix_Sprimme(H, basisSize, basisSize, ldH,
+               0 /* upper part */, 0, T, basisSize, 0));
+      } else {
+         for (j = 0; j < basisSize; j++) {
+            for (i = 0; i <= j; i++) T[basisSize * j + i] = -H[ldH * j + i];
+         }
+      }
+
+      /* Num_hegvx may use the whole w as workspace, but hVals(il:end) */
+      /* can be shorter than basisSize                                  */
+
+      REAL *w;
+      CHKERR(Num_malloc_Rprimme(basisSize, &w, ctx));
+      CHKERR(Num_hegvx_Sprimme("V", "U", basisSize, T, basisSize, VtBV,
+            ldVtBV, il, iu, w, ctx));
+      CHKERR(Num_copy_matrix_Sprimme(T, basisSize, iu - il, basisSize,
+            &hVecs[ldhVecs * il], ldhVecs, ctx));
+      CHKERR(Num_free_Sprimme(T, ctx));
+
+      /* XHEEVX/XHEGVX only orthogonalize the vectors of a cluster computed */
+      /* in the same call. If a cluster falls across il, the new columns    */
+      /* may not be orthogonal to the previous ones, so orthogonalize them  */
+
+      if (il > 0) {
+         CHKERR(Bortho_local_SHprimme(hVecs, ldhVecs, NULL, 0, il, iu - 1,
+               NULL, 0, 0, basisSize, VtBV, ldVtBV, primme->iseed, ctx));
+      }
+
+      for (i = il; i < iu; i++) {
+         hVals[i] = primme->target == primme_largest ? -w[i - il] : w[i - il];
+      }
+      CHKERR(Num_free_Rprimme(w, ctx));
+   }
+
+   /* Broadcast the computed columns and values from process 0, unless  */
+   /* every process solved the problem and all got the same solution    */
+
+   int same = 0;
+   if (replicated) {
+      CHKERR(solve_H_check_Sprimme(basisSize, iu - il, NULL, 0,
+            &hVecs[ldhVecs * il], ldhVecs, &hVals[il], NULL, &same, ctx));
+   }
+   if (!same) {
+      CHKERR(broadcast_Sprimme(&hVecs[ldhVecs * il],
+            ldhVecs * (iu - il - 1) + basisSize, ctx));
+      CHKERR(broadcast_Rprimme(&hVals[il], iu - il, ctx));
+   }
+   Trace_span("projected solve", t0, ctx.trace);
+
+   for (i = iu; i < basisSize; i++) hVals[i] = hVals[iu - 1];
+
+   /* Update the leftmost and rightmost Ritz values ever seen */
+
+   for (i = il; i < iu; i++) {
+      primme->stats.estimateMinEVal =
+            min(primme->stats.estimateMinEVal, hVals[i]);
+      primme->stats.estimateMaxEVal =
+            max(primme->stats.estimateMaxEVal, hVals[i]);
+      primme->stats.estimateLargestSVal =
+            max(primme->stats.estimateLargestSVal, fabs(hVals[i]));
+   }
+
+   return 0;
+#else
+   (void)H;
+   (void)ldH;
+   (void)VtBV;
+   (void)ldVtBV;
+   (void)hVecs;
+   (void)ldhVecs;
+   (void)hVals;
+   (void)basisSize;
+   (void)il;
+   (void)iu;
+   (void)ctx;
+
+   CHKERR(PRIMME_FUNCTION_UNAVAILABLE);
+   return 0;
+#endif /* USE_HERMITIAN */
+}
+
 /*******************************************************************************
  * Subroutine solve_H_Harm - This procedure implements the harmonic extraction
  *    in a novelty way. In standard harmonic the next eigenproblem is solved:
@@ -775,6 +926,71 @@ STATIC int solve_H_brcast_Sprimme(int basisSize, SCALAR *hU, int ldhU,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine solve_H_check - Check whether all processes have the same
+ *       solution of the projected problem when it is solved on every process
+ *       (see projectionParams.replicatedSolve). It hashes the bits of the
+ *       arrays and compares the hash with the one of process 0. If some
+ *       process differs, the caller broadcasts the solution of process 0.
+ * 
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * m              The number of rows of hVecs and hU
+ * n              The number of columns of hVecs and hU and the size of hVals
+ *                and hSVals
+ * hU             The left singular vectors of R or the eigenvectors of QtV/R
+ * ldhU           The leading dimension of hU
+ * hVecs          The coefficient vectors such as V*hVecs will be the Ritz vectors
+ * ldhVecs        The leading dimension of hVecs
+ * hVals          The Ritz values
+ * hSVals         The singular values of R
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * same           1 if all processes have the same solution, 0 otherwise
+ *
+ * Return Value
+ * ------------
+ * error code                          
+ ******************************************************************************/
+
+STATIC int solve_H_check_Sprimme(int m, int n, SCALAR *hU, int ldhU,
+      SCALAR *hVecs, int ldhVecs, EVAL *hVals, REAL *hSVals, int *same,
+      primme_context ctx) {
+
+   uint32_t hash = 5381;
+   int i;
+
+   *same = 1;
+   if (ctx.numProcs <= 1) return 0;
+
+   for (i = 0; hVecs && i < n; i++) {
+      hash = hash_buffer(hash, &hVecs[ldhVecs * i], sizeof(SCALAR) * m);
+   }
+   for (i = 0; hU && i < n; i++) {
+      hash = hash_buffer(hash, &hU[ldhU * i], sizeof(SCALAR) * m);
+   }
+   if (hVals) hash = hash_buffer(hash, hVals, sizeof(EVAL) * n);
+   if (hSVals) hash = hash_buffer(hash, hSVals, sizeof(REAL) * n);
+
+   /* Send the hash in halves of 16 bits, exact in float and double */
+
+   REAL h[2] = {(REAL)(hash >> 16), (REAL)(hash & 0xFFFFu)};
+   REAL h0[2] = {h[0], h[1]};
+   CHKERR(broadcast_Rprimme(h0, 2, ctx));
+   REAL differ = (h[0] != h0[0] || h[1] != h0[1]) ? 1.0 : 0.0;
+   CHKERR(globalSum_Rprimme(&differ, 1, ctx));
+   *same = (differ == 0.0);
+
+   if (!*same) {
+      ctx.primme->stats.numReplicatedMismatches++;
+      PRINTF(2, "Processes solved the projected problem differently; "
+                "broadcasting the solution of process 0");
+   }
+
+   return 0;
+}
+
 /*******************************************************************************
  * Function prepare_vecs - This subroutine checks that the
  *    conditioning of the coefficient vectors are good enough to converge
@@ -1063,6 +1279,6 @@ int map_vecs_Sprimme(HSCALAR *V, int m, int nV, int ldV, HSCALAR *W, int n0,
    return 0;
 }
 
-#endif /* defined(USE_HOST) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)) */
+#endif /* defined(USE_HOST) && defined(BLASLAPACK_WITH_SCALAR) */
 
 #endif /* SUPPORTED_TYPE */
@@ -220,6 +220,99 @@ int solve_H_dprimme(dummy_type_dprimme *H, int basisSize, int ldH, dummy_type_dp
 int solve_H_RR_dprimme(dummy_type_dprimme *H, int ldH, dummy_type_dprimme *VtBV, int ldVtBV,
       dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int basisSize, int numConverged,
       primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_Sprimme)
+#  define solve_H_RR_partial_Sprimme CONCAT(solve_H_RR_partial_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_Rprimme)
+#  define solve_H_RR_partial_Rprimme CONCAT(solve_H_RR_partial_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_SHprimme)
+#  define solve_H_RR_partial_SHprimme CONCAT(solve_H_RR_partial_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_RHprimme)
+#  define solve_H_RR_partial_RHprimme CONCAT(solve_H_RR_partial_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_SXprimme)
+#  define solve_H_RR_partial_SXprimme CONCAT(solve_H_RR_partial_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_RXprimme)
+#  define solve_H_RR_partial_RXprimme CONCAT(solve_H_RR_partial_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_Shprimme)
+#  define solve_H_RR_partial_Shprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_Rhprimme)
+#  define solve_H_RR_partial_Rhprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_Ssprimme)
+#  define solve_H_RR_partial_Ssprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_Rsprimme)
+#  define solve_H_RR_partial_Rsprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_Sdprimme)
+#  define solve_H_RR_partial_Sdprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_Rdprimme)
+#  define solve_H_RR_partial_Rdprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_Sqprimme)
+#  define solve_H_RR_partial_Sqprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_Rqprimme)
+#  define solve_H_RR_partial_Rqprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_SXhprimme)
+#  define solve_H_RR_partial_SXhprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_RXhprimme)
+#  define solve_H_RR_partial_RXhprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_SXsprimme)
+#  define solve_H_RR_partial_SXsprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_RXsprimme)
+#  define solve_H_RR_partial_RXsprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_SXdprimme)
+#  define solve_H_RR_partial_SXdprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_RXdprimme)
+#  define solve_H_RR_partial_RXdprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_SXqprimme)
+#  define solve_H_RR_partial_SXqprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_RXqprimme)
+#  define solve_H_RR_partial_RXqprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_SHhprimme)
+#  define solve_H_RR_partial_SHhprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_RHhprimme)
+#  define solve_H_RR_partial_RHhprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_SHsprimme)
+#  define solve_H_RR_partial_SHsprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_RHsprimme)
+#  define solve_H_RR_partial_RHsprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_SHdprimme)
+#  define solve_H_RR_partial_SHdprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_RHdprimme)
+#  define solve_H_RR_partial_RHdprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_SHqprimme)
+#  define solve_H_RR_partial_SHqprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_partial_RHqprimme)
+#  define solve_H_RR_partial_RHqprimme CONCAT(solve_H_RR_partial_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int solve_H_RR_partial_dprimme(dummy_type_dprimme *H, int ldH, dummy_type_dprimme *VtBV, int ldVtBV,
+      dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int basisSize, int il, int iu,
+      primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(solve_H_Harm_Sprimme)
 #  define solve_H_Harm_Sprimme CONCAT(solve_H_Harm_Sprimme,WITH_KIND(SCALAR_SUF))
 #endif
@@ -240,6 +333,12 @@ int solve_H_Ref_Sprimmedprimme(dummy_type_dprimme *H, int ldH, dummy_type_dprimm
 int solve_H_brcast_Sprimmedprimme(int basisSize, dummy_type_dprimme *hU, int ldhU,
                                   dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals,
                                   dummy_type_dprimme *hSVals, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_check_Sprimme)
+#  define solve_H_check_Sprimme CONCAT(solve_H_check_Sprimme,WITH_KIND(SCALAR_SUF))
+#endif
+int solve_H_check_Sprimmedprimme(int m, int n, dummy_type_dprimme *hU, int ldhU,
+      dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals, int *same,
+      primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_Sprimme)
 #  define prepare_vecs_Sprimme CONCAT(prepare_vecs_,WITH_KIND(SCALAR_SUF))
 #endif
@@ -434,6 +533,9 @@ int solve_H_sprimme(dummy_type_sprimme *H, int basisSize, int ldH, dummy_type_sp
 int solve_H_RR_sprimme(dummy_type_sprimme *H, int ldH, dummy_type_sprimme *VtBV, int ldVtBV,
       dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int basisSize, int numConverged,
       primme_context ctx);
+int solve_H_RR_partial_sprimme(dummy_type_sprimme *H, int ldH, dummy_type_sprimme *VtBV, int ldVtBV,
+      dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int basisSize, int il, int iu,
+      primme_context ctx);
 int solve_H_Harm_Sprimmesprimme(dummy_type_sprimme *H, int ldH, dummy_type_sprimme *QtV, int ldQtV,
       dummy_type_sprimme *R, int ldR, dummy_type_sprimme *QtQ, int ldQtQ, dummy_type_sprimme *VtBV, int ldVtBV,
       dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hU, int ldhU, dummy_type_sprimme *hVals,
@@ -445,6 +547,9 @@ int solve_H_Ref_Sprimmesprimme(dummy_type_sprimme *H, int ldH, dummy_type_sprimm
 int solve_H_brcast_Sprimmesprimme(int basisSize, dummy_type_sprimme *hU, int ldhU,
                                   dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals,
                                   dummy_type_sprimme *hSVals, primme_context ctx);
+int solve_H_check_Sprimmesprimme(int m, int n, dummy_type_sprimme *hU, int ldhU,
+      dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *same,
+      primme_context ctx);
 int prepare_vecs_sprimme(int basisSize, int i0, int blockSize, dummy_type_sprimme *H,
       int ldH, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, dummy_type_sprimme *hVecs, int ldhVecs,
       int targetShiftIndex, int *arbitraryVecs, double smallestResNorm,
@@ -459,6 +564,9 @@ int solve_H_cprimme_normal(dummy_type_cprimme *H, int basisSize, int ldH, dummy_
 int solve_H_RR_cprimme_normal(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
       dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, int basisSize, int numConverged,
       primme_context ctx);
+int solve_H_RR_partial_cprimme_normal(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, int basisSize, int il, int iu,
+      primme_context ctx);
 int solve_H_Harm_Sprimmecprimme_normal(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *QtV, int ldQtV,
       dummy_type_cprimme *R, int ldR, dummy_type_cprimme *QtQ, int ldQtQ, dummy_type_cprimme *VtBV, int ldVtBV,
       dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hU, int ldhU, dummy_type_cprimme *hVals,
@@ -470,6 +578,9 @@ int solve_H_Ref_Sprimmecprimme_normal(dummy_type_cprimme *H, int ldH, dummy_type
 int solve_H_brcast_Sprimmecprimme_normal(int basisSize, dummy_type_cprimme *hU, int ldhU,
                                   dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals,
                                   dummy_type_sprimme *hSVals, primme_context ctx);
+int solve_H_check_Sprimmecprimme_normal(int m, int n, dummy_type_cprimme *hU, int ldhU,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals, int *same,
+      primme_context ctx);
 int prepare_vecs_cprimme_normal(int basisSize, int i0, int blockSize, dummy_type_cprimme *H,
       int ldH, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals, dummy_type_cprimme *hVecs, int ldhVecs,
       int targetShiftIndex, int *arbitraryVecs, double smallestResNorm,
@@ -484,6 +595,9 @@ int solve_H_cprimme(dummy_type_cprimme *H, int basisSize, int ldH, dummy_type_cp
 int solve_H_RR_cprimme(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
       dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int basisSize, int numConverged,
       primme_context ctx);
+int solve_H_RR_partial_cprimme(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int basisSize, int il, int iu,
+      primme_context ctx);
 int solve_H_Harm_Sprimmecprimme(dummy_type_cprimme *H, int ldH, dummy_type_cprimme *QtV, int ldQtV,
       dummy_type_cprimme *R, int ldR, dummy_type_cprimme *QtQ, int ldQtQ, dummy_type_cprimme *VtBV, int ldVtBV,
       dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hU, int ldhU, dummy_type_sprimme *hVals,
@@ -495,6 +609,9 @@ int solve_H_Ref_Sprimmecprimme(dummy_type_cprimme *H, int ldH, dummy_type_cprimm
 int solve_H_brcast_Sprimmecprimme(int basisSize, dummy_type_cprimme *hU, int ldhU,
                                   dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals,
                                   dummy_type_sprimme *hSVals, primme_context ctx);
+int solve_H_check_Sprimmecprimme(int m, int n, dummy_type_cprimme *hU, int ldhU,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *same,
+      primme_context ctx);
 int prepare_vecs_cprimme(int basisSize, int i0, int blockSize, dummy_type_cprimme *H,
       int ldH, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, dummy_type_cprimme *hVecs, int ldhVecs,
       int targetShiftIndex, int *arbitraryVecs, double smallestResNorm,
@@ -509,6 +626,9 @@ int solve_H_zprimme_normal(dummy_type_zprimme *H, int basisSize, int ldH, dummy_
 int solve_H_RR_zprimme_normal(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
       dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, int basisSize, int numConverged,
       primme_context ctx);
+int solve_H_RR_partial_zprimme_normal(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, int basisSize, int il, int iu,
+      primme_context ctx);
 int solve_H_Harm_Sprimmezprimme_normal(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *QtV, int ldQtV,
       dummy_type_zprimme *R, int ldR, dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *VtBV, int ldVtBV,
       dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hU, int ldhU, dummy_type_zprimme *hVals,
@@ -520,6 +640,9 @@ int solve_H_Ref_Sprimmezprimme_normal(dummy_type_zprimme *H, int ldH, dummy_type
 int solve_H_brcast_Sprimmezprimme_normal(int basisSize, dummy_type_zprimme *hU, int ldhU,
                                   dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals,
                                   dummy_type_dprimme *hSVals, primme_context ctx);
+int solve_H_check_Sprimmezprimme_normal(int m, int n, dummy_type_zprimme *hU, int ldhU,
+      dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals, int *same,
+      primme_context ctx);
 int prepare_vecs_zprimme_normal(int basisSize, int i0, int blockSize, dummy_type_zprimme *H,
       int ldH, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals, dummy_type_zprimme *hVecs, int ldhVecs,
       int targetShiftIndex, int *arbitraryVecs, double smallestResNorm,
@@ -534,6 +657,9 @@ int solve_H_zprimme(dummy_type_zprimme *H, int basisSize, int ldH, dummy_type_zp
 int solve_H_RR_zprimme(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
       dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int basisSize, int numConverged,
       primme_context ctx);
+int solve_H_RR_partial_zprimme(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
+      dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int basisSize, int il, int iu,
+      primme_context ctx);
 int solve_H_Harm_Sprimmezprimme(dummy_type_zprimme *H, int ldH, dummy_type_zprimme *QtV, int ldQtV,
       dummy_type_zprimme *R, int ldR, dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *VtBV, int ldVtBV,
       dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hU, int ldhU, dummy_type_dprimme *hVals,
@@ -545,6 +671,9 @@ int solve_H_Ref_Sprimmezprimme(dummy_type_zprimme *H, int ldH, dummy_type_zprimm
 int solve_H_brcast_Sprimmezprimme(int basisSize, dummy_type_zprimme *hU, int ldhU,
                                   dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals,
                                   dummy_type_dprimme *hSVals, primme_context ctx);
+int solve_H_check_Sprimmezprimme(int m, int n, dummy_type_zprimme *hU, int ldhU,
+      dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals, int *same,
+      primme_context ctx);
 int prepare_vecs_zprimme(int basisSize, int i0, int blockSize, dummy_type_zprimme *H,
       int ldH, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals, dummy_type_zprimme *hVecs, int ldhVecs,
       int targetShiftIndex, int *arbitraryVecs, double smallestResNorm,
@@ -159,6 +159,18 @@ int update_Q_zprimme(dummy_type_zprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV,
       PRIMME_INT ldW, dummy_type_zprimme *Q, PRIMME_INT ldQ, dummy_type_zprimme *R, int ldR,
       dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_dh_sprimme(dummy_type_dh_sprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_dh_sprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_sprimme *Q, PRIMME_INT ldQ, dummy_type_dprimme *R, int ldR,
+      dummy_type_dprimme *QtQ, int ldQtQ, dummy_type_dprimme *fQtQ, int ldfQtQ, double targetShift,
+      int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_dh_cprimme_normal(dummy_type_dh_cprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *Q, PRIMME_INT ldQ, dummy_type_zprimme *R, int ldR,
+      dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ, int ldfQtQ, double targetShift,
+      int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_dh_cprimme(dummy_type_dh_cprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_dh_cprimme *W,
+      PRIMME_INT ldW, dummy_type_dh_cprimme *Q, PRIMME_INT ldQ, dummy_type_zprimme *R, int ldR,
+      dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ, int ldfQtQ, double targetShift,
+      int basisSize, int blockSize, int *nQ, primme_context ctx);
 int update_Q_magma_hprimme(dummy_type_magma_hprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_magma_hprimme *W,
       PRIMME_INT ldW, dummy_type_magma_hprimme *Q, PRIMME_INT ldQ, dummy_type_sprimme *R, int ldR,
       dummy_type_sprimme *QtQ, int ldQtQ, dummy_type_sprimme *fQtQ, int ldfQtQ, double targetShift,
@@ -115,10 +115,26 @@ int update_projection_Sprimme(SCALAR *X, PRIMME_INT ldX, SCALAR *Y,
    }
    */
 
+   /* If the reductions can be overlapped with other work, start reducing  */
+   /* Z(:,numCols:end) before computing Z(numCols:end,:)                    */
+
+   int split = !isSymmetric && GLOBALSUM_ASYNC(ctx);
+   HSCALAR *rwork = NULL;
+   primme_reduction r[2]; /* reductions of Z(:,numCols:end) and the rest */
+   if (split) {
+      CHKERR(Num_malloc_SHprimme(m * blockSize + blockSize * numCols, &rwork,
+            ctx));
+      Num_copy_matrix_SHprimme(&Z[ldZ*numCols], m, blockSize, ldZ,
+            rwork, m, ctx);
+      CHKERR(globalSumStart_SHprimme(rwork, m * blockSize, &r[0], ctx));
+   }
+
    if (!isSymmetric) {
       Num_zero_matrix_SHprimme(&Z[numCols], blockSize, numCols, ldZ, ctx);
-      CHKERR(Num_gemm_ddh_Sprimme("C", "N", blockSize, numCols, nLocal, 1.0,
-            &X[ldX * numCols], ldX, Y, ldY, 0.0, &Z[numCols], ldZ, ctx));
+      CHKERRSUM(Num_gemm_ddh_Sprimme("C", "N", blockSize, numCols, nLocal,
+                      1.0, &X[ldX * numCols], ldX, Y, ldY, 0.0, &Z[numCols],
+                      ldZ, ctx),
+            r, split ? 1 : 0);
    }
 
    if (primme->numProcs > 1 && isSymmetric) {
@@ -144,15 +160,24 @@ int update_projection_Sprimme(SCALAR *X, PRIMME_INT ldX, SCALAR *Y,
       /* Reduce Z(:,numCols:end) and Z(numCols:end,:).                         */
       /* --------------------------------------------------------------------- */
 
-      HSCALAR *rwork;
       int count = m * blockSize + blockSize * numCols;
-      CHKERR(Num_malloc_SHprimme(count, &rwork, ctx));
-      Num_copy_matrix_SHprimme(&Z[ldZ*numCols], m, blockSize, ldZ,
-            rwork, m, ctx);
+      if (!split) {
+         CHKERR(Num_malloc_SHprimme(count, &rwork, ctx));
+         Num_copy_matrix_SHprimme(&Z[ldZ*numCols], m, blockSize, ldZ,
+               rwork, m, ctx);
+      }
       Num_copy_matrix_SHprimme(&Z[numCols], blockSize, numCols, ldZ,
             &rwork[m*blockSize], blockSize, ctx);
 
-      CHKERR(globalSum_SHprimme(rwork, count, ctx));
+      if (split) {
+         CHKERRSUM(globalSumStart_SHprimme(&rwork[m * blockSize],
+                         blockSize * numCols, &r[1], ctx),
+               r, 1);
+         CHKERRSUM(globalSumWait_Tprimme(&r[0], ctx), r, 2);
+         CHKERRSUM(globalSumWait_Tprimme(&r[1], ctx), &r[1], 1);
+      } else {
+         CHKERR(globalSum_SHprimme(rwork, count, ctx));
+      }
 
       Num_copy_matrix_SHprimme(rwork, m, blockSize, m, &Z[ldZ*numCols],
             ldZ, ctx);
@@ -141,6 +141,12 @@ int update_projection_cprimme(dummy_type_cprimme *X, PRIMME_INT ldX, dummy_type_
 int update_projection_zprimme(dummy_type_zprimme *X, PRIMME_INT ldX, dummy_type_zprimme *Y,
       PRIMME_INT ldY, dummy_type_zprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_dh_sprimme(dummy_type_dh_sprimme *X, PRIMME_INT ldX, dummy_type_dh_sprimme *Y,
+      PRIMME_INT ldY, dummy_type_dprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_dh_cprimme(dummy_type_dh_cprimme *X, PRIMME_INT ldX, dummy_type_dh_cprimme *Y,
+      PRIMME_INT ldY, dummy_type_zprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
 int update_projection_magma_hprimme(dummy_type_magma_hprimme *X, PRIMME_INT ldX, dummy_type_magma_hprimme *Y,
       PRIMME_INT ldY, dummy_type_sprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
@@ -219,6 +219,280 @@ int Num_matrix_astype_dprimme(void *x, PRIMME_INT m, PRIMME_INT n,
 int Num_matrix_astype_iprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_Sprimme)
+#  define Num_malloc_mapped_Sprimme CONCAT(Num_malloc_mapped_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_Rprimme)
+#  define Num_malloc_mapped_Rprimme CONCAT(Num_malloc_mapped_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_SHprimme)
+#  define Num_malloc_mapped_SHprimme CONCAT(Num_malloc_mapped_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_RHprimme)
+#  define Num_malloc_mapped_RHprimme CONCAT(Num_malloc_mapped_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_SXprimme)
+#  define Num_malloc_mapped_SXprimme CONCAT(Num_malloc_mapped_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_RXprimme)
+#  define Num_malloc_mapped_RXprimme CONCAT(Num_malloc_mapped_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_Shprimme)
+#  define Num_malloc_mapped_Shprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_Rhprimme)
+#  define Num_malloc_mapped_Rhprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_Ssprimme)
+#  define Num_malloc_mapped_Ssprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_Rsprimme)
+#  define Num_malloc_mapped_Rsprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_Sdprimme)
+#  define Num_malloc_mapped_Sdprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_Rdprimme)
+#  define Num_malloc_mapped_Rdprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_Sqprimme)
+#  define Num_malloc_mapped_Sqprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_Rqprimme)
+#  define Num_malloc_mapped_Rqprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_SXhprimme)
+#  define Num_malloc_mapped_SXhprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_RXhprimme)
+#  define Num_malloc_mapped_RXhprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_SXsprimme)
+#  define Num_malloc_mapped_SXsprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_RXsprimme)
+#  define Num_malloc_mapped_RXsprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_SXdprimme)
+#  define Num_malloc_mapped_SXdprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_RXdprimme)
+#  define Num_malloc_mapped_RXdprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_SXqprimme)
+#  define Num_malloc_mapped_SXqprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_RXqprimme)
+#  define Num_malloc_mapped_RXqprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_SHhprimme)
+#  define Num_malloc_mapped_SHhprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_RHhprimme)
+#  define Num_malloc_mapped_RHhprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_SHsprimme)
+#  define Num_malloc_mapped_SHsprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_RHsprimme)
+#  define Num_malloc_mapped_RHsprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_SHdprimme)
+#  define Num_malloc_mapped_SHdprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_RHdprimme)
+#  define Num_malloc_mapped_RHdprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_SHqprimme)
+#  define Num_malloc_mapped_SHqprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_malloc_mapped_RHqprimme)
+#  define Num_malloc_mapped_RHqprimme CONCAT(Num_malloc_mapped_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Num_malloc_mapped_dprimme(PRIMME_INT n, dummy_type_dprimme **x, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_Sprimme)
+#  define Num_free_mapped_Sprimme CONCAT(Num_free_mapped_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_Rprimme)
+#  define Num_free_mapped_Rprimme CONCAT(Num_free_mapped_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_SHprimme)
+#  define Num_free_mapped_SHprimme CONCAT(Num_free_mapped_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_RHprimme)
+#  define Num_free_mapped_RHprimme CONCAT(Num_free_mapped_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_SXprimme)
+#  define Num_free_mapped_SXprimme CONCAT(Num_free_mapped_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_RXprimme)
+#  define Num_free_mapped_RXprimme CONCAT(Num_free_mapped_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_Shprimme)
+#  define Num_free_mapped_Shprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_Rhprimme)
+#  define Num_free_mapped_Rhprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_Ssprimme)
+#  define Num_free_mapped_Ssprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_Rsprimme)
+#  define Num_free_mapped_Rsprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_Sdprimme)
+#  define Num_free_mapped_Sdprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_Rdprimme)
+#  define Num_free_mapped_Rdprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_Sqprimme)
+#  define Num_free_mapped_Sqprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_Rqprimme)
+#  define Num_free_mapped_Rqprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_SXhprimme)
+#  define Num_free_mapped_SXhprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_RXhprimme)
+#  define Num_free_mapped_RXhprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_SXsprimme)
+#  define Num_free_mapped_SXsprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_RXsprimme)
+#  define Num_free_mapped_RXsprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_SXdprimme)
+#  define Num_free_mapped_SXdprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_RXdprimme)
+#  define Num_free_mapped_RXdprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_SXqprimme)
+#  define Num_free_mapped_SXqprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_RXqprimme)
+#  define Num_free_mapped_RXqprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_SHhprimme)
+#  define Num_free_mapped_SHhprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_RHhprimme)
+#  define Num_free_mapped_RHhprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_SHsprimme)
+#  define Num_free_mapped_SHsprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_RHsprimme)
+#  define Num_free_mapped_RHsprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_SHdprimme)
+#  define Num_free_mapped_SHdprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_RHdprimme)
+#  define Num_free_mapped_RHdprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_SHqprimme)
+#  define Num_free_mapped_SHqprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_free_mapped_RHqprimme)
+#  define Num_free_mapped_RHqprimme CONCAT(Num_free_mapped_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Num_free_mapped_dprimme(dummy_type_dprimme *x, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_Sprimme)
+#  define Num_prefetch_matrix_Sprimme CONCAT(Num_prefetch_matrix_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_Rprimme)
+#  define Num_prefetch_matrix_Rprimme CONCAT(Num_prefetch_matrix_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_SHprimme)
+#  define Num_prefetch_matrix_SHprimme CONCAT(Num_prefetch_matrix_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_RHprimme)
+#  define Num_prefetch_matrix_RHprimme CONCAT(Num_prefetch_matrix_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_SXprimme)
+#  define Num_prefetch_matrix_SXprimme CONCAT(Num_prefetch_matrix_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_RXprimme)
+#  define Num_prefetch_matrix_RXprimme CONCAT(Num_prefetch_matrix_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_Shprimme)
+#  define Num_prefetch_matrix_Shprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_Rhprimme)
+#  define Num_prefetch_matrix_Rhprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_Ssprimme)
+#  define Num_prefetch_matrix_Ssprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_Rsprimme)
+#  define Num_prefetch_matrix_Rsprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_Sdprimme)
+#  define Num_prefetch_matrix_Sdprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_Rdprimme)
+#  define Num_prefetch_matrix_Rdprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_Sqprimme)
+#  define Num_prefetch_matrix_Sqprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_Rqprimme)
+#  define Num_prefetch_matrix_Rqprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_SXhprimme)
+#  define Num_prefetch_matrix_SXhprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_RXhprimme)
+#  define Num_prefetch_matrix_RXhprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_SXsprimme)
+#  define Num_prefetch_matrix_SXsprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_RXsprimme)
+#  define Num_prefetch_matrix_RXsprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_SXdprimme)
+#  define Num_prefetch_matrix_SXdprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_RXdprimme)
+#  define Num_prefetch_matrix_RXdprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_SXqprimme)
+#  define Num_prefetch_matrix_SXqprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_RXqprimme)
+#  define Num_prefetch_matrix_RXqprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_SHhprimme)
+#  define Num_prefetch_matrix_SHhprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_RHhprimme)
+#  define Num_prefetch_matrix_RHhprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_SHsprimme)
+#  define Num_prefetch_matrix_SHsprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_RHsprimme)
+#  define Num_prefetch_matrix_RHsprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_SHdprimme)
+#  define Num_prefetch_matrix_SHdprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_RHdprimme)
+#  define Num_prefetch_matrix_RHdprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_SHqprimme)
+#  define Num_prefetch_matrix_SHqprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_prefetch_matrix_RHqprimme)
+#  define Num_prefetch_matrix_RHqprimme CONCAT(Num_prefetch_matrix_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Num_prefetch_matrix_dprimme(dummy_type_dprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(Num_copy_matrix_astype_Sprimme)
 #  define Num_copy_matrix_astype_Sprimme CONCAT(Num_copy_matrix_astype_,SCALAR_SUF)
 #endif
@@ -1047,6 +1321,291 @@ int Num_copy_compact_trimatrix_dprimme(dummy_type_dprimme *x, PRIMME_INT m, int
 #endif
 int compute_submatrix_dprimme(dummy_type_dprimme *X, int nX, int ldX, dummy_type_dprimme *H, int nH,
       int ldH, int isherm, dummy_type_dprimme *R, int ldR, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_Sprimme)
+#  define Num_csrmm_Sprimme CONCAT(Num_csrmm_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_Rprimme)
+#  define Num_csrmm_Rprimme CONCAT(Num_csrmm_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_SHprimme)
+#  define Num_csrmm_SHprimme CONCAT(Num_csrmm_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_RHprimme)
+#  define Num_csrmm_RHprimme CONCAT(Num_csrmm_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_SXprimme)
+#  define Num_csrmm_SXprimme CONCAT(Num_csrmm_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_RXprimme)
+#  define Num_csrmm_RXprimme CONCAT(Num_csrmm_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_Shprimme)
+#  define Num_csrmm_Shprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_Rhprimme)
+#  define Num_csrmm_Rhprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_Ssprimme)
+#  define Num_csrmm_Ssprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_Rsprimme)
+#  define Num_csrmm_Rsprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_Sdprimme)
+#  define Num_csrmm_Sdprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_Rdprimme)
+#  define Num_csrmm_Rdprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_Sqprimme)
+#  define Num_csrmm_Sqprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_Rqprimme)
+#  define Num_csrmm_Rqprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_SXhprimme)
+#  define Num_csrmm_SXhprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_RXhprimme)
+#  define Num_csrmm_RXhprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_SXsprimme)
+#  define Num_csrmm_SXsprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_RXsprimme)
+#  define Num_csrmm_RXsprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_SXdprimme)
+#  define Num_csrmm_SXdprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_RXdprimme)
+#  define Num_csrmm_RXdprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_SXqprimme)
+#  define Num_csrmm_SXqprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_RXqprimme)
+#  define Num_csrmm_RXqprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_SHhprimme)
+#  define Num_csrmm_SHhprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_RHhprimme)
+#  define Num_csrmm_RHhprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_SHsprimme)
+#  define Num_csrmm_SHsprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_RHsprimme)
+#  define Num_csrmm_RHsprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_SHdprimme)
+#  define Num_csrmm_SHdprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_RHdprimme)
+#  define Num_csrmm_RHdprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_SHqprimme)
+#  define Num_csrmm_SHqprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_RHqprimme)
+#  define Num_csrmm_RHqprimme CONCAT(Num_csrmm_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Num_csrmm_dprimme(int trans, PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const dummy_type_dprimme *a, int base, int nx, dummy_type_dprimme *x,
+      PRIMME_INT ldx, dummy_type_dprimme *y, PRIMME_INT ldy);
+#if !defined(CHECK_TEMPLATE) && !defined(csrmm_normal_rows_Sprimme)
+#  define csrmm_normal_rows_Sprimme CONCAT(csrmm_normal_rows_Sprimme,SCALAR_SUF)
+#endif
+void csrmm_normal_rows_Sprimmedprimme(PRIMME_INT i0, PRIMME_INT i1,
+      PRIMME_INT n, const int *ia, const int *ja, const dummy_type_dprimme *a, int base,
+      int nx, dummy_type_dprimme *x, PRIMME_INT ldx, dummy_type_dprimme *y, PRIMME_INT ldy);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_Sprimme)
+#  define Num_csrmm_normal_Sprimme CONCAT(Num_csrmm_normal_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_Rprimme)
+#  define Num_csrmm_normal_Rprimme CONCAT(Num_csrmm_normal_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_SHprimme)
+#  define Num_csrmm_normal_SHprimme CONCAT(Num_csrmm_normal_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_RHprimme)
+#  define Num_csrmm_normal_RHprimme CONCAT(Num_csrmm_normal_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_SXprimme)
+#  define Num_csrmm_normal_SXprimme CONCAT(Num_csrmm_normal_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_RXprimme)
+#  define Num_csrmm_normal_RXprimme CONCAT(Num_csrmm_normal_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_Shprimme)
+#  define Num_csrmm_normal_Shprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_Rhprimme)
+#  define Num_csrmm_normal_Rhprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_Ssprimme)
+#  define Num_csrmm_normal_Ssprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_Rsprimme)
+#  define Num_csrmm_normal_Rsprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_Sdprimme)
+#  define Num_csrmm_normal_Sdprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_Rdprimme)
+#  define Num_csrmm_normal_Rdprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_Sqprimme)
+#  define Num_csrmm_normal_Sqprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_Rqprimme)
+#  define Num_csrmm_normal_Rqprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_SXhprimme)
+#  define Num_csrmm_normal_SXhprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_RXhprimme)
+#  define Num_csrmm_normal_RXhprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_SXsprimme)
+#  define Num_csrmm_normal_SXsprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_RXsprimme)
+#  define Num_csrmm_normal_RXsprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_SXdprimme)
+#  define Num_csrmm_normal_SXdprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_RXdprimme)
+#  define Num_csrmm_normal_RXdprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_SXqprimme)
+#  define Num_csrmm_normal_SXqprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_RXqprimme)
+#  define Num_csrmm_normal_RXqprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_SHhprimme)
+#  define Num_csrmm_normal_SHhprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_RHhprimme)
+#  define Num_csrmm_normal_RHhprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_SHsprimme)
+#  define Num_csrmm_normal_SHsprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_RHsprimme)
+#  define Num_csrmm_normal_RHsprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_SHdprimme)
+#  define Num_csrmm_normal_SHdprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_RHdprimme)
+#  define Num_csrmm_normal_RHdprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_SHqprimme)
+#  define Num_csrmm_normal_SHqprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_csrmm_normal_RHqprimme)
+#  define Num_csrmm_normal_RHqprimme CONCAT(Num_csrmm_normal_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Num_csrmm_normal_dprimme(PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const dummy_type_dprimme *a, int base, int nx, dummy_type_dprimme *x,
+      PRIMME_INT ldx, dummy_type_dprimme *y, PRIMME_INT ldy, dummy_type_dprimme *work, size_t lwork);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_Sprimme)
+#  define Num_sellmm_Sprimme CONCAT(Num_sellmm_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_Rprimme)
+#  define Num_sellmm_Rprimme CONCAT(Num_sellmm_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_SHprimme)
+#  define Num_sellmm_SHprimme CONCAT(Num_sellmm_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_RHprimme)
+#  define Num_sellmm_RHprimme CONCAT(Num_sellmm_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_SXprimme)
+#  define Num_sellmm_SXprimme CONCAT(Num_sellmm_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_RXprimme)
+#  define Num_sellmm_RXprimme CONCAT(Num_sellmm_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_Shprimme)
+#  define Num_sellmm_Shprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_Rhprimme)
+#  define Num_sellmm_Rhprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_Ssprimme)
+#  define Num_sellmm_Ssprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_Rsprimme)
+#  define Num_sellmm_Rsprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_Sdprimme)
+#  define Num_sellmm_Sdprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_Rdprimme)
+#  define Num_sellmm_Rdprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_Sqprimme)
+#  define Num_sellmm_Sqprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_Rqprimme)
+#  define Num_sellmm_Rqprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_SXhprimme)
+#  define Num_sellmm_SXhprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_RXhprimme)
+#  define Num_sellmm_RXhprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_SXsprimme)
+#  define Num_sellmm_SXsprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_RXsprimme)
+#  define Num_sellmm_RXsprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_SXdprimme)
+#  define Num_sellmm_SXdprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_RXdprimme)
+#  define Num_sellmm_RXdprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_SXqprimme)
+#  define Num_sellmm_SXqprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_RXqprimme)
+#  define Num_sellmm_RXqprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_SHhprimme)
+#  define Num_sellmm_SHhprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_RHhprimme)
+#  define Num_sellmm_RHhprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_SHsprimme)
+#  define Num_sellmm_SHsprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_RHsprimme)
+#  define Num_sellmm_RHsprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_SHdprimme)
+#  define Num_sellmm_SHdprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_RHdprimme)
+#  define Num_sellmm_RHdprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_SHqprimme)
+#  define Num_sellmm_SHqprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_sellmm_RHqprimme)
+#  define Num_sellmm_RHqprimme CONCAT(Num_sellmm_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Num_sellmm_dprimme(PRIMME_INT m, int C, const PRIMME_INT *cptr,
+      const int *clen, const int *ccol, const dummy_type_dprimme *cval, const int *perm,
+      int nx, dummy_type_dprimme *x, PRIMME_INT ldx, dummy_type_dprimme *y, PRIMME_INT ldy);
 #if !defined(CHECK_TEMPLATE) && !defined(Num_copy_matrix_columns_Sprimme)
 #  define Num_copy_matrix_columns_Sprimme CONCAT(Num_copy_matrix_columns_,SCALAR_SUF)
 #endif
@@ -1604,6 +2163,10 @@ int Num_scale_matrix_dprimme(dummy_type_dprimme *x, PRIMME_INT m, PRIMME_INT n,
 int Num_matrix_astype_hprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_hprimme(PRIMME_INT n, dummy_type_hprimme **x, primme_context ctx);
+int Num_free_mapped_hprimme(dummy_type_hprimme *x, primme_context ctx);
+int Num_prefetch_matrix_hprimme(dummy_type_hprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_hprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -1634,6 +2197,10 @@ int Num_scale_matrix_hprimme(dummy_type_hprimme *x, PRIMME_INT m, PRIMME_INT n,
 int Num_matrix_astype_kprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_kprimme(PRIMME_INT n, dummy_type_kprimme **x, primme_context ctx);
+int Num_free_mapped_kprimme(dummy_type_kprimme *x, primme_context ctx);
+int Num_prefetch_matrix_kprimme(dummy_type_kprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_kprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -1662,6 +2229,10 @@ int Num_scale_matrix_kprimme(dummy_type_kprimme *x, PRIMME_INT m, PRIMME_INT n,
 int Num_matrix_astype_sprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_sprimme(PRIMME_INT n, dummy_type_sprimme **x, primme_context ctx);
+int Num_free_mapped_sprimme(dummy_type_sprimme *x, primme_context ctx);
+int Num_prefetch_matrix_sprimme(dummy_type_sprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_sprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -1678,6 +2249,18 @@ int Num_copy_compact_trimatrix_sprimme(dummy_type_sprimme *x, PRIMME_INT m, int
       dummy_type_sprimme *y, int ldy);
 int compute_submatrix_sprimme(dummy_type_sprimme *X, int nX, int ldX, dummy_type_sprimme *H, int nH,
       int ldH, int isherm, dummy_type_sprimme *R, int ldR, primme_context ctx);
+int Num_csrmm_sprimme(int trans, PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const dummy_type_sprimme *a, int base, int nx, dummy_type_sprimme *x,
+      PRIMME_INT ldx, dummy_type_sprimme *y, PRIMME_INT ldy);
+void csrmm_normal_rows_Sprimmesprimme(PRIMME_INT i0, PRIMME_INT i1,
+      PRIMME_INT n, const int *ia, const int *ja, const dummy_type_sprimme *a, int base,
+      int nx, dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *y, PRIMME_INT ldy);
+int Num_csrmm_normal_sprimme(PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const dummy_type_sprimme *a, int base, int nx, dummy_type_sprimme *x,
+      PRIMME_INT ldx, dummy_type_sprimme *y, PRIMME_INT ldy, dummy_type_sprimme *work, size_t lwork);
+int Num_sellmm_sprimme(PRIMME_INT m, int C, const PRIMME_INT *cptr,
+      const int *clen, const int *ccol, const dummy_type_sprimme *cval, const int *perm,
+      int nx, dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *y, PRIMME_INT ldy);
 int Num_copy_matrix_columns_sprimme(dummy_type_sprimme *x, PRIMME_INT m, int *xin, int n,
                                      PRIMME_INT ldx, dummy_type_sprimme *y, int *yin,
                                      PRIMME_INT ldy, primme_context ctx);
@@ -1694,6 +2277,10 @@ int Num_scale_matrix_sprimme(dummy_type_sprimme *x, PRIMME_INT m, PRIMME_INT n,
 int Num_matrix_astype_cprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_cprimme(PRIMME_INT n, dummy_type_cprimme **x, primme_context ctx);
+int Num_free_mapped_cprimme(dummy_type_cprimme *x, primme_context ctx);
+int Num_prefetch_matrix_cprimme(dummy_type_cprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_cprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -1710,6 +2297,18 @@ int Num_copy_compact_trimatrix_cprimme(dummy_type_cprimme *x, PRIMME_INT m, int
       dummy_type_cprimme *y, int ldy);
 int compute_submatrix_cprimme(dummy_type_cprimme *X, int nX, int ldX, dummy_type_cprimme *H, int nH,
       int ldH, int isherm, dummy_type_cprimme *R, int ldR, primme_context ctx);
+int Num_csrmm_cprimme(int trans, PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const dummy_type_cprimme *a, int base, int nx, dummy_type_cprimme *x,
+      PRIMME_INT ldx, dummy_type_cprimme *y, PRIMME_INT ldy);
+void csrmm_normal_rows_Sprimmecprimme(PRIMME_INT i0, PRIMME_INT i1,
+      PRIMME_INT n, const int *ia, const int *ja, const dummy_type_cprimme *a, int base,
+      int nx, dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_cprimme *y, PRIMME_INT ldy);
+int Num_csrmm_normal_cprimme(PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const dummy_type_cprimme *a, int base, int nx, dummy_type_cprimme *x,
+      PRIMME_INT ldx, dummy_type_cprimme *y, PRIMME_INT ldy, dummy_type_cprimme *work, size_t lwork);
+int Num_sellmm_cprimme(PRIMME_INT m, int C, const PRIMME_INT *cptr,
+      const int *clen, const int *ccol, const dummy_type_cprimme *cval, const int *perm,
+      int nx, dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_cprimme *y, PRIMME_INT ldy);
 int Num_copy_matrix_columns_cprimme(dummy_type_cprimme *x, PRIMME_INT m, int *xin, int n,
                                      PRIMME_INT ldx, dummy_type_cprimme *y, int *yin,
                                      PRIMME_INT ldy, primme_context ctx);
@@ -1726,6 +2325,10 @@ int Num_scale_matrix_cprimme(dummy_type_cprimme *x, PRIMME_INT m, PRIMME_INT n,
 int Num_matrix_astype_zprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_zprimme(PRIMME_INT n, dummy_type_zprimme **x, primme_context ctx);
+int Num_free_mapped_zprimme(dummy_type_zprimme *x, primme_context ctx);
+int Num_prefetch_matrix_zprimme(dummy_type_zprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_zprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -1742,6 +2345,18 @@ int Num_copy_compact_trimatrix_zprimme(dummy_type_zprimme *x, PRIMME_INT m, int
       dummy_type_zprimme *y, int ldy);
 int compute_submatrix_zprimme(dummy_type_zprimme *X, int nX, int ldX, dummy_type_zprimme *H, int nH,
       int ldH, int isherm, dummy_type_zprimme *R, int ldR, primme_context ctx);
+int Num_csrmm_zprimme(int trans, PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const dummy_type_zprimme *a, int base, int nx, dummy_type_zprimme *x,
+      PRIMME_INT ldx, dummy_type_zprimme *y, PRIMME_INT ldy);
+void csrmm_normal_rows_Sprimmezprimme(PRIMME_INT i0, PRIMME_INT i1,
+      PRIMME_INT n, const int *ia, const int *ja, const dummy_type_zprimme *a, int base,
+      int nx, dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_zprimme *y, PRIMME_INT ldy);
+int Num_csrmm_normal_zprimme(PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const dummy_type_zprimme *a, int base, int nx, dummy_type_zprimme *x,
+      PRIMME_INT ldx, dummy_type_zprimme *y, PRIMME_INT ldy, dummy_type_zprimme *work, size_t lwork);
+int Num_sellmm_zprimme(PRIMME_INT m, int C, const PRIMME_INT *cptr,
+      const int *clen, const int *ccol, const dummy_type_zprimme *cval, const int *perm,
+      int nx, dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_zprimme *y, PRIMME_INT ldy);
 int Num_copy_matrix_columns_zprimme(dummy_type_zprimme *x, PRIMME_INT m, int *xin, int n,
                                      PRIMME_INT ldx, dummy_type_zprimme *y, int *yin,
                                      PRIMME_INT ldy, primme_context ctx);
@@ -1755,9 +2370,81 @@ dummy_type_zprimme* Num_compact_vecs_zprimme(dummy_type_zprimme *vecs, PRIMME_IN
       int avoidCopy, primme_context ctx);
 int Num_scale_matrix_zprimme(dummy_type_zprimme *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, dummy_type_dprimme *s, dummy_type_zprimme *y, PRIMME_INT ldy, primme_context ctx);
+int Num_matrix_astype_dh_sprimme(void *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
+      primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_dh_sprimme(PRIMME_INT n, dummy_type_dh_sprimme **x, primme_context ctx);
+int Num_free_mapped_dh_sprimme(dummy_type_dh_sprimme *x, primme_context ctx);
+int Num_prefetch_matrix_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
+int Num_copy_matrix_astype_dh_sprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
+      PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
+      void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
+      primme_op_datatype yt, primme_context ctx);
+int Num_sizeof_dh_sprimme(primme_op_datatype t, size_t *s);
+int Num_machine_epsilon_dh_sprimme(primme_op_datatype t, double *eps);
+int Num_copy_matrix_conj_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, dummy_type_dh_sprimme *y, PRIMME_INT ldy, primme_context ctx);
+int Num_copy_trimatrix_dh_sprimme(dummy_type_dh_sprimme *x, int m, int n, int ldx, int ul,
+      int i0, dummy_type_dh_sprimme *y, int ldy, int zero);
+int Num_copy_trimatrix_compact_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT m, int n,
+      PRIMME_INT ldx, int i0, dummy_type_dh_sprimme *y, int *ly);
+int Num_copy_compact_trimatrix_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT m, int n, int i0,
+      dummy_type_dh_sprimme *y, int ldy);
+int Num_copy_matrix_columns_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT m, int *xin, int n,
+                                     PRIMME_INT ldx, dummy_type_dh_sprimme *y, int *yin,
+                                     PRIMME_INT ldy, primme_context ctx);
+int Num_copy_matrix_rows_dh_sprimme(dummy_type_dh_sprimme *x, int *xim, int m, int n,
+                                     PRIMME_INT ldx, dummy_type_dh_sprimme *y, int *yim,
+                                     PRIMME_INT ldy, primme_context ctx);
+int permute_vecs_dh_sprimme(dummy_type_dh_sprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
+                         int *perm_, primme_context ctx);
+dummy_type_dh_sprimme* Num_compact_vecs_dh_sprimme(dummy_type_dh_sprimme *vecs, PRIMME_INT m, int n,
+      PRIMME_INT ld, int *perm, dummy_type_dh_sprimme *work, PRIMME_INT ldwork,
+      int avoidCopy, primme_context ctx);
+int Num_scale_matrix_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, dummy_type_dprimme *s, dummy_type_dh_sprimme *y, PRIMME_INT ldy, primme_context ctx);
+int Num_matrix_astype_dh_cprimme(void *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
+      primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_dh_cprimme(PRIMME_INT n, dummy_type_dh_cprimme **x, primme_context ctx);
+int Num_free_mapped_dh_cprimme(dummy_type_dh_cprimme *x, primme_context ctx);
+int Num_prefetch_matrix_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
+int Num_copy_matrix_astype_dh_cprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
+      PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
+      void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
+      primme_op_datatype yt, primme_context ctx);
+int Num_sizeof_dh_cprimme(primme_op_datatype t, size_t *s);
+int Num_machine_epsilon_dh_cprimme(primme_op_datatype t, double *eps);
+int Num_copy_matrix_conj_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, dummy_type_dh_cprimme *y, PRIMME_INT ldy, primme_context ctx);
+int Num_copy_trimatrix_dh_cprimme(dummy_type_dh_cprimme *x, int m, int n, int ldx, int ul,
+      int i0, dummy_type_dh_cprimme *y, int ldy, int zero);
+int Num_copy_trimatrix_compact_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT m, int n,
+      PRIMME_INT ldx, int i0, dummy_type_dh_cprimme *y, int *ly);
+int Num_copy_compact_trimatrix_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT m, int n, int i0,
+      dummy_type_dh_cprimme *y, int ldy);
+int Num_copy_matrix_columns_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT m, int *xin, int n,
+                                     PRIMME_INT ldx, dummy_type_dh_cprimme *y, int *yin,
+                                     PRIMME_INT ldy, primme_context ctx);
+int Num_copy_matrix_rows_dh_cprimme(dummy_type_dh_cprimme *x, int *xim, int m, int n,
+                                     PRIMME_INT ldx, dummy_type_dh_cprimme *y, int *yim,
+                                     PRIMME_INT ldy, primme_context ctx);
+int permute_vecs_dh_cprimme(dummy_type_dh_cprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
+                         int *perm_, primme_context ctx);
+dummy_type_dh_cprimme* Num_compact_vecs_dh_cprimme(dummy_type_dh_cprimme *vecs, PRIMME_INT m, int n,
+      PRIMME_INT ld, int *perm, dummy_type_dh_cprimme *work, PRIMME_INT ldwork,
+      int avoidCopy, primme_context ctx);
+int Num_scale_matrix_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, dummy_type_dprimme *s, dummy_type_dh_cprimme *y, PRIMME_INT ldy, primme_context ctx);
 int Num_matrix_astype_magma_hprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_magma_hprimme(PRIMME_INT n, dummy_type_magma_hprimme **x, primme_context ctx);
+int Num_free_mapped_magma_hprimme(dummy_type_magma_hprimme *x, primme_context ctx);
+int Num_prefetch_matrix_magma_hprimme(dummy_type_magma_hprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_magma_hprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -1780,6 +2467,10 @@ int Num_scale_matrix_magma_hprimme(dummy_type_magma_hprimme *x, PRIMME_INT m, PR
 int Num_matrix_astype_magma_kprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_magma_kprimme(PRIMME_INT n, dummy_type_magma_kprimme **x, primme_context ctx);
+int Num_free_mapped_magma_kprimme(dummy_type_magma_kprimme *x, primme_context ctx);
+int Num_prefetch_matrix_magma_kprimme(dummy_type_magma_kprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_magma_kprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -1802,6 +2493,10 @@ int Num_scale_matrix_magma_kprimme(dummy_type_magma_kprimme *x, PRIMME_INT m, PR
 int Num_matrix_astype_magma_sprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_magma_sprimme(PRIMME_INT n, dummy_type_magma_sprimme **x, primme_context ctx);
+int Num_free_mapped_magma_sprimme(dummy_type_magma_sprimme *x, primme_context ctx);
+int Num_prefetch_matrix_magma_sprimme(dummy_type_magma_sprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_magma_sprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -1824,6 +2519,10 @@ int Num_scale_matrix_magma_sprimme(dummy_type_magma_sprimme *x, PRIMME_INT m, PR
 int Num_matrix_astype_magma_cprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_magma_cprimme(PRIMME_INT n, dummy_type_magma_cprimme **x, primme_context ctx);
+int Num_free_mapped_magma_cprimme(dummy_type_magma_cprimme *x, primme_context ctx);
+int Num_prefetch_matrix_magma_cprimme(dummy_type_magma_cprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_magma_cprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -1846,6 +2545,10 @@ int Num_scale_matrix_magma_cprimme(dummy_type_magma_cprimme *x, PRIMME_INT m, PR
 int Num_matrix_astype_magma_dprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_magma_dprimme(PRIMME_INT n, dummy_type_magma_dprimme **x, primme_context ctx);
+int Num_free_mapped_magma_dprimme(dummy_type_magma_dprimme *x, primme_context ctx);
+int Num_prefetch_matrix_magma_dprimme(dummy_type_magma_dprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_magma_dprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -1868,6 +2571,10 @@ int Num_scale_matrix_magma_dprimme(dummy_type_magma_dprimme *x, PRIMME_INT m, PR
 int Num_matrix_astype_magma_zprimme(void *x, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldx, primme_op_datatype xt, void **y, PRIMME_INT *ldy,
       primme_op_datatype yt, int do_alloc, int do_copy, primme_context ctx);
+int Num_malloc_mapped_magma_zprimme(PRIMME_INT n, dummy_type_magma_zprimme **x, primme_context ctx);
+int Num_free_mapped_magma_zprimme(dummy_type_magma_zprimme *x, primme_context ctx);
+int Num_prefetch_matrix_magma_zprimme(dummy_type_magma_zprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
 int Num_copy_matrix_astype_magma_zprimme(void *x, PRIMME_INT xm0, PRIMME_INT xn0,
       PRIMME_INT m, PRIMME_INT n, PRIMME_INT ldx, primme_op_datatype xt,
       void *y, PRIMME_INT ym0, PRIMME_INT yn0, PRIMME_INT ldy,
@@ -2159,6 +2159,99 @@ int Num_scal_dprimme(PRIMME_INT n, dummy_type_dprimme alpha, dummy_type_dprimme
 #endif
 int Num_heev_dprimme(const char *jobz, const char *uplo, PRIMME_INT n,
       dummy_type_dprimme *a, PRIMME_INT lda, dummy_type_dprimme *w, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_Sprimme)
+#  define Num_heevx_Sprimme CONCAT(Num_heevx_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_Rprimme)
+#  define Num_heevx_Rprimme CONCAT(Num_heevx_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_SHprimme)
+#  define Num_heevx_SHprimme CONCAT(Num_heevx_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_RHprimme)
+#  define Num_heevx_RHprimme CONCAT(Num_heevx_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_SXprimme)
+#  define Num_heevx_SXprimme CONCAT(Num_heevx_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_RXprimme)
+#  define Num_heevx_RXprimme CONCAT(Num_heevx_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_Shprimme)
+#  define Num_heevx_Shprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_Rhprimme)
+#  define Num_heevx_Rhprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_Ssprimme)
+#  define Num_heevx_Ssprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_Rsprimme)
+#  define Num_heevx_Rsprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_Sdprimme)
+#  define Num_heevx_Sdprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_Rdprimme)
+#  define Num_heevx_Rdprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_Sqprimme)
+#  define Num_heevx_Sqprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_Rqprimme)
+#  define Num_heevx_Rqprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_SXhprimme)
+#  define Num_heevx_SXhprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_RXhprimme)
+#  define Num_heevx_RXhprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_SXsprimme)
+#  define Num_heevx_SXsprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_RXsprimme)
+#  define Num_heevx_RXsprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_SXdprimme)
+#  define Num_heevx_SXdprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_RXdprimme)
+#  define Num_heevx_RXdprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_SXqprimme)
+#  define Num_heevx_SXqprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_RXqprimme)
+#  define Num_heevx_RXqprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_SHhprimme)
+#  define Num_heevx_SHhprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_RHhprimme)
+#  define Num_heevx_RHhprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_SHsprimme)
+#  define Num_heevx_SHsprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_RHsprimme)
+#  define Num_heevx_RHsprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_SHdprimme)
+#  define Num_heevx_SHdprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_RHdprimme)
+#  define Num_heevx_RHdprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_SHqprimme)
+#  define Num_heevx_SHqprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_heevx_RHqprimme)
+#  define Num_heevx_RHqprimme CONCAT(Num_heevx_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Num_heevx_dprimme(const char *jobz, const char *uplo, PRIMME_INT n,
+      dummy_type_dprimme *a, PRIMME_INT lda, PRIMME_INT il, PRIMME_INT iu, dummy_type_dprimme *w,
+      primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(Num_hegv_Sprimme)
 #  define Num_hegv_Sprimme CONCAT(Num_hegv_,SCALAR_SUF)
 #endif
@@ -2252,6 +2345,99 @@ int Num_heev_dprimme(const char *jobz, const char *uplo, PRIMME_INT n,
 int Num_hegv_dprimme(const char *jobz, const char *uplo, PRIMME_INT n,
       dummy_type_dprimme *a, PRIMME_INT lda, dummy_type_dprimme *b0, PRIMME_INT ldb0, dummy_type_dprimme *w,
       primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_Sprimme)
+#  define Num_hegvx_Sprimme CONCAT(Num_hegvx_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_Rprimme)
+#  define Num_hegvx_Rprimme CONCAT(Num_hegvx_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_SHprimme)
+#  define Num_hegvx_SHprimme CONCAT(Num_hegvx_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_RHprimme)
+#  define Num_hegvx_RHprimme CONCAT(Num_hegvx_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_SXprimme)
+#  define Num_hegvx_SXprimme CONCAT(Num_hegvx_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_RXprimme)
+#  define Num_hegvx_RXprimme CONCAT(Num_hegvx_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_Shprimme)
+#  define Num_hegvx_Shprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_Rhprimme)
+#  define Num_hegvx_Rhprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_Ssprimme)
+#  define Num_hegvx_Ssprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_Rsprimme)
+#  define Num_hegvx_Rsprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_Sdprimme)
+#  define Num_hegvx_Sdprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_Rdprimme)
+#  define Num_hegvx_Rdprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_Sqprimme)
+#  define Num_hegvx_Sqprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_Rqprimme)
+#  define Num_hegvx_Rqprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_SXhprimme)
+#  define Num_hegvx_SXhprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_RXhprimme)
+#  define Num_hegvx_RXhprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_SXsprimme)
+#  define Num_hegvx_SXsprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_RXsprimme)
+#  define Num_hegvx_RXsprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_SXdprimme)
+#  define Num_hegvx_SXdprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_RXdprimme)
+#  define Num_hegvx_RXdprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_SXqprimme)
+#  define Num_hegvx_SXqprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_RXqprimme)
+#  define Num_hegvx_RXqprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_SHhprimme)
+#  define Num_hegvx_SHhprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_RHhprimme)
+#  define Num_hegvx_RHhprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_SHsprimme)
+#  define Num_hegvx_SHsprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_RHsprimme)
+#  define Num_hegvx_RHsprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_SHdprimme)
+#  define Num_hegvx_SHdprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_RHdprimme)
+#  define Num_hegvx_RHdprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_SHqprimme)
+#  define Num_hegvx_SHqprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_hegvx_RHqprimme)
+#  define Num_hegvx_RHqprimme CONCAT(Num_hegvx_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Num_hegvx_dprimme(const char *jobz, const char *uplo, PRIMME_INT n,
+      dummy_type_dprimme *a, PRIMME_INT lda, dummy_type_dprimme *b0, PRIMME_INT ldb0, PRIMME_INT il,
+      PRIMME_INT iu, dummy_type_dprimme *w, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(Num_gesvd_Sprimme)
 #  define Num_gesvd_Sprimme CONCAT(Num_gesvd_,SCALAR_SUF)
 #endif
@@ -3219,9 +3405,15 @@ int Num_scal_sprimme(PRIMME_INT n, dummy_type_sprimme alpha, dummy_type_sprimme
       primme_context ctx);
 int Num_heev_sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
       dummy_type_sprimme *a, PRIMME_INT lda, dummy_type_sprimme *w, primme_context ctx);
+int Num_heevx_sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
+      dummy_type_sprimme *a, PRIMME_INT lda, PRIMME_INT il, PRIMME_INT iu, dummy_type_sprimme *w,
+      primme_context ctx);
 int Num_hegv_sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
       dummy_type_sprimme *a, PRIMME_INT lda, dummy_type_sprimme *b0, PRIMME_INT ldb0, dummy_type_sprimme *w,
       primme_context ctx);
+int Num_hegvx_sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
+      dummy_type_sprimme *a, PRIMME_INT lda, dummy_type_sprimme *b0, PRIMME_INT ldb0, PRIMME_INT il,
+      PRIMME_INT iu, dummy_type_sprimme *w, primme_context ctx);
 int Num_gesvd_sprimme(const char *jobu, const char *jobvt, PRIMME_INT m,
       PRIMME_INT n, dummy_type_sprimme *a, PRIMME_INT lda, dummy_type_sprimme *s, dummy_type_sprimme *u,
       PRIMME_INT ldu, dummy_type_sprimme *vt, PRIMME_INT ldvt, primme_context ctx);
@@ -3297,9 +3489,15 @@ int Num_scal_cprimme(PRIMME_INT n, dummy_type_cprimme alpha, dummy_type_cprimme
       primme_context ctx);
 int Num_heev_cprimme(const char *jobz, const char *uplo, PRIMME_INT n,
       dummy_type_cprimme *a, PRIMME_INT lda, dummy_type_sprimme *w, primme_context ctx);
+int Num_heevx_cprimme(const char *jobz, const char *uplo, PRIMME_INT n,
+      dummy_type_cprimme *a, PRIMME_INT lda, PRIMME_INT il, PRIMME_INT iu, dummy_type_sprimme *w,
+      primme_context ctx);
 int Num_hegv_cprimme(const char *jobz, const char *uplo, PRIMME_INT n,
       dummy_type_cprimme *a, PRIMME_INT lda, dummy_type_cprimme *b0, PRIMME_INT ldb0, dummy_type_sprimme *w,
       primme_context ctx);
+int Num_hegvx_cprimme(const char *jobz, const char *uplo, PRIMME_INT n,
+      dummy_type_cprimme *a, PRIMME_INT lda, dummy_type_cprimme *b0, PRIMME_INT ldb0, PRIMME_INT il,
+      PRIMME_INT iu, dummy_type_sprimme *w, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(Num_gees_Sprimme)
 #  define Num_gees_Sprimme CONCAT(Num_gees_,SCALAR_SUF)
 #endif
@@ -3467,9 +3665,15 @@ int Num_scal_zprimme(PRIMME_INT n, dummy_type_zprimme alpha, dummy_type_zprimme
       primme_context ctx);
 int Num_heev_zprimme(const char *jobz, const char *uplo, PRIMME_INT n,
       dummy_type_zprimme *a, PRIMME_INT lda, dummy_type_dprimme *w, primme_context ctx);
+int Num_heevx_zprimme(const char *jobz, const char *uplo, PRIMME_INT n,
+      dummy_type_zprimme *a, PRIMME_INT lda, PRIMME_INT il, PRIMME_INT iu, dummy_type_dprimme *w,
+      primme_context ctx);
 int Num_hegv_zprimme(const char *jobz, const char *uplo, PRIMME_INT n,
       dummy_type_zprimme *a, PRIMME_INT lda, dummy_type_zprimme *b0, PRIMME_INT ldb0, dummy_type_dprimme *w,
       primme_context ctx);
+int Num_hegvx_zprimme(const char *jobz, const char *uplo, PRIMME_INT n,
+      dummy_type_zprimme *a, PRIMME_INT lda, dummy_type_zprimme *b0, PRIMME_INT ldb0, PRIMME_INT il,
+      PRIMME_INT iu, dummy_type_dprimme *w, primme_context ctx);
 int Num_gees_zprimme(const char *jobvs, PRIMME_INT n, dummy_type_zprimme *a, PRIMME_INT lda,
       dummy_type_zprimme *w, dummy_type_zprimme *vs, PRIMME_INT ldvs, primme_context ctx);
 int Num_gesvd_zprimme(const char *jobu, const char *jobvt, PRIMME_INT m,
@@ -3496,4 +3700,86 @@ int Num_getrs_zprimme(const char *trans, PRIMME_INT n, PRIMME_INT nrhs,
 int Num_compute_gramm_ddh_zprimme(dummy_type_zprimme *X, PRIMME_INT m, PRIMME_INT n,
       PRIMME_INT ldX, dummy_type_zprimme *Y, PRIMME_INT ldY, dummy_type_zprimme alpha, dummy_type_zprimme *H,
       PRIMME_INT ldH, int isherm, primme_context ctx);
+int Num_check_pointer_dh_sprimme(void *x);
+int Num_malloc_dh_sprimme(PRIMME_INT n, dummy_type_dh_sprimme **x, primme_context ctx);
+int Num_free_dh_sprimme(dummy_type_dh_sprimme *x, primme_context ctx);
+int Num_copy_dh_sprimme(PRIMME_INT n, dummy_type_dh_sprimme *x, PRIMME_INT incx, dummy_type_dh_sprimme *y,
+      PRIMME_INT incy, primme_context ctx);
+int Num_copy_Tmatrix_dh_sprimme(void *x, primme_op_datatype xt, PRIMME_INT m,
+      PRIMME_INT n, PRIMME_INT ldx, dummy_type_dh_sprimme *y, PRIMME_INT ldy,
+      primme_context ctx);
+int Num_copy_matrix_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, dummy_type_dh_sprimme *y, PRIMME_INT ldy,
+      primme_context ctx);
+int Num_zero_matrix_dh_sprimme(dummy_type_dh_sprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
+int Num_gemm_dhd_dh_sprimme(const char *transa, const char *transb, PRIMME_INT m,
+      PRIMME_INT n, PRIMME_INT k, dummy_type_dprimme alpha, dummy_type_dh_sprimme *a, PRIMME_INT lda,
+      dummy_type_dprimme *b, PRIMME_INT ldb, dummy_type_dprimme beta, dummy_type_dh_sprimme *c, PRIMME_INT ldc,
+      primme_context ctx);
+int Num_gemm_ddh_dh_sprimme(const char *transa, const char *transb, PRIMME_INT m,
+      PRIMME_INT n, PRIMME_INT k, dummy_type_dprimme alpha, dummy_type_dh_sprimme *a, PRIMME_INT lda,
+      dummy_type_dh_sprimme *b, PRIMME_INT ldb, dummy_type_dprimme beta, dummy_type_dprimme *c, PRIMME_INT ldc,
+      primme_context ctx);
+int Num_gemv_ddh_dh_sprimme(const char *transa, PRIMME_INT m, PRIMME_INT n,
+      dummy_type_dprimme alpha, dummy_type_dh_sprimme *a, PRIMME_INT lda, dummy_type_dh_sprimme *x, PRIMME_INT incx,
+      dummy_type_dprimme beta, dummy_type_dprimme *y, PRIMME_INT incy, primme_context ctx);
+int Num_gemv_dhd_dh_sprimme(const char *transa, PRIMME_INT m, PRIMME_INT n,
+      dummy_type_dprimme alpha, dummy_type_dh_sprimme *a, PRIMME_INT lda, dummy_type_dprimme *x, PRIMME_INT incx,
+      dummy_type_dprimme beta, dummy_type_dh_sprimme *y, PRIMME_INT incy, primme_context ctx);
+int Num_axpy_dh_sprimme(PRIMME_INT n, dummy_type_dprimme alpha, dummy_type_dh_sprimme *x, PRIMME_INT incx,
+      dummy_type_dh_sprimme *y, PRIMME_INT incy, primme_context ctx);
+dummy_type_dprimme Num_dot_dh_sprimme(PRIMME_INT n, dummy_type_dh_sprimme *x, PRIMME_INT incx, dummy_type_dh_sprimme *y,
+      PRIMME_INT incy, primme_context ctx);
+int Num_larnv_dh_sprimme(int idist, PRIMME_INT *iseed, PRIMME_INT length,
+      dummy_type_dh_sprimme *x, primme_context ctx);
+int Num_scal_dh_sprimme(PRIMME_INT n, dummy_type_dprimme alpha, dummy_type_dh_sprimme *x, PRIMME_INT incx,
+      primme_context ctx);
+int Num_trsm_hd_dh_sprimme(const char *side, const char *uplo, const char *transa,
+      const char *diag, PRIMME_INT m, PRIMME_INT n, dummy_type_dprimme alpha, dummy_type_dprimme *a,
+      PRIMME_INT lda, dummy_type_dh_sprimme *b, PRIMME_INT ldb, primme_context ctx);
+int Num_compute_gramm_ddh_dh_sprimme(dummy_type_dh_sprimme *X, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldX, dummy_type_dh_sprimme *Y, PRIMME_INT ldY, dummy_type_dprimme alpha, dummy_type_dprimme *H,
+      PRIMME_INT ldH, int isherm, primme_context ctx);
+int Num_check_pointer_dh_cprimme(void *x);
+int Num_malloc_dh_cprimme(PRIMME_INT n, dummy_type_dh_cprimme **x, primme_context ctx);
+int Num_free_dh_cprimme(dummy_type_dh_cprimme *x, primme_context ctx);
+int Num_copy_dh_cprimme(PRIMME_INT n, dummy_type_dh_cprimme *x, PRIMME_INT incx, dummy_type_dh_cprimme *y,
+      PRIMME_INT incy, primme_context ctx);
+int Num_copy_Tmatrix_dh_cprimme(void *x, primme_op_datatype xt, PRIMME_INT m,
+      PRIMME_INT n, PRIMME_INT ldx, dummy_type_dh_cprimme *y, PRIMME_INT ldy,
+      primme_context ctx);
+int Num_copy_matrix_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, dummy_type_dh_cprimme *y, PRIMME_INT ldy,
+      primme_context ctx);
+int Num_zero_matrix_dh_cprimme(dummy_type_dh_cprimme *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx);
+int Num_gemm_dhd_dh_cprimme(const char *transa, const char *transb, PRIMME_INT m,
+      PRIMME_INT n, PRIMME_INT k, dummy_type_zprimme alpha, dummy_type_dh_cprimme *a, PRIMME_INT lda,
+      dummy_type_zprimme *b, PRIMME_INT ldb, dummy_type_zprimme beta, dummy_type_dh_cprimme *c, PRIMME_INT ldc,
+      primme_context ctx);
+int Num_gemm_ddh_dh_cprimme(const char *transa, const char *transb, PRIMME_INT m,
+      PRIMME_INT n, PRIMME_INT k, dummy_type_zprimme alpha, dummy_type_dh_cprimme *a, PRIMME_INT lda,
+      dummy_type_dh_cprimme *b, PRIMME_INT ldb, dummy_type_zprimme beta, dummy_type_zprimme *c, PRIMME_INT ldc,
+      primme_context ctx);
+int Num_gemv_ddh_dh_cprimme(const char *transa, PRIMME_INT m, PRIMME_INT n,
+      dummy_type_zprimme alpha, dummy_type_dh_cprimme *a, PRIMME_INT lda, dummy_type_dh_cprimme *x, PRIMME_INT incx,
+      dummy_type_zprimme beta, dummy_type_zprimme *y, PRIMME_INT incy, primme_context ctx);
+int Num_gemv_dhd_dh_cprimme(const char *transa, PRIMME_INT m, PRIMME_INT n,
+      dummy_type_zprimme alpha, dummy_type_dh_cprimme *a, PRIMME_INT lda, dummy_type_zprimme *x, PRIMME_INT incx,
+      dummy_type_zprimme beta, dummy_type_dh_cprimme *y, PRIMME_INT incy, primme_context ctx);
+int Num_axpy_dh_cprimme(PRIMME_INT n, dummy_type_zprimme alpha, dummy_type_dh_cprimme *x, PRIMME_INT incx,
+      dummy_type_dh_cprimme *y, PRIMME_INT incy, primme_context ctx);
+dummy_type_zprimme Num_dot_dh_cprimme(PRIMME_INT n, dummy_type_dh_cprimme *x, PRIMME_INT incx, dummy_type_dh_cprimme *y,
+      PRIMME_INT incy, primme_context ctx);
+int Num_larnv_dh_cprimme(int idist, PRIMME_INT *iseed, PRIMME_INT length,
+      dummy_type_dh_cprimme *x, primme_context ctx);
+int Num_scal_dh_cprimme(PRIMME_INT n, dummy_type_zprimme alpha, dummy_type_dh_cprimme *x, PRIMME_INT incx,
+      primme_context ctx);
+int Num_trsm_hd_dh_cprimme(const char *side, const char *uplo, const char *transa,
+      const char *diag, PRIMME_INT m, PRIMME_INT n, dummy_type_zprimme alpha, dummy_type_zprimme *a,
+      PRIMME_INT lda, dummy_type_dh_cprimme *b, PRIMME_INT ldb, primme_context ctx);
+int Num_compute_gramm_ddh_dh_cprimme(dummy_type_dh_cprimme *X, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldX, dummy_type_dh_cprimme *Y, PRIMME_INT ldY, dummy_type_zprimme alpha, dummy_type_zprimme *H,
+      PRIMME_INT ldH, int isherm, primme_context ctx);
 #endif
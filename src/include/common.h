@@ -86,6 +86,11 @@ typedef PRIMME_COMPLEX_DOUBLE              dummy_type_zprimme;
 typedef PRIMME_QUAD                        dummy_type_qprimme;
 typedef PRIMME_COMPLEX_QUAD                dummy_type_wprimme;
 
+/* Single precision storage with double precision host arrays (USE_DHOST) */
+
+typedef float                              dummy_type_dh_sprimme;
+typedef PRIMME_COMPLEX_FLOAT               dummy_type_dh_cprimme;
+
 /* MAGMA types: not allowed arithmetic on cpu */
 
 typedef struct { PRIMME_HALF a; }          dummy_type_magma_hprimme;
@@ -122,13 +127,15 @@ typedef struct { PRIMME_COMPLEX_QUAD a; }  dummy_type_magma_wprimme;
  * Macro HOST_SCALAR_SUF and HOST_REAL_SUF - suffix appended to call the
  *    CPU version.
  *
- * Macro HSCALAR and HREAL - cpu versions of the types.
+ * Macro HSCALAR and HREAL - cpu versions of the types. They are also the
+ *    types of the arithmetic when SCALAR has no BLAS (see
+ *    BLASLAPACK_WITH_SCALAR), e.g., float for half and double for USE_DHOST.
  *
  **********************************************************************/
 
 #define SCALAR_SUF      CONCAT(CONCAT(STEM,ARITH(h,k,s,c,d,z,q,w)),primme)
 #define XSCALAR_SUF     CONCAT(CONCAT(HOST_STEM,ARITH(h,k,s,c,d,z,q,w)),primme)
-#define HOST_SCALAR_SUF CONCAT(CONCAT(HOST_STEM,ARITH(s,c,s,c,d,z,q,w)),primme)
+#define HOST_SCALAR_SUF CONCAT(CONCAT(HOST_STEM,HOST_ARITH(s,c,s,c,d,z,q,w)),primme)
 
 #define SCALAR CONCAT(dummy_type_, SCALAR_SUF)
 #define XSCALAR CONCAT(dummy_type_, XSCALAR_SUF)
@@ -136,7 +143,7 @@ typedef struct { PRIMME_COMPLEX_QUAD a; }  dummy_type_magma_wprimme;
 
 #define REAL_SUF      CONCAT(CONCAT(STEM,REAL_ARITH(h,k,s,c,d,z,q,w)),primme)
 #define XREAL_SUF     CONCAT(CONCAT(HOST_STEM,REAL_ARITH(h,k,s,c,d,z,q,w)),primme)
-#define HOST_REAL_SUF CONCAT(CONCAT(HOST_STEM,REAL_ARITH(s,c,s,c,d,z,q,w)),primme)
+#define HOST_REAL_SUF CONCAT(CONCAT(HOST_STEM,HOST_REAL_ARITH(s,c,s,c,d,z,q,w)),primme)
 
 #define REAL CONCAT(dummy_type_, REAL_SUF)
 #define XREAL CONCAT(dummy_type_, XREAL_SUF)
@@ -151,8 +158,8 @@ typedef struct { PRIMME_COMPLEX_QUAD a; }  dummy_type_magma_wprimme;
          FLT128_MAX)
 
 #define HOST_MACHINE_MAX                                                       \
-   ARITH(FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX, DBL_MAX, DBL_MAX, FLT128_MAX,     \
-         FLT128_MAX)
+   HOST_ARITH(FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX, DBL_MAX, DBL_MAX,             \
+         FLT128_MAX, FLT128_MAX)
 
 #define PRIMME_OP_SCALAR                                                       \
    ARITH(primme_op_half, primme_op_half, primme_op_float, primme_op_float,     \
@@ -161,8 +168,9 @@ typedef struct { PRIMME_COMPLEX_QUAD a; }  dummy_type_magma_wprimme;
 #define PRIMME_OP_REAL PRIMME_OP_SCALAR
 
 #define PRIMME_OP_HSCALAR                                                      \
-   ARITH(primme_op_float, primme_op_float, primme_op_float, primme_op_float,   \
-         primme_op_double, primme_op_double, primme_op_quad, primme_op_quad)
+   HOST_ARITH(primme_op_float, primme_op_float, primme_op_float,               \
+         primme_op_float, primme_op_double, primme_op_double, primme_op_quad,  \
+         primme_op_quad)
 
 #define PRIMME_OP_HREAL PRIMME_OP_HSCALAR
 
@@ -380,8 +388,19 @@ static inline const char *__compose_function_name(const char *path,
    }
  
 #else
-#define PROFILE_BEGIN(CALL)
-#define PROFILE_END
+
+/* Every call site has a static ID, assigned the first time that it is     */
+/* profiled, and accumulates the number of calls and the times on the      */
+/* entry of the table ctx.prof with that ID. If profiling is not on, the    */
+/* cost is checking ctx.prof.                                               */
+
+#define PROFILE_BEGIN(CALL) \
+   static primme_profile_site ___site = {CALL "@" __FILE__ ":" STR(__LINE__), -1}; \
+   double ___t0 = ctx.prof ? Profile_enter(&___site, ctx.prof) : 0.0;
+
+#define PROFILE_END \
+   if (___t0 > 0) Profile_leave(&___site, ___t0, ctx.prof);
+
 #endif
 
 /*****************************************************************************/
@@ -401,6 +420,17 @@ static inline uint32_t hash_call(const char *str, double value) {
    return hash;
 }
 
+/* Accumulate the bytes of buf into hash, like hash_call */
+
+static inline uint32_t hash_buffer(uint32_t hash, const void *buf, size_t n) {
+   const unsigned char *b = (const unsigned char *)buf;
+   size_t i;
+
+   for (i = 0; i < n; i++) hash = hash * 33 + b[i];
+
+   return hash;
+}
+
 /**********************************************************************
  * Macro PARALLEL_CHECK(CALL) - Check all processes are executing CALL
  *    and it returns the same value. If a process is executing a different
@@ -595,6 +625,65 @@ static inline uint32_t hash_call(const char *str, double value) {
    (*((void **)X) = malloc((NELEM) * sizeof(**(X))),                           \
          *(X) == NULL ? PRIMME_MALLOC_FAILURE : 0)
 
+/* Workspace kept between calls to Xprimme_ws (see primme_c.c) */
+
+struct primme_workspace_str {
+   primme_arena arena;     /* Memory reused by every call */
+   int warmStart;          /* If nonzero, keep the final basis */
+   void *basis;            /* Basis kept from the last call */
+   primme_op_datatype basisType; /* Type of basis */
+   PRIMME_INT nLocal;      /* Number of rows (and leading dimension) of basis */
+   int basisSize;          /* Number of columns of basis */
+};
+
+/* A sparse matrix for primme_csr_matvec. The matrix is kept in CSR format,
+ * and optionally also in SELL-C-sigma format, that is, the rows sorted by
+ * length inside windows of sigma rows and grouped in chunks of C rows that are
+ * stored column-major. */
+
+#define SELL_MAX_C 64
+
+struct primme_csr_str {
+   PRIMME_INT m, n;        /* Number of rows and columns */
+   const int *ia, *ja;     /* Row pointers and column indices */
+   const void *a;          /* Values */
+   int base;               /* Index of the first row and column, 0 or 1 */
+   primme_op_datatype type; /* Precision of the values */
+   int iscomplex;          /* Whether the values are complex */
+   int C;                  /* Rows in a SELL chunk, or zero if no SELL */
+   PRIMME_INT *cptr;       /* Position of every chunk in ccol and cval */
+   int *clen;              /* Number of columns of every chunk */
+   int *ccol;              /* Zero-based column indices of the chunks */
+   void *cval;             /* Values of the chunks */
+   int *perm;              /* Row of the matrix of every row of the chunks */
+   void *work;             /* Workspace of primme_csr_normal_mm */
+   size_t lwork;           /* Number of values in work */
+};
+
+/* Copies of evecs, Bevecs and evecsHat in correctionParams.innerPrecision. */
+/* main_iter keeps them between inner solves and invalidates them after    */
+/* every restart, which is when those vectors change.                      */
+
+typedef struct primme_inner_copies_str {
+   void *src[3];          /* evecs, Bevecs and evecsHat (NULL if unused) */
+   void *copy[3];         /* the copies in innerPrecision */
+   PRIMME_INT ldcopy[3];  /* leading dimension of the copies */
+   int n[3];              /* number of valid columns in the copies */
+} primme_inner_copies;
+
+/* A reduction started by globalSumStart and finished by globalSumWait */
+
+typedef struct primme_reduction_str {
+   void *buffer;                 /* array being reduced */
+   primme_op_datatype buffert;   /* type of buffer */
+   void *buffer0;                /* buffer casted to globalSumReal_type */
+   int count;                    /* number of elements in buffer */
+   void *request;                /* handle returned by globalSumRealStart */
+   int pending;                  /* whether globalSumWait has work to do */
+   int deferred;                 /* whether it is waiting in ctx.sumQueue */
+   struct primme_reduction_str *next; /* next reduction in ctx.sumQueue */
+} primme_reduction;
+
 typedef struct primme_context_str {
    /* For PRIMME */
    primme_params *primme;
@@ -607,6 +696,8 @@ typedef struct primme_context_str {
 
    /* For memory management */
    primme_frame *mm;
+   primme_arena *arena; /* Optional stack for temporaries (see memman.c) */
+   primme_workspace *ws; /* Optional state kept between calls */
 
    /* for MPI */
    int numProcs;     /* number of processes */
@@ -616,15 +707,24 @@ typedef struct primme_context_str {
          struct primme_context_str ctx); /* broadcast */
    int (*globalSum)(void *buffer, primme_op_datatype buffer_type, int count,
          struct primme_context_str ctx); /* global reduction */
+   primme_reduction **sumQueue; /* reductions to coalesce (see globalSumStart) */
 
    /* For MAGMA */
    void *queue;      /* magma device queue (magma_queue_t*) */
 
+   /* For the timeline trace */
+   primme_trace *trace; /* Spans of the solve, if traceFile is set */
+
+   /* For the first stage of internalPrecision = primme_op_auto */
+   int *stalled;     /* If not NULL, stop when the residual norms stall */
+
    #ifdef PRIMME_PROFILE
    /* For profiling */
    regex_t profile;  /* Pattern of the functions to profile */
    const char *path; /* Path of the current function */
    double *timeoff;  /* Accumulated overhead of profiling and reporting */
+   #else
+   primme_profile *prof; /* Times per call site, if profiling (see wtime.c) */
    #endif
 } primme_context;
 
@@ -650,6 +750,10 @@ typedef struct primme_context_str {
 /* Number of rows processed as once for streaming operation */
 #define PRIMME_BLOCK_SIZE IMPL(512, INT_MAX)
 
+/* Number of rows read ahead at once from a basis on files; a multiple of  */
+/* PRIMME_BLOCK_SIZE                                                        */
+#define PRIMME_PREFETCH_ROWS IMPL(8 * 512, INT_MAX)
+
 #ifdef __cplusplus
 #define EXTERN_C extern "C"
 #else
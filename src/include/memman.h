@@ -58,6 +58,15 @@ typedef struct primme_frame_str {
                         
 } primme_frame;
 
+typedef struct primme_arena_str {
+   char *base;                      /* Reserved memory */
+   size_t size;                     /* Size of the reserved memory in bytes */
+   size_t top;                      /* Offset of the first free byte */
+   size_t last;                     /* Offset of the last block's header */
+   size_t missed;                   /* Largest request that did not fit */
+   size_t served;                   /* Requests served since the last reserve */
+} primme_arena;
+
 int Mem_push_frame(struct primme_context_str *ctx);
 int Mem_pop_frame(struct primme_context_str *ctx);
 int Mem_pop_clean_frame(struct primme_context_str ctx);
@@ -66,5 +75,15 @@ int Mem_debug_frame(const char *debug, struct primme_context_str ctx);
 typedef int (*free_fn_type)(void *, struct primme_context_str);
 int Mem_register_alloc(void *p, free_fn_type free_fn, struct primme_context_str ctx);
 int Mem_deregister_alloc(void *p, struct primme_context_str ctx);
+int Mem_malloc(size_t size, void **p, struct primme_context_str ctx);
+int Mem_free(void *p, struct primme_context_str ctx);
+void Mem_arena_init(primme_arena *arena);
+int Mem_arena_create(struct primme_context_str *ctx);
+int Mem_arena_reserve(size_t size, struct primme_context_str ctx);
+int Mem_arena_destroy(struct primme_context_str *ctx);
+int Mem_map(size_t size, const char *dir, void **p,
+      struct primme_context_str ctx);
+int Mem_unmap(void *p, struct primme_context_str ctx);
+void Mem_prefetch(const void *p, size_t size, size_t n, size_t ld);
 
 #endif
@@ -68,11 +68,21 @@
  *
  * Macro USE_MAGMA - MAGMA version
  *
+ * Macro USE_DHOST - CPU version with float or complex float SCALAR, and
+ *    double or complex double HSCALAR. It keeps the large arrays in single
+ *    precision while the arithmetic is done in double precision (see
+ *    primme_params.storagePrecision). It is defined together with USE_HOST
+ *    and one of USE_FLOAT_DHOST or USE_FLOATCOMPLEX_DHOST.
+ *
  * Macro SUPPORTED_TYPE - defined if functions with the current type
  *    are going to be built.
  *
  * Macro SUPPORTED_HALF_TYPE - defined if functions with the current type
  *    has a version in half.
+ *
+ * Macro BLASLAPACK_WITH_SCALAR - defined if BLAS and LAPACK functions can
+ *    be called on SCALAR matrices. Otherwise the kernels cast the matrices
+ *    to HSCALAR, by blocks of PRIMME_BLOCK_SIZE rows if they are tall.
  **********************************************************************/
 
 /* Helper macros and types used to define SCALAR and REAL and their variants */
@@ -84,30 +94,39 @@
       defined(USE_DOUBLECOMPLEX)
 #  define USE_HOST
 #  define STEM
+#  define OTHER_STEM
+#  define IMPL(BL, MA) BL
+#elif defined(USE_FLOAT_DHOST) || defined(USE_FLOATCOMPLEX_DHOST)
+#  define USE_HOST
+#  define USE_DHOST
+#  define STEM dh_
+#  define OTHER_STEM
 #  define IMPL(BL, MA) BL
 #elif defined(USE_FLOAT_MAGMA) || defined(USE_FLOATCOMPLEX_MAGMA) ||           \
       defined(USE_DOUBLE_MAGMA) || defined(USE_DOUBLECOMPLEX_MAGMA) ||         \
       defined(USE_HALF_MAGMA) || defined(USE_HALFCOMPLEX_MAGMA)
 #  define USE_MAGMA
 #  define STEM magma_
+#  define OTHER_STEM magma_
 #  define IMPL(BL, MA) MA
 #else
 #  error 
 #endif
 
 #if !defined(CHECK_TEMPLATE) && !defined(STEM_C)
-#   define STEM_C STEM
+#   define STEM_C OTHER_STEM
 #endif
 
 #if defined(USE_HALF) || defined(USE_HALF_MAGMA) || defined(USE_FLOAT) ||      \
-      defined(USE_FLOAT_MAGMA) || defined(USE_DOUBLE) ||                       \
-      defined(USE_DOUBLE_MAGMA) || defined(USE_QUAD) ||                        \
+      defined(USE_FLOAT_MAGMA) || defined(USE_FLOAT_DHOST) ||                  \
+      defined(USE_DOUBLE) || defined(USE_DOUBLE_MAGMA) || defined(USE_QUAD) || \
       defined(USE_QUAD_MAGMA)
 #  define USE_REAL
 #elif defined(USE_HALFCOMPLEX) || defined(USE_HALFCOMPLEX_MAGMA) ||            \
       defined(USE_FLOATCOMPLEX) || defined(USE_FLOATCOMPLEX_MAGMA) ||          \
-      defined(USE_DOUBLECOMPLEX) || defined(USE_DOUBLECOMPLEX_MAGMA) ||        \
-      defined(USE_QUADCOMPLEX) || defined(USE_QUADCOMPLEX_MAGMA)
+      defined(USE_FLOATCOMPLEX_DHOST) || defined(USE_DOUBLECOMPLEX) ||         \
+      defined(USE_DOUBLECOMPLEX_MAGMA) || defined(USE_QUADCOMPLEX) ||          \
+      defined(USE_QUADCOMPLEX_MAGMA)
 #  define USE_COMPLEX
 #else
 #  error 
@@ -119,10 +138,12 @@
 #elif defined(USE_DOUBLECOMPLEX) || defined(USE_DOUBLECOMPLEX_MAGMA)
 #  define      ARITH(H,K,S,C,D,Z,Q,W) Z
 #  define REAL_ARITH(H,K,S,C,D,Z,Q,W) D
-#elif defined(USE_FLOAT)         || defined(USE_FLOAT_MAGMA)          
+#elif defined(USE_FLOAT)         || defined(USE_FLOAT_MAGMA)          ||      \
+      defined(USE_FLOAT_DHOST)
 #  define      ARITH(H,K,S,C,D,Z,Q,W) S
 #  define REAL_ARITH(H,K,S,C,D,Z,Q,W) S
-#elif defined(USE_FLOATCOMPLEX)  || defined(USE_FLOATCOMPLEX_MAGMA)          
+#elif defined(USE_FLOATCOMPLEX)  || defined(USE_FLOATCOMPLEX_MAGMA)   ||      \
+      defined(USE_FLOATCOMPLEX_DHOST)
 #  define      ARITH(H,K,S,C,D,Z,Q,W) C
 #  define REAL_ARITH(H,K,S,C,D,Z,Q,W) S
 #elif defined(USE_HALF)          || defined(USE_HALF_MAGMA)          
@@ -141,6 +162,20 @@
 #  error
 #endif
 
+/* The host arrays of USE_FLOAT_DHOST and USE_FLOATCOMPLEX_DHOST are double */
+/* and complex double. Otherwise they follow SCALAR (see HOST_SCALAR_SUF).  */
+
+#if   defined(USE_FLOAT_DHOST)
+#  define      HOST_ARITH(H,K,S,C,D,Z,Q,W) D
+#  define HOST_REAL_ARITH(H,K,S,C,D,Z,Q,W) D
+#elif defined(USE_FLOATCOMPLEX_DHOST)
+#  define      HOST_ARITH(H,K,S,C,D,Z,Q,W) Z
+#  define HOST_REAL_ARITH(H,K,S,C,D,Z,Q,W) D
+#else
+#  define      HOST_ARITH ARITH
+#  define HOST_REAL_ARITH REAL_ARITH
+#endif
+
 /* For host types, define SUPPORTED_HALF_TYPE when the compiler supports half
  * precision. For MAGMA, define the macro if MAGMA also supports half precision.
  *
@@ -160,7 +195,8 @@
 // Undefine SUPPORTED_TYPE when the current type is not supported. That is if
 // one the next applies:
 // - USE_HALF/COMPLEX/_MAGMA is defined but SUPPORTED_HALF_TYPE is not.
-// - USE_FLOAT/COMPLEX/_MAGMA is defined but PRIMME_WITHOUT_FLOAT is defined.
+// - USE_FLOAT/COMPLEX/_MAGMA/_DHOST is defined but PRIMME_WITHOUT_FLOAT is
+//   defined.
 // - USE_MAGMA is defined but PRIMME_WITH_MAGMA is not.
 
 #define SUPPORTED_TYPE
@@ -173,11 +209,17 @@
             (defined(USE_MAGMA) && !defined(PRIMME_WITH_MAGMA)) ||             \
             ((defined(USE_FLOAT) || defined(USE_FLOATCOMPLEX) ||               \
                    defined(USE_FLOAT_MAGMA) ||                                 \
-                   defined(USE_FLOATCOMPLEX_MAGMA)) &&                         \
+                   defined(USE_FLOATCOMPLEX_MAGMA) || defined(USE_DHOST)) &&   \
                   defined(PRIMME_WITHOUT_FLOAT)))
 #  undef SUPPORTED_TYPE
 #endif
 
+#if ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) ||                      \
+          defined(BLASLAPACK_WITH_HALF)) &&                                    \
+      !defined(USE_DHOST)
+#  define BLASLAPACK_WITH_SCALAR
+#endif
+
 /* A C99 code with complex type is not a valid C++ code. However C++          */
 /* compilers usually can take it. Nevertheless in order to avoid the warnings */
 /* while compiling in pedantic mode, we use the proper complex type for C99   */
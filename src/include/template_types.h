@@ -93,6 +93,24 @@
 #include "template_undef.h"
 #undef USE_DOUBLECOMPLEX
 
+/* Host types with single precision storage and double precision arithmetic */
+
+#ifdef SHOW_TYPE
+#warning compiling float with double host
+#endif
+#define USE_FLOAT_DHOST
+#include THIS_FILE
+#include "template_undef.h"
+#undef USE_FLOAT_DHOST
+
+#ifdef SHOW_TYPE
+#warning compiling float complex with double host
+#endif
+#define USE_FLOATCOMPLEX_DHOST
+#include THIS_FILE
+#include "template_undef.h"
+#undef USE_FLOATCOMPLEX_DHOST
+
 // #define USE_QUAD
 // #include THIS_FILE
 // #include "template_undef.h"
@@ -39,13 +39,18 @@
 #undef HOST_STEM
 #undef USE_HOST
 #undef USE_MAGMA
+#undef USE_DHOST
 #undef STEM
+#undef OTHER_STEM
 #undef IMPL
 #undef USE_REAL
 #undef USE_COMPLEX
 #undef ARITH
 #undef REAL_ARITH
+#undef HOST_ARITH
+#undef HOST_REAL_ARITH
 #undef SUPPORTED_TYPE
+#undef BLASLAPACK_WITH_SCALAR
 #undef REAL_PART
 #undef IMAGINARY_PART
 #undef ABS
@@ -42,6 +42,53 @@ extern "C" {
 
 double primme_wTimer();
 
+/* A call site profiled with a static ID */
+
+typedef struct primme_profile_site_str {
+   const char *name;   /* call and location, "call@file:line" */
+   int id;             /* index in the profile tables, or -1 if not assigned */
+} primme_profile_site;
+
+/* Times per call site, indexed by the site ID */
+
+struct primme_profile_str {
+   primme_profile_entry *entries; /* count and times of every site */
+   signed char *enabled;   /* 1 if the site matches the pattern, 0 if not,  */
+                           /* and -1 if it has not been checked yet         */
+   int size;               /* capacity of entries and enabled               */
+   char *pattern;          /* pattern selecting the sites to profile        */
+   void *regex;            /* compiled pattern (regex_t)                    */
+};
+
+int Profile_site_id(primme_profile_site *site);
+int Profile_create(const char *pattern, primme_profile **prof);
+void Profile_destroy(primme_profile *prof);
+int Profile_merge(primme_profile *prof, primme_profile *from);
+double Profile_enter(primme_profile_site *site, primme_profile *prof);
+void Profile_leave(primme_profile_site *site, double t0, primme_profile *prof);
+
+typedef struct primme_trace_span_str {
+   const char *name;   /* kind of span, a string literal */
+   double t0, t1;      /* starting and ending times */
+} primme_trace_span;
+
+/* Most spans kept by a trace; about 24 MiB */
+#define PRIMME_TRACE_MAX_SPANS (1 << 20)
+
+typedef struct primme_trace_str {
+   primme_trace_span *spans; /* spans in order of ending */
+   int n;                    /* number of spans */
+   int size;                 /* capacity of spans */
+   int dropped;              /* number of spans not kept */
+   double tFull;             /* when the trace reached its maximum size */
+} primme_trace;
+
+int Trace_create(primme_trace **trace);
+void Trace_destroy(primme_trace *trace);
+void Trace_span(const char *name, double t0, primme_trace *trace);
+int Trace_write(const char *fileName, int numProcs, int procID,
+      primme_trace *trace);
+
 #ifdef __cplusplus
 }
 #endif
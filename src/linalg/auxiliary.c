@@ -41,6 +41,9 @@
 #include <assert.h>
 #include <math.h>
 #include "numerical.h"
+#ifdef PRIMME_WITH_OPENMP
+#include <omp.h>
+#endif
 
 #ifdef SUPPORTED_TYPE
 
@@ -210,6 +213,91 @@ int Num_matrix_astype_iprimme(void *x, PRIMME_INT m, PRIMME_INT n,
 #endif /* USE_DOUBLE */
 #endif /* USE_HOST */
 
+/******************************************************************************
+ * Function Num_malloc_mapped_Sprimme - Allocate a vector of scalars on a
+ *    temporary file in primme->basisStorageDir if it is set; otherwise
+ *    as Num_malloc_Sprimme does.
+ *
+ * PARAMETERS
+ * ---------------------------
+ * n           The number of elements
+ * x           returned pointer
+ * 
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int Num_malloc_mapped_Sprimme(PRIMME_INT n, SCALAR **x, primme_context ctx) {
+
+#ifdef USE_HOST
+   if (n > 0 && ctx.primme && ctx.primme->basisStorageDir) {
+      CHKERR(Mem_map(sizeof(SCALAR) * n, ctx.primme->basisStorageDir,
+            (void **)x, ctx));
+      Mem_keep_frame(ctx);
+      Mem_register_alloc(*x, Mem_unmap, ctx);
+      return 0;
+   }
+#endif
+
+   return Num_malloc_Sprimme(n, x, ctx);
+}
+
+/******************************************************************************
+ * Function Num_free_mapped_Sprimme - Free a vector allocated by
+ *    Num_malloc_mapped_Sprimme
+ *
+ * PARAMETERS
+ * ---------------------------
+ * x           allocated pointer
+ * 
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int Num_free_mapped_Sprimme(SCALAR *x, primme_context ctx) {
+
+#ifdef USE_HOST
+   if (x && ctx.primme && ctx.primme->basisStorageDir) {
+      Mem_deregister_alloc(x, ctx);
+      return Mem_unmap(x, ctx);
+   }
+#endif
+
+   return Num_free_Sprimme(x, ctx);
+}
+
+/******************************************************************************
+ * Function Num_prefetch_matrix_Sprimme - Ask the system to start reading the
+ *    pages of the matrix x if it may be on a file, that is, if
+ *    primme->basisStorageDir is set.
+ *
+ * PARAMETERS
+ * ---------------------------
+ * x           The matrix
+ * m           The number of rows of x
+ * n           The number of columns of x
+ * ldx         The leading dimension of x
+ * 
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int Num_prefetch_matrix_Sprimme(SCALAR *x, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT ldx, primme_context ctx) {
+
+#ifdef USE_HOST
+   if (!x || m <= 0 || n <= 0 || !ctx.primme || !ctx.primme->basisStorageDir)
+      return 0;
+
+   Mem_prefetch(x, sizeof(SCALAR) * m, n, sizeof(SCALAR) * ldx);
+#else
+   (void)x;
+   (void)m;
+   (void)n;
+   (void)ldx;
+   (void)ctx;
+#endif
+
+   return 0;
+}
+
 /******************************************************************************
  * Function Num_copy_matrix_astype - copy the matrix x into y.
  *
@@ -591,7 +679,7 @@ int Num_copy_compact_trimatrix_Sprimme(SCALAR *x, PRIMME_INT m, int n, int i0,
  *
  ******************************************************************************/
 
-#if !defined(USE_HALF) && !defined(USE_HALFCOMPLEX)
+#if !defined(USE_HALF) && !defined(USE_HALFCOMPLEX) && !defined(USE_DHOST)
 TEMPLATE_PLEASE
 int compute_submatrix_Sprimme(SCALAR *X, int nX, int ldX, SCALAR *H, int nH,
       int ldH, int isherm, SCALAR *R, int ldR, primme_context ctx) {
@@ -621,7 +709,259 @@ int compute_submatrix_Sprimme(SCALAR *X, int nX, int ldX, SCALAR *H, int nH,
 
   return 0;
 }
-#endif /* !defined(USE_HALF) && !defined(USE_HALFCOMPLEX) */
+
+/* Number of columns of x and y computed at once by Num_csrmm */
+#define CSRMM_COLS 8
+
+/******************************************************************************
+ * Function Num_csrmm - Compute y = A*x or y = A'*x, where A is a sparse matrix
+ *    in CSR format and x and y have several columns. Every row of A is read
+ *    once for every CSRMM_COLS columns of x. If the library is compiled with
+ *    OpenMP, the rows of y are distributed among the threads when computing
+ *    A*x, and the columns of y when computing A'*x.
+ *
+ * PARAMETERS
+ * ---------------------------
+ * trans       If zero, compute A*x; otherwise compute A'*x
+ * m           The number of rows of A
+ * n           The number of columns of A
+ * ia          The row pointers of A, of size m+1
+ * ja          The column indices of A
+ * a           The values of A
+ * base        The index of the first row and column, 0 or 1
+ * nx          The number of columns of x and y
+ * x           The input matrix
+ * ldx         The leading dimension of x
+ * y           The output matrix
+ * ldy         The leading dimension of y
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int Num_csrmm_Sprimme(int trans, PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const SCALAR *a, int base, int nx, SCALAR *x,
+      PRIMME_INT ldx, SCALAR *y, PRIMME_INT ldy) {
+
+   PRIMME_INT i, k;
+   int j, j0;
+
+   if (!trans) {
+#ifdef PRIMME_WITH_OPENMP
+#pragma omp parallel for private(k, j, j0) schedule(static)
+#endif
+      for (i = 0; i < m; i++) {
+         for (j0 = 0; j0 < nx; j0 += CSRMM_COLS) {
+            int nj = min(CSRMM_COLS, nx - j0);
+            SCALAR s[CSRMM_COLS];
+            for (j = 0; j < nj; j++) s[j] = 0.0;
+            for (k = ia[i] - base; k < ia[i + 1] - base; k++) {
+               SCALAR aik = a[k];
+               SCALAR *xk = &x[ja[k] - base + ldx * j0];
+               for (j = 0; j < nj; j++) s[j] += aik * xk[ldx * j];
+            }
+            for (j = 0; j < nj; j++) y[i + ldy * (j0 + j)] = s[j];
+         }
+      }
+   } else {
+#ifdef PRIMME_WITH_OPENMP
+#pragma omp parallel for private(i, k, j) schedule(static)
+#endif
+      for (j0 = 0; j0 < nx; j0 += CSRMM_COLS) {
+         int nj = min(CSRMM_COLS, nx - j0);
+         for (j = 0; j < nj; j++) {
+            for (i = 0; i < n; i++) y[i + ldy * (j0 + j)] = 0.0;
+         }
+         for (i = 0; i < m; i++) {
+            for (k = ia[i] - base; k < ia[i + 1] - base; k++) {
+               SCALAR aik = CONJ(a[k]);
+               SCALAR *yk = &y[ja[k] - base + ldy * j0];
+               for (j = 0; j < nj; j++) yk[ldy * j] += aik * x[i + ldx * (j0 + j)];
+            }
+         }
+      }
+   }
+
+   return 0;
+}
+
+/* Compute y = A(i0:i1-1,:)'*A(i0:i1-1,:)*x */
+
+STATIC void csrmm_normal_rows_Sprimme(PRIMME_INT i0, PRIMME_INT i1,
+      PRIMME_INT n, const int *ia, const int *ja, const SCALAR *a, int base,
+      int nx, SCALAR *x, PRIMME_INT ldx, SCALAR *y, PRIMME_INT ldy) {
+
+   PRIMME_INT i, k;
+   int j, j0;
+
+   for (j0 = 0; j0 < nx; j0 += CSRMM_COLS) {
+      int nj = min(CSRMM_COLS, nx - j0);
+      for (j = 0; j < nj; j++) {
+         for (i = 0; i < n; i++) y[i + ldy * (j0 + j)] = 0.0;
+      }
+      for (i = i0; i < i1; i++) {
+         SCALAR s[CSRMM_COLS];
+         for (j = 0; j < nj; j++) s[j] = 0.0;
+         for (k = ia[i] - base; k < ia[i + 1] - base; k++) {
+            SCALAR aik = a[k];
+            SCALAR *xk = &x[ja[k] - base + ldx * j0];
+            for (j = 0; j < nj; j++) s[j] += aik * xk[ldx * j];
+         }
+         for (k = ia[i] - base; k < ia[i + 1] - base; k++) {
+            SCALAR aik = CONJ(a[k]);
+            SCALAR *yk = &y[ja[k] - base + ldy * j0];
+            for (j = 0; j < nj; j++) yk[ldy * j] += aik * s[j];
+         }
+      }
+   }
+}
+
+/******************************************************************************
+ * Function Num_csrmm_normal - Compute y = A'*A*x, where A is a sparse matrix
+ *    in CSR format and x and y have several columns. Every row of A is
+ *    multiplied by x and the result is accumulated right away into y, so
+ *    A*x is never stored. If the library is compiled with OpenMP, every thread
+ *    takes a contiguous range of rows of A and accumulates into its own part
+ *    of the workspace, and the parts are added up in a fixed order, so the
+ *    result does not depend on the thread scheduling. The number of threads is
+ *    limited by the size of the workspace; without workspace, the product is
+ *    computed sequentially.
+ *
+ * PARAMETERS
+ * ---------------------------
+ * m           The number of rows of A
+ * n           The number of columns of A
+ * ia          The row pointers of A, of size m+1
+ * ja          The column indices of A
+ * a           The values of A
+ * base        The index of the first row and column, 0 or 1
+ * nx          The number of columns of x and y
+ * x           The input matrix
+ * ldx         The leading dimension of x
+ * y           The output matrix
+ * ldy         The leading dimension of y
+ * work        Workspace, n*nx elements for every thread
+ * lwork       The number of elements in work
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int Num_csrmm_normal_Sprimme(PRIMME_INT m, PRIMME_INT n, const int *ia,
+      const int *ja, const SCALAR *a, int base, int nx, SCALAR *x,
+      PRIMME_INT ldx, SCALAR *y, PRIMME_INT ldy, SCALAR *work, size_t lwork) {
+
+   int nThreads = 1;
+#ifdef PRIMME_WITH_OPENMP
+   PRIMME_INT nChunks = (m + PRIMME_BLOCK_SIZE - 1) / PRIMME_BLOCK_SIZE;
+   if (!omp_in_parallel() && n > 0 && nx > 0) {
+      nThreads = (int)min(min(omp_get_max_threads(), nChunks),
+            lwork / ((size_t)n * nx));
+   }
+#else
+   (void)work;
+   (void)lwork;
+#endif
+
+   if (nThreads <= 1) {
+      csrmm_normal_rows_Sprimme(0, m, n, ia, ja, a, base, nx, x, ldx, y, ldy);
+   }
+#ifdef PRIMME_WITH_OPENMP
+   else {
+      PRIMME_INT i;
+      int j, t;
+
+#pragma omp parallel num_threads(nThreads) private(i, j, t)
+      {
+         t = omp_get_thread_num();
+         csrmm_normal_rows_Sprimme(m * t / nThreads, m * (t + 1) / nThreads,
+               n, ia, ja, a, base, nx, x, ldx, &work[(size_t)n * nx * t], n);
+
+#pragma omp barrier
+#pragma omp for schedule(static)
+         for (i = 0; i < n; i++) {
+            for (j = 0; j < nx; j++) {
+               SCALAR s = 0.0;
+               for (t = 0; t < nThreads; t++) {
+                  s += work[(size_t)n * nx * t + i + n * j];
+               }
+               y[i + ldy * j] = s;
+            }
+         }
+      }
+   }
+#endif
+
+   return 0;
+}
+
+/******************************************************************************
+ * Function Num_sellmm - Compute y = A*x, where A is a sparse matrix in
+ *    SELL-C-sigma format and x and y have several columns. The rows of A are
+ *    grouped in chunks of C rows, and every chunk is stored column-major and
+ *    padded to its longest row, so the C rows of a chunk are processed with
+ *    SIMD instructions. Every chunk is read once for every CSRMM_COLS columns
+ *    of x. If the library is compiled with OpenMP, the chunks are distributed
+ *    among the threads.
+ *
+ * PARAMETERS
+ * ---------------------------
+ * m           The number of rows of A
+ * C           The number of rows in a chunk, at most SELL_MAX_C
+ * cptr        The position in ccol and cval of the first element of every chunk
+ * clen        The number of columns of every chunk
+ * ccol        The zero-based column indices of the chunks
+ * cval        The values of the chunks
+ * perm        The row of y of every row of the chunks
+ * nx          The number of columns of x and y
+ * x           The input matrix
+ * ldx         The leading dimension of x
+ * y           The output matrix
+ * ldy         The leading dimension of y
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int Num_sellmm_Sprimme(PRIMME_INT m, int C, const PRIMME_INT *cptr,
+      const int *clen, const int *ccol, const SCALAR *cval, const int *perm,
+      int nx, SCALAR *x, PRIMME_INT ldx, SCALAR *y, PRIMME_INT ldy) {
+
+   PRIMME_INT c, nc = (m + C - 1) / C;
+   int j, j0, k, r;
+
+   if (C > SELL_MAX_C) return PRIMME_FUNCTION_UNAVAILABLE;
+
+#ifdef PRIMME_WITH_OPENMP
+#pragma omp parallel for private(j, j0, k, r) schedule(static)
+#endif
+   for (c = 0; c < nc; c++) {
+      int nr = (int)min(C, m - c * C);
+      for (j0 = 0; j0 < nx; j0 += CSRMM_COLS) {
+         int nj = min(CSRMM_COLS, nx - j0);
+         SCALAR s[CSRMM_COLS][SELL_MAX_C];
+         for (j = 0; j < nj; j++) {
+            for (r = 0; r < C; r++) s[j][r] = 0.0;
+         }
+         for (k = 0; k < clen[c]; k++) {
+            const SCALAR *v = &cval[cptr[c] + (PRIMME_INT)C * k];
+            const int *col = &ccol[cptr[c] + (PRIMME_INT)C * k];
+            for (j = 0; j < nj; j++) {
+               SCALAR *xj = &x[ldx * (j0 + j)], *sj = s[j];
+#ifdef PRIMME_WITH_OPENMP
+#pragma omp simd
+#endif
+               for (r = 0; r < C; r++) sj[r] += v[r] * xj[col[r]];
+            }
+         }
+         for (j = 0; j < nj; j++) {
+            for (r = 0; r < nr; r++) {
+               y[perm[c * C + r] + ldy * (j0 + j)] = s[j][r];
+            }
+         }
+      }
+   }
+
+   return 0;
+}
+#endif /* !defined(USE_HALF) && !defined(USE_HALFCOMPLEX) && !defined(USE_DHOST) */
 
 #endif /* USE_HOST */
 
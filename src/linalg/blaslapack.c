@@ -49,9 +49,7 @@
 
 #ifdef USE_DOUBLE
 static int free_fn_dummy (void *p, primme_context ctx) {
-   (void)ctx;
-   free(p);
-   return 0;
+   return Mem_free(p, ctx);
 }
 
 static int to_blas_int(PRIMME_INT i, PRIMME_BLASINT *out) {
@@ -103,8 +101,8 @@ int Num_malloc_Sprimme(PRIMME_INT n, SCALAR **x, primme_context ctx) {
 
    /* Allocate memory */
 
-   *x = (SCALAR *)malloc(sizeof(SCALAR) * n);
-   if (*x == NULL) return PRIMME_MALLOC_FAILURE;
+   if (Mem_malloc(sizeof(SCALAR) * n, (void **)x, ctx))
+      return PRIMME_MALLOC_FAILURE;
 
    /* Register the allocation */
 
@@ -136,7 +134,7 @@ int Num_free_Sprimme(SCALAR *x, primme_context ctx) {
 
    /* Free pointer */
 
-   free(x);
+   Mem_free(x, ctx);
 
    return 0;
 }
@@ -166,8 +164,8 @@ int Num_malloc_iprimme(PRIMME_INT n, int **x, primme_context ctx) {
 
    /* Allocate memory */
 
-   *x = (int *)malloc(sizeof(int) * n);
-   if (*x == NULL) return PRIMME_MALLOC_FAILURE;
+   if (Mem_malloc(sizeof(int) * n, (void **)x, ctx))
+      return PRIMME_MALLOC_FAILURE;
 
    /* Register the allocation */
 
@@ -198,7 +196,7 @@ int Num_free_iprimme(int *x, primme_context ctx) {
 
    /* Free pointer */
 
-   free(x);
+   Mem_free(x, ctx);
 
    return 0;
 }
@@ -228,8 +226,8 @@ static int Num_malloc_iblasprimme(
 
    /* Allocate memory */
 
-   *x = (PRIMME_BLASINT *)malloc(sizeof(PRIMME_BLASINT) * n);
-   if (*x == NULL) return PRIMME_MALLOC_FAILURE;
+   if (Mem_malloc(sizeof(PRIMME_BLASINT) * n, (void **)x, ctx))
+      return PRIMME_MALLOC_FAILURE;
 
    /* Register the allocation */
 
@@ -259,7 +257,7 @@ static int Num_free_iblasprimme(PRIMME_BLASINT *x, primme_context ctx) {
 
    /* Free pointer */
 
-   free(x);
+   Mem_free(x, ctx);
 
    return 0;
 }
@@ -279,7 +277,7 @@ int Num_copy_Sprimme(PRIMME_INT n, SCALAR *x, PRIMME_INT incx, SCALAR *y,
 
    if (x == y && incx == incy) return 0;
 
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
    (void)ctx;
    PRIMME_BLASINT ln, lincx, lincy;
    CHKERR(to_blas_int(n, &ln));
@@ -512,7 +510,7 @@ int Num_zero_matrix_Sprimme(SCALAR *x, PRIMME_INT m, PRIMME_INT n,
  * Subroutine Num_gemm_Sprimme - C = op(A)*op(B), with C size m x n
  ******************************************************************************/
 
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_gemm_Sprimme(const char *transa, const char *transb, PRIMME_INT m,
       PRIMME_INT n, PRIMME_INT k, HSCALAR alpha, SCALAR *a, PRIMME_INT lda,
@@ -558,7 +556,7 @@ int Num_gemm_Sprimme(const char *transa, const char *transb, PRIMME_INT m,
 
    return 0;
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 TEMPLATE_PLEASE
 int Num_gemm_dhd_Sprimme(const char *transa, const char *transb, PRIMME_INT m,
@@ -572,31 +570,46 @@ int Num_gemm_dhd_Sprimme(const char *transa, const char *transb, PRIMME_INT m,
          ((k == 0 || ABS(alpha) == 0.0) && beta == (HSCALAR)1.0))
       return 0;
 
+   /* If the matrices are going to be cast and the rows of a and c go */
+   /* together, that is, C = A*B, then stream the operation by rows    */
+
+   PRIMME_INT M = m;
+   if (PRIMME_OP_SCALAR != PRIMME_OP_HSCALAR &&
+         (*transa == 'N' || *transa == 'n') && m > PRIMME_BLOCK_SIZE) {
+      M = PRIMME_BLOCK_SIZE;
+   }
+
    /* Cast the matrices a and c to HSCALAR */
 
    HSCALAR *af = NULL, *cf = NULL;
    PRIMME_INT ldaf, ldcf, ldc0 = ldc;
-   PRIMME_INT ma = (*transa == 'N' || *transa == 'n') ? m : k;
+   PRIMME_INT ma = (*transa == 'N' || *transa == 'n') ? M : k;
    PRIMME_INT na = (*transa == 'N' || *transa == 'n') ? k : m;
 
-   CHKERR(Num_matrix_astype_Sprimme(a, ma, na, lda, PRIMME_OP_SCALAR,
-         (void **)&af, &ldaf, PRIMME_OP_HSCALAR, 1 /* alloc */, 1 /* copy */,
-         ctx));
-   CHKERR(Num_matrix_astype_Sprimme(c, m, n, ldc, PRIMME_OP_SCALAR,
-         (void **)&cf, &ldcf, PRIMME_OP_HSCALAR, 1 /* alloc */, 1 /* copy */,
-         ctx));
+   PRIMME_INT i;
+   for (i=0; i<m; i+=M, M=min(M,m-i)) {
+      if (*transa == 'N' || *transa == 'n') ma = M;
+      CHKERR(Num_matrix_astype_Sprimme(&a[i], ma, na, lda, PRIMME_OP_SCALAR,
+            (void **)&af, &ldaf, PRIMME_OP_HSCALAR,
+            i == 0 /* alloc the first time */, 1 /* copy */, ctx));
+      CHKERR(Num_matrix_astype_Sprimme(&c[i], M, n, ldc, PRIMME_OP_SCALAR,
+            (void **)&cf, &ldcf, PRIMME_OP_HSCALAR,
+            i == 0 /* alloc the first time */, 1 /* copy */, ctx));
 
-   /* Call the kernel */
+      /* Call the kernel */
 
-   CHKERR(Num_gemm_SHprimme(transa, transb, m, n, k, alpha, af, ldaf, b, ldb,
-         beta, cf, ldcf, ctx));
+      CHKERR(Num_gemm_SHprimme(transa, transb, M, n, k, alpha, af, ldaf, b,
+            ldb, beta, cf, ldcf, ctx));
 
-   /* Copy back c and destroy the cast matrices */
+      /* Copy back c, and destroy the cast matrix at the last rows */
+
+      SCALAR *ci = &c[i];
+      CHKERR(Num_matrix_astype_Sprimme(cf, M, n, ldcf, PRIMME_OP_HSCALAR,
+            (void **)&ci, &ldc0, PRIMME_OP_SCALAR,
+            i + M >= m ? -1 /* destroy */ : 0, 1 /* copy */, ctx));
+   }
 
    if (a != (SCALAR*)af) CHKERR(Num_free_SHprimme(af, ctx));
-   CHKERR(Num_matrix_astype_Sprimme(cf, m, n, ldcf, PRIMME_OP_HSCALAR,
-         (void **)&c, &ldc0, PRIMME_OP_SCALAR, -1 /* destroy */, 1 /* copy */,
-         ctx));
 
    return 0;
 }
@@ -613,12 +626,20 @@ int Num_gemm_ddh_Sprimme(const char *transa, const char *transb, PRIMME_INT m,
          ((k == 0 || ABS(alpha) == 0.0) && beta == (HSCALAR)1.0))
       return 0;
 
+   /* Quick exit, as the next loop doesn't run if k is zero */
+
+   if (k == 0) {
+      CHKERR(Num_gemm_SHprimme(transa, transb, m, n, k, alpha, NULL, 1, NULL,
+            1, beta, c, ldc, ctx));
+      return 0;
+   }
+
    /* If input matrices are going to be cast and the operation is the inner */
    /* product between, that is, C = A'*B, then stream the operation */
 
    PRIMME_INT K = k;
    if (PRIMME_OP_SCALAR != PRIMME_OP_HSCALAR &&
-         (*transa == 'C' || *transa == 'C') &&
+         (*transa == 'C' || *transa == 'c') &&
          (*transb == 'N' || *transb == 'n') && k > PRIMME_BLOCK_SIZE) {
       K = PRIMME_BLOCK_SIZE;
    }
@@ -660,7 +681,7 @@ int Num_gemm_ddh_Sprimme(const char *transa, const char *transb, PRIMME_INT m,
  *    where C size m x n.
  ******************************************************************************/
 
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_hemm_Sprimme(const char *side, const char *uplo, PRIMME_INT m,
       PRIMME_INT n, HSCALAR alpha, SCALAR *a, PRIMME_INT lda, SCALAR *b,
@@ -691,7 +712,7 @@ int Num_hemm_Sprimme(const char *side, const char *uplo, PRIMME_INT m,
  *    with B size m x n.
  ******************************************************************************/
 
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_trmm_Sprimme(const char *side, const char *uplo, const char *transa,
       const char *diag, PRIMME_INT m, PRIMME_INT n, HSCALAR alpha, SCALAR *a,
@@ -712,13 +733,13 @@ int Num_trmm_Sprimme(const char *side, const char *uplo, const char *transa,
 
    return 0;
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 /*******************************************************************************
  * Subroutine Num_gemv_Sprimme - y = alpha*A*x + beta*y, with A size m x n
  ******************************************************************************/
 
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_gemv_Sprimme(const char *transa, PRIMME_INT m, PRIMME_INT n,
       HSCALAR alpha, SCALAR *a, PRIMME_INT lda, SCALAR *x, PRIMME_INT incx,
@@ -776,7 +797,7 @@ int Num_gemv_Sprimme(const char *transa, PRIMME_INT m, PRIMME_INT n,
 
    return 0;
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 /*******************************************************************************
  * Subroutine Num_gemv_ddh_Sprimme - y = alpha*A*x + beta*y, with A size m x n
@@ -788,23 +809,54 @@ int Num_gemv_ddh_Sprimme(const char *transa, PRIMME_INT m, PRIMME_INT n,
       HSCALAR alpha, SCALAR *a, PRIMME_INT lda, SCALAR *x, PRIMME_INT incx,
       HSCALAR beta, HSCALAR *y, PRIMME_INT incy, primme_context ctx) {
 
-   /* Cast the matrices a and x to HSCALAR */
+   /* Quick exit, as the next loop doesn't run if m is zero */
+
+   if (m == 0) {
+      CHKERR(Num_gemv_SHprimme(transa, m, n, alpha, NULL, 1, NULL, 1, beta, y,
+            incy, ctx));
+      return 0;
+   }
+
+   /* If a is going to be cast, cast it by blocks of rows */
+
+   int notrans = (*transa == 'N' || *transa == 'n');
+   PRIMME_INT M = m;
+   if (PRIMME_OP_SCALAR != PRIMME_OP_HSCALAR && m > PRIMME_BLOCK_SIZE) {
+      M = PRIMME_BLOCK_SIZE;
+   }
+
+   /* Cast the matrices a and x to HSCALAR. If y = A*x, x is cast once; */
+   /* otherwise, the rows of x go with the rows of a                    */
 
    HSCALAR *af = NULL, *xf = NULL;
    PRIMME_INT ldaf, incxf;
-   PRIMME_INT mx = (*transa == 'N' || *transa == 'n') ? n : m;
 
-   CHKERR(Num_matrix_astype_Sprimme(a, m, n, lda, PRIMME_OP_SCALAR,
-         (void **)&af, &ldaf, PRIMME_OP_HSCALAR, 1 /* alloc */, 1 /* copy */,
-         ctx));
-   CHKERR(Num_matrix_astype_Sprimme(x, 1, mx, incx, PRIMME_OP_SCALAR,
-         (void **)&xf, &incxf, PRIMME_OP_HSCALAR, 1 /* alloc */, 1 /* copy */,
-         ctx));
+   if (notrans) {
+      CHKERR(Num_matrix_astype_Sprimme(x, 1, n, incx, PRIMME_OP_SCALAR,
+            (void **)&xf, &incxf, PRIMME_OP_HSCALAR, 1 /* alloc */,
+            1 /* copy */, ctx));
+   }
 
-   /* Call the kernel */
+   PRIMME_INT i;
+   for (i=0; i<m; i+=M, M=min(M,m-i)) {
+      CHKERR(Num_matrix_astype_Sprimme(&a[i], M, n, lda, PRIMME_OP_SCALAR,
+            (void **)&af, &ldaf, PRIMME_OP_HSCALAR,
+            i == 0 /* alloc the first time */, 1 /* copy */, ctx));
 
-   CHKERR(Num_gemv_SHprimme(
-         transa, m, n, alpha, af, m, xf, 1, beta, y, incy, ctx));
+      /* Call the kernel */
+
+      if (notrans) {
+         CHKERR(Num_gemv_SHprimme(transa, M, n, alpha, af, ldaf, xf, incxf,
+               beta, &y[i * incy], incy, ctx));
+      } else {
+         CHKERR(Num_matrix_astype_Sprimme(&x[i * incx], 1, M, incx,
+               PRIMME_OP_SCALAR, (void **)&xf, &incxf, PRIMME_OP_HSCALAR,
+               i == 0 /* alloc the first time */, 1 /* copy */, ctx));
+         CHKERR(Num_gemv_SHprimme(
+               transa, M, n, alpha, af, ldaf, xf, incxf, beta, y, incy, ctx));
+         beta = (HSCALAR)1.0;
+      }
+   }
 
    if (a != (SCALAR*)af) CHKERR(Num_free_SHprimme(af, ctx));
    if (x != (SCALAR*)xf) CHKERR(Num_free_SHprimme(xf, ctx));
@@ -822,28 +874,71 @@ int Num_gemv_dhd_Sprimme(const char *transa, PRIMME_INT m, PRIMME_INT n,
       HSCALAR alpha, SCALAR *a, PRIMME_INT lda, HSCALAR *x, PRIMME_INT incx,
       HSCALAR beta, SCALAR *y, PRIMME_INT incy, primme_context ctx) {
 
-   /* Cast the matrices a and y to HSCALAR */
+   int notrans = (*transa == 'N' || *transa == 'n');
+
+   /* Quick exit, as the next loop doesn't run if m is zero */
+
+   if (m == 0) {
+      if (!notrans && ABS(beta) == 0.0) {
+         CHKERR(Num_zero_matrix_Sprimme(y, 1, n, incy, ctx));
+      } else if (!notrans) {
+         CHKERR(Num_scal_Sprimme(n, beta, y, incy, ctx));
+      }
+      return 0;
+   }
+
+   /* If a is going to be cast, cast it by blocks of rows */
+
+   PRIMME_INT M = m;
+   if (PRIMME_OP_SCALAR != PRIMME_OP_HSCALAR && m > PRIMME_BLOCK_SIZE) {
+      M = PRIMME_BLOCK_SIZE;
+   }
+
+   /* Cast the matrices a and y to HSCALAR. If y = A'*x, y is cast once; */
+   /* otherwise, the rows of y go with the rows of a                     */
 
    HSCALAR *af = NULL, *yf = NULL;
    PRIMME_INT ldaf, incyf, incy0 = incy;
-   PRIMME_INT my = (*transa == 'N' || *transa == 'n') ? m : n;
 
-   CHKERR(Num_matrix_astype_Sprimme(a, m, n, lda, PRIMME_OP_SCALAR,
-         (void **)&af, &ldaf, PRIMME_OP_HSCALAR, 1 /* alloc */, 1 /* copy */,
-         ctx));
-   CHKERR(Num_matrix_astype_Sprimme(y, 1, my, incy, PRIMME_OP_SCALAR,
-         (void **)&yf, &incyf, PRIMME_OP_HSCALAR, 1 /* alloc */, 1 /* copy */,
-         ctx));
+   if (!notrans) {
+      CHKERR(Num_matrix_astype_Sprimme(y, 1, n, incy, PRIMME_OP_SCALAR,
+            (void **)&yf, &incyf, PRIMME_OP_HSCALAR, 1 /* alloc */,
+            1 /* copy */, ctx));
+   }
+
+   PRIMME_INT i;
+   for (i=0; i<m; i+=M, M=min(M,m-i)) {
+      CHKERR(Num_matrix_astype_Sprimme(&a[i], M, n, lda, PRIMME_OP_SCALAR,
+            (void **)&af, &ldaf, PRIMME_OP_HSCALAR,
+            i == 0 /* alloc the first time */, 1 /* copy */, ctx));
 
-   CHKERR(Num_gemv_SHprimme(
-         transa, m, n, alpha, af, m, x, incx, beta, yf, incyf, ctx));
+      /* Call the kernel, and copy back y if y = A*x */
+
+      if (notrans) {
+         SCALAR *yi = &y[i * incy];
+         CHKERR(Num_matrix_astype_Sprimme(yi, 1, M, incy, PRIMME_OP_SCALAR,
+               (void **)&yf, &incyf, PRIMME_OP_HSCALAR,
+               i == 0 /* alloc the first time */, 1 /* copy */, ctx));
+         CHKERR(Num_gemv_SHprimme(transa, M, n, alpha, af, ldaf, x, incx,
+               beta, yf, incyf, ctx));
+         CHKERR(Num_matrix_astype_Sprimme(yf, 1, M, incyf, PRIMME_OP_HSCALAR,
+               (void **)&yi, &incy0, PRIMME_OP_SCALAR,
+               i + M >= m ? -1 /* destroy */ : 0, 1 /* copy */, ctx));
+      } else {
+         CHKERR(Num_gemv_SHprimme(transa, M, n, alpha, af, ldaf, &x[i * incx],
+               incx, beta, yf, incyf, ctx));
+         beta = (HSCALAR)1.0;
+      }
+   }
 
-   /* Copy back y and destroy cast matrices */
+   /* Copy back y and destroy the cast matrices */
 
    if (a != (SCALAR*)af) CHKERR(Num_free_SHprimme(af, ctx));
-   CHKERR(Num_matrix_astype_Sprimme(yf, 1, my, incyf, PRIMME_OP_HSCALAR,
-         (void **)&y, &incy0, PRIMME_OP_SCALAR, -1 /* destroy */, 1 /* copy */,
-         ctx));
+   if (!notrans) {
+      CHKERR(Num_matrix_astype_Sprimme(yf, 1, n, incyf, PRIMME_OP_HSCALAR,
+            (void **)&y, &incy0, PRIMME_OP_SCALAR, -1 /* destroy */,
+            1 /* copy */, ctx));
+   }
 
    return 0;
 }
@@ -857,7 +952,7 @@ int Num_axpy_Sprimme(PRIMME_INT n, HSCALAR alpha, SCALAR *x, PRIMME_INT incx,
       SCALAR *y, PRIMME_INT incy, primme_context ctx) {
 
    (void)ctx;
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
    PRIMME_BLASINT ln, lincx, lincy;
    CHKERR(to_blas_int(incx, &lincx));
    CHKERR(to_blas_int(incy, &lincy));
@@ -888,7 +983,7 @@ HSCALAR Num_dot_Sprimme(PRIMME_INT n, SCALAR *x, PRIMME_INT incx, SCALAR *y,
       PRIMME_INT incy, primme_context ctx) {
    (void)ctx;
 /* NOTE: vecLib doesn't follow BLAS reference for sdot */
-#if defined(USE_COMPLEX) || (defined(USE_FLOAT) && (defined(__APPLE__) || defined(__MACH__))) || (defined(USE_HALF) && !defined(BLASLAPACK_WITH_HALF))
+#if defined(USE_COMPLEX) || (defined(USE_FLOAT) && (defined(__APPLE__) || defined(__MACH__))) || !defined(BLASLAPACK_WITH_SCALAR)
 /* ---- Explicit implementation of the zdotc() --- */
    PRIMME_INT i;
    HSCALAR zdotc = 0.0;
@@ -940,7 +1035,7 @@ int Num_larnv_Sprimme(int idist, PRIMME_INT *iseed, PRIMME_INT length,
    assert(idist < 4); /* complex distributions are not supported */
    return Num_larnv_Rprimme(idist, iseed, length*2, (REAL*)x, ctx);
 
-#elif (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#elif defined(BLASLAPACK_WITH_SCALAR)
    PRIMME_BLASINT lidist;
    CHKERR(to_blas_int(idist, &lidist));
    PRIMME_BLASINT llength;
@@ -989,7 +1084,7 @@ int Num_scal_Sprimme(PRIMME_INT n, HSCALAR alpha, SCALAR *x, PRIMME_INT incx,
       primme_context ctx) {
 
    (void)ctx;
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
    PRIMME_BLASINT ln, lincx;
    CHKERR(to_blas_int(incx, &lincx));
 
@@ -1010,12 +1105,29 @@ int Num_scal_Sprimme(PRIMME_INT n, HSCALAR alpha, SCALAR *x, PRIMME_INT incx,
 /*******************************************************************************
  * Subroutines for dense eigenvalue decomposition
  * NOTE: xheevx is used instead of xheev because xheev is not in ESSL
+ *
+ * Num_heevx and Num_hegvx compute only the eigenpairs il:iu-1 (counting from
+ * zero in ascending order). The eigenvalues are returned in w(0:iu-il-1) and
+ * the eigenvectors in the first iu-il columns of a. Still, w should have
+ * space for n values.
  ******************************************************************************/
  
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_heev_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
       SCALAR *a, PRIMME_INT lda, REAL *w, primme_context ctx) {
+
+   return Num_heevx_Sprimme(jobz, uplo, n, a, lda, 0, n, w, ctx);
+}
+
+TEMPLATE_PLEASE
+int Num_heevx_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
+      SCALAR *a, PRIMME_INT lda, PRIMME_INT il, PRIMME_INT iu, REAL *w,
+      primme_context ctx) {
+
+   /* Zero dimension matrix may cause problems */
+   if (n == 0 || il >= iu) return 0;
+
 #ifndef USE_XHEEV
 
    PRIMME_BLASINT ln, llda;
@@ -1030,10 +1142,8 @@ int Num_heev_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
 #  endif
    PRIMME_BLASINT *iwork, *ifail;
    REAL   dummyr=0;
-   PRIMME_BLASINT dummyi=0;
-
-   /* Zero dimension matrix may cause problems */
-   if (n == 0) return 0;
+   PRIMME_BLASINT lil = il + 1, liu = iu, lm = 0;
+   const char *range = (il == 0 && iu == n) ? "A" : "I";
 
    /* Allocate arrays */
 
@@ -1048,8 +1158,8 @@ int Num_heev_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
 
    lldwork = -1;
    SCALAR lwork0 = 0;
-   XHEEVX(jobz, "A", uplo, &ln, a, &llda, &dummyr, &dummyr,
-         &dummyi, &dummyi, &abstol, &dummyi, w, z, &ln, &lwork0, &lldwork,
+   XHEEVX(jobz, range, uplo, &ln, a, &llda, &dummyr, &dummyr,
+         &lil, &liu, &abstol, &lm, w, z, &ln, &lwork0, &lldwork,
 #  ifdef USE_COMPLEX
          &dummyr,
 #  endif
@@ -1061,8 +1171,8 @@ int Num_heev_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    if (linfo == 0) {
       SCALAR *work = NULL;
       CHKERR(Num_malloc_Sprimme(lldwork, &work, ctx));
-      XHEEVX(jobz, "A", uplo, &ln, a, &llda, &dummyr, &dummyr,
-            &dummyi, &dummyi, &abstol, &dummyi, w, z, &ln, work, &lldwork,
+      XHEEVX(jobz, range, uplo, &ln, a, &llda, &dummyr, &dummyr,
+            &lil, &liu, &abstol, &lm, w, z, &ln, work, &lldwork,
 #  ifdef USE_COMPLEX
             rwork,
 #  endif
@@ -1071,7 +1181,7 @@ int Num_heev_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    }
 
    /* Copy z to a */
-   Num_copy_matrix_Sprimme(z, n, n, n, a, lda, ctx);
+   Num_copy_matrix_Sprimme(z, n, iu - il, n, a, lda, ctx);
 
    CHKERR(Num_free_Sprimme(z, ctx)); 
 #  ifdef USE_COMPLEX
@@ -1095,9 +1205,6 @@ int Num_heev_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    REAL *rwork;
 #  endif
 
-   /* Zero dimension matrix may cause problems */
-   if (n == 0) return 0;
-
 #  ifdef USE_COMPLEX
    CHKERR(Num_malloc_Rprimme(3*n, &rwork, ctx));
 #  endif
@@ -1130,11 +1237,19 @@ int Num_heev_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    
    CHKERRM(linfo != 0, PRIMME_LAPACK_FAILURE, "Error in xheev with info %d",
           (int)linfo);
+
+   /* Move the eigenpairs il:iu-1 to the beginning */
+
+   PRIMME_INT i;
+   for (i = il; i < iu && il > 0; i++) {
+      w[i - il] = w[i];
+      CHKERR(Num_copy_Sprimme(n, &a[lda * i], 1, &a[lda * (i - il)], 1, ctx));
+   }
    return 0;
 
 #endif
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 
 /*******************************************************************************
@@ -1142,17 +1257,28 @@ int Num_heev_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
  * NOTE: xhegvx is used instead of xhegv because xhegv is not in ESSL
  ******************************************************************************/
  
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
       SCALAR *a, PRIMME_INT lda, SCALAR *b0, PRIMME_INT ldb0, REAL *w,
       primme_context ctx) {
 
+   return Num_hegvx_Sprimme(jobz, uplo, n, a, lda, b0, ldb0, 0, n, w, ctx);
+}
+
+TEMPLATE_PLEASE
+int Num_hegvx_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
+      SCALAR *a, PRIMME_INT lda, SCALAR *b0, PRIMME_INT ldb0, PRIMME_INT il,
+      PRIMME_INT iu, REAL *w, primme_context ctx) {
+
    /* Call heev if b is null */
    if (b0 == NULL) {
-      return Num_heev_Sprimme(jobz, uplo, n, a, lda, w, ctx);
+      return Num_heevx_Sprimme(jobz, uplo, n, a, lda, il, iu, w, ctx);
    }
 
+   /* Zero dimension matrix may cause problems */
+   if (n == 0 || il >= iu) return 0;
+
 #ifndef USE_XHEGV
 
    PRIMME_BLASINT ln, llda;
@@ -1168,10 +1294,8 @@ int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
 #  endif
    PRIMME_BLASINT *iwork, *ifail;
    REAL   dummyr=0;
-   PRIMME_BLASINT dummyi=0;
-
-   /* Zero dimension matrix may cause problems */
-   if (n == 0) return 0;
+   PRIMME_BLASINT lil = il + 1, liu = iu, lm = 0;
+   const char *range = (il == 0 && iu == n) ? "A" : "I";
 
    /* Allocate arrays */
 
@@ -1191,8 +1315,8 @@ int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
 
    lldwork = -1;
    SCALAR lwork0 = 0;
-   XHEGVX(&ONE, jobz, "A", uplo, &ln, a, &llda, b, &ln, &dummyr, &dummyr,
-         &dummyi, &dummyi, &abstol, &dummyi, w, z, &ln, &lwork0, &lldwork,
+   XHEGVX(&ONE, jobz, range, uplo, &ln, a, &llda, b, &ln, &dummyr, &dummyr,
+         &lil, &liu, &abstol, &lm, w, z, &ln, &lwork0, &lldwork,
 #  ifdef USE_COMPLEX
          rwork,
 #  endif
@@ -1202,8 +1326,8 @@ int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    if (linfo == 0) {
       SCALAR *work = NULL;
       CHKERR(Num_malloc_Sprimme(lldwork, &work, ctx));
-      XHEGVX(&ONE, jobz, "A", uplo, &ln, a, &llda, b, &ln, &dummyr, &dummyr,
-            &dummyi, &dummyi, &abstol, &dummyi, w, z, &ln, work, &lldwork,
+      XHEGVX(&ONE, jobz, range, uplo, &ln, a, &llda, b, &ln, &dummyr,
+            &dummyr, &lil, &liu, &abstol, &lm, w, z, &ln, work, &lldwork,
 #  ifdef USE_COMPLEX
             rwork,
 #  endif
@@ -1212,7 +1336,7 @@ int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    }
 
    /* Copy z to a */
-   Num_copy_matrix_Sprimme(z, n, n, n, a, lda, ctx);
+   Num_copy_matrix_Sprimme(z, n, iu - il, n, a, lda, ctx);
 
    CHKERR(Num_free_Sprimme(z, ctx)); 
    CHKERR(Num_free_Sprimme(b, ctx)); 
@@ -1240,9 +1364,6 @@ int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    REAL *rwork;
 #  endif
 
-   /* Zero dimension matrix may cause problems */
-   if (n == 0) return 0;
-
    CHKERR(Num_malloc_Sprimme(n*n, &b, ctx)); 
 #  ifdef USE_COMPLEX
    CHKERR(Num_malloc_Rprimme(3*n, &rwork, ctx));
@@ -1276,18 +1397,26 @@ int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
 #  ifdef USE_COMPLEX
    CHKERR(Num_free_Rprimme(rwork, ctx));
 #  endif
+
+   /* Move the eigenpairs il:iu-1 to the beginning */
+
+   PRIMME_INT i;
+   for (i = il; i < iu && il > 0; i++) {
+      w[i - il] = w[i];
+      CHKERR(Num_copy_Sprimme(n, &a[lda * i], 1, &a[lda * (i - il)], 1, ctx));
+   }
    return 0;
  
 #endif
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 /*******************************************************************************
  * Subroutines for dense Schur decomposition
  * NOTE: only for complex matrices
  ******************************************************************************/
  
-#if defined(USE_COMPLEX) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF))
+#if defined(USE_COMPLEX) && defined(BLASLAPACK_WITH_SCALAR)
 
 TEMPLATE_PLEASE
 int Num_gees_Sprimme(const char *jobvs, PRIMME_INT n, SCALAR *a, PRIMME_INT lda,
@@ -1332,13 +1461,13 @@ int Num_gees_Sprimme(const char *jobvs, PRIMME_INT n, SCALAR *a, PRIMME_INT lda,
           (int)linfo);
    return 0;
 }
-#endif /* defined(USE_COMPLEX) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)) */
+#endif /* defined(USE_COMPLEX) && defined(BLASLAPACK_WITH_SCALAR) */
 
 /*******************************************************************************
  * Subroutines for dense singular value decomposition
  ******************************************************************************/
  
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_gesvd_Sprimme(const char *jobu, const char *jobvt, PRIMME_INT m,
       PRIMME_INT n, SCALAR *a, PRIMME_INT lda, REAL *s, SCALAR *u,
@@ -1394,13 +1523,13 @@ int Num_gesvd_Sprimme(const char *jobu, const char *jobvt, PRIMME_INT m,
           (int)linfo);
    return 0;
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 /*******************************************************************************
  * Subroutine Num_hetrf_Sprimme - LL^H factorization with pivoting
  ******************************************************************************/
 
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_hetrf_Sprimme(const char *uplo, PRIMME_INT n, SCALAR *a, PRIMME_INT lda,
       int *ipivot, primme_context ctx) {
@@ -1478,13 +1607,13 @@ int Num_hetrf_Sprimme(const char *uplo, PRIMME_INT n, SCALAR *a, PRIMME_INT lda,
 
 #endif
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 /*******************************************************************************
  * Subroutine Num_hetrs_Sprimme - b = A\b where A may store a LL^H factorization
  ******************************************************************************/
  
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_hetrs_Sprimme(const char *uplo, PRIMME_INT n, PRIMME_INT nrhs,
       SCALAR *a, PRIMME_INT lda, int *ipivot, SCALAR *b, PRIMME_INT ldb,
@@ -1529,13 +1658,13 @@ int Num_hetrs_Sprimme(const char *uplo, PRIMME_INT n, PRIMME_INT nrhs,
 
    return 0;
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 /*******************************************************************************
  * Subroutine Num_potrf_Sprimme - Cholesky factorization
  ******************************************************************************/
  
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_potrf_Sprimme(const char *uplo, PRIMME_INT n, SCALAR *a, PRIMME_INT lda,
       int *info, primme_context ctx) {
@@ -1560,14 +1689,14 @@ int Num_potrf_Sprimme(const char *uplo, PRIMME_INT n, SCALAR *a, PRIMME_INT lda,
 
    return 0;
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 
 /*******************************************************************************
  * Subroutine Num_trsm_Sprimme - b = op(A)\b, where A is triangular
  ******************************************************************************/
  
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_trsm_Sprimme(const char *side, const char *uplo, const char *transa,
       const char *diag, PRIMME_INT m, PRIMME_INT n, HSCALAR alpha, SCALAR *a,
@@ -1587,32 +1716,44 @@ int Num_trsm_Sprimme(const char *side, const char *uplo, const char *transa,
 
    return 0;
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 TEMPLATE_PLEASE
 int Num_trsm_hd_Sprimme(const char *side, const char *uplo, const char *transa,
       const char *diag, PRIMME_INT m, PRIMME_INT n, HSCALAR alpha, HSCALAR *a,
       PRIMME_INT lda, SCALAR *b, PRIMME_INT ldb, primme_context ctx) {
 
-   /* Cast the matrix b to HSCALAR */
+   /* If b is going to be cast and the rows of b are independent, that is, */
+   /* b = b*op(A)^{-1}, then cast b by blocks of rows                      */
+
+   PRIMME_INT M = m;
+   if (PRIMME_OP_SCALAR != PRIMME_OP_HSCALAR &&
+         (*side == 'R' || *side == 'r') && m > PRIMME_BLOCK_SIZE) {
+      M = PRIMME_BLOCK_SIZE;
+   }
 
    HSCALAR *bf = NULL;
-   PRIMME_INT ldbf;
-   CHKERR(
-         Num_matrix_astype_Sprimme(b, m, n, ldb, PRIMME_OP_SCALAR, (void **)&bf,
-               &ldbf, PRIMME_OP_HSCALAR, 1 /* alloc */, 1 /* copy */, ctx));
+   PRIMME_INT ldbf, ldb_ = ldb;
+   PRIMME_INT i;
+   for (i=0; i<m; i+=M, M=min(M,m-i)) {
+      /* Cast the matrix b to HSCALAR */
 
-   /* Call the kernel */
+      SCALAR *bi = &b[i];
+      CHKERR(Num_matrix_astype_Sprimme(bi, M, n, ldb, PRIMME_OP_SCALAR,
+            (void **)&bf, &ldbf, PRIMME_OP_HSCALAR,
+            i == 0 /* alloc the first time */, 1 /* copy */, ctx));
+
+      /* Call the kernel */
 
-   CHKERR(Num_trsm_SHprimme(
-         side, uplo, transa, diag, m, n, alpha, a, lda, bf, ldbf, ctx));
+      CHKERR(Num_trsm_SHprimme(
+            side, uplo, transa, diag, M, n, alpha, a, lda, bf, ldbf, ctx));
 
-   /* Copy back and destroy the cast matrix */
+      /* Copy back, and destroy the cast matrix at the last rows */
 
-   PRIMME_INT ldb_ = ldb;
-   CHKERR(Num_matrix_astype_Sprimme(bf, m, n, ldbf, PRIMME_OP_HSCALAR,
-         (void **)&b, &ldb_, PRIMME_OP_SCALAR, -1 /* destroy */, 1 /* copy */,
-         ctx));
+      CHKERR(Num_matrix_astype_Sprimme(bf, M, n, ldbf, PRIMME_OP_HSCALAR,
+            (void **)&bi, &ldb_, PRIMME_OP_SCALAR,
+            i + M >= m ? -1 /* destroy */ : 0, 1 /* copy */, ctx));
+   }
 
    return 0;
 }
@@ -1621,7 +1762,7 @@ int Num_trsm_hd_Sprimme(const char *side, const char *uplo, const char *transa,
  * Subroutine Num_getrf_Sprimme - Factorize A=LU
  ******************************************************************************/
  
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_getrf_Sprimme(PRIMME_INT m, PRIMME_INT n, SCALAR *a, PRIMME_INT lda,
       int *ipivot, primme_context ctx) {
@@ -1656,13 +1797,13 @@ int Num_getrf_Sprimme(PRIMME_INT m, PRIMME_INT n, SCALAR *a, PRIMME_INT lda,
 
    return 0;
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 /*******************************************************************************
  * Subroutine Num_getrs_Sprimme - Computes A\X where A=LU computed with getrf
  ******************************************************************************/
  
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 TEMPLATE_PLEASE
 int Num_getrs_Sprimme(const char *trans, PRIMME_INT n, PRIMME_INT nrhs,
       SCALAR *a, PRIMME_INT lda, int *ipivot, SCALAR *b, PRIMME_INT ldb,
@@ -1700,7 +1841,7 @@ int Num_getrs_Sprimme(const char *trans, PRIMME_INT n, PRIMME_INT nrhs,
 
    return 0;
 }
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
 
 /*******************************************************************************
  * Subroutine Num_compute_gramm_ddh - Computes the upper part of the Gramm matrix
@@ -117,7 +117,7 @@
 #endif
 
 
-#if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
+#if defined(BLASLAPACK_WITH_SCALAR)
 
 #ifdef __cplusplus
 extern "C" {
@@ -166,4 +166,4 @@ void XGETRS(STRING trans, PRIMME_BLASINT *n, PRIMME_BLASINT *nrhs, SCALAR *a, PR
 }
 #endif /* __cplusplus */
 
-#endif /* (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF) */
+#endif /* defined(BLASLAPACK_WITH_SCALAR) */
@@ -41,6 +41,12 @@
 #include <stdlib.h>   /* free */
 #include <assert.h>
 #include <math.h>
+#include <string.h>   /* strlen */
+#if defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  define PRIMME_WITH_MMAP
+#endif
 #include "common.h"
 #include "memman.h"
 
@@ -176,7 +182,7 @@ int Mem_pop_clean_frame(primme_context ctx) {
    while (a) {
       primme_alloc *a_prev = a->prev;
       if (a->p) a->free_fn(a->p, ctx);
-      free(a);
+      Mem_free(a, ctx);
       a = a_prev;
    }
 
@@ -217,7 +223,7 @@ int Mem_register_alloc(void *p, free_fn_type free_fn, primme_context ctx) {
    assert(ctx.mm);
 
    primme_alloc *prev_alloc = ctx.mm->prev_alloc, *a;
-   CHKERR(MALLOC_PRIMME(1, &a)); 
+   CHKERR(Mem_malloc(sizeof(primme_alloc), (void **)&a, ctx));
    a->p = p;
    a->free_fn = free_fn;
    a->prev = prev_alloc;
@@ -264,7 +270,7 @@ int Mem_deregister_alloc(void *p, primme_context ctx) {
 
    assert(a);
    *prev = a->prev;
-   free(a);
+   Mem_free(a, ctx);
 
    return 0;
 }
@@ -297,3 +303,323 @@ int Mem_debug_frame(const char *debug, primme_context ctx) {
 
    return 0;
 }
+
+/*******************************************************************************
+ * Optional arena for temporaries.
+ *
+ * If ctx.arena has reserved memory, Mem_malloc serves the requests from it by
+ * bumping an offset, and falls back to malloc when the arena is exhausted.
+ * Allocations in PRIMME are mostly scoped by frames, but they may be freed in
+ * any order (e.g., Mem_keep_frame, or Num_free_Sprimme called in a different
+ * order than the allocation). So every block has a header with the offset of
+ * the previous block and a freed flag; Mem_free marks the block as freed and
+ * pops all freed blocks from the top of the arena.
+ *
+ ******************************************************************************/
+
+typedef struct {
+   size_t prev;   /* Offset of the header of the previous block */
+   size_t freed;  /* Whether the block has been freed */
+} arena_block;
+
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(S) (((S) + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN)
+#define ARENA_HEADER ARENA_ROUND(sizeof(arena_block))
+#define ARENA_NONE ((size_t)-1)
+
+/*******************************************************************************
+ * Subroutine Mem_malloc - Allocate memory from the arena if there is room
+ *    for it, and from the system otherwise.
+ * 
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * size     Number of bytes to allocate
+ * ctx      context
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * p        Allocated pointer
+ *
+ ******************************************************************************/
+
+int Mem_malloc(size_t size, void **p, primme_context ctx) {
+
+   primme_arena *arena = ctx.arena;
+   if (arena && arena->base && size <= arena->size &&
+         ARENA_HEADER + ARENA_ROUND(size) <= arena->size - arena->top) {
+      arena_block *b = (arena_block *)&arena->base[arena->top];
+      b->prev = arena->last;
+      b->freed = 0;
+      arena->last = arena->top;
+      arena->top += ARENA_HEADER + ARENA_ROUND(size);
+      *p = (char *)b + ARENA_HEADER;
+      arena->served++;
+      return 0;
+   }
+
+   if (arena && arena->base && size > arena->missed) arena->missed = size;
+   *p = malloc(size);
+   return *p == NULL ? PRIMME_MALLOC_FAILURE : 0;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_free - Free a pointer returned by Mem_malloc.
+ * 
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * p        Pointer to free
+ * ctx      context
+ *
+ ******************************************************************************/
+
+int Mem_free(void *p, primme_context ctx) {
+
+   primme_arena *arena = ctx.arena;
+   if (!arena || !arena->base || (char *)p < arena->base ||
+         (char *)p >= arena->base + arena->size) {
+      free(p);
+      return 0;
+   }
+
+   /* Mark the block as freed and release the freed blocks at the top */
+
+   ((arena_block *)((char *)p - ARENA_HEADER))->freed = 1;
+   while (arena->last != ARENA_NONE) {
+      arena_block *b = (arena_block *)&arena->base[arena->last];
+      if (!b->freed) break;
+      arena->top = arena->last;
+      arena->last = b->prev;
+   }
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_arena_init - Initialize an empty arena.
+ * 
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * arena    the arena
+ *
+ ******************************************************************************/
+
+void Mem_arena_init(primme_arena *arena) {
+
+   arena->base = NULL;
+   arena->size = arena->top = arena->missed = arena->served = 0;
+   arena->last = ARENA_NONE;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_arena_create - Set an empty arena in the context.
+ * 
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * ctx      context
+ *
+ * Return Value
+ * ------------
+ * PRIMME_MALLOC_FAILURE if the arena could not be allocated; then ctx is not
+ * changed
+ *
+ ******************************************************************************/
+
+int Mem_arena_create(primme_context *ctx) {
+
+   primme_arena *arena;
+   if (MALLOC_PRIMME(1, &arena)) return PRIMME_MALLOC_FAILURE;
+   Mem_arena_init(arena);
+   ctx->arena = arena;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_arena_reserve - Reserve the memory for the arena if it has
+ *    not been done already. If the arena is reused and it is smaller than size
+ *    or some request did not fit in it since the last call, the arena is
+ *    enlarged while it is empty.
+ *    If the allocation fails, the arena stays empty and all requests go to
+ *    the system allocator.
+ * 
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * size     Number of bytes to reserve
+ * ctx      context
+ *
+ ******************************************************************************/
+
+int Mem_arena_reserve(size_t size, primme_context ctx) {
+
+   primme_arena *arena = ctx.arena;
+   if (!arena) return 0;
+
+   if (arena->base && arena->top == 0 &&
+         (arena->missed > 0 || size > arena->size)) {
+      if (arena->missed > 0) size = max(size, arena->size * 2 + arena->missed);
+      free(arena->base);
+      arena->base = NULL;
+      arena->size = 0;
+   }
+   arena->missed = arena->served = 0;
+   if (arena->base || size == 0) return 0;
+
+   arena->base = (char *)malloc(size);
+   if (arena->base) arena->size = size;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_arena_destroy - Free the arena in the context.
+ * 
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * ctx      context
+ *
+ ******************************************************************************/
+
+int Mem_arena_destroy(primme_context *ctx) {
+
+   if (!ctx || !ctx->arena) return 0;
+
+   if (ctx->arena->base) free(ctx->arena->base);
+   free(ctx->arena);
+   ctx->arena = NULL;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Optional file-backed memory for the large arrays.
+ *
+ * Mem_map creates an anonymous (unlinked) file in a given directory and maps
+ * it, so that the pages are written back to the file instead of taking RAM.
+ * The first page keeps the size of the mapping for Mem_unmap.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Subroutine Mem_map - Allocate memory backed by a temporary file.
+ * 
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * size     Number of bytes to allocate
+ * dir      Directory where to create the file
+ * ctx      context
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * p        Allocated pointer
+ *
+ ******************************************************************************/
+
+int Mem_map(size_t size, const char *dir, void **p, primme_context ctx) {
+
+#ifdef PRIMME_WITH_MMAP
+   size_t page = (size_t)sysconf(_SC_PAGESIZE);
+   size_t total = page + (size + page - 1) / page * page;
+
+   /* Create the file and remove its name, so that it is deleted when */
+   /* unmapped or when the process finishes                           */
+
+   const char *name = "/primme-XXXXXX";
+   char *path;
+   if (MALLOC_PRIMME(strlen(dir) + strlen(name) + 1, &path)) {
+      return PRIMME_MALLOC_FAILURE;
+   }
+   strcpy(path, dir);
+   strcat(path, name);
+   int fd = mkstemp(path);
+   if (fd >= 0) unlink(path);
+   free(path);
+   if (fd < 0) {
+      PRINTFALLCTX(ctx, 1, "Could not create a file in '%s'", dir);
+      return PRIMME_MALLOC_FAILURE;
+   }
+
+   void *base = MAP_FAILED;
+   if (ftruncate(fd, (off_t)total) == 0) {
+      base = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   }
+   close(fd);
+   if (base == MAP_FAILED) {
+      PRINTFALLCTX(ctx, 1, "Could not map %zu bytes in '%s'", total, dir);
+      return PRIMME_MALLOC_FAILURE;
+   }
+
+   *(size_t *)base = total;
+   *p = (char *)base + page;
+   return 0;
+#else
+   (void)size;
+   (void)dir;
+   (void)p;
+   (void)ctx;
+   return PRIMME_FUNCTION_UNAVAILABLE;
+#endif
+}
+
+/*******************************************************************************
+ * Subroutine Mem_unmap - Free a pointer returned by Mem_map.
+ * 
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * p        Pointer to free
+ * ctx      context
+ *
+ ******************************************************************************/
+
+int Mem_unmap(void *p, primme_context ctx) {
+   (void)ctx;
+
+#ifdef PRIMME_WITH_MMAP
+   if (!p) return 0;
+   char *base = (char *)p - (size_t)sysconf(_SC_PAGESIZE);
+   return munmap(base, *(size_t *)base) == 0 ? 0 : PRIMME_UNEXPECTED_FAILURE;
+#else
+   (void)p;
+   return PRIMME_FUNCTION_UNAVAILABLE;
+#endif
+}
+
+/*******************************************************************************
+ * Subroutine Mem_prefetch - Ask the system to start reading the pages of a
+ *    mapped region that will be used soon, without waiting for them. The
+ *    region is n pieces of size bytes separated by ld bytes. If the pieces are
+ *    not contiguous, they are advised one by one only if every one spans
+ *    several pages; otherwise a call per page costs more than it saves.
+ * 
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * p        Pointer to the first byte of the region
+ * size     Number of bytes of every piece
+ * n        Number of pieces
+ * ld       Number of bytes from the start of a piece to the start of the next
+ *
+ ******************************************************************************/
+
+void Mem_prefetch(const void *p, size_t size, size_t n, size_t ld) {
+
+#ifdef PRIMME_WITH_MMAP
+   if (!p || size == 0 || n == 0) return;
+   size_t page = (size_t)sysconf(_SC_PAGESIZE);
+   size_t i;
+   if (n == 1 || ld == size) {
+      size *= n;
+      n = 1;
+   } else if (size < 4 * page) {
+      return;
+   }
+   for (i = 0; i < n; i++) {
+      const char *pi = (const char *)p + ld * i;
+      size_t off = (size_t)pi % page;
+      posix_madvise((char *)pi - off, size + off, POSIX_MADV_WILLNEED);
+   }
+#else
+   (void)p;
+   (void)size;
+   (void)n;
+   (void)ld;
+#endif
+}
@@ -29,18 +29,25 @@
  *******************************************************************************
  * File: wtime.c
  *
- * Purpose - Time functions.
+ * Purpose - Time functions, the table of times per call site used by the
+ *           profiler (see PROFILE_BEGIN in common.h), and the spans written
+ *           by the timeline trace (see primme_params.traceFile).
  *
  ******************************************************************************/
 
 #define THIS_FILE "../linalg/wtime.c"
 
 #include <stdlib.h>
+#include <stdio.h>    /* fopen, fprintf */
+#include <string.h>   /* strcmp, strstr */
 #if defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))
 #  include <sys/time.h>
 #  include <sys/resource.h>
+#  include <regex.h>
+#  define PRIMME_WITH_REGEX
 #endif
 
+#include "primme.h"
 #ifndef CHECK_TEMPLATE
 #include "wtime.h"
 #endif
@@ -84,3 +91,376 @@ double primme_wTimer() {
 }
 
 #endif
+
+/*******************************************************************************
+ * Subroutine Profile_site_id - Assign an ID to a call site the first time it
+ *    is profiled. The IDs are shared by all profile tables.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * site     call site
+ *
+ * Return Value
+ * ------------
+ * the ID of the site
+ *
+ ******************************************************************************/
+
+int Profile_site_id(primme_profile_site *site) {
+   static int numSites = 0;
+
+#if defined(__GNUC__)
+   /* Concurrent solvers may see the site for the first time together; */
+   /* keep the ID of the first one                                     */
+   int id = __sync_fetch_and_add(&numSites, 1);
+   __sync_bool_compare_and_swap(&site->id, -1, id);
+#else
+   if (site->id < 0) site->id = numSites++;
+#endif
+   return site->id;
+}
+
+/*******************************************************************************
+ * Subroutine Profile_create - Create a profile table, or update the pattern
+ *    of an existing one. The times collected are kept.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * pattern  regular expression selecting the sites to profile, as
+ *          "call@file:line"; without regex.h, a substring of that
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * prof     the table
+ *
+ * Return Value
+ * ------------
+ * error code
+ *
+ ******************************************************************************/
+
+int Profile_create(const char *pattern, primme_profile **prof) {
+
+   primme_profile *p = *prof;
+   if (!p) {
+      p = (primme_profile *)calloc(1, sizeof(primme_profile));
+      if (!p) return PRIMME_MALLOC_FAILURE;
+      *prof = p;
+   }
+
+   /* Nothing to do if the pattern is the same */
+
+   if (p->pattern && strcmp(p->pattern, pattern) == 0) return 0;
+
+   /* Set the new pattern, and check again all the sites */
+
+   char *pattern0 = (char *)malloc(strlen(pattern) + 1);
+   if (!pattern0) return PRIMME_MALLOC_FAILURE;
+   strcpy(pattern0, pattern);
+#ifdef PRIMME_WITH_REGEX
+   regex_t *regex = (regex_t *)malloc(sizeof(regex_t));
+   if (!regex || regcomp(regex, pattern, REG_NOSUB) != 0) {
+      free(regex);
+      free(pattern0);
+      return PRIMME_FUNCTION_UNAVAILABLE;
+   }
+   if (p->regex) {
+      regfree((regex_t *)p->regex);
+      free(p->regex);
+   }
+   p->regex = regex;
+#endif
+   free(p->pattern);
+   p->pattern = pattern0;
+   if (p->size > 0) memset(p->enabled, -1, p->size);
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Profile_destroy - Free a profile table
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * prof     the table
+ *
+ ******************************************************************************/
+
+void Profile_destroy(primme_profile *prof) {
+   if (!prof) return;
+#ifdef PRIMME_WITH_REGEX
+   if (prof->regex) regfree((regex_t *)prof->regex);
+#endif
+   free(prof->regex);
+   free(prof->pattern);
+   free(prof->entries);
+   free(prof->enabled);
+   free(prof);
+}
+
+/*******************************************************************************
+ * Subroutine Profile_reserve - Extend a profile table to hold the sites with
+ *    IDs up to size-1
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * size     new capacity of the table
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * prof     the table
+ *
+ * Return Value
+ * ------------
+ * error code
+ *
+ ******************************************************************************/
+
+static int Profile_reserve(primme_profile *prof, int size) {
+   int i;
+
+   if (size <= prof->size) return 0;
+   primme_profile_entry *entries = (primme_profile_entry *)realloc(
+         prof->entries, sizeof(primme_profile_entry) * size);
+   if (!entries) return PRIMME_MALLOC_FAILURE;
+   prof->entries = entries;
+   signed char *enabled = (signed char *)realloc(prof->enabled, size);
+   if (!enabled) return PRIMME_MALLOC_FAILURE;
+   prof->enabled = enabled;
+   for (i = prof->size; i < size; i++) {
+      entries[i].name = NULL;
+      entries[i].count = 0;
+      entries[i].totalTime = entries[i].maxTime = 0.0;
+      enabled[i] = -1;
+   }
+   prof->size = size;
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Profile_merge - Add the calls and the times of a profile table
+ *    into another one, for instance the table of a solve on a copy of the
+ *    parameters into the table of the original ones
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * from     the table to add
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * prof     the table
+ *
+ * Return Value
+ * ------------
+ * error code
+ *
+ ******************************************************************************/
+
+int Profile_merge(primme_profile *prof, primme_profile *from) {
+   int id;
+
+   if (Profile_reserve(prof, from->size) != 0) return PRIMME_MALLOC_FAILURE;
+   for (id = 0; id < from->size; id++) {
+      primme_profile_entry *e = &prof->entries[id], *f = &from->entries[id];
+      if (from->enabled[id] < 0) continue;
+      if (prof->enabled[id] < 0) {
+         e->name = f->name;
+         prof->enabled[id] = from->enabled[id];
+      }
+      e->count += f->count;
+      e->totalTime += f->totalTime;
+      if (f->maxTime > e->maxTime) e->maxTime = f->maxTime;
+   }
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Profile_enter - Start timing a call on a site. The first time a
+ *    site is seen, the table is extended and the pattern is checked.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * site     call site
+ * prof     the table
+ *
+ * Return Value
+ * ------------
+ * the starting time, or zero if the site is not profiled
+ *
+ ******************************************************************************/
+
+double Profile_enter(primme_profile_site *site, primme_profile *prof) {
+
+   int id = site->id >= 0 ? site->id : Profile_site_id(site);
+
+   if (id >= prof->size && Profile_reserve(prof, (id + 1) * 2) != 0) {
+      return 0.0;
+   }
+
+   if (prof->enabled[id] < 0) {
+      prof->entries[id].name = site->name;
+#ifdef PRIMME_WITH_REGEX
+      prof->enabled[id] =
+            regexec((regex_t *)prof->regex, site->name, 0, NULL, 0) == 0;
+#else
+      prof->enabled[id] = strstr(site->name, prof->pattern) != NULL;
+#endif
+   }
+
+   return prof->enabled[id] ? primme_wTimer() : 0.0;
+}
+
+/*******************************************************************************
+ * Subroutine Profile_leave - Finish timing a call on a site
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * site     call site
+ * t0       value returned by Profile_enter
+ * prof     the table
+ *
+ ******************************************************************************/
+
+void Profile_leave(primme_profile_site *site, double t0, primme_profile *prof) {
+   double t = primme_wTimer() - t0;
+   primme_profile_entry *e = &prof->entries[site->id];
+   e->count++;
+   e->totalTime += t;
+   if (t > e->maxTime) e->maxTime = t;
+}
+
+/*******************************************************************************
+ * Subroutine Trace_create - Create an empty trace
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * trace    the trace
+ *
+ * Return Value
+ * ------------
+ * error code
+ *
+ ******************************************************************************/
+
+int Trace_create(primme_trace **trace) {
+   *trace = (primme_trace *)calloc(1, sizeof(primme_trace));
+   return *trace ? 0 : PRIMME_MALLOC_FAILURE;
+}
+
+/*******************************************************************************
+ * Subroutine Trace_destroy - Free a trace
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * trace    the trace
+ *
+ ******************************************************************************/
+
+void Trace_destroy(primme_trace *trace) {
+   if (!trace) return;
+   free(trace->spans);
+   free(trace);
+}
+
+/*******************************************************************************
+ * Subroutine Trace_span - Record a span that started at t0 and ends now. If
+ *    the trace has PRIMME_TRACE_MAX_SPANS spans, the span is dropped unless
+ *    it was open when the trace got full. Those spans enclose the dropped
+ *    ones (the iteration, the stage or the whole call), they are as many as
+ *    the nesting depth, and keeping them shows the extent of the call. If
+ *    the trace cannot grow, the span is dropped.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * name     kind of span; the string is not copied
+ * t0       starting time, as returned by primme_wTimer
+ * trace    the trace, or NULL if tracing is off
+ *
+ ******************************************************************************/
+
+void Trace_span(const char *name, double t0, primme_trace *trace) {
+   if (!trace) return;
+
+   if (trace->n >= PRIMME_TRACE_MAX_SPANS && t0 > trace->tFull) {
+      trace->dropped++;
+      return;
+   }
+
+   if (trace->n >= trace->size) {
+      int size = trace->size > 0 ? trace->size * 2 : 1024;
+      if (trace->size >= PRIMME_TRACE_MAX_SPANS) size = trace->size + 64;
+      primme_trace_span *spans = (primme_trace_span *)realloc(
+            trace->spans, sizeof(primme_trace_span) * size);
+      if (!spans) {
+         trace->dropped++;
+         return;
+      }
+      trace->spans = spans;
+      trace->size = size;
+   }
+
+   primme_trace_span *s = &trace->spans[trace->n++];
+   s->name = name;
+   s->t0 = t0;
+   s->t1 = primme_wTimer();
+   if (trace->n == PRIMME_TRACE_MAX_SPANS) trace->tFull = s->t1;
+}
+
+/*******************************************************************************
+ * Subroutine Trace_write - Write the spans in the Chrome trace format, which
+ *    Perfetto and chrome://tracing can open. The process ID of the events
+ *    is procID. With several processes, every process writes its own file,
+ *    with the suffix ".<procID>". The number of dropped spans is written in
+ *    "otherData".
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * fileName    name of the file
+ * numProcs    number of processes
+ * procID      ID of this process
+ * trace       the trace
+ *
+ * Return Value
+ * ------------
+ * error code
+ *
+ ******************************************************************************/
+
+int Trace_write(const char *fileName, int numProcs, int procID,
+      primme_trace *trace) {
+
+   size_t len = strlen(fileName) + 32;
+   char *path = (char *)malloc(len);
+   if (!path) return PRIMME_MALLOC_FAILURE;
+   if (numProcs > 1) {
+      snprintf(path, len, "%s.%d", fileName, procID);
+   } else {
+      snprintf(path, len, "%s", fileName);
+   }
+   FILE *f = fopen(path, "w");
+   free(path);
+   if (!f) return PRIMME_UNEXPECTED_FAILURE;
+
+   /* Times are in microseconds since the epoch, so that the spans of */
+   /* different processes line up                                     */
+
+   int i, ok = fprintf(f, "{\"traceEvents\":[\n"
+                          "{\"name\":\"process_name\",\"ph\":\"M\","
+                          "\"pid\":%d,\"tid\":0,"
+                          "\"args\":{\"name\":\"process %d\"}}",
+                     procID, procID) > 0;
+   for (i = 0; ok && i < trace->n; i++) {
+      primme_trace_span *s = &trace->spans[i];
+      ok = fprintf(f,
+                 ",\n{\"name\":\"%s\",\"cat\":\"primme\",\"ph\":\"X\","
+                 "\"ts\":%.1f,\"dur\":%.1f,\"pid\":%d,\"tid\":0}",
+                 s->name, s->t0 * 1e6, (s->t1 - s->t0) * 1e6, procID) > 0;
+   }
+   if (ok) {
+      ok = fprintf(f,
+                 "\n],\"displayTimeUnit\":\"ms\","
+                 "\"otherData\":{\"droppedSpans\":%d}}\n",
+                 trace->dropped) > 0;
+   }
+   if (fclose(f) != 0) ok = 0;
+   return ok ? 0 : PRIMME_UNEXPECTED_FAILURE;
+}
@@ -47,6 +47,10 @@
 #include "primme_svds_c.h"
 #endif
 
+/* The USE_DHOST types keep the basis of the eigensolver in single precision */
+/* and they are not exposed by the public interface                        */
+
+#ifndef USE_DHOST
 
 #ifdef SUPPORTED_TYPE
 
@@ -58,6 +62,7 @@
    (PRIMME_SVDS_STATS).numMatvecs         OP  (PRIMME_STATS).numMatvecs*2      ;\
    (PRIMME_SVDS_STATS).numPreconds        OP  (PRIMME_STATS).numPreconds       ;\
    (PRIMME_SVDS_STATS).numGlobalSum       OP  (PRIMME_STATS).numGlobalSum      ;\
+   (PRIMME_SVDS_STATS).numGlobalSumRequested OP (PRIMME_STATS).numGlobalSumRequested;\
    (PRIMME_SVDS_STATS).numBroadcast       OP  (PRIMME_STATS).numBroadcast      ;\
    (PRIMME_SVDS_STATS).volumeGlobalSum    OP  (PRIMME_STATS).volumeGlobalSum   ;\
    (PRIMME_SVDS_STATS).volumeBroadcast    OP  (PRIMME_STATS).volumeBroadcast   ;\
@@ -148,6 +153,17 @@ static primme_context primme_svds_get_context(primme_svds_params *primme_svds) {
       } else {
          ctx.path = NULL;
       }
+#else
+      if (primme_svds->profile) {
+         /* Share the table with the first stage, see primme_get_profile */
+
+         if (Profile_create(primme_svds->profile,
+                   &primme_svds->primme.profileTable) == 0) {
+            ctx.prof = primme_svds->primme.profileTable;
+         } else {
+            ctx.report("Invalid pattern in profile", -1, ctx);
+         }
+      }
 #endif
    }
 
@@ -272,10 +288,17 @@ STATIC int Xprimme_svds_aux(void *svals, XSCALAR *svecs, void *resNorms,
 
 #ifdef SUPPORTED_TYPE
 
+   double t0 = primme_wTimer();
+
    /* Generate context */
 
    primme_context ctx = primme_svds_get_context(primme_svds);
 
+   /* Record the spans of the call, including the ones of both stages. If */
+   /* the trace cannot be created, the solver goes on without it           */
+
+   if (primme_svds->traceFile) Trace_create(&ctx.trace);
+
    /* Set the current type as the default type for user's operators */
 
    if (primme_svds->matrixMatvec && primme_svds->matrixMatvec_type == primme_op_default)
@@ -299,7 +322,7 @@ STATIC int Xprimme_svds_aux(void *svals, XSCALAR *svecs, void *resNorms,
 
    int ret;
    primme_op_datatype t = primme_svds->internalPrecision;
-   if (t == primme_op_default) t = PRIMME_OP_SCALAR;
+   if (t == primme_op_default || t == primme_op_auto) t = PRIMME_OP_SCALAR;
    switch (t) {
 #  ifdef SUPPORTED_HALF_TYPE
    case primme_op_half:
@@ -330,6 +353,21 @@ STATIC int Xprimme_svds_aux(void *svals, XSCALAR *svecs, void *resNorms,
    default: ret = PRIMME_FUNCTION_UNAVAILABLE;
    }
 
+   /* Write the trace */
+
+   if (ctx.trace) {
+      Trace_span("primme_svds", t0, ctx.trace);
+      if (Trace_write(primme_svds->traceFile, ctx.numProcs, ctx.procID,
+                ctx.trace) != 0) {
+         PRINTF(1, "Warning: could not write the trace '%s'",
+               primme_svds->traceFile);
+      } else if (ctx.trace->dropped > 0) {
+         PRINTF(1, "Warning: %d spans were not kept in the trace '%s'",
+               ctx.trace->dropped, primme_svds->traceFile);
+      }
+      Trace_destroy(ctx.trace);
+   }
+
    /* Free context */
 
    primme_svds_free_context(ctx);
@@ -448,6 +486,7 @@ int wrapper_svds_Sprimme(void *svals_, void *svecs_, void *resNorms_,
    primme_svds->stats.numMatvecs                    = 0;
    primme_svds->stats.numPreconds                   = 0;
    primme_svds->stats.numGlobalSum                  = 0;
+   primme_svds->stats.numGlobalSumRequested         = 0;
    primme_svds->stats.volumeGlobalSum               = 0;
    primme_svds->stats.numOrthoInnerProds            = 0.0;
    primme_svds->stats.elapsedTime                   = 0.0;
@@ -488,8 +527,45 @@ int wrapper_svds_Sprimme(void *svals_, void *svecs_, void *resNorms_,
    CHKERR(copy_last_params_from_svds(0, NULL, svecs,
             NULL, &allocatedTargetShifts, &svecs0, ctx));
 
+   /* With primme_op_auto, run the first stage of the hybrid method in     */
+   /* single precision if eps is so small that the second stage is going to */
+   /* refine the triplets anyway. Otherwise the normal equations in the     */
+   /* working precision are cheaper than refining more in the second stage. */
+   /* The threshold, a hundred times the machine epsilon, is documented in  */
+   /* primme_svds_params.internalPrecision; primme.internalPrecision set to */
+   /* primme_op_float forces the single precision stage for any eps         */
+
+   primme_op_datatype stage1Precision = primme_svds->primme.internalPrecision;
+#ifndef PRIMME_WITHOUT_FLOAT
+   if (primme_svds->internalPrecision == primme_op_auto &&
+         primme_svds->methodStage2 != primme_svds_op_none &&
+         stage1Precision == primme_op_default &&
+         primme_svds->eps > 0.0 && primme_svds->eps < MACHINE_EPSILON * 1e2 &&
+         PRIMME_OP_SCALAR > primme_op_float) {
+      primme_svds->primme.internalPrecision = primme_op_float;
+   }
+#endif
+
+   /* The convergence of the first stage is decided by primme_svds.eps and */
+   /* the precision limit in convTestFunATA, but primme.eps cannot be       */
+   /* smaller than the machine epsilon of the stage's precision             */
+
+   double stage1Eps = primme_svds->primme.eps;
+   if (primme_svds->primme.internalPrecision != primme_op_default &&
+         primme_svds->primme.internalPrecision != primme_op_auto &&
+         stage1Eps != 0.0) {
+      double eps_stage;
+      CHKERR(Num_machine_epsilon_Sprimme(
+            primme_svds->primme.internalPrecision, &eps_stage));
+      primme_svds->primme.eps = max(stage1Eps, eps_stage);
+   }
+
+   double t0 = primme_wTimer();
    ret = Xprimme_aux_Sprimme(svals, (XSCALAR *)svecs0, resNorms,
-         &primme_svds->primme, PRIMME_OP_HREAL);
+         &primme_svds->primme, PRIMME_OP_HREAL, NULL, ctx.trace);
+   Trace_span("stage 1", t0, ctx.trace);
+   primme_svds->primme.internalPrecision = stage1Precision;
+   primme_svds->primme.eps = stage1Eps;
 
    CHKERR(copy_last_params_to_svds(
             0, svals, svecs, resNorms, allocatedTargetShifts, ctx));
@@ -508,8 +584,10 @@ int wrapper_svds_Sprimme(void *svals_, void *svecs_, void *resNorms_,
       /* are already converged. So shift svals and resnorms that much */
       int nconv = primme_svds->numSvals - primme_svds->primmeStage2.numEvals;
 
+      t0 = primme_wTimer();
       ret = Xprimme_aux_Sprimme(svals + nconv, (XSCALAR *)svecs0, resNorms + nconv,
-            &primme_svds->primmeStage2, PRIMME_OP_HREAL);
+            &primme_svds->primmeStage2, PRIMME_OP_HREAL, NULL, ctx.trace);
+      Trace_span("stage 2", t0, ctx.trace);
 
       CHKERR(copy_last_params_to_svds(
             1, svals, svecs, resNorms, allocatedTargetShifts, ctx));
@@ -1302,7 +1380,8 @@ int monitorFunSVDS_Sprimme(HREAL *basisSvals, int basisSize, int *basisFlags,
 /*******************************************************************************
  * Subroutine matrixMatvec_eigs - Computes y = B*x where B can be A'*A or A*A' or
  *    the augmented operator, A is the operator defined by
- *    primme_svds->matrixMatvec
+ *    primme_svds->matrixMatvec. A'*A and A*A' are computed by
+ *    primme_svds->matrixMatvecNormal if it is set.
  *
  * INPUT/OUPUT ARRAYS AND PARAMETERS
  * ---------------------------
@@ -1331,6 +1410,18 @@ void matrixMatvec_eigs_Sprimme(void *x_, PRIMME_INT *ldx, void *y_,
    int i, bs;
    *ierr = 0;
 
+   /* Compute A'*A*x or A*A'*x with a single call if the user provides it */
+
+   if (primme_svds->matrixMatvecNormal &&
+         (method == primme_svds_op_AtA || method == primme_svds_op_AAt)) {
+      primme_svds->matrixMatvecNormal(x, ldx, y, ldy, blockSize,
+            method == primme_svds_op_AtA ? &notrans : &trans, primme_svds,
+            ierr);
+      CHKERRA(*ierr, /* do nothing */);
+      primme_svds_free_context(ctx);
+      return;
+   }
+
    switch(method) {
       case primme_svds_op_AtA:
          CHKERRA(Num_malloc_Sprimme(primme_svds->mLocal *
@@ -1476,6 +1567,7 @@ STATIC int globalSum_Rprimme_svds(
          CHKERR(Num_free_Sprimme((SCALAR *)recvBuf0, ctx));
 
       primme_svds->stats.numGlobalSum++;
+      primme_svds->stats.numGlobalSumRequested++;
       primme_svds->stats.timeGlobalSum += primme_wTimer() - t0;
       primme_svds->stats.volumeGlobalSum += count;
    }
@@ -1647,13 +1739,20 @@ STATIC void convTestFunATA(double *eval, void *evec, double *rNorm, int *isConv,
       primme->aNorm : primme->stats.estimateLargestSVal;
    primme_context ctx = primme_svds_get_context(primme_svds);
 
-   /* Check machine precision limit */
+   /* Check machine precision limit, either the matvec's or the working */
+   /* precision of this stage                                            */
 
    double maxaNorm = max(primme->aNorm, primme->stats.estimateLargestSVal);
-   double eps_matvec = MACHINE_EPSILON;
+   double eps_matvec = MACHINE_EPSILON, eps_stage = MACHINE_EPSILON;
    CHKERRA(Num_machine_epsilon_Sprimme(
                  primme_svds->matrixMatvec_type, &eps_matvec),
          *ierr = 1);
+   if (primme->internalPrecision != primme_op_auto) {
+      CHKERRA(Num_machine_epsilon_Sprimme(
+                    primme->internalPrecision, &eps_stage),
+            *ierr = 1);
+   }
+   eps_matvec = max(eps_matvec, eps_stage);
    if (rNorm && *rNorm < eps_matvec * maxaNorm * 3.16) {
       *isConv = 1;
       *ierr = 0;
@@ -2255,3 +2354,5 @@ STATIC void monitor_stage2(void *basisEvals_, int *basisSize, int *basisFlags,
 }
 
 #endif /* SUPPORTED_TYPE */
+
+#endif /* USE_DHOST */
@@ -42,6 +42,10 @@
 #include "numerical.h"
 #include "primme_svds_interface.h"
 
+/* The USE_DHOST types keep the basis of the eigensolver in single precision */
+/* and they are not exposed by the public interface                        */
+
+#ifndef USE_DHOST
 
 EXTERN_C void AS_FORTRAN(Sprimme_svds)(XREAL *svals, XSCALAR *svecs,
       XREAL *resNorms, primme_svds_params **primme_svds, int *ierr) {
@@ -93,3 +97,5 @@ EXTERN_C void AS_FORTRAN(primme_svds_get_member)(primme_svds_params *primme_svds
 }
 
 #endif /* USE_DOUBLE */
+
+#endif /* USE_DHOST */
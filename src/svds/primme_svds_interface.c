@@ -90,10 +90,31 @@ primme_svds_params * primme_svds_params_create(void) {
  *  * Free the internally allocated work arrays of the primme_svds structure 
  *   *****************************************************************************/
 int primme_svds_params_destroy(primme_svds_params *primme_svds) {
+    primme_svds_free(primme_svds);
     free(primme_svds);
     return 0;
 }
 
+/*****************************************************************************
+ * Callbacks for primme_svds_params.matrixMatvec and matrixMatvecNormal that
+ * multiply by the primme_csr in primme_svds.matrix
+ *****************************************************************************/
+void primme_csr_svds_matvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, int *transpose, primme_svds_params *primme_svds,
+      int *ierr) {
+
+   *ierr = primme_csr_mm((primme_csr *)primme_svds->matrix, *transpose,
+         *blockSize, x, *ldx, y, *ldy);
+}
+
+void primme_csr_svds_matvec_normal(void *x, PRIMME_INT *ldx, void *y,
+      PRIMME_INT *ldy, int *blockSize, int *transpose,
+      primme_svds_params *primme_svds, int *ierr) {
+
+   *ierr = primme_csr_normal_mm((primme_csr *)primme_svds->matrix, *transpose,
+         *blockSize, x, *ldx, y, *ldy);
+}
+
 /*******************************************************************************
  * Subroutine primme_svds_initialize - Set primme_svds_params members to default
  *    values.
@@ -137,6 +158,7 @@ void primme_svds_initialize(primme_svds_params *primme_svds) {
    /* Matvec and preconditioner */
    primme_svds->matrixMatvec            = NULL;
    primme_svds->matrixMatvec_type       = primme_op_default;
+   primme_svds->matrixMatvecNormal      = NULL;
    primme_svds->applyPreconditioner     = NULL;
    primme_svds->applyPreconditioner_type= primme_op_default;
 
@@ -159,6 +181,7 @@ void primme_svds_initialize(primme_svds_params *primme_svds) {
    primme_svds->stats.numMatvecs                    = 0;
    primme_svds->stats.numPreconds                   = 0;
    primme_svds->stats.numGlobalSum                  = 0;
+   primme_svds->stats.numGlobalSumRequested         = 0;
    primme_svds->stats.volumeGlobalSum               = 0;
    primme_svds->stats.numBroadcast                  = 0;
    primme_svds->stats.volumeBroadcast               = 0;
@@ -183,6 +206,7 @@ void primme_svds_initialize(primme_svds_params *primme_svds) {
    primme_svds->monitor                 = NULL;
    primme_svds->queue                   = NULL;
    primme_svds->profile                 = NULL;
+   primme_svds->traceFile               = NULL;
 
    primme_initialize(&primme_svds->primme);
    primme_initialize(&primme_svds->primmeStage2);
@@ -491,6 +515,7 @@ fprintf(outputFile, "// ---------------------------------------------------\n"
    PRINTIF(internalPrecision, primme_op_float);
    PRINTIF(internalPrecision, primme_op_double);
    PRINTIF(internalPrecision, primme_op_quad);
+   PRINTIF(internalPrecision, primme_op_auto);
 
 
    if (primme_svds.method != primme_svds_op_none) {
@@ -524,9 +549,9 @@ fprintf(outputFile, "// ---------------------------------------------------\n"
  *
  ******************************************************************************/
 
-void primme_svds_free(primme_svds_params *primme) {
-   (void)primme;
-   /* No function */    
+void primme_svds_free(primme_svds_params *primme_svds) {
+   primme_free(&primme_svds->primme);
+   primme_free(&primme_svds->primmeStage2);
 }
 
 /*******************************************************************************
@@ -597,6 +622,9 @@ int primme_svds_get_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_matrixMatvec_type:
          *(PRIMME_INT*)value = primme_svds->matrixMatvec_type;
          break;
+      case PRIMME_SVDS_matrixMatvecNormal :
+         v->matFunc_v = primme_svds->matrixMatvecNormal;
+         break;
       case PRIMME_SVDS_applyPreconditioner :
          v->matFunc_v = primme_svds->applyPreconditioner;
          break;
@@ -710,6 +738,9 @@ int primme_svds_get_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_stats_numGlobalSum:
          *(PRIMME_INT*)value = primme_svds->stats.numGlobalSum;
          break;
+      case PRIMME_SVDS_stats_numGlobalSumRequested:
+         *(PRIMME_INT*)value = primme_svds->stats.numGlobalSumRequested;
+         break;
       case PRIMME_SVDS_stats_volumeGlobalSum:
          *(PRIMME_INT*)value = primme_svds->stats.volumeGlobalSum;
          break;
@@ -767,6 +798,9 @@ int primme_svds_get_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_profile:
          *(str_v*)value = primme_svds->profile;
          break;
+      case PRIMME_SVDS_traceFile:
+         *(str_v*)value = primme_svds->traceFile;
+         break;
       default:
          return 1;
    }
@@ -816,6 +850,9 @@ int primme_svds_set_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_matrixMatvec_type:
          primme_svds->matrixMatvec_type = (primme_op_datatype)*(PRIMME_INT*)value;
          break;
+      case PRIMME_SVDS_matrixMatvecNormal :
+         primme_svds->matrixMatvecNormal = v.matFunc_v;
+         break;
       case PRIMME_SVDS_applyPreconditioner :
          primme_svds->applyPreconditioner = v.matFunc_v;
          break;
@@ -988,6 +1025,9 @@ int primme_svds_set_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_profile:
          primme_svds->profile = (str_v)value;
          break;
+      case PRIMME_SVDS_traceFile:
+         primme_svds->traceFile = (str_v)value;
+         break;
       default:
          return 1;
    }
@@ -1039,6 +1079,7 @@ int primme_svds_member_info(primme_svds_params_label *label,
    IF_IS(n);
    IF_IS(matrixMatvec);
    IF_IS(matrixMatvec_type);
+   IF_IS(matrixMatvecNormal);
    IF_IS(applyPreconditioner);
    IF_IS(applyPreconditioner_type);
    IF_IS(numProcs);
@@ -1076,6 +1117,7 @@ int primme_svds_member_info(primme_svds_params_label *label,
    IF_IS(stats_numMatvecs);
    IF_IS(stats_numPreconds);
    IF_IS(stats_numGlobalSum);
+   IF_IS(stats_numGlobalSumRequested);
    IF_IS(stats_volumeGlobalSum);
    IF_IS(stats_numBroadcast);
    IF_IS(stats_volumeBroadcast);
@@ -1095,6 +1137,7 @@ int primme_svds_member_info(primme_svds_params_label *label,
    IF_IS(monitor);
    IF_IS(queue);
    IF_IS(profile);
+   IF_IS(traceFile);
 #undef IF_IS
 
    /* Return error if no label was found */
@@ -1129,6 +1172,7 @@ int primme_svds_member_info(primme_svds_params_label *label,
       case PRIMME_SVDS_stats_numMatvecs:
       case PRIMME_SVDS_stats_numPreconds:
       case PRIMME_SVDS_stats_numGlobalSum:
+      case PRIMME_SVDS_stats_numGlobalSumRequested:
       case PRIMME_SVDS_stats_volumeGlobalSum:
       case PRIMME_SVDS_stats_numBroadcast:
       case PRIMME_SVDS_stats_volumeBroadcast:
@@ -1170,6 +1214,7 @@ int primme_svds_member_info(primme_svds_params_label *label,
       case PRIMME_SVDS_primme:
       case PRIMME_SVDS_primmeStage2:
       case PRIMME_SVDS_matrixMatvec: 
+      case PRIMME_SVDS_matrixMatvecNormal:
       case PRIMME_SVDS_applyPreconditioner:
       case PRIMME_SVDS_commInfo:
       case PRIMME_SVDS_globalSumReal:
@@ -1187,6 +1232,7 @@ int primme_svds_member_info(primme_svds_params_label *label,
       break;
 
       case PRIMME_SVDS_profile:
+      case PRIMME_SVDS_traceFile:
       if (type) *type = primme_string;
       if (arity) *arity = 1;
       break;
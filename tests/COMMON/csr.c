@@ -48,6 +48,7 @@ int readMatrixNative(const char* matrixFileName, CSRMatrix **matrix_, double *fn
    CSRMatrix *matrix;
 
    matrix = (CSRMatrix*)primme_calloc(1, sizeof(CSRMatrix), "CSRMatrix");
+   matrix->csr = NULL;
    if (!strcmp("mtx", &matrixFileName[strlen(matrixFileName)-3])) {  
       /* coordinate format storing both lower and upper triangular parts */
       ret = readfullMTX(matrixFileName, &matrix->AElts, &matrix->JA, 
@@ -285,6 +286,7 @@ void shiftCSRMatrix(double shift, CSRMatrix *matrix) {
 
 void freeCSRMatrix(CSRMatrix *matrix) {
    if (!matrix) return;
+   primme_csr_destroy(matrix->csr);
    free(matrix->AElts);
    free(matrix->IA);
    free(matrix->JA);
@@ -37,6 +37,7 @@ typedef struct {
    int m; /* number of rows */
    int n; /* number of columns */
    int nnz;
+   primme_csr *csr; /* built by createCSRMatrixKernelNative, or NULL */
 } CSRMatrix;
 
 int readMatrixNative(const char* matrixFileName, CSRMatrix **matrix_, double *fnorm);
@@ -40,6 +40,7 @@
 primme_context get_dummy_context() {
    primme_context ctx;
    memset(&ctx, 0, sizeof(primme_context));
+   return ctx;
 }
 
 static REAL primme_dot_real(SCALAR *x, SCALAR *y, primme_params *primme) {
@@ -59,70 +59,224 @@ void FORTRAN_FUNCTION(zlusol)(int*, SCALAR*, SCALAR*, SCALAR*, int*, int*);
 #endif
 
 /******************************************************************************
- * Applies the matrix vector multiplication on a block of vectors.
- * Because a block function is not available, we call blockSize times
- * the SPARSKIT function amux(). Note the (void *) parameters x, y that must 
- * be cast as doubles for use in amux()
+ * Builds the handle used by primme_csr_mm to multiply by the matrix, in
+ * SELL-C-sigma format if sell is nonzero. Without the handle, the products
+ * are computed with the SPARSKIT functions. Call it after building the
+ * preconditioners, because some of them shift the diagonal of the matrix
+ * temporarily, and before calling the solver, which may do products from
+ * several threads.
  *
 ******************************************************************************/
-void CSRMatrixMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
-   
-   int i;
-   int n = (int)primme->n;
-   SCALAR *xvec, *yvec;
-   CSRMatrix *matrix;
-   
-   matrix = (CSRMatrix *)primme->matrix;
-   xvec = (SCALAR *)x;
-   yvec = (SCALAR *)y;
 
-   for (i=0;i<*blockSize;i++) {
+int createCSRMatrixKernelNative(CSRMatrix *matrix, int sell) {
+   int ierr = 0;
+
+   if (matrix->csr) return 0;
+   matrix->csr = primme_csr_create(matrix->m, matrix->n, matrix->IA,
+         matrix->JA, matrix->AElts, 1, primme_op_double,
 #ifndef USE_DOUBLECOMPLEX
-      FORTRAN_FUNCTION(amux)
+         0
 #else
-      FORTRAN_FUNCTION(zamux)
+         1
 #endif
-            (&n, &xvec[*ldx*i], &yvec[*ldy*i], 
-             matrix->AElts, matrix->JA, matrix->IA);
+         );
+   if (!matrix->csr) return -1;
+   if (sell) ierr = primme_csr_sell(matrix->csr, 8, 256);
+   if (ierr != 0) {
+      primme_csr_destroy(matrix->csr);
+      matrix->csr = NULL;
    }
-   *ierr = 0;
+   return ierr;
 }
 
-void CSRMatrixMatvecSVD(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
-      int *blockSize, int *trans, primme_svds_params *primme_svds, int *ierr) {
-   
+/******************************************************************************
+ * Applies the matrix vector multiplication on a block of vectors.
+ * If createCSRMatrixKernelNative has built the handle, the whole block is
+ * multiplied with primme_csr_mm. Otherwise, because a block function is not
+ * available, we call blockSize times the SPARSKIT function amux() or atmuxr().
+ *
+******************************************************************************/
+
+static int CSRMatrixMatvecGen(CSRMatrix *matrix, int trans, void *x,
+      PRIMME_INT ldx, void *y, PRIMME_INT ldy, int blockSize) {
    int i;
-   int m = (int)primme_svds->m;
-   int n = (int)primme_svds->n;
-   SCALAR *xvec, *yvec;
-   CSRMatrix *matrix;
-   
-   matrix = (CSRMatrix *)primme_svds->matrix;
-   xvec = (SCALAR *)x;
-   yvec = (SCALAR *)y;
+   SCALAR *xvec = (SCALAR *)x, *yvec = (SCALAR *)y;
+
+   if (matrix->csr) {
+      return primme_csr_mm(matrix->csr, trans, blockSize, x, ldx, y, ldy);
+   }
 
-   if (*trans == 0) {
-      for (i=0;i<*blockSize;i++) {
+   for (i=0;i<blockSize;i++) {
+      if (trans == 0) {
 #ifndef USE_DOUBLECOMPLEX
          FORTRAN_FUNCTION(amux)
 #else
          FORTRAN_FUNCTION(zamux)
 #endif
-              (&m, &xvec[(*ldx)*i], &yvec[(*ldy)*i], 
-               matrix->AElts, matrix->JA, matrix->IA);
-      }
-   } else {
-      for (i=0;i<*blockSize;i++) {
+               (&matrix->m, &xvec[ldx*i], &yvec[ldy*i], 
+                matrix->AElts, matrix->JA, matrix->IA);
+      } else {
 #ifndef USE_DOUBLECOMPLEX
          FORTRAN_FUNCTION(atmuxr)
 #else
          FORTRAN_FUNCTION(zatmuxr)
 #endif
-           (&n, &m, &xvec[(*ldx)*i], 
-            &yvec[(*ldy)*i], matrix->AElts, matrix->JA, matrix->IA);
+               (&matrix->n, &matrix->m, &xvec[ldx*i], &yvec[ldy*i],
+                matrix->AElts, matrix->JA, matrix->IA);
       }
    }
-   *ierr = 0;
+   return 0;
+}
+
+/******************************************************************************
+ * Checks the products by the handle built by createCSRMatrixKernelNative
+ * against the SPARSKIT functions on a block of random vectors. The block has
+ * more than eight columns, so the kernels process several groups of columns.
+ * Returns zero if the products agree.
+ *
+******************************************************************************/
+
+int checkCSRMatrixKernelNative(CSRMatrix *matrix, int trans) {
+   const int nx = 10;
+   int i, ierr;
+   int mx = trans ? matrix->m : matrix->n, my = trans ? matrix->n : matrix->m;
+   double diff = 0.0, ynorm = 0.0;
+   primme_csr *csr = matrix->csr;
+   SCALAR *x, *y, *y0;
+
+   if (!csr) return 0;
+   x = (SCALAR *)primme_calloc((size_t)mx * nx, sizeof(SCALAR), "x");
+   y = (SCALAR *)primme_calloc((size_t)my * nx, sizeof(SCALAR), "y");
+   y0 = (SCALAR *)primme_calloc((size_t)my * nx, sizeof(SCALAR), "y0");
+   for (i = 0; i < mx * nx; i++) {
+      x[i] = (double)rand() / RAND_MAX - 0.5 +
+             ((double)rand() / RAND_MAX - 0.5) * IMAGINARY;
+   }
+   ierr = CSRMatrixMatvecGen(matrix, trans, x, mx, y, my, nx);
+   matrix->csr = NULL;
+   if (ierr == 0) ierr = CSRMatrixMatvecGen(matrix, trans, x, mx, y0, my, nx);
+   matrix->csr = csr;
+   for (i = 0; ierr == 0 && i < my * nx; i++) {
+      diff = max(diff, ABS(y[i] - y0[i]));
+      ynorm = max(ynorm, ABS(y0[i]));
+   }
+   free(x);
+   free(y);
+   free(y0);
+   if (ierr != 0) return ierr;
+   if (diff > ynorm * 1e-12) {
+      fprintf(stderr, "ERROR: primme_csr_mm differs from SPARSKIT by %g\n",
+            diff / ynorm);
+      return -1;
+   }
+   return 0;
+}
+
+void CSRMatrixMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
+   
+   CSRMatrix *matrix = (CSRMatrix *)primme->matrix;
+
+   *ierr = CSRMatrixMatvecGen(matrix, 0, x, *ldx, y, *ldy, *blockSize);
+}
+
+#ifdef USE_MPI
+/******************************************************************************
+ * Distributes the rows of the matrix among the processes in consecutive
+ * blocks. Every process keeps the whole matrix, gathers the whole vectors
+ * and multiplies only its rows.
+ *
+******************************************************************************/
+
+int createDistCSRMatrixNative(CSRMatrix *matrix, MPI_Comm comm,
+      DistCSRMatrix **dist_) {
+   int i, numProcs, procID;
+   DistCSRMatrix *dist;
+
+   MPI_Comm_size(comm, &numProcs);
+   MPI_Comm_rank(comm, &procID);
+   dist = (DistCSRMatrix *)primme_calloc(1, sizeof(DistCSRMatrix), "dist");
+   dist->matrix = matrix;
+   dist->comm = comm;
+   dist->counts = (int *)primme_calloc(numProcs, sizeof(int), "counts");
+   dist->displs = (int *)primme_calloc(numProcs, sizeof(int), "displs");
+   for (i = 0; i < numProcs; i++) {
+      dist->displs[i] = (int)((PRIMME_INT)matrix->m * i / numProcs);
+      dist->counts[i] =
+            (int)((PRIMME_INT)matrix->m * (i + 1) / numProcs) - dist->displs[i];
+   }
+   dist->local = *matrix;
+   dist->local.IA = &matrix->IA[dist->displs[procID]];
+   dist->local.m = dist->counts[procID];
+   dist->local.csr = NULL;
+   dist->x = NULL;
+   dist->nx = 0;
+   *dist_ = dist;
+   return 0;
+}
+
+void freeDistCSRMatrix(DistCSRMatrix *dist) {
+   if (dist->local.csr) primme_csr_destroy(dist->local.csr);
+   freeCSRMatrix(dist->matrix);
+   free(dist->counts);
+   free(dist->displs);
+   free(dist->x);
+   free(dist);
+}
+
+void DistCSRMatrixMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr) {
+
+   DistCSRMatrix *dist = (DistCSRMatrix *)primme->matrix;
+   SCALAR *xvec = (SCALAR *)x;
+   int i, n = dist->matrix->n;
+#ifdef USE_DOUBLECOMPLEX
+   MPI_Datatype type = MPI_C_DOUBLE_COMPLEX;
+#else
+   MPI_Datatype type = MPI_DOUBLE;
+#endif
+
+   if (dist->nx < *blockSize) {
+      free(dist->x);
+      dist->x = (SCALAR *)primme_calloc(
+            (size_t)n * *blockSize, sizeof(SCALAR), "x");
+      dist->nx = *blockSize;
+   }
+   for (i = 0; i < *blockSize; i++) {
+      *ierr = MPI_Allgatherv(&xvec[*ldx * i], (int)primme->nLocal, type,
+            &dist->x[(size_t)n * i], dist->counts, dist->displs, type,
+            dist->comm);
+      if (*ierr != MPI_SUCCESS) return;
+   }
+   *ierr = CSRMatrixMatvecGen(
+         &dist->local, 0, dist->x, n, y, *ldy, *blockSize);
+}
+#endif
+
+void CSRMatrixMatvecSVD(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, int *trans, primme_svds_params *primme_svds, int *ierr) {
+   
+   CSRMatrix *matrix = (CSRMatrix *)primme_svds->matrix;
+
+   *ierr = CSRMatrixMatvecGen(matrix, *trans, x, *ldx, y, *ldy, *blockSize);
+}
+
+/******************************************************************************
+ * Applies A'*A or A*A' on a block of vectors with primme_csr_normal_mm. It
+ * needs the handle built by createCSRMatrixKernelNative.
+ *
+******************************************************************************/
+
+void CSRMatrixMatvecNormalSVD(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, int *trans, primme_svds_params *primme_svds, int *ierr) {
+   
+   CSRMatrix *matrix = (CSRMatrix *)primme_svds->matrix;
+
+   if (!matrix->csr) {
+      *ierr = -1;
+      return;
+   }
+   *ierr = primme_csr_normal_mm(
+         matrix->csr, *trans, *blockSize, x, *ldx, y, *ldy);
 }
 
 
@@ -223,6 +377,7 @@ int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
    lenFactors = 9*matrix->nnz;
 
    factors = (CSRMatrix *)primme_calloc(1,  sizeof(CSRMatrix), "factors");
+   factors->csr = NULL;
    factors->AElts = (SCALAR *)primme_calloc(lenFactors,
                                 sizeof(SCALAR), "iluElts");
    factors->JA = (int *)primme_calloc(lenFactors, sizeof(int), "Jilu");
@@ -269,6 +424,7 @@ int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
    /* Max size of factorization */
    lenFactors = 9*matrix->nnz;
    factors = (CSRMatrix *)primme_calloc(1,  sizeof(CSRMatrix), "factors");
+   factors->csr = NULL;
    factors->AElts = (double *)primme_calloc(lenFactors,
                                 sizeof(double), "iluElts");
    factors->JA = (int *)primme_calloc(lenFactors, sizeof(int), "Jilu");
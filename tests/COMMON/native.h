@@ -32,7 +32,25 @@
 #include "csr.h"
 #include "primme_svds.h"
 
+int createCSRMatrixKernelNative(CSRMatrix *matrix, int sell);
+int checkCSRMatrixKernelNative(CSRMatrix *matrix, int trans);
 void CSRMatrixMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr);
+#ifdef USE_MPI
+#include <mpi.h>
+typedef struct {
+   CSRMatrix *matrix;     /* the whole matrix */
+   CSRMatrix local;       /* the local rows of the matrix */
+   int *counts, *displs;  /* number of rows and first row of every process */
+   SCALAR *x;             /* the whole vectors gathered for the product */
+   int nx;                /* number of columns allocated in x */
+   MPI_Comm comm;
+} DistCSRMatrix;
+int createDistCSRMatrixNative(CSRMatrix *matrix, MPI_Comm comm,
+      DistCSRMatrix **dist);
+void freeDistCSRMatrix(DistCSRMatrix *dist);
+void DistCSRMatrixMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr);
+#endif
 int createInvDiagPrecNative(const CSRMatrix *matrix, double shift, double **prec);
 void ApplyInvDiagPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, 
                                         primme_params *primme, int *ierr);
@@ -43,6 +61,8 @@ int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
 void ApplyILUTPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr);
 void CSRMatrixMatvecSVD(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
       int *blockSize, int *trans, primme_svds_params *primme_svds, int *ierr);
+void CSRMatrixMatvecNormalSVD(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, int *trans, primme_svds_params *primme_svds, int *ierr);
 int createInvNormalPrecNative(const CSRMatrix *matrix, double shift, double **prec);
 void ApplyInvNormalPrecNative(void *x, PRIMME_INT *ldx, void *y,
       PRIMME_INT *ldy, int *blockSize, int *mode,
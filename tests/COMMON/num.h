@@ -43,6 +43,9 @@
 #endif
 #define Sprimme SCALAR_SUF
 #define Sprimme_svds CONCAT(SCALAR_SUF,_svds)
+#define Sprimme_ws CONCAT(SCALAR_SUF,_ws)
+#define Sprimme_batch CONCAT(SCALAR_SUF,_batch)
+#define Sprimme_slice CONCAT(SCALAR_SUF,_slice)
 #include <stdlib.h>   /* malloc, free */
 #define primme_calloc(N,S,D) (malloc((N)*(S)))
 #define ASSERT_MSG(COND, RETURN, ...) { if (!(COND)) {fprintf(stderr, "Error in " __FUNCT__ ": " __VA_ARGS__); return (RETURN);} }
@@ -123,6 +123,14 @@ int read_solver_params(char *configFileName, char *outputFileName,
             if (ret == 0) printf("Invalid " #V " value\n"); \
          }
          #define OPTION(F, V) if (strcmp(stringValue, #V) == 0) { primme-> F = V; ret = 1; }
+         #define READ_FIELD_STR(V) if (strcmp(field, #V) == 0) { \
+            ret = fscanf(configFile, "%s", stringValue); \
+            if (ret == 1) { \
+               char *str = (char *)malloc(strlen(stringValue) + 1); \
+               strcpy(str, stringValue); \
+               primme-> V = str; \
+            } \
+         }
          #define READ_FIELDParams(S, V, P) if (strcmp(field, #S "." #V) == 0) \
             ret = fscanf(configFile, P, &primme-> S ## Params . V);
          #define READ_FIELD_OPParams(S, V, P) if (strcmp(field, #S "." #V) == 0) { \
@@ -154,6 +162,8 @@ int read_solver_params(char *configFileName, char *outputFileName,
             OPTIONParams(projection, projection, primme_proj_refined)
             OPTIONParams(projection, projection, primme_proj_harmonic)
          );
+         READ_FIELDParams(projection, partialSolve, "%d");
+         READ_FIELDParams(projection, replicatedSolve, "%d");
 
          READ_FIELD_OP(initBasisMode,
             OPTION(initBasisMode, primme_init_default)
@@ -162,6 +172,30 @@ int read_solver_params(char *configFileName, char *outputFileName,
             OPTION(initBasisMode, primme_init_user)
          );
 
+         READ_FIELD_OP(orth,
+            OPTION(orth, primme_orth_default)
+            OPTION(orth, primme_orth_implicit_I)
+            OPTION(orth, primme_orth_explicit_I)
+            OPTION(orth, primme_orth_lowsync)
+         );
+
+         READ_FIELD_OP(internalPrecision,
+            OPTION(internalPrecision, primme_op_default)
+            OPTION(internalPrecision, primme_op_half)
+            OPTION(internalPrecision, primme_op_float)
+            OPTION(internalPrecision, primme_op_double)
+            OPTION(internalPrecision, primme_op_quad)
+            OPTION(internalPrecision, primme_op_auto)
+         );
+
+         READ_FIELD_OP(storagePrecision,
+            OPTION(storagePrecision, primme_op_default)
+            OPTION(storagePrecision, primme_op_half)
+            OPTION(storagePrecision, primme_op_float)
+            OPTION(storagePrecision, primme_op_double)
+            OPTION(storagePrecision, primme_op_quad)
+         );
+
          READ_FIELD(numTargetShifts, "%d");
          if (strcmp(field, "targetShifts") == 0) {
             ret = 1;
@@ -184,6 +218,13 @@ int read_solver_params(char *configFileName, char *outputFileName,
          READ_FIELD(locking, "%d");
          READ_FIELD(initSize, "%d");
          READ_FIELD(numOrthoConst, "%d");
+         READ_FIELD(memoryArena, "%d");
+         READ_FIELD(checkpointInterval, "%d");
+         READ_FIELD(dynamicBlockSize, "%d");
+         READ_FIELD_STR(basisStorageDir);
+         READ_FIELD_STR(checkpointFile);
+         READ_FIELD_STR(profile);
+         READ_FIELD_STR(traceFile);
 
          if (strcmp(field, "iseed") == 0) {
             ret = 1;
@@ -212,6 +253,15 @@ int read_solver_params(char *configFileName, char *outputFileName,
             OPTIONParams(correction, convTest, primme_adaptive)
          );
 
+         READ_FIELD_OPParams(correction, innerPrecision,
+            OPTIONParams(correction, innerPrecision, primme_op_default)
+            OPTIONParams(correction, innerPrecision, primme_op_half)
+            OPTIONParams(correction, innerPrecision, primme_op_float)
+            OPTIONParams(correction, innerPrecision, primme_op_double)
+            OPTIONParams(correction, innerPrecision, primme_op_quad)
+         );
+         READ_FIELDParams(correction, chebyshevDegree, "%d");
+
          READ_FIELDParams(correction, projectors.LeftQ , "%d");
          READ_FIELDParams(correction, projectors.LeftX , "%d");
          READ_FIELDParams(correction, projectors.RightQ, "%d");
@@ -229,6 +279,7 @@ int read_solver_params(char *configFileName, char *outputFileName,
          #undef READ_FIELD
          #undef READ_FIELD_OP
          #undef OPTION
+         #undef READ_FIELD_STR
          #undef READ_FIELDParams
          #undef READ_FIELD_OPParams
          #undef OPTIONParams
@@ -336,6 +387,30 @@ int read_driver_params(char *configFileName, driver_params *driver) {
          else if (strcmp(ident, "driver.checkInterface") == 0) {
             ret = fscanf(configFile, "%d", &driver->checkInterface);
          }
+         else if (strcmp(ident, "driver.callChoice") == 0) {
+            ret = fscanf(configFile, "%s", stringValue);
+            if (ret == 1) {
+               if (strcmp(stringValue, "default") == 0) {
+                  driver->callChoice = driver_call_default;
+               }
+               else if (strcmp(stringValue, "ws") == 0) {
+                  driver->callChoice = driver_call_ws;
+               }
+               else if (strcmp(stringValue, "resume") == 0) {
+                  driver->callChoice = driver_call_resume;
+               }
+               else if (strcmp(stringValue, "batch") == 0) {
+                  driver->callChoice = driver_call_batch;
+               }
+               else if (strcmp(stringValue, "slice") == 0) {
+                  driver->callChoice = driver_call_slice;
+               }
+               else {
+                  fprintf(stderr, 
+                     "ERROR(read_driver_params): Invalid parameter '%s'\n", ident);
+               }
+            }
+         }
          else if (strcmp(ident, "driver.matrixChoice") == 0) {
             ret = fscanf(configFile, "%s", stringValue);
             if (ret == 1) {
@@ -360,6 +435,27 @@ int read_driver_params(char *configFileName, driver_params *driver) {
                }
             }
          }
+         else if (strcmp(ident, "driver.matvecChoice") == 0) {
+            ret = fscanf(configFile, "%s", stringValue);
+            if (ret == 1) {
+               if (strcmp(stringValue, "default") == 0) {
+                  driver->matvecChoice = driver_matvec_default;
+               }
+               else if (strcmp(stringValue, "csr") == 0) {
+                  driver->matvecChoice = driver_matvec_csr;
+               }
+               else if (strcmp(stringValue, "sell") == 0) {
+                  driver->matvecChoice = driver_matvec_sell;
+               }
+               else {
+                  fprintf(stderr, 
+                     "ERROR(read_driver_params): Invalid parameter '%s'\n", ident);
+               }
+            }
+         }
+         else if (strcmp(ident, "driver.matvecNormal") == 0) {
+            ret = fscanf(configFile, "%d", &driver->matvecNormal);
+         }
          /* Preconditioning parameters */
          else if (strcmp(ident, "driver.PrecChoice") == 0) {
             ret = fscanf(configFile, "%s", stringValue);
@@ -391,6 +487,18 @@ int read_driver_params(char *configFileName, driver_params *driver) {
          else if (strcmp(ident, "driver.shift") == 0) {
             ret = fscanf(configFile, "%le", &driver->shift);
          }
+         else if (strcmp(ident, "driver.sliceLower") == 0) {
+            ret = fscanf(configFile, "%le", &driver->sliceLower);
+         }
+         else if (strcmp(ident, "driver.sliceUpper") == 0) {
+            ret = fscanf(configFile, "%le", &driver->sliceUpper);
+         }
+         else if (strcmp(ident, "driver.numSlices") == 0) {
+            ret = fscanf(configFile, "%d", &driver->numSlices);
+         }
+         else if (strcmp(ident, "driver.numThreads") == 0) {
+            ret = fscanf(configFile, "%d", &driver->numThreads);
+         }
          else if (strcmp(ident, "driver.isymm") == 0) {
             ret = fscanf(configFile, "%d", &driver->isymm);
          }
@@ -436,6 +544,8 @@ void driver_display_params(driver_params driver, FILE *outputFile) {
 
 const char *strPrecChoice[] = {"noprecond", "jacobi", "davidsonjacobi", "ilut", "normal", "bjacobi"};
 const char *strMatrixChoice[] = {"default", "native", "petsc", "parasails", "rsb"};
+const char *strMatvecChoice[] = {"default", "csr", "sell"};
+const char *strCallChoice[] = {"default", "ws", "resume", "batch", "slice"};
  
 fprintf(outputFile, "// ---------------------------------------------------\n"
                     "//                 driver configuration               \n"
@@ -445,11 +555,18 @@ fprintf(outputFile, "driver.partId        = %s\n", driver.partId);
 fprintf(outputFile, "driver.partDir       = %s\n", driver.partDir);
 fprintf(outputFile, "driver.matrixFile    = %s\n", driver.matrixFileName);
 fprintf(outputFile, "driver.matrixChoice  = %s\n", strMatrixChoice[driver.matrixChoice]);
+fprintf(outputFile, "driver.matvecChoice  = %s\n", strMatvecChoice[driver.matvecChoice]);
+fprintf(outputFile, "driver.matvecNormal  = %d\n", driver.matvecNormal);
 fprintf(outputFile, "driver.initialGuessesFile = %s\n", driver.initialGuessesFileName);
 fprintf(outputFile, "driver.initialGuessesPert = %e\n", driver.initialGuessesPert);
 fprintf(outputFile, "driver.saveXFile     = %s\n", driver.saveXFileName);
 fprintf(outputFile, "driver.checkXFile    = %s\n", driver.checkXFileName);
 fprintf(outputFile, "driver.checkInterface = %d\n", driver.checkInterface);
+fprintf(outputFile, "driver.callChoice    = %s\n", strCallChoice[driver.callChoice]);
+fprintf(outputFile, "driver.sliceLower    = %e\n", driver.sliceLower);
+fprintf(outputFile, "driver.sliceUpper    = %e\n", driver.sliceUpper);
+fprintf(outputFile, "driver.numSlices     = %d\n", driver.numSlices);
+fprintf(outputFile, "driver.numThreads    = %d\n", driver.numThreads);
 fprintf(outputFile, "driver.PrecChoice    = %s\n", strPrecChoice[driver.PrecChoice]);
 fprintf(outputFile, "driver.shift         = %e\n", driver.shift);
 fprintf(outputFile, "driver.isymm         = %d\n", driver.isymm);
@@ -634,6 +751,15 @@ int read_solver_params_svds(char *configFileName, char *outputFileName,
             OPTION(method, primme_svds_op_augmented)
          );
 
+         READ_FIELD_OP(internalPrecision,
+            OPTION(internalPrecision, primme_op_default)
+            OPTION(internalPrecision, primme_op_half)
+            OPTION(internalPrecision, primme_op_float)
+            OPTION(internalPrecision, primme_op_double)
+            OPTION(internalPrecision, primme_op_quad)
+            OPTION(internalPrecision, primme_op_auto)
+         );
+
          if (ret == 0) {
             fprintf(stderr, 
                "ERROR(read_solver_params_svds): Invalid parameter '%s'\n", ident);
@@ -686,6 +812,18 @@ int read_solver_params_svds(char *configFileName, char *outputFileName,
 
 #ifdef USE_MPI
 
+/******************************************************************************
+ * Function to broadcast a string read by processor 0, or NULL
+******************************************************************************/
+static void broadCast_string(const char **str, int master, MPI_Comm comm) {
+
+   int len = (master && *str) ? (int)strlen(*str) + 1 : 0;
+   MPI_Bcast(&len, 1, MPI_INT, 0, comm);
+   if (len == 0) return;
+   if (!master) *str = (char *)malloc(len);
+   MPI_Bcast((void *)*str, len, MPI_CHAR, 0, comm);
+}
+
 /******************************************************************************
  * Function to broadcast the primme data structure to all processors
  *
@@ -705,6 +843,12 @@ void broadCast(primme_params *primme, primme_preset_method *method,
       MPI_Bcast(driver->checkXFileName, 1024, MPI_CHAR, 0, comm);
       MPI_Bcast(&driver->initialGuessesPert, 1, MPI_DOUBLE, 0, comm);
       MPI_Bcast(&driver->matrixChoice, 1, MPI_INT, 0, comm);
+      MPI_Bcast(&driver->matvecChoice, 1, MPI_INT, 0, comm);
+      MPI_Bcast(&driver->callChoice, 1, MPI_INT, 0, comm);
+      MPI_Bcast(&driver->sliceLower, 1, MPI_DOUBLE, 0, comm);
+      MPI_Bcast(&driver->sliceUpper, 1, MPI_DOUBLE, 0, comm);
+      MPI_Bcast(&driver->numSlices, 1, MPI_INT, 0, comm);
+      MPI_Bcast(&driver->numThreads, 1, MPI_INT, 0, comm);
       MPI_Bcast(&driver->PrecChoice, 1, MPI_INT, 0, comm);
       MPI_Bcast(&driver->isymm, 1, MPI_INT, 0, comm);
       MPI_Bcast(&driver->level, 1, MPI_INT, 0, comm);
@@ -728,6 +872,13 @@ void broadCast(primme_params *primme, primme_preset_method *method,
    MPI_Bcast(&(primme->dynamicMethodSwitch), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->initSize), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->numOrthoConst), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->memoryArena), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->checkpointInterval), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->dynamicBlockSize), 1, MPI_INT, 0, comm);
+   broadCast_string(&primme->basisStorageDir, master, comm);
+   broadCast_string(&primme->checkpointFile, master, comm);
+   broadCast_string(&primme->profile, master, comm);
+   broadCast_string(&primme->traceFile, master, comm);
    MPI_Bcast(&(primme->maxBasisSize), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->minRestartSize), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->maxBlockSize), 1, MPI_INT, 0, comm);
@@ -737,9 +888,13 @@ void broadCast(primme_params *primme, primme_preset_method *method,
    MPI_Bcast(&(primme->eps), 1, MPI_DOUBLE, 0, comm);
    MPI_Bcast(&(primme->printLevel), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->initBasisMode), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->orth), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->storagePrecision), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->internalPrecision), 1, MPI_INT, 0, comm);
 
    MPI_Bcast(&(primme->projectionParams.projection), 1, MPI_INT, 0, comm);
-   MPI_Bcast(&(primme->restartingParams.scheme), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->projectionParams.partialSolve), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->projectionParams.replicatedSolve), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->restartingParams.maxPrevRetain), 1, MPI_INT, 0, comm);
 
    MPI_Bcast(&(primme->correctionParams.precondition), 1, MPI_INT, 0, comm);
@@ -747,6 +902,8 @@ void broadCast(primme_params *primme, primme_preset_method *method,
    MPI_Bcast(&(primme->correctionParams.maxInnerIterations),1, MPI_INT, 0,comm);
    MPI_Bcast(&(primme->correctionParams.convTest), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->correctionParams.relTolBase), 1, MPI_DOUBLE, 0, comm);
+   MPI_Bcast(&(primme->correctionParams.innerPrecision), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->correctionParams.chebyshevDegree), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->correctionParams.projectors.LeftQ),  1, MPI_INT, 0,comm);
    MPI_Bcast(&(primme->correctionParams.projectors.LeftX),  1, MPI_INT, 0,comm);
    MPI_Bcast(&(primme->correctionParams.projectors.RightQ), 1, MPI_INT, 0,comm);
@@ -775,6 +932,9 @@ void broadCast_svds(primme_svds_params *primme_svds, primme_svds_preset_method *
    MPI_Bcast(driver->checkXFileName, 1024, MPI_CHAR, 0, comm);
    MPI_Bcast(&driver->initialGuessesPert, 1, MPI_DOUBLE, 0, comm);
    MPI_Bcast(&driver->matrixChoice, 1, MPI_INT, 0, comm);
+   MPI_Bcast(&driver->matvecChoice, 1, MPI_INT, 0, comm);
+   MPI_Bcast(&driver->matvecNormal, 1, MPI_INT, 0, comm);
+   MPI_Bcast(&driver->numThreads, 1, MPI_INT, 0, comm);
    MPI_Bcast(&driver->PrecChoice, 1, MPI_INT, 0, comm);
    MPI_Bcast(&driver->isymm, 1, MPI_INT, 0, comm);
    MPI_Bcast(&driver->level, 1, MPI_INT, 0, comm);
@@ -804,6 +964,7 @@ void broadCast_svds(primme_svds_params *primme_svds, primme_svds_preset_method *
    MPI_Bcast(&(primme_svds->method), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme_svds->methodStage2), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme_svds->precondition), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme_svds->internalPrecision), 1, MPI_INT, 0, comm);
 
    MPI_Bcast(method, 1, MPI_INT, 0, comm);
    broadCast(&primme_svds->primme, primmemethod,  NULL, master, comm);
@@ -822,6 +983,7 @@ void par_GlobalSumDouble(void *sendBuf, void *recvBuf, int *count,
                          primme_params *primme, int *ierr) {
    MPI_Comm communicator = *(MPI_Comm *) primme->commInfo;
 
+   if (sendBuf == recvBuf) sendBuf = MPI_IN_PLACE;
 #ifdef USE_PETSC
    extern PetscLogEvent PRIMME_GLOBAL_SUM;
    PetscLogEventBegin(PRIMME_GLOBAL_SUM,0,0,0,0);
@@ -832,10 +994,34 @@ void par_GlobalSumDouble(void *sendBuf, void *recvBuf, int *count,
 #endif
 }
 
+/******************************************************************************
+ * MPI split-phase globalSumDouble functions
+ *
+******************************************************************************/
+void par_GlobalSumDoubleStart(void *sendBuf, void *recvBuf, int *count,
+      void **request, primme_params *primme, int *ierr) {
+   MPI_Comm communicator = *(MPI_Comm *) primme->commInfo;
+   MPI_Request *req = (MPI_Request *)malloc(sizeof(MPI_Request));
+
+   if (sendBuf == recvBuf) sendBuf = MPI_IN_PLACE;
+   *ierr = MPI_Iallreduce(
+         sendBuf, recvBuf, *count, MPI_DOUBLE, MPI_SUM, communicator, req);
+   *request = req;
+}
+
+void par_GlobalSumDoubleWait(void *request, primme_params *primme, int *ierr) {
+   MPI_Request *req = (MPI_Request *)request;
+
+   (void)primme;
+   *ierr = MPI_Wait(req, MPI_STATUS_IGNORE);
+   free(req);
+}
+
 void par_GlobalSumDoubleSvds(void *sendBuf, void *recvBuf, int *count, 
                          primme_svds_params *primme_svds, int *ierr) {
    MPI_Comm communicator = *(MPI_Comm *) primme_svds->commInfo;
 
+   if (sendBuf == recvBuf) sendBuf = MPI_IN_PLACE;
 #ifdef USE_PETSC
    extern PetscLogEvent PRIMME_GLOBAL_SUM;
    PetscLogEventBegin(PRIMME_GLOBAL_SUM,0,0,0,0);
@@ -53,6 +53,20 @@ typedef enum {
    driver_bjacobi       /* block jacobi */
 } driver_prec;
 
+typedef enum {
+   driver_matvec_default, /* SPARSKIT for the native matrices */
+   driver_matvec_csr,     /* primme_csr_mm on the CSR matrix */
+   driver_matvec_sell     /* primme_csr_mm on the SELL-C-sigma matrix */
+} driver_matvec;
+
+typedef enum {
+   driver_call_default, /* call Sprimme */
+   driver_call_ws,      /* call Sprimme_ws twice on a warm-start workspace */
+   driver_call_resume,  /* stop Sprimme early and resume from checkpointFile */
+   driver_call_batch,   /* call Sprimme_batch on the problem and a copy */
+   driver_call_slice    /* call Sprimme_slice on [sliceLower, sliceUpper] */
+} driver_call;
+
 typedef struct driver_params {
 
    char outputFileName[512];
@@ -65,8 +79,14 @@ typedef struct driver_params {
    double initialGuessesPert;
    char checkXFileName[1024];
    int checkInterface;
+   driver_call callChoice;
+   double sliceLower, sliceUpper; /* interval for callChoice slice */
+   int numSlices;
+   int numThreads;              /* OpenMP threads, one if not set */
 
    driver_mat matrixChoice;
+   driver_matvec matvecChoice;  /* product kernel for native matrices */
+   int matvecNormal;            /* set primme_svds.matrixMatvecNormal */
 
    int weightedPart;
 
@@ -97,6 +117,9 @@ void driver_display_methodsvd(primme_svds_preset_method method, const char *meth
 #include <mpi.h>
 void par_GlobalSumDouble(void *sendBuf, void *recvBuf, int *count, 
                          primme_params *primme, int *ierr);
+void par_GlobalSumDoubleStart(void *sendBuf, void *recvBuf, int *count,
+      void **request, primme_params *primme, int *ierr);
+void par_GlobalSumDoubleWait(void *request, primme_params *primme, int *ierr);
 void par_GlobalSumDoubleSvds(void *sendBuf, void *recvBuf, int *count, 
                          primme_svds_params *primme, int *ierr);
 void broadCast_svds(primme_svds_params *primme_svds, primme_svds_preset_method *method,
@@ -0,0 +1,694 @@
+/*******************************************************************************
+ *   PRIMME PReconditioned Iterative MultiMethod Eigensolver
+ *   Copyright (C) 2018 College of William & Mary,
+ *   James R. McCombs, Eloy Romero Alcalde, Andreas Stathopoulos, Lingfei Wu
+ *
+ *   This file is part of PRIMME.
+ *
+ *   PRIMME is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2.1 of the License, or (at your option) any later version.
+ *
+ *   PRIMME is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *******************************************************************************
+ * File: bench.c
+ *
+ * Purpose - benchmark driver that generates the matrices in memory, runs a
+ *           set of methods, block sizes and thread counts on them, and writes
+ *           the statistics of every run in JSON.
+ *
+ *  Calling format:
+ *
+ *             primme_bench [options]
+ *
+ *  -o file          write the JSON to file instead of the standard output
+ *  -scale s         multiply the size of the problems by s (default 1)
+ *  -problems list   comma separated list from lap2d, lap3d, randspd and rect
+ *                   (default all); rect is a tall-skinny matrix solved with
+ *                   dprimme_svds, the rest are SPD matrices solved with dprimme
+ *  -methods list    comma separated list of preset methods without the prefix
+ *                   PRIMME_ (default DYNAMIC,GD_Olsen_plusK,JDQMR,
+ *                   LOBPCG_OrthoBasis_Window)
+ *  -bs list         comma separated list of maxBlockSize (default 1,4)
+ *  -threads list    comma separated list of OpenMP threads (default 1 and
+ *                   the maximum number of threads)
+ *  -nev n           number of eigenvalues or singular values (default 10)
+ *  -eps tol         convergence tolerance (default 1e-8)
+ *  -maxMatvecs n    maximum number of matrix-vector products (default 500000)
+ *  -repeat r        solve each case r times and report the fastest (default 1)
+ *
+ *  Threads other than 1 need the driver built with OpenMP. PRIMME kernels
+ *  are multithreaded if the library is built with PRIMME_WITH_OPENMP=yes; the
+ *  threads of BLAS are controlled by the variables of the BLAS library, e.g.,
+ *  OPENBLAS_NUM_THREADS.
+ *
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/time.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+#include "primme.h"
+
+/* Compressed sparse row matrix */
+
+typedef struct {
+   PRIMME_INT m, n;     /* rows and columns */
+   PRIMME_INT *rowptr;  /* row pointers, size m+1 */
+   PRIMME_INT *colind;  /* column indices, size nnz */
+   double *vals;        /* values, size nnz */
+} benchMatrix;
+
+typedef struct {
+   const char *name;    /* problem name */
+   benchMatrix A;       /* matrix */
+   benchMatrix At;      /* transpose, only for svds problems */
+   int svds;            /* solve with dprimme_svds if nonzero */
+} benchProblem;
+
+static const struct {
+   const char *name;
+   primme_preset_method method;
+} methods[] = {
+   {"DEFAULT_METHOD", PRIMME_DEFAULT_METHOD},
+   {"DYNAMIC", PRIMME_DYNAMIC},
+   {"DEFAULT_MIN_TIME", PRIMME_DEFAULT_MIN_TIME},
+   {"DEFAULT_MIN_MATVECS", PRIMME_DEFAULT_MIN_MATVECS},
+   {"Arnoldi", PRIMME_Arnoldi},
+   {"GD", PRIMME_GD},
+   {"GD_plusK", PRIMME_GD_plusK},
+   {"GD_Olsen_plusK", PRIMME_GD_Olsen_plusK},
+   {"JD_Olsen_plusK", PRIMME_JD_Olsen_plusK},
+   {"RQI", PRIMME_RQI},
+   {"JDQR", PRIMME_JDQR},
+   {"JDQMR", PRIMME_JDQMR},
+   {"JDQMR_ETol", PRIMME_JDQMR_ETol},
+   {"STEEPEST_DESCENT", PRIMME_STEEPEST_DESCENT},
+   {"LOBPCG_OrthoBasis", PRIMME_LOBPCG_OrthoBasis},
+   {"LOBPCG_OrthoBasis_Window", PRIMME_LOBPCG_OrthoBasis_Window}};
+
+static double wallTime(void) {
+   struct timeval t;
+   gettimeofday(&t, NULL);
+   return t.tv_sec + t.tv_usec * 1e-6;
+}
+
+/******************************************************************************
+ * Matrix generation
+ ******************************************************************************/
+
+static unsigned long long randState = 88172645463325252ULL;
+
+static double randUniform(void) {
+   randState ^= randState << 13;
+   randState ^= randState >> 7;
+   randState ^= randState << 17;
+   return (randState >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static void allocMatrix(benchMatrix *A, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT nnz) {
+   A->m = m;
+   A->n = n;
+   A->rowptr = (PRIMME_INT *)malloc(sizeof(PRIMME_INT) * (m + 1));
+   A->colind = (PRIMME_INT *)malloc(sizeof(PRIMME_INT) * (nnz > 0 ? nnz : 1));
+   A->vals = (double *)malloc(sizeof(double) * (nnz > 0 ? nnz : 1));
+   if (!A->rowptr || !A->colind || !A->vals) {
+      fprintf(stderr, "Not enough memory for a matrix of %lld nonzeros\n",
+            (long long)nnz);
+      exit(1);
+   }
+}
+
+static void freeMatrix(benchMatrix *A) {
+   free(A->rowptr);
+   free(A->colind);
+   free(A->vals);
+   A->rowptr = A->colind = NULL;
+   A->vals = NULL;
+}
+
+/* Laplacian with Dirichlet conditions on a k^dim grid (dim is 2 or 3) */
+
+static void laplacian(benchMatrix *A, PRIMME_INT k, int dim) {
+   PRIMME_INT n = dim == 2 ? k * k : k * k * k, i, nnz = 0;
+   PRIMME_INT stride[3] = {1, k, k * k};
+   int d;
+
+   allocMatrix(A, n, n, n * (2 * dim + 1));
+   A->rowptr[0] = 0;
+   for (i = 0; i < n; i++) {
+      for (d = dim - 1; d >= 0; d--) {
+         if ((i / stride[d]) % k > 0) {
+            A->colind[nnz] = i - stride[d];
+            A->vals[nnz++] = -1.0;
+         }
+      }
+      A->colind[nnz] = i;
+      A->vals[nnz++] = 2.0 * dim;
+      for (d = 0; d < dim; d++) {
+         if ((i / stride[d]) % k < k - 1) {
+            A->colind[nnz] = i + stride[d];
+            A->vals[nnz++] = -1.0;
+         }
+      }
+      A->rowptr[i + 1] = nnz;
+   }
+}
+
+/* Build CSR from coordinate entries; duplicates are kept */
+
+static void fromCoordinates(benchMatrix *A, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT nnz, const PRIMME_INT *ri, const PRIMME_INT *ci,
+      const double *va) {
+   PRIMME_INT i, *next;
+
+   allocMatrix(A, m, n, nnz);
+   for (i = 0; i <= m; i++) A->rowptr[i] = 0;
+   for (i = 0; i < nnz; i++) A->rowptr[ri[i] + 1]++;
+   for (i = 0; i < m; i++) A->rowptr[i + 1] += A->rowptr[i];
+   next = (PRIMME_INT *)malloc(sizeof(PRIMME_INT) * (m > 0 ? m : 1));
+   for (i = 0; i < m; i++) next[i] = A->rowptr[i];
+   for (i = 0; i < nnz; i++) {
+      A->colind[next[ri[i]]] = ci[i];
+      A->vals[next[ri[i]]++] = va[i];
+   }
+   free(next);
+}
+
+/* Random sparse symmetric matrix with about 2*k+1 nonzeros per row, made   */
+/* positive definite by diagonal dominance                                  */
+
+static void randomSPD(benchMatrix *A, PRIMME_INT n, int k) {
+   PRIMME_INT nnz = 0, i, *ri, *ci;
+   double *va, *diag;
+   int j;
+
+   ri = (PRIMME_INT *)malloc(sizeof(PRIMME_INT) * n * (2 * k + 1));
+   ci = (PRIMME_INT *)malloc(sizeof(PRIMME_INT) * n * (2 * k + 1));
+   va = (double *)malloc(sizeof(double) * n * (2 * k + 1));
+   diag = (double *)calloc(n, sizeof(double));
+   for (i = 0; i < n; i++) {
+      for (j = 0; j < k; j++) {
+         PRIMME_INT c = (PRIMME_INT)(randUniform() * n);
+         double v = randUniform() - .5;
+         if (c == i) continue;
+         ri[nnz] = i;
+         ci[nnz] = c;
+         va[nnz++] = v;
+         ri[nnz] = c;
+         ci[nnz] = i;
+         va[nnz++] = v;
+         diag[i] += fabs(v);
+         diag[c] += fabs(v);
+      }
+   }
+   for (i = 0; i < n; i++) {
+      ri[nnz] = i;
+      ci[nnz] = i;
+      va[nnz++] = diag[i] + randUniform() + 1e-3;
+   }
+   fromCoordinates(A, n, n, nnz, ri, ci, va);
+   free(ri);
+   free(ci);
+   free(va);
+   free(diag);
+}
+
+/* Random m x n matrix with k nonzeros per row plus a diagonal band */
+
+static void randomRect(benchMatrix *A, benchMatrix *At, PRIMME_INT m,
+      PRIMME_INT n, int k) {
+   PRIMME_INT nnz = 0, i, *ri, *ci;
+   double *va;
+   int j;
+
+   ri = (PRIMME_INT *)malloc(sizeof(PRIMME_INT) * m * (k + 1));
+   ci = (PRIMME_INT *)malloc(sizeof(PRIMME_INT) * m * (k + 1));
+   va = (double *)malloc(sizeof(double) * m * (k + 1));
+   for (i = 0; i < m; i++) {
+      ri[nnz] = i;
+      ci[nnz] = i % n;
+      va[nnz++] = 1.0 + (double)(i % n) / n;
+      for (j = 0; j < k; j++) {
+         ri[nnz] = i;
+         ci[nnz] = (PRIMME_INT)(randUniform() * n);
+         va[nnz++] = randUniform() - .5;
+      }
+   }
+   fromCoordinates(A, m, n, nnz, ri, ci, va);
+   fromCoordinates(At, n, m, nnz, ci, ri, va);
+   free(ri);
+   free(ci);
+   free(va);
+}
+
+/******************************************************************************
+ * Matrix-vector products
+ ******************************************************************************/
+
+static void csrMatvec(const benchMatrix *A, const double *x, PRIMME_INT ldx,
+      double *y, PRIMME_INT ldy, int blockSize) {
+   PRIMME_INT i;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+   for (i = 0; i < A->m; i++) {
+      int b;
+      for (b = 0; b < blockSize; b++) {
+         PRIMME_INT j;
+         double s = 0.0;
+         for (j = A->rowptr[i]; j < A->rowptr[i + 1]; j++) {
+            s += A->vals[j] * x[ldx * b + A->colind[j]];
+         }
+         y[ldy * b + i] = s;
+      }
+   }
+}
+
+static void eigsMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr) {
+   csrMatvec(&((benchProblem *)primme->matrix)->A, (double *)x, *ldx,
+         (double *)y, *ldy, *blockSize);
+   *ierr = 0;
+}
+
+static void svdsMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, int *transpose, primme_svds_params *primme_svds,
+      int *ierr) {
+   benchProblem *p = (benchProblem *)primme_svds->matrix;
+   csrMatvec(*transpose ? &p->At : &p->A, (double *)x, *ldx, (double *)y,
+         *ldy, *blockSize);
+   *ierr = 0;
+}
+
+/******************************************************************************
+ * JSON output
+ ******************************************************************************/
+
+static void jsonDouble(FILE *f, const char *name, double v, int last) {
+   if (isfinite(v)) {
+      fprintf(f, "\"%s\": %.17g%s", name, v, last ? "" : ", ");
+   } else {
+      fprintf(f, "\"%s\": null%s", name, last ? "" : ", ");
+   }
+}
+
+static void jsonInt(FILE *f, const char *name, PRIMME_INT v, int last) {
+   fprintf(f, "\"%s\": %lld%s", name, (long long)v, last ? "" : ", ");
+}
+
+static void printEigsStats(FILE *f, const primme_stats *s) {
+   fprintf(f, "\"stats\": {");
+   jsonInt(f, "numOuterIterations", s->numOuterIterations, 0);
+   jsonInt(f, "numRestarts", s->numRestarts, 0);
+   jsonInt(f, "numMatvecs", s->numMatvecs, 0);
+   jsonInt(f, "numPreconds", s->numPreconds, 0);
+   jsonInt(f, "numGlobalSum", s->numGlobalSum, 0);
+   jsonInt(f, "numBroadcast", s->numBroadcast, 0);
+   jsonInt(f, "volumeGlobalSum", s->volumeGlobalSum, 0);
+   jsonInt(f, "volumeBroadcast", s->volumeBroadcast, 0);
+   jsonDouble(f, "flopsDense", s->flopsDense, 0);
+   jsonDouble(f, "numOrthoInnerProds", s->numOrthoInnerProds, 0);
+   jsonDouble(f, "elapsedTime", s->elapsedTime, 0);
+   jsonDouble(f, "timeMatvec", s->timeMatvec, 0);
+   jsonDouble(f, "timePrecond", s->timePrecond, 0);
+   jsonDouble(f, "timeOrtho", s->timeOrtho, 0);
+   jsonDouble(f, "timeGlobalSum", s->timeGlobalSum, 0);
+   jsonDouble(f, "timeBroadcast", s->timeBroadcast, 0);
+   jsonDouble(f, "timeDense", s->timeDense, 0);
+   jsonDouble(f, "estimateMinEVal", s->estimateMinEVal, 0);
+   jsonDouble(f, "estimateMaxEVal", s->estimateMaxEVal, 0);
+   jsonDouble(f, "estimateLargestSVal", s->estimateLargestSVal, 0);
+   jsonDouble(f, "estimateBNorm", s->estimateBNorm, 0);
+   jsonDouble(f, "estimateInvBNorm", s->estimateInvBNorm, 0);
+   jsonDouble(f, "maxConvTol", s->maxConvTol, 0);
+   jsonDouble(f, "estimateResidualError", s->estimateResidualError, 0);
+   jsonInt(f, "lockingIssue", s->lockingIssue, 0);
+   jsonInt(f, "numGlobalSumRequested", s->numGlobalSumRequested, 0);
+   jsonInt(f, "numReplicatedMismatches", s->numReplicatedMismatches, 1);
+   fprintf(f, "}, ");
+}
+
+static void printSvdsStats(FILE *f, const primme_svds_stats *s) {
+   fprintf(f, "\"stats\": {");
+   jsonInt(f, "numOuterIterations", s->numOuterIterations, 0);
+   jsonInt(f, "numRestarts", s->numRestarts, 0);
+   jsonInt(f, "numMatvecs", s->numMatvecs, 0);
+   jsonInt(f, "numPreconds", s->numPreconds, 0);
+   jsonInt(f, "numGlobalSum", s->numGlobalSum, 0);
+   jsonInt(f, "numBroadcast", s->numBroadcast, 0);
+   jsonInt(f, "volumeGlobalSum", s->volumeGlobalSum, 0);
+   jsonInt(f, "volumeBroadcast", s->volumeBroadcast, 0);
+   jsonDouble(f, "numOrthoInnerProds", s->numOrthoInnerProds, 0);
+   jsonDouble(f, "elapsedTime", s->elapsedTime, 0);
+   jsonDouble(f, "timeMatvec", s->timeMatvec, 0);
+   jsonDouble(f, "timePrecond", s->timePrecond, 0);
+   jsonDouble(f, "timeOrtho", s->timeOrtho, 0);
+   jsonDouble(f, "timeGlobalSum", s->timeGlobalSum, 0);
+   jsonDouble(f, "timeBroadcast", s->timeBroadcast, 0);
+   jsonInt(f, "lockingIssue", s->lockingIssue, 0);
+   jsonInt(f, "numGlobalSumRequested", s->numGlobalSumRequested, 1);
+   fprintf(f, "}, ");
+}
+
+/* Rates derived from the statistics; a rate is null if its time is zero */
+
+static double rate(double work, double time) {
+   return time > 0.0 ? work / time : NAN;
+}
+
+static void printThroughput(FILE *f, PRIMME_INT nnz, PRIMME_INT n,
+      PRIMME_INT numMatvecs, PRIMME_INT numOuterIterations,
+      double numOrthoInnerProds, double elapsedTime, double timeMatvec,
+      double timeOrtho, double flopsDense, double timeDense) {
+   fprintf(f, "\"throughput\": {");
+   jsonDouble(f, "matvecsPerSecond", rate(numMatvecs, elapsedTime), 0);
+   jsonDouble(f, "iterationsPerSecond",
+         rate(numOuterIterations, elapsedTime), 0);
+   jsonDouble(f, "matvecGflops",
+         rate(2.0 * nnz * numMatvecs * 1e-9, timeMatvec), 0);
+   jsonDouble(f, "orthoGflops",
+         rate(2.0 * n * numOrthoInnerProds * 1e-9, timeOrtho), 0);
+   jsonDouble(f, "denseGflops", rate(flopsDense * 1e-9, timeDense), 0);
+   jsonDouble(f, "matvecTimeFraction", rate(timeMatvec, elapsedTime), 1);
+   fprintf(f, "}");
+}
+
+/******************************************************************************
+ * Runs
+ ******************************************************************************/
+
+typedef struct {
+   int nev;
+   double eps;
+   PRIMME_INT maxMatvecs;
+   int repeat;
+} benchOptions;
+
+static int runEigs(FILE *f, benchProblem *p, int im, int bs, int threads,
+      const benchOptions *opt) {
+   primme_params primme, best;
+   double *evals, *evecs, *rnorms, t, bestTime = HUGE_VAL;
+   int r, ret = 0, bestRet = 0;
+
+   evals = (double *)malloc(sizeof(double) * opt->nev);
+   rnorms = (double *)malloc(sizeof(double) * opt->nev);
+   evecs = (double *)malloc(sizeof(double) * p->A.n * opt->nev);
+   memset(&best, 0, sizeof(best));
+   for (r = 0; r < opt->repeat; r++) {
+      primme_initialize(&primme);
+      primme.n = p->A.n;
+      primme.matrix = p;
+      primme.matrixMatvec = eigsMatvec;
+      primme.numEvals = opt->nev;
+      primme.eps = opt->eps;
+      primme.target = primme_smallest;
+      primme.maxMatvecs = opt->maxMatvecs;
+      primme.maxBlockSize = bs;
+      primme_set_method(methods[im].method, &primme);
+      t = wallTime();
+      ret = dprimme(evals, evecs, rnorms, &primme);
+      t = wallTime() - t;
+      if (t < bestTime) {
+         bestTime = t;
+         best = primme;
+         bestRet = ret;
+      }
+      primme_free(&primme);
+   }
+
+   fprintf(f, "{\"problem\": \"%s\", \"solver\": \"dprimme\", ", p->name);
+   jsonInt(f, "m", p->A.m, 0);
+   jsonInt(f, "n", p->A.n, 0);
+   jsonInt(f, "nnz", p->A.rowptr[p->A.m], 0);
+   fprintf(f, "\"method\": \"%s\", ", methods[im].name);
+   jsonInt(f, "blockSize", bs, 0);
+   jsonInt(f, "threads", threads, 0);
+   jsonInt(f, "numEvals", opt->nev, 0);
+   jsonDouble(f, "eps", opt->eps, 0);
+   jsonInt(f, "ret", bestRet, 0);
+   jsonInt(f, "converged", best.initSize, 0);
+   jsonDouble(f, "wallTime", bestTime, 0);
+   printEigsStats(f, &best.stats);
+   printThroughput(f, p->A.rowptr[p->A.m], p->A.n, best.stats.numMatvecs,
+         best.stats.numOuterIterations, best.stats.numOrthoInnerProds,
+         best.stats.elapsedTime, best.stats.timeMatvec, best.stats.timeOrtho,
+         best.stats.flopsDense, best.stats.timeDense);
+   fprintf(f, "}");
+
+   free(evals);
+   free(rnorms);
+   free(evecs);
+   return bestRet;
+}
+
+static int runSvds(FILE *f, benchProblem *p, int im, int bs, int threads,
+      const benchOptions *opt) {
+   primme_svds_params primme_svds, best;
+   double *svals, *svecs, *rnorms, t, bestTime = HUGE_VAL;
+   int r, ret = 0, bestRet = 0;
+
+   svals = (double *)malloc(sizeof(double) * opt->nev);
+   rnorms = (double *)malloc(sizeof(double) * opt->nev);
+   svecs = (double *)malloc(sizeof(double) * (p->A.m + p->A.n) * opt->nev);
+   memset(&best, 0, sizeof(best));
+   for (r = 0; r < opt->repeat; r++) {
+      primme_svds_initialize(&primme_svds);
+      primme_svds.m = p->A.m;
+      primme_svds.n = p->A.n;
+      primme_svds.matrix = p;
+      primme_svds.matrixMatvec = svdsMatvec;
+      primme_svds.numSvals = opt->nev;
+      primme_svds.eps = opt->eps;
+      primme_svds.target = primme_svds_largest;
+      primme_svds.maxMatvecs = opt->maxMatvecs;
+      primme_svds.maxBlockSize = bs;
+      primme_svds_set_method(primme_svds_default, methods[im].method,
+            PRIMME_DEFAULT_METHOD, &primme_svds);
+      t = wallTime();
+      ret = dprimme_svds(svals, svecs, rnorms, &primme_svds);
+      t = wallTime() - t;
+      if (t < bestTime) {
+         bestTime = t;
+         best = primme_svds;
+         bestRet = ret;
+      }
+      primme_svds_free(&primme_svds);
+   }
+
+   fprintf(f, "{\"problem\": \"%s\", \"solver\": \"dprimme_svds\", ",
+         p->name);
+   jsonInt(f, "m", p->A.m, 0);
+   jsonInt(f, "n", p->A.n, 0);
+   jsonInt(f, "nnz", p->A.rowptr[p->A.m], 0);
+   fprintf(f, "\"method\": \"%s\", ", methods[im].name);
+   jsonInt(f, "blockSize", bs, 0);
+   jsonInt(f, "threads", threads, 0);
+   jsonInt(f, "numEvals", opt->nev, 0);
+   jsonDouble(f, "eps", opt->eps, 0);
+   jsonInt(f, "ret", bestRet, 0);
+   jsonInt(f, "converged", best.initSize, 0);
+   jsonDouble(f, "wallTime", bestTime, 0);
+   printSvdsStats(f, &best.stats);
+   printThroughput(f, p->A.rowptr[p->A.m], p->A.m + p->A.n,
+         best.stats.numMatvecs, best.stats.numOuterIterations,
+         best.stats.numOrthoInnerProds, best.stats.elapsedTime,
+         best.stats.timeMatvec, best.stats.timeOrtho, NAN, 0.0);
+   fprintf(f, "}");
+
+   free(svals);
+   free(rnorms);
+   free(svecs);
+   return bestRet;
+}
+
+/******************************************************************************
+ * Command line
+ ******************************************************************************/
+
+/* Parse a comma separated list of positive integers */
+
+static int parseInts(const char *s, int *v, int max) {
+   int n = 0;
+   char *end;
+   while (*s && n < max) {
+      v[n] = (int)strtol(s, &end, 10);
+      if (end == s || v[n] <= 0) return -1;
+      n++;
+      s = *end == ',' ? end + 1 : end;
+      if (*end && *end != ',') return -1;
+   }
+   return n;
+}
+
+/* Return whether name is in the comma separated list */
+
+static int inList(const char *list, const char *name) {
+   size_t l = strlen(name);
+   const char *s = list;
+   while ((s = strstr(s, name)) != NULL) {
+      if ((s == list || s[-1] == ',') && (s[l] == ',' || s[l] == '\0')) {
+         return 1;
+      }
+      s += l;
+   }
+   return 0;
+}
+
+static void usage(const char *prog) {
+   fprintf(stderr,
+         "Usage: %s [-o file] [-scale s] [-problems list] [-methods list]\n"
+         "          [-bs list] [-threads list] [-nev n] [-eps tol]\n"
+         "          [-maxMatvecs n] [-repeat r]\n",
+         prog);
+   exit(1);
+}
+
+int main(int argc, char **argv) {
+   const char *outFile = NULL;
+   const char *problemList = "lap2d,lap3d,randspd,rect";
+   const char *methodList =
+         "DYNAMIC,GD_Olsen_plusK,JDQMR,LOBPCG_OrthoBasis_Window";
+   double scale = 1.0;
+   int bs[32] = {1, 4}, nbs = 2, threads[32] = {1}, nthreads = 1;
+   benchOptions opt = {10, 1e-8, 500000, 1};
+   benchProblem problems[4];
+   int nproblems = 0, i, j, k, l, first = 1, failures = 0;
+   char host[256] = "";
+   time_t now = time(NULL);
+   FILE *f = stdout;
+
+#ifdef _OPENMP
+   if (omp_get_max_threads() > 1) {
+      threads[nthreads++] = omp_get_max_threads();
+   }
+#endif
+
+   for (i = 1; i < argc; i++) {
+      if (i + 1 >= argc) usage(argv[0]);
+      if (strcmp(argv[i], "-o") == 0) {
+         outFile = argv[++i];
+      } else if (strcmp(argv[i], "-scale") == 0) {
+         scale = atof(argv[++i]);
+      } else if (strcmp(argv[i], "-problems") == 0) {
+         problemList = argv[++i];
+      } else if (strcmp(argv[i], "-methods") == 0) {
+         methodList = argv[++i];
+      } else if (strcmp(argv[i], "-bs") == 0) {
+         if ((nbs = parseInts(argv[++i], bs, 32)) <= 0) usage(argv[0]);
+      } else if (strcmp(argv[i], "-threads") == 0) {
+         if ((nthreads = parseInts(argv[++i], threads, 32)) <= 0) {
+            usage(argv[0]);
+         }
+      } else if (strcmp(argv[i], "-nev") == 0) {
+         opt.nev = atoi(argv[++i]);
+      } else if (strcmp(argv[i], "-eps") == 0) {
+         opt.eps = atof(argv[++i]);
+      } else if (strcmp(argv[i], "-maxMatvecs") == 0) {
+         opt.maxMatvecs = atol(argv[++i]);
+      } else if (strcmp(argv[i], "-repeat") == 0) {
+         opt.repeat = atoi(argv[++i]);
+      } else {
+         usage(argv[0]);
+      }
+   }
+   if (scale <= 0.0 || opt.nev <= 0 || opt.repeat <= 0) usage(argv[0]);
+
+   /* Generate the problems */
+
+   if (inList(problemList, "lap2d")) {
+      problems[nproblems].name = "lap2d";
+      problems[nproblems].svds = 0;
+      laplacian(&problems[nproblems++].A, (PRIMME_INT)(100 * sqrt(scale)) + 1,
+            2);
+   }
+   if (inList(problemList, "lap3d")) {
+      problems[nproblems].name = "lap3d";
+      problems[nproblems].svds = 0;
+      laplacian(&problems[nproblems++].A, (PRIMME_INT)(22 * cbrt(scale)) + 1,
+            3);
+   }
+   if (inList(problemList, "randspd")) {
+      problems[nproblems].name = "randspd";
+      problems[nproblems].svds = 0;
+      randomSPD(&problems[nproblems++].A, (PRIMME_INT)(10000 * scale) + 1, 3);
+   }
+   if (inList(problemList, "rect")) {
+      problems[nproblems].name = "rect";
+      problems[nproblems].svds = 1;
+      randomRect(&problems[nproblems].A, &problems[nproblems].At,
+            (PRIMME_INT)(20000 * scale) + 1, (PRIMME_INT)(1000 * scale) + 1,
+            4);
+      nproblems++;
+   }
+   for (i = 0; i < nproblems; i++) {
+      if (opt.nev > problems[i].A.n) opt.nev = (int)problems[i].A.n;
+   }
+
+   if (outFile && !(f = fopen(outFile, "w"))) {
+      fprintf(stderr, "Cannot open '%s'\n", outFile);
+      return 1;
+   }
+
+   gethostname(host, sizeof(host) - 1);
+   fprintf(f, "{\"version\": \"%d.%d\", \"host\": \"%s\", \"date\": %lld, ",
+         PRIMME_VERSION_MAJOR, PRIMME_VERSION_MINOR, host, (long long)now);
+   fprintf(f, "\"scale\": %g, \"results\": [\n", scale);
+
+   for (i = 0; i < nproblems; i++) {
+      for (j = 0; j < (int)(sizeof(methods) / sizeof(methods[0])); j++) {
+         if (!inList(methodList, methods[j].name)) continue;
+         for (k = 0; k < nbs; k++) {
+            for (l = 0; l < nthreads; l++) {
+               int ret;
+#ifdef _OPENMP
+               omp_set_num_threads(threads[l]);
+#else
+               if (threads[l] != 1) {
+                  fprintf(stderr, "Skipping %d threads: built without "
+                                  "OpenMP\n", threads[l]);
+                  continue;
+               }
+#endif
+               fprintf(stderr, "%s %s bs=%d threads=%d\n", problems[i].name,
+                     methods[j].name, bs[k], threads[l]);
+               if (!first) fprintf(f, ",\n");
+               first = 0;
+               if (problems[i].svds) {
+                  ret = runSvds(f, &problems[i], j, bs[k], threads[l], &opt);
+               } else {
+                  ret = runEigs(f, &problems[i], j, bs[k], threads[l], &opt);
+               }
+               if (ret != 0) failures++;
+               fflush(f);
+            }
+         }
+      }
+   }
+   fprintf(f, "\n]}\n");
+
+   if (outFile) fclose(f);
+   for (i = 0; i < nproblems; i++) {
+      freeMatrix(&problems[i].A);
+      if (problems[i].svds) freeMatrix(&problems[i].At);
+   }
+   if (failures) fprintf(stderr, "%d runs did not converge\n", failures);
+   return 0;
+}
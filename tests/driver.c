@@ -50,7 +50,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
 #include <unistd.h>
+#include <regex.h>
 #include <math.h>
 #include <assert.h>
 
@@ -79,6 +81,24 @@ PetscLogEvent PRIMME_GLOBAL_SUM;
 static int real_main (int argc, char *argv[]);
 static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int **permutation);
 static int destroyMatrixAndPrecond(driver_params *driver, primme_params *primme, int *permutation);
+static int callPrimme(driver_params *driver, double *evals, SCALAR *evecs, double *rnorms, primme_params *primme);
+static int checkTrace(primme_params *primme);
+static int checkLowSync(primme_params *primme);
+static int countMappedFiles(const char *dir);
+static void recordMonitor(void *basisEvals, int *basisSize, int *basisFlags,
+      int *iblock, int *blockSize, void *basisNorms, int *numConverged,
+      void *lockedEvals, int *numLocked, int *lockedFlags, void *lockedNorms,
+      int *inner_its, void *LSRes, const char *msg, double *time,
+      primme_event *event, primme_params *primme, int *err);
+
+/* What recordMonitor records of the solve */
+
+typedef struct {
+   int first;     /* block size of the first outer iteration */
+   int max;       /* largest block size */
+   long arenaServed; /* requests served by the memory arena, or -1 */
+   int mapped;    /* files in basisStorageDir mapped, or -1 if unknown */
+} monitorRecord;
 
 
 
@@ -268,10 +288,64 @@ static int real_main (int argc, char *argv[]) {
    /*  Call primme  */
    /* ------------- */
 
-   ret = Sprimme(evals, evecs, rnorms, &primme);
+   /* With dynamicBlockSize, record the block sizes of the iterations; */
+   /* with memoryArena, record the use of the arena that the solver     */
+   /* reports with printLevel 3; with basisStorageDir, record whether   */
+   /* the process maps files of that directory during the iterations    */
+
+   monitorRecord record = {0, 0, -1, 0};
+   int checkBlockSize = (primme.dynamicBlockSize > 0 && !primme.monitorFun &&
+                         primme.maxBlockSize > 1);
+   int checkArena = (primme.memoryArena && !primme.monitorFun &&
+                     primme.printLevel >= 3);
+   int checkMapped = (primme.basisStorageDir && !primme.monitorFun);
+   if (checkBlockSize || checkArena || checkMapped) {
+      primme.monitorFun = recordMonitor;
+      primme.monitor = &record;
+   }
+
+   ret = callPrimme(&driver, evals, evecs, rnorms, &primme);
+
+   /* The block size should start at 1 and grow while it is being tuned. */
+   /* The tuner always probes the block size 2 after the first measure,   */
+   /* so this doesn't depend on the timings, unlike the size chosen.      */
+
+   if (ret == 0 && checkBlockSize && record.first >= record.max) {
+      fprintf(stderr, "Error in " __FUNCT__ ": the block size started with "
+            "%d and did not change\n", record.first);
+      retX = -1;
+   }
+
+   /* The arena should serve some temporaries; the solver reports it on */
+   /* the process 0                                                     */
 
-   if (driver.checkXFileName[0]) {
-      retX = check_solution(driver.checkXFileName, &primme, evals, evecs, rnorms, permutation);
+   if (ret == 0 && checkArena && master && record.arenaServed <= 0) {
+      fprintf(stderr, "Error in " __FUNCT__ ": memoryArena is set but the "
+            "arena served %ld requests\n", record.arenaServed);
+      retX = -1;
+   }
+
+   /* The basis should be in files of basisStorageDir, unless the maps */
+   /* of the process can't be inspected                                 */
+
+   if (ret == 0 && checkMapped && record.mapped == 0) {
+      fprintf(stderr, "Error in " __FUNCT__ ": basisStorageDir is set but "
+            "no file in '%s' was mapped\n", primme.basisStorageDir);
+      retX = -1;
+   }
+
+   if (ret == 0 && primme.traceFile && checkTrace(&primme) != 0) {
+      retX = -1;
+   }
+
+   if (driver.checkXFileName[0] && check_solution(driver.checkXFileName,
+            &primme, evals, evecs, rnorms, permutation) != 0) {
+      retX = -1;
+   }
+
+   if (ret == 0 && primme.orth == primme_orth_lowsync && primme.numProcs > 1 &&
+         checkLowSync(&primme) != 0) {
+      retX = -1;
    }
 
    /* --------------------------------------------------------------------- */
@@ -303,6 +377,50 @@ static int real_main (int argc, char *argv[]) {
       fprintf(primme.outputFile, "Time precond  : %f\n",  primme.stats.timePrecond);
       fprintf(primme.outputFile, "Time ortho    : %f\n",  primme.stats.timeOrtho);
       fprintf(primme.outputFile, "Wallclock Runtime  : %f\n",  primme.stats.elapsedTime);
+      if (primme.profile) {
+         /* Report the call sites that take more time; every entry should */
+         /* match the pattern, and have some call and its longest call     */
+         /* within the total                                               */
+
+         int numEntries = 0, nprof = 0;
+         regex_t re;
+         int validRe = (regcomp(&re, primme.profile, REG_NOSUB) == 0);
+         primme_profile_entry *entries = NULL;
+         primme_get_profile(&primme, NULL, &numEntries);
+         if (numEntries > 0) {
+            entries = (primme_profile_entry *)primme_calloc(numEntries,
+                  sizeof(primme_profile_entry), "entries");
+            primme_get_profile(&primme, entries, &numEntries);
+         }
+         fprintf(primme.outputFile, "Profile    : %d call sites\n", numEntries);
+         for (i=0; i < numEntries; i++) {
+            if (i < 10) {
+               fprintf(primme.outputFile, "   %8" PRIMME_INT_P " %f %f %s\n",
+                     entries[i].count, entries[i].totalTime,
+                     entries[i].maxTime, entries[i].name);
+            }
+            if (entries[i].count > 0 &&
+                  entries[i].maxTime <= entries[i].totalTime &&
+                  validRe && regexec(&re, entries[i].name, 0, NULL, 0) == 0) {
+               nprof++;
+            }
+         }
+         free(entries);
+         if (validRe) regfree(&re);
+         if (numEntries == 0 || nprof < numEntries) {
+            fprintf(stderr, "Error in " __FUNCT__ ": invalid profile for '%s'\n",
+                  primme.profile);
+            retX = -1;
+         }
+      }
+      if (primme.projectionParams.replicatedSolve &&
+            primme.stats.numReplicatedMismatches > 0) {
+         fprintf(stderr, "Error in " __FUNCT__ ": replicatedSolve is set but "
+               "the processes solved the projected problem differently "
+               "%" PRIMME_INT_P " times\n",
+               primme.stats.numReplicatedMismatches);
+         retX = -1;
+      }
       if (primme.stats.lockingIssue) {
          fprintf(primme.outputFile, "\nA locking problem has occurred.\n");
          fprintf(primme.outputFile,
@@ -351,6 +469,364 @@ static int real_main (int argc, char *argv[]) {
 /******************************************************************************/
 /* Matvec, preconditioner and other utilities                                 */
 
+/******************************************************************************/
+#undef __FUNCT__
+#define __FUNCT__ "callPrimme"
+static int callPrimme(driver_params *driver, double *evals, SCALAR *evecs, double *rnorms, primme_params *primme) {
+
+   int ret = 0;
+
+   switch(driver->callChoice) {
+   case driver_call_default:
+      ret = Sprimme(evals, evecs, rnorms, primme);
+      break;
+
+   case driver_call_ws:
+      {
+         /* Solve the problem twice on a warm-start workspace; the second */
+         /* call should take fewer matvecs than the first one             */
+
+         primme_workspace *ws = primme_workspace_create(1);
+         int initSize = primme->initSize;
+         PRIMME_INT numMatvecs;
+
+         ASSERT_MSG(ws, -1, "primme_workspace_create failed\n");
+         ret = Sprimme_ws(evals, evecs, rnorms, primme, ws);
+         numMatvecs = primme->stats.numMatvecs;
+         if (ret == 0) {
+            primme->initSize = initSize;
+            ret = Sprimme_ws(evals, evecs, rnorms, primme, ws);
+         }
+         if (primme_workspace_destroy(ws) != 0 && ret == 0) {
+            fprintf(stderr, "Error in " __FUNCT__ ": primme_workspace_destroy "
+                  "failed\n");
+            ret = -1;
+         }
+         if (ret == 0 && primme->stats.numMatvecs >= numMatvecs) {
+            fprintf(stderr, "Error in " __FUNCT__ ": the warm start took %"
+                  PRIMME_INT_P " matvecs and the first call %" PRIMME_INT_P
+                  "\n", primme->stats.numMatvecs, numMatvecs);
+            ret = -1;
+         }
+      }
+      break;
+
+   case driver_call_resume:
+      {
+         /* Stop the first call after a few restarts, which leaves the state */
+         /* in checkpointFile; the second call should resume from it and     */
+         /* remove the file when it converges                                */
+
+         PRIMME_INT maxMatvecs = primme->maxMatvecs;
+         int initSize = primme->initSize;
+         char path[1024];
+         FILE *f;
+
+         ASSERT_MSG(primme->checkpointFile, -1,
+               "driver.callChoice = resume needs primme.checkpointFile\n");
+         if (primme->numProcs > 1) {
+            snprintf(path, sizeof(path), "%s.%d", primme->checkpointFile,
+                  primme->procID);
+         } else {
+            snprintf(path, sizeof(path), "%s", primme->checkpointFile);
+         }
+         remove(path);
+         primme->maxMatvecs = 2 * primme->maxBasisSize;
+         ret = Sprimme(evals, evecs, rnorms, primme);
+         f = fopen(path, "rb");
+         if (ret != PRIMME_MAIN_ITER_FAILURE || !f) {
+            fprintf(stderr, "Error in " __FUNCT__ ": the first call returned "
+                  "%d and %s the checkpoint\n", ret, f ? "saved" : "did not save");
+            if (f) fclose(f);
+            return -1;
+         }
+         fclose(f);
+         primme->maxMatvecs = maxMatvecs;
+         primme->initSize = initSize;
+
+         /* A call with another eps should not resume from the checkpoint */
+
+         double eps = primme->eps;
+         primme->eps = eps * 10;
+         ret = Sprimme(evals, evecs, rnorms, primme);
+         primme->eps = eps;
+         primme->initSize = initSize;
+         if (ret != PRIMME_UNEXPECTED_FAILURE) {
+            fprintf(stderr, "Error in " __FUNCT__ ": the call with another eps "
+                  "returned %d and should reject the checkpoint\n", ret);
+            return -1;
+         }
+         ret = Sprimme(evals, evecs, rnorms, primme);
+         if (ret == 0 && (f = fopen(path, "rb"))) {
+            fclose(f);
+            fprintf(stderr, "Error in " __FUNCT__ ": the checkpoint '%s' was "
+                  "not removed\n", path);
+            ret = -1;
+         }
+      }
+      break;
+
+   case driver_call_batch:
+      {
+         /* Solve the problem and a copy of it in a batch, concurrently if */
+         /* the library has OpenMP; both should return the same values     */
+
+         primme_params primme1 = *primme;
+         double *evals1 = (double *)primme_calloc(primme->numEvals,
+               sizeof(double), "evals1");
+         double *rnorms1 = (double *)primme_calloc(primme->numEvals,
+               sizeof(double), "rnorms1");
+         SCALAR *evecs1 = (SCALAR *)primme_calloc(
+               primme->nLocal * primme->numEvals, sizeof(SCALAR), "evecs1");
+         double *allEvals[2] = {evals, evals1};
+         double *allRnorms[2] = {rnorms, rnorms1};
+         SCALAR *allEvecs[2] = {evecs, evecs1};
+         primme_params *params[2] = {primme, &primme1};
+         int ierrs[2], i;
+
+         memcpy(evecs1, evecs, sizeof(SCALAR) * primme->nLocal * primme->numEvals);
+         ret = Sprimme_batch(allEvals, allEvecs, allRnorms, params, 2,
+               primme->numProcs > 1 ? 1 : 2, ierrs);
+         if (ret == 0 && (ierrs[0] != 0 || ierrs[1] != 0)) {
+            fprintf(stderr, "Error in " __FUNCT__ ": the batch returned 0 "
+                  "but the problems returned %d and %d\n", ierrs[0], ierrs[1]);
+            ret = -1;
+         }
+         if (ret == 0 && (primme->stats.numMatvecs <= 0 ||
+                                primme1.stats.numMatvecs <= 0)) {
+            fprintf(stderr, "Error in " __FUNCT__ ": the batch did %"
+                  PRIMME_INT_P " and %" PRIMME_INT_P " matvecs\n",
+                  primme->stats.numMatvecs, primme1.stats.numMatvecs);
+            ret = -1;
+         }
+         if (ret == 0 && primme1.initSize != primme->initSize) {
+            fprintf(stderr, "Error in " __FUNCT__ ": the copy converged %d "
+                  "pairs and the problem %d\n", primme1.initSize,
+                  primme->initSize);
+            ret = -1;
+         }
+         for (i = 0; ret == 0 && i < primme->initSize; i++) {
+            if (fabs(evals[i] - evals1[i]) > 2 * primme->aNorm * primme->eps) {
+               fprintf(stderr, "Error in " __FUNCT__ ": eval[%d] is %g in "
+                     "the problem and %g in the copy\n", i, evals[i],
+                     evals1[i]);
+               ret = -1;
+            }
+         }
+         primme_free(&primme1);
+         free(evals1);
+         free(rnorms1);
+         free(evecs1);
+      }
+      break;
+
+   case driver_call_slice:
+      {
+         /* Find the eigenvalues in [sliceLower, sliceUpper]. They should be */
+         /* in the interval, and the next eigenvalue closest to the center  */
+         /* of the interval should be out of it                             */
+
+         double lower = driver->sliceLower, upper = driver->sliceUpper;
+         double center = (lower + upper) / 2, dist = 0.0;
+         primme_params primme1;
+         double *evals1, *rnorms1;
+         SCALAR *evecs1;
+         int i, n;
+
+         ret = Sprimme_slice(evals, evecs, rnorms, lower, upper, primme,
+               driver->numSlices > 0 ? driver->numSlices : 1, 2);
+         for (i = 0; ret == 0 && i < primme->initSize; i++) {
+            if (evals[i] < lower - rnorms[i] || evals[i] > upper + rnorms[i]) {
+               fprintf(stderr, "Error in " __FUNCT__ ": eval[%d] = %g is "
+                     "out of [%g, %g]\n", i, evals[i], lower, upper);
+               ret = -1;
+            }
+         }
+         n = primme->initSize + 1;
+         if (ret != 0 || n > primme->n) break;
+         primme1 = *primme;
+         primme1.numEvals = n;
+         primme1.target = primme_closest_abs;
+         primme1.numTargetShifts = 1;
+         primme1.targetShifts = &center;
+         primme1.initSize = 0;
+         primme1.profileTable = NULL;
+         evals1 = (double *)primme_calloc(n, sizeof(double), "evals1");
+         rnorms1 = (double *)primme_calloc(n, sizeof(double), "rnorms1");
+         evecs1 = (SCALAR *)primme_calloc(primme->nLocal * n, sizeof(SCALAR),
+               "evecs1");
+         ret = Sprimme(evals1, evecs1, rnorms1, &primme1);
+         for (i = 0; i < primme1.initSize; i++) {
+            dist = max(dist, fabs(evals1[i] - center) - rnorms1[i]);
+         }
+         if (ret == 0 && dist <= (upper - lower) / 2) {
+            fprintf(stderr, "Error in " __FUNCT__ ": [%g, %g] has more than "
+                  "the %d eigenvalues found\n", lower, upper,
+                  primme->initSize);
+            ret = -1;
+         }
+         primme_free(&primme1);
+         free(evals1);
+         free(rnorms1);
+         free(evecs1);
+      }
+      break;
+   }
+
+   return ret;
+}
+
+/******************************************************************************/
+#undef __FUNCT__
+#define __FUNCT__ "recordMonitor"
+static void recordMonitor(void *basisEvals, int *basisSize, int *basisFlags,
+      int *iblock, int *blockSize, void *basisNorms, int *numConverged,
+      void *lockedEvals, int *numLocked, int *lockedFlags, void *lockedNorms,
+      int *inner_its, void *LSRes, const char *msg, double *time,
+      primme_event *event, primme_params *primme, int *err) {
+
+   monitorRecord *r = (monitorRecord *)primme->monitor;
+
+   (void)basisEvals; (void)basisSize; (void)basisFlags; (void)iblock;
+   (void)basisNorms; (void)numConverged; (void)lockedEvals; (void)numLocked;
+   (void)lockedFlags; (void)lockedNorms; (void)inner_its; (void)LSRes;
+   (void)time;
+
+   if (*event == primme_event_outer_iteration && *blockSize > 0) {
+      if (r->first == 0) r->first = *blockSize;
+      if (*blockSize > r->max) r->max = *blockSize;
+      if (primme->basisStorageDir && r->mapped == 0) {
+         r->mapped = countMappedFiles(primme->basisStorageDir);
+      }
+   } else if (*event == primme_event_message) {
+      sscanf(msg, "Memory arena: %ld", &r->arenaServed);
+      if (primme->printLevel >= 2 && primme->procID == 0) {
+         fprintf(primme->outputFile, "%s\n", msg);
+      }
+   }
+   *err = 0;
+}
+
+/******************************************************************************/
+#undef __FUNCT__
+#define __FUNCT__ "countMappedFiles"
+static int countMappedFiles(const char *dir) {
+
+   /* Count the files named primme-* in dir that the process has mapped, as */
+   /* listed in /proc/self/maps; return -1 if that file isn't available    */
+
+#ifdef __linux__
+   char path[PATH_MAX], prefix[PATH_MAX + 16], line[2 * PATH_MAX];
+   FILE *f;
+   int count = 0;
+
+   if (!realpath(dir, path)) return -1;
+   snprintf(prefix, sizeof(prefix), "%s/primme-", path);
+   if (!(f = fopen("/proc/self/maps", "r"))) return -1;
+   while (fgets(line, sizeof(line), f)) {
+      if (strstr(line, prefix)) count++;
+   }
+   fclose(f);
+   return count;
+#else
+   (void)dir;
+   return -1;
+#endif
+}
+
+/******************************************************************************/
+#undef __FUNCT__
+#define __FUNCT__ "checkTrace"
+static int checkTrace(primme_params *primme) {
+
+   /* The trace should be a whole JSON object with some spans of the solve, */
+   /* a span for every outer iteration and some matvec, and no span dropped */
+
+   const char *names[] = {"\"name\":\"primme\"", "\"name\":\"iteration\"",
+         "\"name\":\"matvec\"", "\"droppedSpans\":0}"};
+   char path[1024], *trace, *p;
+   long size;
+   size_t i;
+   PRIMME_INT numIterations = 0;
+   FILE *f;
+
+   if (primme->numProcs > 1) {
+      snprintf(path, sizeof(path), "%s.%d", primme->traceFile, primme->procID);
+   } else {
+      snprintf(path, sizeof(path), "%s", primme->traceFile);
+   }
+   f = fopen(path, "rb");
+   ASSERT_MSG(f, -1, "the trace '%s' was not written\n", path);
+   fseek(f, 0, SEEK_END);
+   size = ftell(f);
+   rewind(f);
+   trace = (char *)primme_calloc(size + 1, sizeof(char), "trace");
+   size = (long)fread(trace, 1, size, f);
+   fclose(f);
+   remove(path);
+   trace[size] = '\0';
+   for (i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+      if (!strstr(trace, names[i])) break;
+   }
+   for (p = trace; (p = strstr(p, names[1])); p++) numIterations++;
+   if (strncmp(trace, "{\"traceEvents\":[", 16) != 0 || size < 2 ||
+         strcmp(&trace[size - 2], "}\n") != 0 ||
+         i < sizeof(names) / sizeof(names[0])) {
+      fprintf(stderr, "Error in " __FUNCT__ ": invalid trace '%s'\n", path);
+      free(trace);
+      return -1;
+   }
+   if (numIterations != primme->stats.numOuterIterations) {
+      fprintf(stderr, "Error in " __FUNCT__ ": the trace '%s' has %"
+            PRIMME_INT_P " iterations and the solver did %" PRIMME_INT_P "\n",
+            path, numIterations, primme->stats.numOuterIterations);
+      free(trace);
+      return -1;
+   }
+   free(trace);
+
+   return 0;
+}
+
+/******************************************************************************/
+#undef __FUNCT__
+#define __FUNCT__ "checkLowSync"
+static int checkLowSync(primme_params *primme) {
+
+   /* Solve the problem again with orth explicit_I, which is the variant   */
+   /* with broadcasts of lowsync; lowsync should do fewer reductions and   */
+   /* broadcasts per outer iteration                                       */
+
+   primme_params primme1 = *primme;
+   double *evals1, *rnorms1, syncs, syncs1;
+   SCALAR *evecs1;
+   int ret;
+
+   primme1.orth = primme_orth_explicit_I;
+   primme1.initSize = 0;
+   primme1.profileTable = NULL;
+   evals1 = (double *)primme_calloc(primme->numEvals, sizeof(double), "evals1");
+   rnorms1 = (double *)primme_calloc(primme->numEvals, sizeof(double), "rnorms1");
+   evecs1 = (SCALAR *)primme_calloc(primme->nLocal * primme->numEvals,
+         sizeof(SCALAR), "evecs1");
+   ret = Sprimme(evals1, evecs1, rnorms1, &primme1);
+   syncs = (double)(primme->stats.numGlobalSum + primme->stats.numBroadcast) /
+           max(primme->stats.numOuterIterations, 1);
+   syncs1 = (double)(primme1.stats.numGlobalSum + primme1.stats.numBroadcast) /
+            max(primme1.stats.numOuterIterations, 1);
+   if (ret == 0 && syncs >= syncs1) {
+      fprintf(stderr, "Error in " __FUNCT__ ": orth lowsync did %g reductions "
+            "and broadcasts per iteration and explicit_I %g\n", syncs, syncs1);
+      ret = -1;
+   }
+   primme_free(&primme1);
+   free(evals1);
+   free(rnorms1);
+   free(evecs1);
+
+   return ret;
+}
+
 /******************************************************************************/
 
 #ifdef _OPENMP
@@ -375,10 +851,12 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
          driver->matrixChoice = driver_native;
 #        endif
       } else {
-#        ifdef USE_PETSC
+#        if defined(USE_PETSC)
             driver->matrixChoice = driver_petsc;
-#        else
+#        elif defined(USE_PARASAILS)
             driver->matrixChoice = driver_parasails;
+#        else
+            driver->matrixChoice = driver_native;
 #        endif
       }
    }
@@ -391,26 +869,35 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
       fprintf(stderr, "ERROR: NATIVE is needed!\n");
       return -1;
 #else
-#  if defined(USE_MPI)
-      if (numProcs != 1) {
-         fprintf(stderr, "ERROR: MPI is not supported with NATIVE, use other!\n");
-         return -1;
-      }
-      *(MPI_Comm*)primme->commInfo = MPI_COMM_WORLD;
-#  endif
       {
-         CSRMatrix *matrix, *prec;
+         CSRMatrix *matrix, *local, *prec;
          double *diag;
-         /* Fix to use a single thread */
+         PRIMME_INT firstRow = 0;
+         /* Use a single thread unless driver.numThreads says otherwise */
          #ifdef _OPENMP
-         omp_set_num_threads(1);
+         omp_set_num_threads(driver->numThreads > 0 ? driver->numThreads : 1);
          #endif
           
          if (readMatrixNative(driver->matrixFileName, &matrix, &aNorm) !=0 )
             return -1;
-         primme->matrix = matrix;
+         primme->matrix = local = matrix;
          primme->matrixMatvec = CSRMatrixMatvec;
          primme->n = primme->nLocal = matrix->n;
+#  if defined(USE_MPI)
+         /* Every process keeps the whole matrix, but the rows are      */
+         /* distributed in consecutive blocks among the processes       */
+         if (numProcs > 1) {
+            DistCSRMatrix *dist;
+            createDistCSRMatrixNative(matrix, MPI_COMM_WORLD, &dist);
+            primme->matrix = dist;
+            primme->matrixMatvec = DistCSRMatrixMatvec;
+            primme->numProcs = numProcs;
+            MPI_Comm_rank(MPI_COMM_WORLD, &primme->procID);
+            primme->nLocal = dist->local.m;
+            firstRow = dist->local.IA - matrix->IA;
+            local = &dist->local;
+         }
+#  endif
          switch(driver->PrecChoice) {
          case driver_noprecond:
             primme->preconditioner = NULL;
@@ -418,15 +905,21 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
             break;
          case driver_jacobi:
             createInvDiagPrecNative(matrix, driver->shift, &diag);
+            memmove(diag, &diag[firstRow], sizeof(double) * primme->nLocal);
             primme->preconditioner = diag;
             primme->applyPreconditioner = ApplyInvDiagPrecNative;
             break;
          case driver_jacobi_i:
             createInvDiagPrecNative(matrix, 0.0, &diag);
+            memmove(diag, &diag[firstRow], sizeof(double) * primme->nLocal);
             primme->preconditioner = diag;
             primme->applyPreconditioner = ApplyInvDavidsonDiagPrecNative;
             break;
          case driver_ilut:
+            if (numProcs > 1) {
+               fprintf(stderr, "ERROR: ILUT is not supported with NATIVE and MPI, use other!\n");
+               return -1;
+            }
             createILUTPrecNative(matrix, driver->shift, driver->level, driver->threshold,
                                  driver->filter, &prec);
             primme->preconditioner = prec;
@@ -436,6 +929,16 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
             fprintf(stderr, "ERROR: preconditioner is not supported with NATIVE, use other!\n");
             return -1;
          }
+
+         /* Build the matrix for primme_csr_mm after the preconditioner and */
+         /* check its products                                             */
+         if (driver->matvecChoice != driver_matvec_default &&
+               (createCSRMatrixKernelNative(local,
+                      driver->matvecChoice == driver_matvec_sell) != 0 ||
+                     checkCSRMatrixKernelNative(local, 0) != 0)) {
+            fprintf(stderr, "ERROR: primme_csr_mm failed!\n");
+            return -1;
+         }
       }
 #endif
       break;
@@ -576,6 +1079,8 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
 
 #if defined(USE_MPI)
    primme->globalSumReal = par_GlobalSumDouble;
+   primme->globalSumRealStart = par_GlobalSumDoubleStart;
+   primme->globalSumRealWait = par_GlobalSumDoubleWait;
 #endif
 
 #ifdef NOT_USE_ALIGNMENT
@@ -594,6 +1099,11 @@ static int destroyMatrixAndPrecond(driver_params *driver, primme_params *primme,
       fprintf(stderr, "ERROR: NATIVE is needed!\n");
       return -1;
 #else
+#  if defined(USE_MPI)
+      if (primme->numProcs > 1) {
+         freeDistCSRMatrix((DistCSRMatrix*)primme->matrix);
+      } else
+#  endif
       freeCSRMatrix((CSRMatrix*)primme->matrix);
 
       switch(driver->PrecChoice) {
@@ -437,9 +437,9 @@ static int setMatrixAndPrecond(driver_params *driver,
       {
          CSRMatrix *matrix;
          double *diag;
-         /* Fix to use a single thread */
+         /* Use a single thread unless driver.numThreads says otherwise */
          #ifdef _OPENMP
-         omp_set_num_threads(1);
+         omp_set_num_threads(driver->numThreads > 0 ? driver->numThreads : 1);
          #endif
           
          if (readMatrixNative(driver->matrixFileName, &matrix, &aNorm) !=0 )
@@ -470,6 +470,23 @@ static int setMatrixAndPrecond(driver_params *driver,
             fprintf(stderr, "ERROR: preconditioner is not supported with NATIVE, use other!\n");
             return -1;
          }
+
+         /* Build the matrix for primme_csr_mm after the preconditioner and */
+         /* check its products. A'*A and A*A' need primme_csr_normal_mm.   */
+         if (driver->matvecNormal) {
+            primme_svds->matrixMatvecNormal = CSRMatrixMatvecNormalSVD;
+            if (driver->matvecChoice == driver_matvec_default) {
+               driver->matvecChoice = driver_matvec_csr;
+            }
+         }
+         if (driver->matvecChoice != driver_matvec_default &&
+               (createCSRMatrixKernelNative(matrix,
+                      driver->matvecChoice == driver_matvec_sell) != 0 ||
+                     checkCSRMatrixKernelNative(matrix, 0) != 0 ||
+                     checkCSRMatrixKernelNative(matrix, 1) != 0)) {
+            fprintf(stderr, "ERROR: primme_csr_mm failed!\n");
+            return -1;
+         }
       }
 #endif
       break;